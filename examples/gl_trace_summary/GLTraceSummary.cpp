@@ -0,0 +1,500 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr char          traceMagic[8]{'S', 'F', 'G', 'L', 'T', 'R', 'C', '1'};
+constexpr std::uint16_t frameMarkerId      = 0xFFFF;
+constexpr std::uint8_t  hasByteCountFlag   = 1u;
+constexpr std::size_t   topCallCount       = 15;
+constexpr std::size_t   topUploadCount     = 10;
+constexpr std::uint64_t elementArrayBuffer = 0x8893; // GL_ELEMENT_ARRAY_BUFFER
+
+
+////////////////////////////////////////////////////////////
+/// GL state set by a call: the first `keyArgumentCount`
+/// arguments select the piece of state, the others are its
+/// new value
+///
+////////////////////////////////////////////////////////////
+struct StateSetter
+{
+    std::string_view name;
+    std::string_view state;
+    std::size_t      keyArgumentCount;
+    bool             perTextureUnit;
+};
+
+constexpr StateSetter stateSetters[]{
+    {"glActiveTexture", "active texture", 0, false},
+    {"glBindBuffer", "buffer binding", 1, false},
+    {"glBindFramebuffer", "framebuffer binding", 1, false},
+    {"glBindRenderbuffer", "renderbuffer binding", 1, false},
+    {"glBindSampler", "sampler binding", 1, false},
+    {"glBindTexture", "texture binding", 1, true},
+    {"glBindVertexArray", "vertex array binding", 0, false},
+    {"glBlendColor", "blend color", 0, false},
+    {"glBlendEquation", "blend equation", 0, false},
+    {"glBlendEquationSeparate", "blend equation", 0, false},
+    {"glBlendFunc", "blend function", 0, false},
+    {"glBlendFuncSeparate", "blend function", 0, false},
+    {"glClearColor", "clear color", 0, false},
+    {"glClearStencil", "clear stencil", 0, false},
+    {"glColorMask", "color mask", 0, false},
+    {"glPixelStorei", "pixel store", 1, false},
+    {"glScissor", "scissor box", 0, false},
+    {"glStencilFunc", "stencil function", 0, false},
+    {"glStencilMask", "stencil mask", 0, false},
+    {"glStencilOp", "stencil operation", 0, false},
+    {"glUseProgram", "program", 0, false},
+    {"glViewport", "viewport", 0, false},
+};
+
+
+////////////////////////////////////////////////////////////
+struct Record
+{
+    std::uint16_t              callId{};
+    std::uint32_t              duration{};
+    std::uint64_t              timestamp{};
+    bool                       hasByteCount{};
+    std::uint64_t              byteCount{};
+    std::vector<std::uint64_t> arguments;
+};
+
+
+////////////////////////////////////////////////////////////
+struct CallStatistics
+{
+    std::uint64_t count{};
+    std::uint64_t totalDuration{};
+    std::uint64_t redundantCount{};
+};
+
+
+////////////////////////////////////////////////////////////
+struct Upload
+{
+    std::string_view name;
+    std::uint64_t    byteCount{};
+    std::uint64_t    frame{};
+};
+
+
+////////////////////////////////////////////////////////////
+/// Sequential reader of the raw bytes of a trace
+///
+////////////////////////////////////////////////////////////
+class TraceReader
+{
+public:
+    explicit TraceReader(std::vector<char> data) : m_data(std::move(data))
+    {
+    }
+
+    [[nodiscard]] bool atEnd() const
+    {
+        return m_offset >= m_data.size();
+    }
+
+    template <typename T>
+    [[nodiscard]] bool read(T& value)
+    {
+        return read(&value, sizeof(value));
+    }
+
+    [[nodiscard]] bool read(void* destination, std::size_t size)
+    {
+        if (m_data.size() - m_offset < size)
+            return false;
+
+        std::memcpy(destination, m_data.data() + m_offset, size);
+        m_offset += size;
+        return true;
+    }
+
+private:
+    std::vector<char> m_data;
+    std::size_t       m_offset{};
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool readHeader(TraceReader& reader, std::vector<std::string>& callNames)
+{
+    char magic[sizeof(traceMagic)]{};
+
+    if (!reader.read(magic, sizeof(magic)) || std::memcmp(magic, traceMagic, sizeof(magic)) != 0)
+        return false;
+
+    std::uint16_t callNameCount{};
+
+    if (!reader.read(callNameCount))
+        return false;
+
+    callNames.resize(callNameCount);
+
+    for (std::string& name : callNames)
+    {
+        std::uint16_t length{};
+
+        if (!reader.read(length))
+            return false;
+
+        name.resize(length);
+
+        if (!reader.read(name.data(), length))
+            return false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool readRecord(TraceReader& reader, Record& record)
+{
+    std::uint8_t argumentCount{};
+    std::uint8_t flags{};
+
+    if (!reader.read(record.callId) || !reader.read(argumentCount) || !reader.read(flags) ||
+        !reader.read(record.duration) || !reader.read(record.timestamp))
+        return false;
+
+    record.hasByteCount = (flags & hasByteCountFlag) != 0u;
+
+    if (record.hasByteCount && !reader.read(record.byteCount))
+        return false;
+
+    record.arguments.resize(argumentCount);
+    return reader.read(record.arguments.data(), argumentCount * sizeof(std::uint64_t));
+}
+
+
+////////////////////////////////////////////////////////////
+/// Tracks the GL state set by the calls, to detect the calls
+/// setting a piece of state to the value it already has
+///
+/// The state is assumed to belong to a single context, and
+/// object deletions forget the bindings of the deleted kind
+/// of object since GL resets them to zero.
+///
+////////////////////////////////////////////////////////////
+class StateTracker
+{
+public:
+    explicit StateTracker(const std::vector<std::string>& callNames)
+    {
+        for (const std::string& name : callNames)
+        {
+            const auto* setter = std::find_if(std::begin(stateSetters),
+                                              std::end(stateSetters),
+                                              [&](const StateSetter& s) { return s.name == name; });
+
+            m_setters.push_back(setter != std::end(stateSetters) ? setter : nullptr);
+        }
+    }
+
+    // Returns true if the call changes nothing
+    [[nodiscard]] bool isRedundant(std::string_view                  name,
+                                   std::uint16_t                     callId,
+                                   const std::vector<std::uint64_t>& arguments)
+    {
+        if (name == "glEnable" || name == "glDisable" || name == "glEnableVertexAttribArray" ||
+            name == "glDisableVertexAttribArray")
+        {
+            if (arguments.empty())
+                return false;
+
+            const bool        enable = name.substr(0, 8) == "glEnable";
+            const std::string state  = name.find("VertexAttrib") != std::string_view::npos ? "vertex attribute"
+                                                                                              : "capability";
+
+            return update({state, {arguments[0]}}, {enable ? 1u : 0u});
+        }
+
+        if (name.substr(0, 8) == "glDelete")
+        {
+            forget(name == "glDeleteBuffers"        ? "buffer binding"
+                   : name == "glDeleteFramebuffers" ? "framebuffer binding"
+                   : name == "glDeleteTextures"     ? "texture binding"
+                   : name == "glDeleteVertexArrays" ? "vertex array binding"
+                   : name == "glDeleteProgram"      ? "program"
+                                                    : "");
+
+            if (name == "glDeleteVertexArrays")
+                m_state.erase({"buffer binding", {elementArrayBuffer}});
+
+            return false;
+        }
+
+        const StateSetter* setter = callId < m_setters.size() ? m_setters[callId] : nullptr;
+
+        if (setter == nullptr || arguments.size() < setter->keyArgumentCount)
+            return false;
+
+        const auto                 keyEnd = arguments.begin() + static_cast<std::ptrdiff_t>(setter->keyArgumentCount);
+        std::vector<std::uint64_t> key(arguments.begin(), keyEnd);
+
+        if (setter->perTextureUnit)
+            key.push_back(m_activeTexture);
+
+        const bool redundant = update({std::string(setter->state), key}, {keyEnd, arguments.end()});
+
+        if (name == "glActiveTexture" && !arguments.empty())
+            m_activeTexture = arguments[0];
+
+        // The element array buffer binding is part of the vertex array object state
+        if (name == "glBindVertexArray" && !redundant)
+            m_state.erase({"buffer binding", {elementArrayBuffer}});
+
+        return redundant;
+    }
+
+private:
+    using StateKey = std::pair<std::string, std::vector<std::uint64_t>>;
+
+    [[nodiscard]] bool update(const StateKey& key, std::vector<std::uint64_t> value)
+    {
+        const auto [it, inserted] = m_state.try_emplace(key, value);
+
+        if (inserted)
+            return false;
+
+        if (it->second == value)
+            return true;
+
+        it->second = std::move(value);
+        return false;
+    }
+
+    void forget(std::string_view state)
+    {
+        for (auto it = m_state.begin(); it != m_state.end();)
+            it = it->first.first == state ? m_state.erase(it) : std::next(it);
+    }
+
+    std::vector<const StateSetter*>                m_setters;
+    std::map<StateKey, std::vector<std::uint64_t>> m_state;
+    std::uint64_t                                  m_activeTexture{};
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string formatBytes(std::uint64_t bytes)
+{
+    constexpr const char* units[]{"B", "KiB", "MiB", "GiB"};
+
+    auto        value = static_cast<double>(bytes);
+    std::size_t unit  = 0;
+
+    while (value >= 1024.0 && unit + 1 < std::size(units))
+    {
+        value /= 1024.0;
+        ++unit;
+    }
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(unit == 0 ? 0 : 1) << value << ' ' << units[unit];
+    return stream.str();
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file>\n\n"
+                  << "Summarizes a trace recorded by SFML built with SFML_ENABLE_GL_TRACING,\n"
+                  << "when running an application with SFML_GL_TRACE_FILE set to the trace file.\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file(argv[1], std::ios::binary);
+
+    if (!file)
+    {
+        std::cerr << "Failed to open " << argv[1] << '\n';
+        return EXIT_FAILURE;
+    }
+
+    TraceReader reader{std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>())};
+
+    std::vector<std::string> callNames;
+
+    if (!readHeader(reader, callNames))
+    {
+        std::cerr << argv[1] << " is not a GL trace\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<CallStatistics> callStatistics(callNames.size());
+    std::vector<std::uint64_t>  callsPerFrame;
+    std::vector<Upload>         uploads;
+    StateTracker                stateTracker(callNames);
+
+    std::uint64_t callCount          = 0;
+    std::uint64_t currentFrameCalls  = 0;
+    std::uint64_t totalUploadedBytes = 0;
+    bool          truncated          = false;
+
+    Record record;
+
+    while (!reader.atEnd())
+    {
+        if (!readRecord(reader, record))
+        {
+            // The application may have crashed or been killed while writing the trace
+            truncated = true;
+            break;
+        }
+
+        if (record.callId == frameMarkerId)
+        {
+            callsPerFrame.push_back(currentFrameCalls);
+            currentFrameCalls = 0;
+            continue;
+        }
+
+        if (record.callId >= callNames.size())
+        {
+            std::cerr << "Unknown call id " << record.callId << ", stopping\n";
+            truncated = true;
+            break;
+        }
+
+        const std::string& name       = callNames[record.callId];
+        CallStatistics&    statistics = callStatistics[record.callId];
+
+        ++callCount;
+        ++currentFrameCalls;
+        ++statistics.count;
+        statistics.totalDuration += record.duration;
+
+        if (stateTracker.isRedundant(name, record.callId, record.arguments))
+            ++statistics.redundantCount;
+
+        if (record.hasByteCount)
+        {
+            uploads.push_back({name, record.byteCount, callsPerFrame.size()});
+            totalUploadedBytes += record.byteCount;
+        }
+    }
+
+    // Overview
+    std::cout << "Calls: " << callCount << ", frames: " << callsPerFrame.size()
+              << (truncated ? " (trace truncated)" : "") << '\n';
+
+    if (!callsPerFrame.empty())
+    {
+        const auto [minIt, maxIt] = std::minmax_element(callsPerFrame.begin(), callsPerFrame.end());
+
+        std::uint64_t total = 0;
+
+        for (const std::uint64_t count : callsPerFrame)
+            total += count;
+
+        std::cout << "Calls per frame: min " << *minIt << ", average " << total / callsPerFrame.size() << ", max "
+                  << *maxIt << '\n';
+    }
+
+    std::cout << "Uploaded or read back: " << formatBytes(totalUploadedBytes) << " in " << uploads.size()
+              << " calls\n";
+
+    // Most expensive calls
+    std::vector<std::size_t> order;
+
+    for (std::size_t i = 0; i < callStatistics.size(); ++i)
+        if (callStatistics[i].count > 0)
+            order.push_back(i);
+
+    std::sort(order.begin(),
+              order.end(),
+              [&](std::size_t a, std::size_t b)
+              { return callStatistics[a].totalDuration > callStatistics[b].totalDuration; });
+
+    std::cout << "\nTop calls by CPU time:\n"
+              << std::left << std::setw(28) << "  call" << std::right << std::setw(12) << "count" << std::setw(14)
+              << "total (us)" << std::setw(14) << "average (ns)" << '\n';
+
+    for (std::size_t i = 0; i < std::min(order.size(), topCallCount); ++i)
+    {
+        const CallStatistics& statistics = callStatistics[order[i]];
+
+        std::cout << "  " << std::left << std::setw(26) << callNames[order[i]] << std::right << std::setw(12)
+                  << statistics.count << std::setw(14) << statistics.totalDuration / 1000 << std::setw(14)
+                  << statistics.totalDuration / statistics.count << '\n';
+    }
+
+    // Redundant state changes
+    std::sort(order.begin(),
+              order.end(),
+              [&](std::size_t a, std::size_t b)
+              { return callStatistics[a].redundantCount > callStatistics[b].redundantCount; });
+
+    std::cout << "\nRedundant state changes:\n";
+
+    bool anyRedundant = false;
+
+    for (const std::size_t index : order)
+    {
+        const CallStatistics& statistics = callStatistics[index];
+
+        if (statistics.redundantCount == 0)
+            break;
+
+        anyRedundant = true;
+        std::cout << "  " << std::left << std::setw(26) << callNames[index] << std::right << std::setw(12)
+                  << statistics.redundantCount << " of " << statistics.count << " (" << std::fixed
+                  << std::setprecision(1)
+                  << 100.0 * static_cast<double>(statistics.redundantCount) / static_cast<double>(statistics.count)
+                  << "%)\n";
+    }
+
+    if (!anyRedundant)
+        std::cout << "  none\n";
+
+    // Largest transfers
+    const std::size_t uploadCount = std::min(uploads.size(), topUploadCount);
+
+    std::partial_sort(uploads.begin(),
+                      uploads.begin() + static_cast<std::ptrdiff_t>(uploadCount),
+                      uploads.end(),
+                      [](const Upload& a, const Upload& b) { return a.byteCount > b.byteCount; });
+
+    std::cout << "\nLargest uploads and read backs:\n";
+
+    for (std::size_t i = 0; i < uploadCount; ++i)
+        std::cout << "  " << std::left << std::setw(26) << uploads[i].name << std::right << std::setw(12)
+                  << formatBytes(uploads[i].byteCount) << "  in frame " << uploads[i].frame << '\n';
+
+    if (uploadCount == 0)
+        std::cout << "  none\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageEncoder.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u imageSize{2048u, 2048u};
+constexpr int          iterations = 20;
+
+
+////////////////////////////////////////////////////////////
+/// Fill an image with a deterministic pseudo-random pattern
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Image makeNoiseImage(std::uint32_t seed)
+{
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(imageSize.x) * imageSize.y * 4);
+
+    for (std::uint8_t& value : pixels)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        value = static_cast<std::uint8_t>(seed >> 24);
+    }
+
+    return sf::Image::create(imageSize, pixels.data()).value();
+}
+
+
+////////////////////////////////////////////////////////////
+/// Fill an image with smooth gradients, which compress like rendered frames rather than like noise
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Image makeGradientImage()
+{
+    auto image = sf::Image::create(imageSize).value();
+
+    for (unsigned int y = 0; y < imageSize.y; ++y)
+        for (unsigned int x = 0; x < imageSize.x; ++x)
+            image.setPixel({x, y},
+                           {static_cast<std::uint8_t>(x / 8),
+                            static_cast<std::uint8_t>(y / 8),
+                            static_cast<std::uint8_t>((x + y) / 16),
+                            255});
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` on a fresh copy of `source` several times and print the average duration
+///
+////////////////////////////////////////////////////////////
+template <typename Func>
+void benchmark(const std::string& name, const sf::Image& source, Func&& func, int runCount = iterations)
+{
+    sf::Time total;
+
+    for (int i = 0; i < runCount; ++i)
+    {
+        sf::Image image = source;
+
+        sf::Clock clock;
+        func(image);
+        total += clock.getElapsedTime();
+    }
+
+    const double milliseconds    = static_cast<double>(total.asMicroseconds()) / 1000.0 / runCount;
+    const double megapixelPerSec = (static_cast<double>(imageSize.x) * imageSize.y / 1'000'000.0) /
+                                   (milliseconds / 1000.0);
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(3) << milliseconds << " ms" << std::setw(12) << std::setprecision(1)
+              << megapixelPerSec << " MP/s\n";
+}
+
+
+////////////////////////////////////////////////////////////
+/// Naive per-pixel reference implementations, for comparison
+///
+////////////////////////////////////////////////////////////
+void referenceMaskFromColor(sf::Image& image, sf::Color color, std::uint8_t alpha)
+{
+    for (unsigned int y = 0; y < imageSize.y; ++y)
+        for (unsigned int x = 0; x < imageSize.x; ++x)
+            if (image.getPixel({x, y}) == color)
+                image.setPixel({x, y}, {color.r, color.g, color.b, alpha});
+}
+
+
+////////////////////////////////////////////////////////////
+void referencePremultiply(sf::Image& image)
+{
+    for (unsigned int y = 0; y < imageSize.y; ++y)
+        for (unsigned int x = 0; x < imageSize.x; ++x)
+        {
+            const sf::Color c = image.getPixel({x, y});
+            image.setPixel({x, y},
+                           {static_cast<std::uint8_t>((c.r * c.a + 127) / 255),
+                            static_cast<std::uint8_t>((c.g * c.a + 127) / 255),
+                            static_cast<std::uint8_t>((c.b * c.a + 127) / 255),
+                            c.a});
+        }
+}
+
+
+////////////////////////////////////////////////////////////
+void referenceSwapRedBlue(sf::Image& image)
+{
+    for (unsigned int y = 0; y < imageSize.y; ++y)
+        for (unsigned int x = 0; x < imageSize.x; ++x)
+        {
+            const sf::Color c = image.getPixel({x, y});
+            image.setPixel({x, y}, {c.b, c.g, c.r, c.a});
+        }
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    const sf::Image source  = makeNoiseImage(42u);
+    const sf::Image overlay = makeNoiseImage(1337u);
+
+    std::cout << "Image pixel operations on " << imageSize.x << 'x' << imageSize.y << " pixels, average of "
+              << iterations << " runs\n\n";
+
+    benchmark("reference mask from color", source, [](sf::Image& image) { referenceMaskFromColor(image, sf::Color::Black, 0); });
+    benchmark("createMaskFromColor", source, [](sf::Image& image) { image.createMaskFromColor(sf::Color::Black); });
+    benchmark("applyColorKey", source, [](sf::Image& image) { image.applyColorKey(sf::Color::Black); });
+
+    benchmark("reference premultiply", source, [](sf::Image& image) { referencePremultiply(image); });
+    benchmark("premultiplyAlpha", source, [](sf::Image& image) { image.premultiplyAlpha(); });
+    benchmark("unpremultiplyAlpha",
+              source,
+              [](sf::Image& image)
+              {
+                  image.setAlphaPremultiplied(true);
+                  image.unpremultiplyAlpha();
+              });
+
+    benchmark("reference red/blue swap", source, [](sf::Image& image) { referenceSwapRedBlue(image); });
+    benchmark("swapRedBlueChannels", source, [](sf::Image& image) { image.swapRedBlueChannels(); });
+
+    benchmark("flipHorizontally", source, [](sf::Image& image) { image.flipHorizontally(); });
+    benchmark("flipVertically", source, [](sf::Image& image) { image.flipVertically(); });
+
+    benchmark("copy (applyAlpha)", source, [&](sf::Image& image) { (void)image.copy(overlay, {0, 0}, {}, true); });
+
+    benchmark("createDownscaled (box, 1/4)",
+              source,
+              [](sf::Image& image) { (void)image.createDownscaled(imageSize / 4u, sf::Image::DownscaleFilter::Box); });
+    benchmark("createDownscaled (bilinear, 1/4)",
+              source,
+              [](sf::Image& image)
+              { (void)image.createDownscaled(imageSize / 4u, sf::Image::DownscaleFilter::Bilinear); });
+
+    // Encoding is much slower than the pixel operations above, run it fewer times
+    constexpr int encodeIterations = 3;
+
+    const sf::Image frame = makeGradientImage();
+
+    sf::ImageEncoder          encoder;
+    std::vector<std::uint8_t> buffer;
+
+    const auto encodePng = [&](sf::PngCompression compression)
+    {
+        return [&encoder, &buffer, compression](sf::Image& image)
+        { (void)encoder.encode(image.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer, {compression}); };
+    };
+
+    std::cout << "\nPNG encoding of smooth gradients, average of " << encodeIterations << " runs\n\n";
+
+    benchmark("ImageUtils::saveToMemory (png)",
+              frame,
+              [](sf::Image& image) { (void)sf::ImageUtils::saveToMemory(image, sf::ImageUtils::SaveFormat::PNG); },
+              encodeIterations);
+    benchmark("ImageEncoder (png, default)", frame, encodePng(sf::PngCompression::Default), encodeIterations);
+    benchmark("ImageEncoder (png, fast)", frame, encodePng(sf::PngCompression::Fast), encodeIterations);
+    benchmark("ImageEncoder (png, none)", frame, encodePng(sf::PngCompression::None), encodeIterations);
+
+    std::cout << "\nEncoded size:";
+
+    for (const sf::PngCompression compression :
+         {sf::PngCompression::Default, sf::PngCompression::Fast, sf::PngCompression::None})
+    {
+        (void)encoder.encode(frame.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer, {compression});
+        std::cout << ' ' << buffer.size() / 1024u << " KiB";
+    }
+
+    std::cout << " (default, fast, none)\n";
+}
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CircleShape.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shape.hpp"
+
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr std::size_t circleCount = 10'000;
+constexpr std::size_t pointCount  = 30;
+constexpr int         frameCount  = 100;
+
+
+////////////////////////////////////////////////////////////
+/// Circle built like `sf::CircleShape` used to be: trigonometry for every
+/// point, stored in a separate array and then copied into the shape
+///
+////////////////////////////////////////////////////////////
+class ReferenceCircle : public sf::Shape
+{
+public:
+    explicit ReferenceCircle(float radius)
+    {
+        setRadius(radius);
+    }
+
+    void setRadius(float radius)
+    {
+        m_points.resize(pointCount);
+
+        for (std::size_t i = 0; i < pointCount; ++i)
+        {
+            const sf::Angle angle = static_cast<float>(i) / static_cast<float>(pointCount) * sf::degrees(360.f) -
+                                    sf::degrees(90.f);
+
+            m_points[i] = sf::Vector2f{radius, radius}.movedTowards(radius, angle);
+        }
+
+        update(m_points.data(), m_points.size());
+    }
+
+private:
+    std::vector<sf::Vector2f> m_points;
+};
+
+
+////////////////////////////////////////////////////////////
+/// Resize every circle once per frame and print the average frame duration
+///
+////////////////////////////////////////////////////////////
+template <typename TCircle>
+void benchmark(const std::string& name, std::vector<TCircle>& circles)
+{
+    sf::Clock clock;
+
+    for (int frame = 0; frame < frameCount; ++frame)
+        for (std::size_t i = 0; i < circles.size(); ++i)
+            circles[i].setRadius(5.f + static_cast<float>((i + static_cast<std::size_t>(frame)) % 16u));
+
+    const double milliseconds = static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0 / frameCount;
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(10) << std::fixed
+              << std::setprecision(3) << milliseconds << " ms/frame\n";
+}
+
+
+////////////////////////////////////////////////////////////
+/// Create the circles to resize, optionally with an outline
+///
+////////////////////////////////////////////////////////////
+template <typename TCircle, typename... Args>
+[[nodiscard]] std::vector<TCircle> makeCircles(float outlineThickness, Args&... args)
+{
+    std::vector<TCircle> circles;
+    circles.reserve(circleCount);
+
+    for (std::size_t i = 0; i < circleCount; ++i)
+    {
+        if constexpr (sizeof...(Args) == 0)
+            circles.emplace_back(5.f);
+        else
+            circles.emplace_back(args..., 5.f, pointCount);
+
+        circles.back().setOutlineThickness(outlineThickness);
+    }
+
+    return circles;
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::GraphicsContext graphicsContext;
+
+    for (const float outlineThickness : {0.f, 1.f})
+    {
+        std::cout << "Resizing " << circleCount << " circles of " << pointCount << " points every frame, "
+                  << (outlineThickness == 0.f ? "without" : "with") << " outline, average of " << frameCount
+                  << " frames\n\n";
+
+        auto referenceCircles = makeCircles<ReferenceCircle>(outlineThickness);
+        benchmark("reference (trigonometry + copy)", referenceCircles);
+
+        struct TrigonometricCircle : sf::CircleShape
+        {
+            explicit TrigonometricCircle(float radius) : sf::CircleShape(radius, pointCount)
+            {
+            }
+        };
+
+        auto trigonometricCircles = makeCircles<TrigonometricCircle>(outlineThickness);
+        benchmark("CircleShape (trigonometry, in place)", trigonometricCircles);
+
+        auto tableCircles = makeCircles<sf::CircleShape>(outlineThickness, graphicsContext);
+        benchmark("CircleShape (unit-circle table)", tableCircles);
+
+        std::cout << '\n';
+    }
+}
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderWindow.hpp"
+#include "SFML/Graphics/StrokeTessellator.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/Window/Event.hpp"
+#include "SFML/Window/EventUtils.hpp"
+#include "SFML/Window/Keyboard.hpp"
+#include "SFML/Window/WindowSettings.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u windowSize{1280u, 720u};
+constexpr std::size_t  graphCount       = 4;
+constexpr std::size_t  segmentsPerGraph = 25'000;
+constexpr int          framesPerReport  = 120;
+constexpr const char*  joinNames[]      = {"miter", "bevel", "round"};
+constexpr const char*  capNames[]       = {"butt", "square", "round"};
+constexpr sf::Color    graphColors[]    = {sf::Color::Green, sf::Color::Cyan, sf::Color::Yellow, sf::Color::Magenta};
+
+
+////////////////////////////////////////////////////////////
+/// Sample a noisy animated signal, like the traces of a chart
+///
+////////////////////////////////////////////////////////////
+void updateGraph(std::vector<sf::Vector2f>& points, std::size_t graphIndex, float time)
+{
+    const float laneHeight = static_cast<float>(windowSize.y) / static_cast<float>(graphCount);
+    const float baseline   = laneHeight * (static_cast<float>(graphIndex) + 0.5f);
+    const float xStep      = static_cast<float>(windowSize.x) / static_cast<float>(segmentsPerGraph);
+    const float phase      = time * (1.f + static_cast<float>(graphIndex) * 0.3f);
+
+    points.resize(segmentsPerGraph + 1);
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        const auto  x     = static_cast<float>(i);
+        const float value = std::sin(x * 0.002f + phase) * 0.6f + std::sin(x * 0.37f + phase * 3.f) * 0.15f;
+
+        points[i] = {x * xStep, baseline + value * laneHeight * 0.45f};
+    }
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::GraphicsContext graphicsContext;
+
+    sf::RenderWindow window(graphicsContext,
+                            {.size{windowSize},
+                             .title = "SFML Stroke Benchmark",
+                             .style = sf::Style::Titlebar | sf::Style::Close,
+                             .state = sf::State::Windowed});
+
+    // Measure the tessellation itself, not the display rate
+    window.setVerticalSyncEnabled(false);
+
+    sf::StrokeTessellator     tessellator;
+    std::vector<sf::Vertex>   vertices;
+    std::vector<sf::Vector2f> points;
+
+    sf::StrokeStyle style{.thickness = 1.5f, .antialiasingWidth = 1.f};
+
+    std::cout << "Drawing " << graphCount * segmentsPerGraph << " segments per frame\n"
+              << "J: cycle joins, C: cycle caps, A: toggle antialiasing, T: cycle thickness\n\n";
+
+    const sf::Clock clock;
+
+    sf::Time tessellationTime;
+    sf::Time drawTime;
+    int      frameCount = 0;
+
+    while (true)
+    {
+        while (const sf::base::Optional event = window.pollEvent())
+        {
+            if (sf::EventUtils::isClosedOrEscapeKeyPressed(*event))
+                return EXIT_SUCCESS;
+
+            if (const auto* keyPress = event->getIf<sf::Event::KeyPressed>())
+            {
+                if (keyPress->code == sf::Keyboard::Key::J)
+                    style.join = static_cast<sf::LineJoin>((static_cast<int>(style.join) + 1) % 3);
+                else if (keyPress->code == sf::Keyboard::Key::C)
+                    style.cap = static_cast<sf::LineCap>((static_cast<int>(style.cap) + 1) % 3);
+                else if (keyPress->code == sf::Keyboard::Key::A)
+                    style.antialiasingWidth = style.antialiasingWidth > 0.f ? 0.f : 1.f;
+                else if (keyPress->code == sf::Keyboard::Key::T)
+                    style.thickness = style.thickness >= 8.f ? 1.f : style.thickness * 2.f;
+            }
+        }
+
+        const float time = clock.getElapsedTime().asSeconds();
+
+        // Reuse the vertex array, so that nothing is allocated once it reached its peak size
+        sf::Clock tessellationClock;
+        vertices.clear();
+
+        for (std::size_t i = 0; i < graphCount; ++i)
+        {
+            updateGraph(points, i, time);
+
+            style.color = graphColors[i];
+            tessellator.appendPolyline(vertices, points.data(), points.size(), style);
+        }
+
+        tessellationTime += tessellationClock.getElapsedTime();
+
+        sf::Clock drawClock;
+
+        window.clear();
+        window.draw(vertices, sf::PrimitiveType::Triangles);
+        window.display();
+
+        drawTime += drawClock.getElapsedTime();
+
+        if (++frameCount == framesPerReport)
+        {
+            std::cout << std::left << "join " << std::setw(7) << joinNames[static_cast<int>(style.join)] << "cap "
+                      << std::setw(7) << capNames[static_cast<int>(style.cap)] << "aa " << std::setw(4)
+                      << (style.antialiasingWidth > 0.f ? "on" : "off") << "thickness " << std::setw(6)
+                      << style.thickness << std::right << std::fixed << std::setprecision(3)
+                      << static_cast<double>(tessellationTime.asMicroseconds()) / 1000.0 / frameCount
+                      << " ms tessellation" << std::setw(10)
+                      << static_cast<double>(drawTime.asMicroseconds()) / 1000.0 / frameCount << " ms draw"
+                      << std::setw(10) << vertices.size() << " vertices\n";
+
+            tessellationTime = sf::Time{};
+            drawTime         = sf::Time{};
+            frameCount       = 0;
+        }
+    }
+}
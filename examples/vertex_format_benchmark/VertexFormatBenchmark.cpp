@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderWindow.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
+
+#include "SFML/Window/Event.hpp"
+#include "SFML/Window/EventUtils.hpp"
+#include "SFML/Window/Keyboard.hpp"
+#include "SFML/Window/WindowSettings.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u windowSize{1280u, 720u};
+constexpr unsigned int tileSize        = 8u;
+constexpr unsigned int tilesetColumns  = 8u;
+constexpr std::size_t  layerCount      = 8;
+constexpr int          framesPerReport = 120;
+constexpr const char*  formatNames[]   = {"standard", "compact", "packed"};
+constexpr std::size_t  vertexSizes[]   = {sizeof(sf::Vertex), sizeof(sf::VertexCompact), sizeof(sf::VertexPacked)};
+
+
+////////////////////////////////////////////////////////////
+/// Generate a tileset of flat colored tiles with a dark border
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Image makeTileset()
+{
+    auto image = sf::Image::create({tileSize * tilesetColumns, tileSize}).value();
+
+    for (unsigned int x = 0u; x < image.getSize().x; ++x)
+        for (unsigned int y = 0u; y < tileSize; ++y)
+        {
+            const auto tile   = static_cast<std::uint8_t>(x / tileSize);
+            const bool border = x % tileSize == 0u || y == 0u;
+
+            image.setPixel({x, y},
+                           border ? sf::Color{32, 32, 32}
+                                  : sf::Color{static_cast<std::uint8_t>(64u + tile * 24u),
+                                              static_cast<std::uint8_t>(255u - tile * 24u),
+                                              160});
+        }
+
+    return image;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Convert a corner of a tile to each vertex format
+///
+////////////////////////////////////////////////////////////
+void convertVertex(sf::Vertex& vertex, sf::Vector2u position, sf::Vector2u texCoords, sf::Color color)
+{
+    vertex = {position.to<sf::Vector2f>(), color, texCoords.to<sf::Vector2f>()};
+}
+
+void convertVertex(sf::VertexCompact& vertex, sf::Vector2u position, sf::Vector2u texCoords, sf::Color color)
+{
+    vertex = {position.to<sf::Vector2f>(), color, texCoords.to<sf::Vector2<std::uint16_t>>()};
+}
+
+void convertVertex(sf::VertexPacked& vertex, sf::Vector2u position, sf::Vector2u texCoords, sf::Color color)
+{
+    vertex = {position.to<sf::Vector2<std::int16_t>>(), color, texCoords.to<sf::Vector2<std::uint16_t>>()};
+}
+
+
+////////////////////////////////////////////////////////////
+/// Append the two triangles of a tile
+///
+////////////////////////////////////////////////////////////
+template <typename TVertex>
+void appendTile(std::vector<TVertex>& vertices, sf::Vector2u cell, unsigned int tile, sf::Color color)
+{
+    const sf::Vector2u topLeft{cell.x * tileSize, cell.y * tileSize};
+    const sf::Vector2u texTopLeft{tile * tileSize, 0u};
+
+    const sf::Vector2u corners[]{{0u, 0u},
+                                 {tileSize, 0u},
+                                 {0u, tileSize},
+                                 {0u, tileSize},
+                                 {tileSize, 0u},
+                                 {tileSize, tileSize}};
+
+    for (const sf::Vector2u corner : corners)
+        convertVertex(vertices.emplace_back(), topLeft + corner, texTopLeft + corner, color);
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    sf::GraphicsContext graphicsContext;
+
+    sf::RenderWindow window(graphicsContext,
+                            {.size{windowSize},
+                             .title = "SFML Vertex Format Benchmark",
+                             .style = sf::Style::Titlebar | sf::Style::Close,
+                             .state = sf::State::Windowed});
+
+    // Measure the upload and draw cost, not the display rate
+    window.setVerticalSyncEnabled(false);
+
+    const auto tileset = sf::Texture::loadFromImage(graphicsContext, makeTileset()).value();
+
+    std::vector<sf::Vertex>        standardVertices;
+    std::vector<sf::VertexCompact> compactVertices;
+    std::vector<sf::VertexPacked>  packedVertices;
+
+    // Every layer covers the whole window, as stacked tile map layers would
+    const sf::Vector2u gridSize = windowSize / tileSize;
+
+    for (std::size_t layer = 0; layer < layerCount; ++layer)
+        for (unsigned int y = 0u; y < gridSize.y; ++y)
+            for (unsigned int x = 0u; x < gridSize.x; ++x)
+            {
+                const unsigned int tile = (x * 7u + y * 3u + static_cast<unsigned int>(layer)) % tilesetColumns;
+                const sf::Color    color{255, 255, 255, static_cast<std::uint8_t>(layer == 0 ? 255 : 48)};
+
+                appendTile(standardVertices, {x, y}, tile, color);
+                appendTile(compactVertices, {x, y}, tile, color);
+                appendTile(packedVertices, {x, y}, tile, color);
+            }
+
+    const std::size_t vertexCount = standardVertices.size();
+
+    std::cout << "Drawing " << vertexCount / 6 << " tiles per frame\n"
+              << "F: cycle vertex formats (standard, compact, packed)\n\n";
+
+    const sf::RenderStates states(&tileset);
+
+    auto     format = sf::VertexFormat::Standard;
+    sf::Time drawTime;
+    int      frameCount = 0;
+
+    while (true)
+    {
+        while (const sf::base::Optional event = window.pollEvent())
+        {
+            if (sf::EventUtils::isClosedOrEscapeKeyPressed(*event))
+                return EXIT_SUCCESS;
+
+            if (const auto* keyPress = event->getIf<sf::Event::KeyPressed>();
+                keyPress != nullptr && keyPress->code == sf::Keyboard::Key::F)
+            {
+                format     = static_cast<sf::VertexFormat>((static_cast<int>(format) + 1) % 3);
+                drawTime   = sf::Time{};
+                frameCount = 0;
+            }
+        }
+
+        sf::Clock drawClock;
+
+        window.clear();
+
+        // The vertices are streamed to the graphics card on every draw, so the upload size scales with the format
+        if (format == sf::VertexFormat::Standard)
+            window.draw(standardVertices.data(), vertexCount, sf::PrimitiveType::Triangles, states);
+        else if (format == sf::VertexFormat::Compact)
+            window.draw(compactVertices.data(), vertexCount, sf::PrimitiveType::Triangles, states);
+        else
+            window.draw(packedVertices.data(), vertexCount, sf::PrimitiveType::Triangles, states);
+
+        window.display();
+
+        drawTime += drawClock.getElapsedTime();
+
+        if (++frameCount == framesPerReport)
+        {
+            const std::size_t vertexSize = vertexSizes[static_cast<int>(format)];
+
+            std::cout << std::left << "format " << std::setw(10) << formatNames[static_cast<int>(format)] << std::right
+                      << std::fixed << std::setprecision(3)
+                      << static_cast<double>(drawTime.asMicroseconds()) / 1000.0 / frameCount << " ms/frame"
+                      << std::setw(10) << vertexSize * vertexCount / 1024u << " KiB uploaded/frame\n";
+
+            drawTime   = sf::Time{};
+            frameCount = 0;
+        }
+    }
+}
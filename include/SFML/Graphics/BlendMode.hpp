@@ -129,12 +129,13 @@ struct [[nodiscard]] SFML_GRAPHICS_API BlendMode
 // Commonly used blending modes
 ////////////////////////////////////////////////////////////
 // NOLINTBEGIN(readability-identifier-naming)
-SFML_GRAPHICS_API extern const BlendMode BlendAlpha;    //!< Blend source and dest according to dest alpha
-SFML_GRAPHICS_API extern const BlendMode BlendAdd;      //!< Add source to dest
-SFML_GRAPHICS_API extern const BlendMode BlendMultiply; //!< Multiply source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendMin;      //!< Take minimum between source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendMax;      //!< Take maximum between source and dest
-SFML_GRAPHICS_API extern const BlendMode BlendNone;     //!< Overwrite dest with source
+SFML_GRAPHICS_API extern const BlendMode BlendAlpha;              //!< Blend source and dest according to dest alpha
+SFML_GRAPHICS_API extern const BlendMode BlendAdd;                //!< Add source to dest
+SFML_GRAPHICS_API extern const BlendMode BlendMultiply;           //!< Multiply source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendMin;                //!< Take minimum between source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendMax;                //!< Take maximum between source and dest
+SFML_GRAPHICS_API extern const BlendMode BlendNone;               //!< Overwrite dest with source
+SFML_GRAPHICS_API extern const BlendMode BlendPremultipliedAlpha; //!< Blend premultiplied source and dest according to source alpha
 // NOLINTEND(readability-identifier-naming)
 
 } // namespace sf
@@ -15,6 +15,15 @@
 #include <cstddef>
 
 
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+} // namespace sf
+
+
 namespace sf
 {
 ////////////////////////////////////////////////////////////
@@ -33,6 +42,22 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] explicit CircleShape(float radius = 0, std::size_t pointCount = 30);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct a circle using the unit-circle tables of a graphics context
+    ///
+    /// The points are obtained by scaling the cached tables of
+    /// `GraphicsContext::getUnitCircleTable` instead of evaluating
+    /// `sin` and `cos` for each of them, which makes changing the
+    /// radius or the point count much cheaper. The context must
+    /// outlive the circle.
+    ///
+    /// \param graphicsContext Graphics context providing the unit-circle tables
+    /// \param radius          Radius of the circle
+    /// \param pointCount      Number of points composing the circle
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit CircleShape(GraphicsContext& graphicsContext, float radius = 0, std::size_t pointCount = 30);
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -175,6 +200,16 @@ private:
 /// small numbers you can create any regular polygon shape:
 /// equilateral triangle, square, pentagon, hexagon, ...
 ///
+/// Circles constructed with a graphics context scale its cached
+/// unit-circle tables instead of evaluating trigonometric functions
+/// for each point. Prefer this constructor when many circles are
+/// resized every frame:
+/// \code
+/// sf::CircleShape blip(graphicsContext, 4.f, 16);
+/// ...
+/// blip.setRadius(4.f + pulse); // no trigonometry, no allocation
+/// \endcode
+///
 /// \see sf::Shape, sf::RectangleShape, sf::ConvexShape
 ///
 ////////////////////////////////////////////////////////////
@@ -289,6 +289,36 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable premultiplied alpha glyph pages
+    ///
+    /// When enabled, glyphs are rasterized into premultiplied
+    /// alpha textures, which are drawn with `sf::BlendPremultipliedAlpha`
+    /// and can therefore be batched together with other
+    /// premultiplied content. `sf::Text` premultiplies its vertex
+    /// colors accordingly.
+    /// Changing this setting discards all the glyph pages, which
+    /// are then re-rendered on demand: references to textures
+    /// previously returned by `getTexture` become invalid.
+    /// Premultiplied alpha is disabled by default.
+    ///
+    /// \param premultiplied True to store glyphs with premultiplied alpha
+    ///
+    /// \see isAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlphaPremultiplied(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the glyph pages use premultiplied alpha
+    ///
+    /// \return True if the glyph pages are premultiplied
+    ///
+    /// \see setAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAlphaPremultiplied() const;
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Return the index of the internal representation a character
@@ -8,8 +8,12 @@
 
 #include "SFML/Window/WindowContext.hpp"
 
+#include "SFML/System/Vector2.hpp"
+
 #include "SFML/Base/InPlacePImpl.hpp"
 
+#include <cstddef>
+
 
 ////////////////////////////////////////////////////////////
 // Forward declarations
@@ -23,7 +27,9 @@ class RenderTextureImplFBO;
 
 namespace sf
 {
+class RenderTexturePool;
 class Shader;
+class ShaderCache;
 class Texture;
 } // namespace sf
 
@@ -43,6 +49,68 @@ public:
     [[nodiscard]] Shader&  getBuiltInShader();
     [[nodiscard]] Texture& getBuiltInWhiteDotTexture();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the built-in shader reading the view from the view block
+    ///
+    /// Equivalent to the default built-in shader, except that the
+    /// view-projection matrix is read from the `sf_u_ViewBlock`
+    /// uniform block, uploaded once per view change and shared by
+    /// all the programs of a render target. Only the model matrix
+    /// is set per draw, and only when it changes.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Shader& getBuiltInViewBlockShader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the vertex shader source of `getBuiltInViewBlockShader`
+    ///
+    /// Useful to pair custom fragment shaders with the view block.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const char* getBuiltInViewBlockShaderVertexSrc() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Install a program binary cache used by all shader loading functions
+    ///
+    /// The cache is not owned by the context and must outlive it,
+    /// or be uninstalled by passing a null pointer.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setShaderCache(ShaderCache* shaderCache);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the installed program binary cache, if any
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ShaderCache* getShaderCache() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the points of a regular polygon inscribed in the unit circle
+    ///
+    /// The first point is at the top, the following ones go
+    /// clockwise in screen coordinates, matching the points of
+    /// `sf::CircleShape`. Tables are computed on first use and
+    /// cached per point count, so that scaling them by a radius
+    /// replaces all the trigonometry of building a circle.
+    ///
+    /// The returned pointer stays valid as long as the context.
+    ///
+    /// \param pointCount Number of points of the polygon
+    ///
+    /// \return Pointer to `pointCount` points, `nullptr` if `pointCount` is 0
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Vector2f* getUnitCircleTable(std::size_t pointCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the pool of transient render textures of the context
+    ///
+    /// The pool is created on first use, and destroyed with the
+    /// context along with all its render textures.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexturePool& getRenderTexturePool();
+
 private:
     friend Shader;
     friend priv::RenderTextureImplDefault;
@@ -57,7 +125,7 @@ private:
     /// Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 512> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -7,6 +7,7 @@
 #include "SFML/Graphics/Export.hpp"
 
 #include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/ImageView.hpp"
 
 #include "SFML/System/Rect.hpp"
 #include "SFML/System/Vector2.hpp"
@@ -73,6 +74,16 @@ public:
         JPG
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters available to `createDownscaled`
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] DownscaleFilter
+    {
+        Box,     //!< Average of all the source pixels covered by each target pixel
+        Bilinear //!< Bilinear sample at the center of each target pixel (faster, aliases at large factors)
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image and fill it with a unique color
     ///
@@ -98,6 +109,19 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Image> create(Vector2u size, const std::uint8_t* pixels);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the image from externally stored pixels
+    ///
+    /// The pixels are copied row by row, honoring the stride of
+    /// the view, and converted to RGBA if needed.
+    ///
+    /// \param view Pixels to copy to the image
+    ///
+    /// \return Image if the view was valid, `base::nullOpt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Image> create(ImageView view);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the image from a file on disk
     ///
@@ -106,14 +130,15 @@ public:
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
-    /// \param filename Path of the image file to load
+    /// \param filename         Path of the image file to load
+    /// \param premultiplyAlpha True to convert the pixels to premultiplied alpha while loading
     ///
     /// \return Image if loading was successful, `base::nullOpt` otherwise
     ///
-    /// \see loadFromMemory, loadFromStream, saveToFile
+    /// \see loadFromMemory, loadFromStream, saveToFile, premultiplyAlpha
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static base::Optional<Image> loadFromFile(const Path& filename);
+    [[nodiscard]] static base::Optional<Image> loadFromFile(const Path& filename, bool premultiplyAlpha = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the image from a file in memory
@@ -123,15 +148,16 @@ public:
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
-    /// \param data Pointer to the file data in memory
-    /// \param size Size of the data to load, in bytes
+    /// \param data             Pointer to the file data in memory
+    /// \param size             Size of the data to load, in bytes
+    /// \param premultiplyAlpha True to convert the pixels to premultiplied alpha while loading
     ///
     /// \return Image if loading was successful, `base::nullOpt` otherwise
     ///
-    /// \see loadFromFile, loadFromStream
+    /// \see loadFromFile, loadFromStream, premultiplyAlpha
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static base::Optional<Image> loadFromMemory(const void* data, std::size_t size);
+    [[nodiscard]] static base::Optional<Image> loadFromMemory(const void* data, std::size_t size, bool premultiplyAlpha = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Load the image from a custom stream
@@ -141,14 +167,15 @@ public:
     /// like jpeg with arithmetic coding or ASCII pnm.
     /// If this function fails, the image is left unchanged.
     ///
-    /// \param stream Source stream to read from
+    /// \param stream           Source stream to read from
+    /// \param premultiplyAlpha True to convert the pixels to premultiplied alpha while loading
     ///
     /// \return Image if loading was successful, `base::nullOpt` otherwise
     ///
-    /// \see loadFromFile, loadFromMemory
+    /// \see loadFromFile, loadFromMemory, premultiplyAlpha
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static base::Optional<Image> loadFromStream(InputStream& stream);
+    [[nodiscard]] static base::Optional<Image> loadFromStream(InputStream& stream, bool premultiplyAlpha = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the size (width and height) of the image
@@ -165,12 +192,32 @@ public:
     /// the given color to \a alpha (0 by default), so that they
     /// become transparent.
     ///
+    /// The image must not have premultiplied alpha, call this
+    /// function before `premultiplyAlpha`.
+    ///
     /// \param color Color to make transparent
     /// \param alpha Alpha value to assign to transparent pixels
     ///
     ////////////////////////////////////////////////////////////
     void createMaskFromColor(Color color, std::uint8_t alpha = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Make the pixels matching a color-key transparent
+    ///
+    /// Unlike `createMaskFromColor`, only the red, green and
+    /// blue components are compared: the alpha of every pixel
+    /// whose color matches \a key is set to \a alpha, whatever
+    /// its previous alpha value was.
+    ///
+    /// The image must not have premultiplied alpha, call this
+    /// function before `premultiplyAlpha`.
+    ///
+    /// \param key   Color to make transparent (its alpha is ignored)
+    /// \param alpha Alpha value to assign to matching pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyColorKey(Color key, std::uint8_t alpha = 0);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy pixels from another image onto this one
     ///
@@ -185,6 +232,10 @@ public:
     /// using the \b over operator. If it is false, the source
     /// pixels are copied unchanged with their alpha value.
     ///
+    /// Both images must use the same alpha encoding. If they
+    /// have premultiplied alpha, the \b over operator is applied
+    /// to the premultiplied components.
+    ///
     /// See https://en.wikipedia.org/wiki/Alpha_compositing for
     /// details on the \b over operator.
     ///
@@ -205,6 +256,25 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool copy(const Image& source, Vector2u dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy externally stored pixels onto this image
+    ///
+    /// Same as the `sf::Image` overload. BGRA pixels are
+    /// converted to RGBA while being copied.
+    ///
+    /// An image view carries no alpha encoding: the source pixels
+    /// are assumed to be premultiplied if and only if this image is.
+    ///
+    /// \param source     Source pixels to copy
+    /// \param dest       Coordinates of the destination position
+    /// \param sourceRect Sub-rectangle of the source pixels to copy
+    /// \param applyAlpha Should the copy take into account the source transparency?
+    ///
+    /// \return True if the operation was successful, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool copy(ImageView source, Vector2u dest, const IntRect& sourceRect = {}, bool applyAlpha = false);
+
     ////////////////////////////////////////////////////////////
     /// \brief Change the color of a pixel
     ///
@@ -251,6 +321,28 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const std::uint8_t* getPixelsPtr() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only view over the pixels of the image
+    ///
+    /// The same invalidation rules as `getPixelsPtr` apply.
+    ///
+    /// \return Contiguous RGBA view over the whole image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ImageView asImageView() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a view allowing to modify the pixels of the image in place
+    ///
+    /// The same invalidation rules as `getPixelsPtr` apply.
+    /// This is useful to run the pixel operations of
+    /// `sf::ImageUtils` on a sub-rectangle of the image.
+    ///
+    /// \return Contiguous RGBA view over the whole image
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] MutableImageView asMutableImageView();
+
     ////////////////////////////////////////////////////////////
     /// \brief Flip the image horizontally (left <-> right)
     ///
@@ -263,6 +355,82 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color components of every pixel by its alpha
+    ///
+    /// The result is rounded to the nearest integer, and the image
+    /// is then flagged as premultiplied. Premultiplied images are
+    /// meant to be drawn with `sf::BlendPremultipliedAlpha`, which
+    /// avoids dark fringes around smoothed edges and lets alpha
+    /// blended and additive sprites share the same blend mode.
+    ///
+    /// The image must not already be premultiplied.
+    ///
+    /// \see unpremultiplyAlpha, isAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color components of every pixel by its alpha
+    ///
+    /// This is the inverse of `premultiplyAlpha`, up to the
+    /// precision lost by the premultiplication. Fully transparent
+    /// pixels are left unchanged.
+    ///
+    /// The image must be premultiplied.
+    ///
+    /// \see premultiplyAlpha, isAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    void unpremultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare whether the pixels are stored with premultiplied alpha
+    ///
+    /// Unlike `premultiplyAlpha` and `unpremultiplyAlpha`, this
+    /// function doesn't touch the pixels: use it when they have
+    /// been provided already premultiplied.
+    ///
+    /// \param premultiplied True if the pixels are premultiplied
+    ///
+    /// \see isAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlphaPremultiplied(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the pixels are stored with premultiplied alpha
+    ///
+    /// \return True if the color components are multiplied by alpha
+    ///
+    /// \see premultiplyAlpha, setAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAlphaPremultiplied() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the red and blue components of every pixel
+    ///
+    /// Converts between RGBA and BGRA pixel layouts.
+    ///
+    ////////////////////////////////////////////////////////////
+    void swapRedBlueChannels();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a smaller copy of the image
+    ///
+    /// This function fails if \a size is zero or if it is
+    /// larger than the size of the image on any axis.
+    ///
+    /// \param size   Size of the resulting image
+    /// \param filter Filter used to compute the resulting pixels
+    ///
+    /// \return Downscaled image on success, `base::nullOpt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Image> createDownscaled(Vector2u size, DownscaleFilter filter = DownscaleFilter::Box) const;
+
     ////////////////////////////////////////////////////////////
     /// \private
     ///
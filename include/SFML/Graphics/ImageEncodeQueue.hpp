@@ -0,0 +1,183 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/Base/FixedFunction.hpp"
+#include "SFML/Base/InPlacePImpl.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Image;
+class Path;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Encodes and saves images on background threads
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageEncodeQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Callable receiving the result of an encoding job
+    ///
+    /// Invoked on a worker thread. `data` points to the encoded
+    /// bytes and is only valid until the callable returns. If
+    /// encoding failed, `success` is `false` and `size` is 0.
+    ///
+    ////////////////////////////////////////////////////////////
+    using CompletionCallback = base::FixedFunction<void(bool success, const std::uint8_t* data, std::size_t size), 64>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param workerCount    Number of images encoded in parallel (at least 1)
+    /// \param maxPendingJobs Maximum number of queued or running jobs, `push` fails beyond it
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ImageEncodeQueue(unsigned int workerCount = 1u, std::size_t maxPendingJobs = 8u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish all pending jobs and stop the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ImageEncodeQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageEncodeQueue(const ImageEncodeQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ImageEncodeQueue& operator=(const ImageEncodeQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image to be saved to a file
+    ///
+    /// Never blocks: if the queue is full, the job is rejected
+    /// and the caller decides whether to drop the image or to
+    /// call `waitForCompletion` and try again. Premultiplied
+    /// images are converted back to straight alpha on the
+    /// worker thread.
+    ///
+    /// \param image    Image to save, moved into the queue to avoid a copy
+    /// \param filename Path of the file to save, see `sf::ImageUtils::saveToFile`
+    /// \param options  Encoder settings
+    ///
+    /// \return True if the job was queued, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(Image&& image, const Path& filename, const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue an image to be encoded in memory
+    ///
+    /// Same as the file overload, but the encoded data is passed
+    /// to `onEncoded` instead. Each worker thread reuses the same
+    /// output buffer for all its jobs. When using more than one
+    /// worker, callbacks may be invoked out of order.
+    ///
+    /// \param image     Image to encode, moved into the queue to avoid a copy
+    /// \param format    Encoding format to use
+    /// \param onEncoded Callable receiving the encoded data
+    /// \param options   Encoder settings
+    ///
+    /// \return True if the job was queued, false if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool push(Image&&                 image,
+                            ImageUtils::SaveFormat  format,
+                            CompletionCallback      onEncoded,
+                            const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until all pending jobs are finished
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForCompletion();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of jobs that are queued or running
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingJobCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of jobs that failed since the queue was created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFailedJobCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Body of the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void runWorker();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 512> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageEncodeQueue
+/// \ingroup graphics
+///
+/// `sf::ImageEncodeQueue` moves image encoding off the calling
+/// thread, so that saving screenshots or recording frames does
+/// not stall rendering. Each worker thread owns an
+/// `sf::ImageEncoder`, whose scratch memory is reused from one
+/// job to the next.
+///
+/// The queue is bounded: `push` returns `false` instead of
+/// blocking when `maxPendingJobs` jobs are already in flight,
+/// which keeps memory usage under control when encoding cannot
+/// keep up with the frame rate.
+///
+/// Usage example:
+/// \code
+/// // Two workers encoding in parallel, at most 16 frames in flight
+/// sf::ImageEncodeQueue       queue(2u, 16u);
+/// const sf::ImageSaveOptions options{sf::PngCompression::Fast};
+///
+/// while (recording)
+/// {
+///     // ... draw the frame into `renderTexture` ...
+///
+///     sf::Image frame = renderTexture.getTexture().copyToImage();
+///     if (!queue.push(std::move(frame), "frame_" + std::to_string(index++) + ".png", options))
+///         ++droppedFrames;
+/// }
+///
+/// queue.waitForCompletion();
+/// \endcode
+///
+/// \see sf::ImageEncoder, sf::ImageUtils
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,163 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/ImageUtils.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+
+#include "SFML/Base/FixedFunction.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Path;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Reusable image encoder writing to caller-supplied outputs
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ImageEncoder
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Callable receiving consecutive chunks of encoded data
+    ///
+    /// Returning `false` aborts the encoding, which then fails.
+    ///
+    ////////////////////////////////////////////////////////////
+    using Sink = base::FixedFunction<bool(const std::uint8_t* data, std::size_t size), 64>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode pixels and stream the result to a sink
+    ///
+    /// The encoded data is passed to `sink` in chunks, as soon
+    /// as it is produced. Uncompressed PNG images are streamed
+    /// row by row without ever holding the whole file in memory.
+    ///
+    /// \param view    Pixels to encode, in straight alpha
+    /// \param format  Encoding format to use
+    /// \param sink    Callable receiving the encoded data
+    /// \param options Encoder settings
+    ///
+    /// \return True if encoding was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool encode(ImageView               view,
+                              ImageUtils::SaveFormat  format,
+                              const Sink&             sink,
+                              const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode pixels into a caller-owned buffer
+    ///
+    /// The previous contents of `output` are replaced, but its
+    /// capacity is kept: encoding images of similar sizes into
+    /// the same buffer does not allocate after the first call.
+    ///
+    /// \param view    Pixels to encode, in straight alpha
+    /// \param format  Encoding format to use
+    /// \param output  Buffer receiving the encoded data
+    /// \param options Encoder settings
+    ///
+    /// \return True if encoding was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool encode(ImageView                  view,
+                              ImageUtils::SaveFormat     format,
+                              std::vector<std::uint8_t>& output,
+                              const ImageSaveOptions&    options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode pixels directly into a file on disk
+    ///
+    /// The format is deduced from the extension of `filename`,
+    /// see `sf::ImageUtils::saveToFile`.
+    ///
+    /// \param view     Pixels to encode, in straight alpha
+    /// \param filename Path of the file to write
+    /// \param options  Encoder settings
+    ///
+    /// \return True if encoding was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool encodeToFile(ImageView view, const Path& filename, const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release the scratch memory kept between calls
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseMemory();
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Encode a PNG image using the encoder's own writer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool encodePng(ImageView view, const Sink& sink, PngCompression compression);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<std::uint8_t> m_packedPixels; //!< Tightly packed RGBA copy of views that need conversion
+    std::vector<std::uint8_t> m_scanlines;    //!< Filtered PNG scanlines, or a single converted row
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ImageEncoder
+/// \ingroup graphics
+///
+/// `sf::ImageEncoder` encodes pixels in the formats supported
+/// by `sf::ImageUtils`, but lets the caller decide where the
+/// encoded bytes go and keeps its scratch memory between
+/// calls. It is meant for code that saves many images, such
+/// as screenshot or replay recorders.
+///
+/// An encoder is not thread-safe, but distinct encoders can
+/// be used concurrently from different threads. See
+/// `sf::ImageEncodeQueue` for encoding in the background.
+///
+/// Usage example:
+/// \code
+/// sf::ImageEncoder          encoder;
+/// std::vector<std::uint8_t> buffer;
+///
+/// const sf::ImageSaveOptions options{sf::PngCompression::Fast};
+///
+/// for (const sf::Image& frame : frames)
+/// {
+///     // `buffer` and the internal scratch memory are reused for every frame
+///     if (!encoder.encode(frame.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer, options))
+///         return EXIT_FAILURE;
+///
+///     sendOverNetwork(buffer.data(), buffer.size());
+/// }
+///
+/// // Stream a file to a custom destination without an intermediate buffer
+/// (void)encoder.encode(view,
+///                      sf::ImageUtils::SaveFormat::BMP,
+///                      [&](const std::uint8_t* data, std::size_t size)
+///                      { return archive.write(data, size); });
+/// \endcode
+///
+/// \see sf::ImageUtils, sf::ImageEncodeQueue, sf::ImageView
+///
+////////////////////////////////////////////////////////////
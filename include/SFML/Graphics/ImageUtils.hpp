@@ -6,6 +6,9 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/Export.hpp"
 
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+
 #include <vector>
 
 #include <cstdint>
@@ -23,6 +26,29 @@ class Image;
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+/// \brief Trade-off between PNG encoding speed and file size
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] PngCompression : unsigned char
+{
+    None,   //!< No compression, rows are stored as-is (fastest, largest files)
+    Fast,   //!< Fixed row filters and short match search (about 3x faster than `Default`, slightly larger)
+    Default //!< Best filter per row and thorough match search (smallest files)
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Encoder settings used when saving images
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] ImageSaveOptions
+{
+    PngCompression pngCompression{PngCompression::Default}; //!< Compression level of PNG images
+    int            jpgQuality{90};                          //!< Quality of JPG images, in [1, 100]
+};
+
+
 ////////////////////////////////////////////////////////////
 /// \brief Class for loading, manipulating and saving images
 ///
@@ -49,16 +75,19 @@ public:
     /// the extension. The supported image formats are bmp, png,
     /// tga and jpg. The destination file is overwritten
     /// if it already exists. This function fails if the image is empty.
+    /// Premultiplied images are converted back to straight alpha
+    /// before being encoded.
     ///
-    /// \param image Image to save
+    /// \param image    Image to save
     /// \param filename Path of the file to save
+    /// \param options  Encoder settings
     ///
     /// \return True if saving was successful
     ///
     /// \see create, loadFromFile, loadFromMemory
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static bool saveToFile(const Image& image, const Path& filename);
+    [[nodiscard]] static bool saveToFile(const Image& image, const Path& filename, const ImageSaveOptions& options = {});
 
     ////////////////////////////////////////////////////////////
     /// \brief Save an image to a buffer in memory
@@ -66,10 +95,16 @@ public:
     /// The format of the image must be specified.
     /// The supported image formats are bmp, png, tga and jpg.
     /// This function fails if the image is empty, or if
-    /// the format was invalid.
+    /// the format was invalid. Premultiplied images are converted
+    /// back to straight alpha before being encoded.
     ///
-    /// \param image Image to save
-    /// \param format Encoding format to use
+    /// This function allocates a new buffer on every call, use
+    /// `sf::ImageEncoder` to reuse memory between images or to
+    /// stream the encoded data to a callback instead.
+    ///
+    /// \param image   Image to save
+    /// \param format  Encoding format to use
+    /// \param options Encoder settings
     ///
     /// \return Buffer with encoded data if saving was successful,
     ///     otherwise base::nullOpt
@@ -77,7 +112,95 @@ public:
     /// \see create, loadFromFile, loadFromMemory, saveToFile
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static std::vector<std::uint8_t> saveToMemory(const Image& image, SaveFormat format);
+    [[nodiscard]] static std::vector<std::uint8_t> saveToMemory(const Image&            image,
+                                                                SaveFormat              format,
+                                                                const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save externally stored pixels to a file on disk
+    ///
+    /// Same as the `sf::Image` overload. Contiguous RGBA views
+    /// are encoded in place, other views are repacked first.
+    ///
+    /// \param view     Pixels to save
+    /// \param filename Path of the file to save
+    /// \param options  Encoder settings
+    ///
+    /// \return True if saving was successful
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool saveToFile(ImageView view, const Path& filename, const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Save externally stored pixels to a buffer in memory
+    ///
+    /// Same as the `sf::Image` overload. Contiguous RGBA views
+    /// are encoded in place, other views are repacked first.
+    ///
+    /// \param view    Pixels to save
+    /// \param format  Encoding format to use
+    /// \param options Encoder settings
+    ///
+    /// \return Buffer with encoded data if saving was successful,
+    ///     otherwise an empty buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<std::uint8_t> saveToMemory(ImageView               view,
+                                                                SaveFormat              format,
+                                                                const ImageSaveOptions& options = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the alpha of the pixels matching a color
+    ///
+    /// \see `sf::Image::createMaskFromColor`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void createMaskFromColor(MutableImageView view, Color color, std::uint8_t alpha = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the alpha of the pixels matching a color, ignoring their current alpha
+    ///
+    /// \see `sf::Image::applyColorKey`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void applyColorKey(MutableImageView view, Color key, std::uint8_t alpha = 0);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Flip the pixels horizontally (left <-> right)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void flipHorizontally(MutableImageView view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Flip the pixels vertically (top <-> bottom)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void flipVertically(MutableImageView view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color components of every pixel by its alpha
+    ///
+    /// \see `sf::Image::premultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void premultiplyAlpha(MutableImageView view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color components of every pixel by its alpha
+    ///
+    /// \see `sf::Image::unpremultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unpremultiplyAlpha(MutableImageView view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the red and blue channels of every pixel
+    ///
+    /// The `format` member of the view is not modified: the
+    /// caller is responsible for describing the new layout.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void swapRedBlueChannels(MutableImageView view);
 };
 
 } // namespace sf
@@ -89,6 +212,6 @@ public:
 ///
 /// TODO P1: docs
 ///
-/// \see sf::Image
+/// \see sf::Image, sf::ImageEncoder, sf::ImageEncodeQueue
 ///
 ////////////////////////////////////////////////////////////
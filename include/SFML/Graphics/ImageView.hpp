@@ -0,0 +1,145 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Traits/IsSame.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Layout of the channels of a 32-bit pixel
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] PixelFormat : unsigned char
+{
+    RGBA, //!< Red, green, blue, alpha (the layout of `sf::Image`)
+    BGRA  //!< Blue, green, red, alpha (common for video frames and OS surfaces)
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Non-owning view over 32-bit pixels stored in external memory
+///
+/// \tparam TByte `const std::uint8_t` for read-only views,
+///               `std::uint8_t` for views that allow modifications
+///
+////////////////////////////////////////////////////////////
+template <typename TByte>
+struct [[nodiscard]] BasicImageView
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes between the starts of two consecutive rows
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr std::size_t getRowStride() const
+    {
+        return stride != 0u ? stride : static_cast<std::size_t>(size.x) * 4u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the rows are stored without any gap between them
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr bool isContiguous() const
+    {
+        return getRowStride() == static_cast<std::size_t>(size.x) * 4u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the first pixel of row `y`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr TByte* getRow(unsigned int y) const
+    {
+        SFML_BASE_ASSERT(y < size.y && "BasicImageView::getRow() row out of bounds");
+        return pixels + static_cast<std::size_t>(y) * getRowStride();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a view over a rectangular area of this view
+    ///
+    /// The area must be fully contained in this view. No pixel
+    /// is copied: the returned view shares the same storage.
+    ///
+    /// \param position Top-left corner of the area
+    /// \param areaSize Size of the area
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr BasicImageView getSubView(Vector2u position, Vector2u areaSize) const
+    {
+        SFML_BASE_ASSERT(position.x + areaSize.x <= size.x && position.y + areaSize.y <= size.y &&
+                         "BasicImageView::getSubView() area out of bounds");
+
+        return {pixels + static_cast<std::size_t>(position.y) * getRowStride() + static_cast<std::size_t>(position.x) * 4u,
+                areaSize,
+                getRowStride(),
+                format};
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Convert a mutable view to a read-only view
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] constexpr operator BasicImageView<const std::uint8_t>() const
+        requires SFML_BASE_IS_SAME(TByte, std::uint8_t)
+    {
+        return {pixels, size, stride, format};
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    TByte*      pixels{};                  //!< Pointer to the first pixel of the first row
+    Vector2u    size;                      //!< Width and height, in pixels
+    std::size_t stride{};                  //!< Bytes between the starts of two rows (0 means tightly packed)
+    PixelFormat format{PixelFormat::RGBA}; //!< Layout of the channels of each pixel
+};
+
+////////////////////////////////////////////////////////////
+// Aliases
+////////////////////////////////////////////////////////////
+using ImageView        = BasicImageView<const std::uint8_t>;
+using MutableImageView = BasicImageView<std::uint8_t>;
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::BasicImageView
+/// \ingroup graphics
+///
+/// `sf::ImageView` and `sf::MutableImageView` describe 32-bit
+/// pixels that live in memory not owned by SFML, for example
+/// a frame in shared memory, a memory-mapped file or a
+/// sub-rectangle of another image. They are cheap to copy and
+/// can be passed to `sf::Texture::update`, `sf::Image::create`,
+/// `sf::Image::copy`, `sf::ImageUtils::saveToMemory` and the
+/// pixel operations of `sf::ImageUtils` without copying the
+/// pixels into an `sf::Image` first.
+///
+/// The viewed memory must outlive every use of the view.
+///
+/// Usage example:
+/// \code
+/// // A 1920x1080 BGRA frame with 64-byte aligned rows, e.g. from a capture API
+/// const sf::ImageView frame{framePtr, {1920u, 1080u}, 7680u, sf::PixelFormat::BGRA};
+///
+/// // Upload the frame directly
+/// texture.update(frame);
+///
+/// // Upload only a part of the frame
+/// texture.update(frame.getSubView({100u, 100u}, {256u, 256u}), {0u, 0u});
+/// \endcode
+///
+/// \see sf::Image, sf::Texture, sf::ImageUtils
+///
+////////////////////////////////////////////////////////////
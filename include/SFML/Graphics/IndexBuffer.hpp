@@ -0,0 +1,187 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/IndexType.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Vertex indices stored in graphics memory
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API IndexBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// If data is going to be updated once or more every frame,
+    /// set the usage to Stream. If data is going to be set once
+    /// and used for a long time without being modified, set the
+    /// usage to Static. For everything else Dynamic should be a
+    /// good compromise.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Usage
+    {
+        Stream,  //!< Constantly changing data
+        Dynamic, //!< Occasionally changing data
+        Static   //!< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the index buffer
+    ///
+    /// The contents of the buffer are undefined until `update`
+    /// is called.
+    ///
+    /// \param indexCount Number of indices the buffer can hold
+    /// \param usage      Usage specifier
+    ///
+    /// \return Index buffer if creation was successful, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<IndexBuffer> create(GraphicsContext& graphicsContext,
+                                                            std::size_t      indexCount,
+                                                            Usage            usage = Usage::Dynamic);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~IndexBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(const IndexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(const IndexBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer(IndexBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    IndexBuffer& operator=(IndexBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a range of the buffer
+    ///
+    /// Only the given range is uploaded, the rest of the buffer
+    /// is left untouched.
+    ///
+    /// \param indices    Indices to copy to the buffer
+    /// \param indexCount Number of indices to copy
+    /// \param offset     Offset in the buffer to copy to, in indices
+    ///
+    /// \return True if the update was successful, false if the range exceeds the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const IndexType* indices, std::size_t indexCount, std::size_t offset = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of indices the buffer can hold
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the buffer
+    ///
+    /// \return OpenGL handle of the index buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit IndexBuffer(base::PassKey<IndexBuffer>&&,
+                                       GraphicsContext& graphicsContext,
+                                       unsigned int     buffer,
+                                       std::size_t      indexCount,
+                                       Usage            usage);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext; //!< The window context
+    unsigned int     m_buffer;          //!< Internal buffer identifier
+    std::size_t      m_indexCount;      //!< Number of indices the buffer can hold
+    Usage            m_usage;           //!< How this index buffer is to be used
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::IndexBuffer
+/// \ingroup graphics
+///
+/// `sf::IndexBuffer` stores vertex indices in graphics memory.
+/// Drawn together with a `sf::VertexBuffer`, it lets vertices
+/// shared by several primitives be stored once, and lets many
+/// disjoint primitives be drawn with a single draw call, which
+/// `PrimitiveType::TriangleStrip` and `PrimitiveType::TriangleFan`
+/// cannot do.
+///
+/// Usage example:
+/// \code
+/// // Two quads sharing no vertices, drawn with a single call
+/// sf::VertexBuffer vertexBuffer(graphicsContext, sf::PrimitiveType::Triangles);
+/// if (!vertexBuffer.create(8) || !vertexBuffer.update(quadVertices))
+///     return;
+///
+/// const sf::IndexType indices[]{0, 1, 2, 2, 1, 3, 4, 5, 6, 6, 5, 7};
+///
+/// auto indexBuffer = sf::IndexBuffer::create(graphicsContext, 12).value();
+/// if (!indexBuffer.update(indices, 12))
+///     return;
+///
+/// window.draw(vertexBuffer, indexBuffer, 0, 12);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::RenderTarget
+///
+////////////////////////////////////////////////////////////
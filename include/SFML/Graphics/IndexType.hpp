@@ -0,0 +1,16 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup graphics
+/// \brief Type of the vertex indices used by indexed draws
+///
+/// Indices are 32-bit, so that a single indexed draw can
+/// reference any number of vertices.
+///
+////////////////////////////////////////////////////////////
+using IndexType = unsigned int;
+
+} // namespace sf
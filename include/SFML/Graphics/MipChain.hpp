@@ -0,0 +1,168 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Image.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief CPU-side container of the mipmap levels of an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API MipChain
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Build a complete mipmap chain from an image
+    ///
+    /// Each level is a box-filtered copy of the previous one,
+    /// with half its size (rounded down, at least 1 pixel),
+    /// down to a 1x1 level. Downscaling premultiplied images
+    /// avoids dark fringes around transparent areas.
+    ///
+    /// \param image Level 0 of the chain
+    ///
+    /// \return Mipmap chain on success, `base::nullOpt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<MipChain> create(const Image& image);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a mipmap chain from precomputed levels
+    ///
+    /// Use this overload to stream levels that were generated
+    /// offline. Each level must be half the size of the previous
+    /// one (rounded down, at least 1 pixel), but the chain does
+    /// not have to go all the way down to 1x1.
+    ///
+    /// \param levels Levels of the chain, from the largest to the smallest
+    ///
+    /// \return Mipmap chain on success, `base::nullOpt` if the level sizes are inconsistent
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<MipChain> create(std::vector<Image>&& levels);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of levels of a complete chain
+    ///
+    /// \param size Size of level 0
+    ///
+    /// \return Number of levels, from \a size down to 1x1
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getFullLevelCount(Vector2u size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a mipmap level
+    ///
+    /// \param size  Size of level 0
+    /// \param level Index of the level
+    ///
+    /// \return Size of the level, as defined by OpenGL
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static Vector2u getLevelSize(Vector2u size, unsigned int level);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of levels in the chain
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLevelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a level of the chain
+    ///
+    /// \param level Index of the level, 0 being the largest
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Image& getLevel(unsigned int level) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of level 0
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes used by the pixels of a level
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLevelByteCount(unsigned int level) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of bytes used by a range of levels
+    ///
+    /// \param firstLevel Index of the largest level of the range,
+    ///                   the range extends to the end of the chain
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getByteCount(unsigned int firstLevel = 0u) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Select the level required to display the image at a given size
+    ///
+    /// Returns the smallest level that is still at least as large
+    /// as \a displaySize on both axes, i.e. the level a trilinear
+    /// sampler would read at most from.
+    ///
+    /// \param displaySize Size of the image on screen, in pixels
+    ///
+    /// \return Index of the level
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int selectLevel(Vector2f displaySize) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit MipChain(base::PassKey<MipChain>&&, std::vector<Image>&& levels);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Image> m_levels; //!< Levels of the chain, from the largest to the smallest
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MipChain
+/// \ingroup graphics
+///
+/// `sf::MipChain` holds the pixels of every mipmap level of an
+/// image in system memory. It is the source from which
+/// `sf::TextureStreamer` uploads levels to the graphics card,
+/// and into which it can fall back when video memory runs out.
+///
+/// Usage example:
+/// \code
+/// const auto image = sf::Image::loadFromFile("map.png").value();
+/// auto       chain = sf::MipChain::create(image).value();
+///
+/// // A 4096x4096 map drawn on 600x600 pixels only needs level 2 (1024x1024)
+/// const unsigned int level = chain.selectLevel({600.f, 600.f});
+/// \endcode
+///
+/// \see sf::TextureStreamer, sf::Image
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,265 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class RenderTarget;
+class Texture;
+class Time;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Large set of short-lived textured squares, stored and updated in bulk
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ParticleSystem : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Initial state of an emitted particle
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Particle
+    {
+        Vector2f position;            //!< Position of the center of the particle, in local coordinates
+        Vector2f velocity;            //!< Velocity of the particle, in units per second
+        float    lifetime{1.f};       //!< Time the particle lives, in seconds
+        float    size{1.f};           //!< Width and height of the particle
+        Color    color{Color::White}; //!< Color multiplied with the texture
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty particle system
+    ///
+    /// \param graphicsContext Graphics context owning the vertex buffers
+    /// \param threadCount     Number of threads updating the particles, the calling thread included,
+    ///                        0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit ParticleSystem(GraphicsContext& graphicsContext, unsigned int threadCount = 1u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParticleSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem(const ParticleSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a particle
+    ///
+    /// \param particle Initial state of the particle
+    ///
+    ////////////////////////////////////////////////////////////
+    void emit(const Particle& particle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add many particles at once
+    ///
+    /// \param particles     Initial states of the particles
+    /// \param particleCount Number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void emit(const Particle* particles, std::size_t particleCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the particles and remove the expired ones
+    ///
+    /// Each particle is accelerated by the acceleration of the
+    /// system, slowed down by its drag, then moved by its
+    /// velocity. Particles whose lifetime elapsed are removed,
+    /// which changes the order of the remaining particles.
+    ///
+    /// \param deltaTime Time elapsed since the last update
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(Time deltaTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Preallocate the storage for a number of particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t particleCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of living particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getParticleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a particle
+    ///
+    /// \param index Index of the particle, in [0, getParticleCount())
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getParticlePosition(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the acceleration applied to all the particles, such as gravity
+    ///
+    /// \param acceleration Acceleration, in units per second squared
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAcceleration(Vector2f acceleration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the acceleration applied to all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getAcceleration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the drag slowing down all the particles
+    ///
+    /// A drag of `d` scales the velocity of the particles by
+    /// `1 - d * deltaTime` at each update.
+    ///
+    /// \param drag Drag, per second, 0 to disable it
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDrag(float drag);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the drag slowing down all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDrag() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable fading the particles out over their lifetime
+    ///
+    /// When enabled, the alpha of the particles decreases
+    /// linearly from their emitted color to 0.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFadeOutEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether particles fade out over their lifetime
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isFadeOutEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture displayed by all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by all the particles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads updating the particles, the calling thread included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the particles
+    ///
+    /// \param target  Render target to draw to
+    /// \param texture Texture of the particles, `nullptr` for none
+    /// \param states  Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const Texture* texture, RenderStates states) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ParticleSystem
+/// \ingroup graphics
+///
+/// Drawing particles as a `std::vector<sf::Sprite>` costs a
+/// transform per particle and per frame, and spreads the state
+/// of the particles over memory. `sf::ParticleSystem` stores
+/// each attribute of the particles in its own contiguous array
+/// (positions, velocities, remaining lifetimes, ...), so that
+/// updates run as vectorized loops over whole arrays, split
+/// over several threads when requested.
+///
+/// The particles are drawn as squares centered on their
+/// position, all displaying the same texture rectangle. Their
+/// vertices are written directly into a stream that is
+/// uploaded into a single vertex buffer and drawn with one
+/// draw call, using the compact `sf::VertexCompact` format.
+/// The vertices are written by `emit` and `update`: changes to
+/// the texture rectangle or to the fade out setting apply to
+/// existing particles from the next update.
+///
+/// The transform of the particle system applies to all the
+/// particles at once.
+///
+/// Usage example:
+/// \code
+/// sf::ParticleSystem sparks(graphicsContext, 0u); // One thread per hardware thread
+/// sparks.setAcceleration({0.f, 400.f});
+/// sparks.setFadeOutEnabled(true);
+/// sparks.setTextureRect({{0, 0}, {16, 16}});
+///
+/// // Each frame
+/// for (int i = 0; i < 1000; ++i)
+///     sparks.emit({.position = emitter, .velocity = randomDirection() * 300.f, .lifetime = 2.f, .size = 4.f});
+///
+/// sparks.update(frameTime);
+/// sparks.draw(window, &sparkTexture, sf::RenderStates(sf::BlendAdd));
+/// \endcode
+///
+/// \see sf::VertexCompact, sf::VertexBuffer
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,299 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/PolygonTriangulator.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/StrokeTessellator.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class RenderTarget;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Specialized shape representing any simple polygon, possibly concave and with holes
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PolygonShape : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outer contour of the polygon
+    ///
+    /// Removes all the holes. The contour can be given in any
+    /// winding order, and must not repeat its first point.
+    ///
+    /// \param points     Points of the outer contour
+    /// \param pointCount Number of points of the outer contour
+    ///
+    /// \see addHole
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPoints(const Vector2f* points, std::size_t pointCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a hole to the polygon
+    ///
+    /// The hole must be inside the outer contour, and must not
+    /// overlap other holes. Its points are numbered after the
+    /// points of the outer contour and of the previous holes.
+    ///
+    /// \param points     Points of the hole
+    /// \param pointCount Number of points of the hole
+    ///
+    ////////////////////////////////////////////////////////////
+    void addHole(const Vector2f* points, std::size_t pointCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the holes, keeping the outer contour
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearHoles();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move a point of the polygon
+    ///
+    /// \param index    Index of the point, including the points of the holes
+    /// \param position New position of the point
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPoint(std::size_t index, Vector2f position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the total number of points of the polygon, holes included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPointCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a point of the polygon
+    ///
+    /// \param index Index of the point, including the points of the holes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPoint(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of holes of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getHoleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture that the fill will display
+    ///
+    /// The texture rectangle is mapped onto the bounding
+    /// rectangle of the polygon, like for `sf::Shape`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by the fill
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fill color of the polygon
+    ///
+    /// Changing the color does not triangulate the polygon again.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFillColor(Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fill color of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getFillColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the outline color of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineColor(Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the outline color of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getOutlineColor() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thickness of the outline of the polygon
+    ///
+    /// Unlike the outline of `sf::Shape`, which is extruded
+    /// outwards, the outline of a polygon is centered on its
+    /// contours, holes included. 0 disables the outline.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOutlineThickness(float thickness);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the thickness of the outline of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getOutlineThickness() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the polygon, outline included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global (non-minimal) bounding rectangle of the polygon
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of indices of the triangulated fill
+    ///
+    /// Triangulates the polygon if its points changed.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getFillIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the geometry of the polygon to indexed triangle arrays
+    ///
+    /// The vertices are transformed by the transform of the
+    /// polygon, and the indices are offset by the initial size of
+    /// `vertices`, so that many polygons can be accumulated and
+    /// drawn with a single call to
+    /// `RenderTarget::drawIndexedVertices`. The fill is appended
+    /// first, then the outline.
+    ///
+    /// \param vertices Vertex array to append the vertices to
+    /// \param indices  Index array to append the triangles to
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendGeometry(std::vector<Vertex>& vertices, std::vector<IndexType>& indices) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the polygon, untextured
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the polygon, with its fill textured
+    ///
+    /// \param target  Render target to draw to
+    /// \param texture Texture of the fill, `nullptr` for none
+    /// \param states  Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const Texture* texture, RenderStates states) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Triangulate the fill and tessellate the outline if the points changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateGeometry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Regenerate the outline vertices and indices
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateOutline() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the texture coordinates of the fill vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTexCoords() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Vector2f>    m_points;                     //!< Points of the outer contour, then of the holes
+    std::vector<std::size_t> m_holeOffsets;                //!< Index of the first point of each hole
+    IntRect                  m_textureRect;                //!< Area of the texture displayed by the fill
+    Color                    m_fillColor{Color::White};    //!< Fill color
+    Color                    m_outlineColor{Color::White}; //!< Outline color
+    float                    m_outlineThickness{};         //!< Thickness of the outline, centered on the contours
+
+    mutable std::vector<Vertex>    m_vertices;          //!< Fill vertices, one per point, then outline vertices
+    mutable std::vector<IndexType> m_indices;           //!< Fill triangles, then outline triangles
+    mutable std::size_t            m_fillIndexCount{};  //!< Number of fill indices, at the start of `m_indices`
+    mutable FloatRect              m_insideBounds;      //!< Bounds of the points
+    mutable FloatRect              m_bounds;            //!< Bounds of the points and of the outline
+    mutable PolygonTriangulator    m_triangulator;      //!< Triangulator of the fill, storage reused
+    mutable StrokeTessellator      m_strokeTessellator; //!< Tessellator of the outline, storage reused
+    mutable bool                   m_fillDirty{true};   //!< Must the fill be triangulated again?
+    mutable bool                   m_outlineDirty{};    //!< Must the outline be tessellated again?
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PolygonShape
+/// \ingroup graphics
+///
+/// `sf::ConvexShape` and the other shapes derived from
+/// `sf::Shape` are drawn as a triangle fan around their center,
+/// so they can only represent convex polygons. `sf::PolygonShape`
+/// triangulates its points with `sf::PolygonTriangulator`, and
+/// can represent any simple polygon, concave or with holes.
+///
+/// The triangulation is cached: it is only computed again when
+/// the points change, and changing the colors, the texture
+/// rectangle or the transform of the polygon is cheap. The
+/// geometry is stored as indexed triangles, and untextured
+/// polygons are drawn with a single draw call, outline included.
+///
+/// To draw many polygons at once, accumulate their geometry
+/// with `appendGeometry` and draw it with
+/// `sf::RenderTarget::drawIndexedVertices`.
+///
+/// Usage example:
+/// \code
+/// // An arrow pointing right, with a square hole
+/// const sf::Vector2f arrow[]{{0, 20}, {60, 20}, {60, 0}, {100, 40}, {60, 80}, {60, 60}, {0, 60}};
+/// const sf::Vector2f hole[]{{10, 30}, {30, 30}, {30, 50}, {10, 50}};
+///
+/// sf::PolygonShape polygon;
+/// polygon.setPoints(arrow, 7);
+/// polygon.addHole(hole, 4);
+/// polygon.setFillColor(sf::Color::Red);
+/// polygon.setOutlineThickness(2.f);
+/// polygon.setPosition({10.f, 20.f});
+///
+/// window.draw(polygon);
+/// \endcode
+///
+/// \see sf::PolygonTriangulator, sf::ConvexShape, sf::StrokeTessellator
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,142 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/IndexType.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Splits simple polygons, possibly concave and with holes, into triangles
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API PolygonTriangulator
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] PolygonTriangulator();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PolygonTriangulator();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonTriangulator(const PolygonTriangulator& rhs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Copy assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonTriangulator& operator=(const PolygonTriangulator&);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonTriangulator(PolygonTriangulator&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment operator
+    ///
+    ////////////////////////////////////////////////////////////
+    PolygonTriangulator& operator=(PolygonTriangulator&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the triangles covering a polygon to an index array
+    ///
+    /// The polygon is made of an outer contour followed by any
+    /// number of holes, all stored in `points`. The outer contour
+    /// spans from the first point to the first hole offset, each
+    /// hole spans from its offset to the next one, or to the end.
+    /// Contours can be given in any winding order, and must not
+    /// repeat their first point at the end.
+    ///
+    /// The indices refer to `points`, offset by `baseIndex`, so
+    /// that the triangles of several polygons can be accumulated
+    /// in the same arrays.
+    ///
+    /// \param indices     Index array to append the triangles to
+    /// \param points      Points of the outer contour, then of the holes
+    /// \param pointCount  Total number of points
+    /// \param holeOffsets Index in `points` of the first point of each hole, in increasing order
+    /// \param holeCount   Number of holes
+    /// \param baseIndex   Value added to every appended index
+    ///
+    /// \return Number of indices appended to `indices`, a multiple of 3
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t triangulate(std::vector<IndexType>& indices,
+                            const Vector2f*         points,
+                            std::size_t             pointCount,
+                            const std::size_t*      holeOffsets = nullptr,
+                            std::size_t             holeCount   = 0,
+                            IndexType               baseIndex   = 0);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 64> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PolygonTriangulator
+/// \ingroup graphics
+///
+/// `sf::Shape` draws its fill as a triangle fan around its
+/// center, which only works for convex polygons.
+/// `sf::PolygonTriangulator` splits any simple polygon, concave
+/// or with holes, into triangles that can be drawn as indexed
+/// triangle lists.
+///
+/// It uses ear clipping: holes are first bridged to the outer
+/// contour, then triangles are cut off the resulting outline one
+/// at a time. Large polygons are sorted along a z-order curve,
+/// so that finding ears does not need to test every vertex. The
+/// linked vertices are stored in arrays that are reused between
+/// calls, so that triangulating polygons of similar sizes does
+/// not allocate.
+///
+/// Self-intersecting and degenerate polygons are handled on a
+/// best-effort basis: they produce triangles covering most of
+/// their area, but never fail.
+///
+/// Usage example:
+/// \code
+/// // Square with a square hole
+/// const sf::Vector2f points[]{{0, 0}, {100, 0}, {100, 100}, {0, 100}, {25, 25}, {75, 25}, {75, 75}, {25, 75}};
+/// const std::size_t  holeOffsets[]{4};
+///
+/// sf::PolygonTriangulator     triangulator;
+/// std::vector<sf::IndexType> indices;
+/// triangulator.triangulate(indices, points, 8, holeOffsets, 1);
+/// \endcode
+///
+/// \see sf::PolygonShape, sf::RenderTarget::drawIndexedVertices
+///
+////////////////////////////////////////////////////////////
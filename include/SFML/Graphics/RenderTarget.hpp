@@ -8,8 +8,10 @@
 
 #include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/IndexType.hpp"
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
 
 #include "SFML/System/Rect.hpp"
 #include "SFML/System/Vector2.hpp"
@@ -22,6 +24,7 @@
 namespace sf
 {
 class GraphicsContext;
+class IndexBuffer;
 class Shader;
 class Shape;
 class Sprite;
@@ -34,6 +37,8 @@ struct RenderStates;
 struct StencilMode;
 struct StencilValue;
 struct Vertex;
+struct VertexCompact;
+struct VertexPacked;
 
 ////////////////////////////////////////////////////////////
 /// \brief Base class for all render targets (window, texture, ...)
@@ -336,6 +341,44 @@ public:
               PrimitiveType       type,
               const RenderStates& states = getDefaultRenderStates());
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of compact vertices
+    ///
+    /// Uploads 16 bytes per vertex instead of 20. Unlike `sf::Vertex`,
+    /// small arrays are not pre-transformed on the CPU, which would
+    /// require uploading full precision vertices.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see sf::VertexCompact
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexCompact* vertices,
+              std::size_t          vertexCount,
+              PrimitiveType        type,
+              const RenderStates&  states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of packed vertices
+    ///
+    /// Uploads 12 bytes per vertex instead of 20.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    /// \see sf::VertexPacked
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexPacked* vertices,
+              std::size_t         vertexCount,
+              PrimitiveType       type,
+              const RenderStates& states = getDefaultRenderStates());
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw primitives defined by a contiguous container of vertices
     ///
@@ -391,6 +434,77 @@ public:
               std::size_t         vertexCount,
               const RenderStates& states = getDefaultRenderStates());
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives from a vertex buffer, in the order given by an index buffer
+    ///
+    /// The primitive type of the vertex buffer is used.
+    ///
+    /// \param vertexBuffer Vertex buffer
+    /// \param indexBuffer  Index buffer, referencing vertices of \a vertexBuffer
+    /// \param firstIndex   Index of the first index to render
+    /// \param indexCount   Number of indices to render
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const VertexBuffer& vertexBuffer,
+              const IndexBuffer&  indexBuffer,
+              std::size_t         firstIndex,
+              std::size_t         indexCount,
+              const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices, in the order given by an array of indices
+    ///
+    /// Unlike strips and fans, indexed triangle lists can hold any
+    /// number of disjoint shapes, which can thus be drawn at once.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices, referencing \a vertices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedVertices(const Vertex*       vertices,
+                             std::size_t         vertexCount,
+                             const IndexType*    indices,
+                             std::size_t         indexCount,
+                             PrimitiveType       type,
+                             const RenderStates& states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of compact vertices, in the order given by an array of indices
+    ///
+    /// Same as the `sf::Vertex` overload, uploading 16 bytes per
+    /// vertex instead of 20.
+    ///
+    /// \see sf::VertexCompact
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedVertices(const VertexCompact* vertices,
+                             std::size_t          vertexCount,
+                             const IndexType*     indices,
+                             std::size_t          indexCount,
+                             PrimitiveType        type,
+                             const RenderStates&  states = getDefaultRenderStates());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of packed vertices, in the order given by an array of indices
+    ///
+    /// Same as the `sf::Vertex` overload, uploading 12 bytes per
+    /// vertex instead of 20.
+    ///
+    /// \see sf::VertexPacked
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedVertices(const VertexPacked* vertices,
+                             std::size_t         vertexCount,
+                             const IndexType*    indices,
+                             std::size_t         indexCount,
+                             PrimitiveType       type,
+                             const RenderStates& states = getDefaultRenderStates());
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the size of the rendering region of the target
     ///
@@ -451,6 +565,74 @@ public:
     ////////////////////////////////////////////////////////////
     void resetGLStates();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable damage tracking
+    ///
+    /// When damage tracking is enabled, the contents of the
+    /// target are preserved between frames and all clears and
+    /// draws are scissored to the dirty region, which is the
+    /// union of the rectangles passed to `markDirty` since the
+    /// last call to `display`. Clears and draws are skipped
+    /// entirely while the dirty region is empty.
+    ///
+    /// Enabling damage tracking marks the whole target as dirty.
+    ///
+    /// \param enabled True to enable damage tracking, false to disable it
+    ///
+    /// \return True if the operation was successful, false otherwise
+    ///
+    /// \see markDirty, isDamageTrackingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] virtual bool setDamageTrackingEnabled(bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether damage tracking is enabled
+    ///
+    /// \return True if damage tracking is enabled, false otherwise
+    ///
+    /// \see setDamageTrackingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDamageTrackingEnabled() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a rectangle to the dirty region
+    ///
+    /// The rectangle is expressed in pixels, relative to the
+    /// top-left corner of the target, and is clamped to its
+    /// bounds. The dirty region is the bounding rectangle of
+    /// all the marked rectangles.
+    ///
+    /// This function has no effect if damage tracking is disabled.
+    ///
+    /// \param rect Rectangle to redraw, in pixels
+    ///
+    /// \see markAllDirty, getDirtyRegion
+    ///
+    ////////////////////////////////////////////////////////////
+    void markDirty(const IntRect& rect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the whole target as dirty
+    ///
+    /// This function has no effect if damage tracking is disabled.
+    ///
+    /// \see markDirty
+    ///
+    ////////////////////////////////////////////////////////////
+    void markAllDirty();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the region that will be redrawn in the current frame
+    ///
+    /// \return Dirty region in pixels, empty if nothing needs to be redrawn
+    ///
+    /// \see markDirty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] IntRect getDirtyRegion() const;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Constructor from graphics context
@@ -473,7 +655,22 @@ protected:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] GraphicsContext& getGraphicsContext();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Empty the dirty region once a frame was presented
+    ///
+    /// The derived classes must call this function at the end
+    /// of their `display` function.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearDirtyRegion();
+
 private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether damage tracking discards all clears and draws
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDamageEmpty() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Perform common cleaning operations prior to GL calls
     ///
@@ -492,6 +689,12 @@ private:
     ////////////////////////////////////////////////////////////
     void applyCurrentView();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the view block if the view changed, and bind it
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyViewBlock();
+
     ////////////////////////////////////////////////////////////
     /// \brief Apply a new blending mode
     ///
@@ -540,6 +743,42 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDraw(bool useVertexCache, const RenderStates& states);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload and draw vertices without pre-transforming them
+    ///
+    /// \param vertexData   Pointer to the vertices
+    /// \param vertexCount  Number of vertices in the array
+    /// \param vertexFormat Memory layout of the vertices
+    /// \param type         Type of primitives to draw
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawVertexData(const void*         vertexData,
+                        std::size_t         vertexCount,
+                        VertexFormat        vertexFormat,
+                        PrimitiveType       type,
+                        const RenderStates& states);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload and draw vertices in the order given by an array of indices
+    ///
+    /// \param vertexData   Pointer to the vertices
+    /// \param vertexCount  Number of vertices in the array
+    /// \param vertexFormat Memory layout of the vertices
+    /// \param indices      Pointer to the indices, referencing \a vertexData
+    /// \param indexCount   Number of indices in the array
+    /// \param type         Type of primitives to draw
+    /// \param states       Render states to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedVertexData(const void*         vertexData,
+                               std::size_t         vertexCount,
+                               VertexFormat        vertexFormat,
+                               const IndexType*    indices,
+                               std::size_t         indexCount,
+                               PrimitiveType       type,
+                               const RenderStates& states);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw the primitives
     ///
@@ -550,6 +789,16 @@ private:
     ////////////////////////////////////////////////////////////
     void drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the primitives referenced by the bound index buffer
+    ///
+    /// \param type       Type of primitives to draw
+    /// \param firstIndex Index of the first index to use when drawing
+    /// \param indexCount Number of indices to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, std::size_t firstIndex, std::size_t indexCount);
+
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
     ///
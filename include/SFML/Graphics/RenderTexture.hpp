@@ -7,6 +7,7 @@
 #include "SFML/Graphics/Export.hpp"
 
 #include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/TextureFormat.hpp"
 
 #include "SFML/Window/ContextSettings.hpp"
 
@@ -15,6 +16,8 @@
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -28,6 +31,15 @@ class Texture;
 class SFML_GRAPHICS_API RenderTexture : public RenderTarget
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of color attachments of a render texture
+    ///
+    /// The actual limit of the system may be lower, see
+    /// `getMaximumColorAttachmentCount`.
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr std::size_t MaxColorAttachments{8u};
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -79,6 +91,40 @@ public:
                                                               Vector2u               size,
                                                               const ContextSettings& contextSettings = {});
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the render-texture with one or more color attachments
+    ///
+    /// One texture is created per format, all of the same size.
+    /// The fragment shader output at location `i` is written to
+    /// the texture of index `i`, which is returned by `getTexture(i)`.
+    /// All the attachments are drawn to, so drawing into several
+    /// attachments requires a shader writing each of them: the
+    /// built-in shader only writes output 0, which leaves the
+    /// other attachments undefined where it draws. Clearing
+    /// writes to all the attachments.
+    ///
+    /// sRGB encoding only applies to the `TextureFormat::RGBA8`
+    /// attachments. Formats other than `TextureFormat::RGBA8` and
+    /// multiple attachments require support for frame buffer objects.
+    /// On OpenGL ES, floating point formats also require the
+    /// `GL_EXT_color_buffer_float` extension.
+    ///
+    /// After creation, the contents of the render-texture are undefined.
+    ///
+    /// \param size                 Width and height of the render-texture
+    /// \param colorFormats         Format of each color attachment
+    /// \param colorAttachmentCount Number of color attachments, at most `getMaximumColorAttachmentCount()`
+    /// \param contextSettings      Additional settings for the underlying OpenGL textures and context
+    ///
+    /// \return Render texture if creation has been successful, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<RenderTexture> create(GraphicsContext&       graphicsContext,
+                                                              Vector2u               size,
+                                                              const TextureFormat*   colorFormats,
+                                                              std::size_t            colorAttachmentCount,
+                                                              const ContextSettings& contextSettings = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the maximum anti-aliasing level supported by the system
     ///
@@ -87,10 +133,19 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getMaximumAntialiasingLevel(GraphicsContext& graphicsContext);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of color attachments supported by the system
+    ///
+    /// \return The maximum number of color attachments, 1 if frame buffer objects are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaximumColorAttachmentCount(GraphicsContext& graphicsContext);
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable texture smoothing
     ///
-    /// This function is similar to Texture::setSmooth.
+    /// This function is similar to Texture::setSmooth, and
+    /// applies to all the color attachments.
     /// This parameter is disabled by default.
     ///
     /// \param smooth True to enable smoothing, false to disable it
@@ -110,10 +165,38 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare whether the contents are stored with premultiplied alpha
+    ///
+    /// This function is similar to Texture::setAlphaPremultiplied.
+    /// Content drawn with `sf::BlendPremultipliedAlpha` (or with
+    /// `sf::BlendAlpha` using premultiplied textures) onto a cleared
+    /// transparent render texture is premultiplied: enable this flag
+    /// so that the result composites correctly when drawn.
+    /// This parameter is disabled by default.
+    ///
+    /// \param premultiplied True if the contents are premultiplied
+    ///
+    /// \see isAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlphaPremultiplied(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the contents are stored with premultiplied alpha
+    ///
+    /// \return True if the contents are premultiplied
+    ///
+    /// \see setAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAlphaPremultiplied() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable texture repeating
     ///
-    /// This function is similar to Texture::setRepeated.
+    /// This function is similar to Texture::setRepeated, and
+    /// applies to all the color attachments.
     /// This parameter is disabled by default.
     ///
     /// \param repeated True to enable repeating, false to disable it
@@ -137,7 +220,7 @@ public:
     /// \brief Generate a mipmap using the current texture data
     ///
     /// This function is similar to Texture::generateMipmap and operates
-    /// on the texture used as the target for drawing.
+    /// on the textures of all the color attachments.
     /// Be aware that any draw operation may modify the base level image data.
     /// For this reason, calling this function only makes sense after all
     /// drawing is completed and display has been called. Not calling display
@@ -174,6 +257,9 @@ public:
     /// function is mandatory at the end of rendering. Not calling
     /// it may leave the texture in an undefined state.
     ///
+    /// If damage tracking is enabled, the dirty region is
+    /// emptied for the next frame.
+    ///
     ////////////////////////////////////////////////////////////
     void display();
 
@@ -215,6 +301,27 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const Texture& getTexture() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a read-only reference to the texture of a color attachment
+    ///
+    /// The texture can be bound as a shader input like any other
+    /// texture, with `Shader::setUniform`.
+    ///
+    /// \param index Index of the color attachment, `getTexture(0)` is the same as `getTexture()`
+    ///
+    /// \return Const reference to the texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(std::size_t index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of color attachments
+    ///
+    /// \return Number of formats passed to `create`, 1 by default
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getColorAttachmentCount() const;
+
     ////////////////////////////////////////////////////////////
     /// \private
     ///
@@ -297,6 +404,24 @@ private:
 /// and regular SFML drawing commands. If you need a depth buffer for
 /// 3D rendering, don't forget to request it when calling RenderTexture::create.
 ///
+/// A render-texture can also store floating point colors, for
+/// example to accumulate HDR lighting before tone mapping, and
+/// have several color attachments that a shader writes in a
+/// single pass, like the albedo and normals of a deferred
+/// renderer. Each attachment is then read back as a texture:
+///
+/// \code
+/// const sf::TextureFormat formats[]{sf::TextureFormat::RGBA8, sf::TextureFormat::RGBA16F};
+/// auto gBuffer = sf::RenderTexture::create(graphicsContext, {800, 600}, formats, 2).value();
+///
+/// // The shader declares `layout(location = 0) out vec4 albedo;` and `layout(location = 1) out vec4 normal;`
+/// gBuffer.draw(scene, sf::RenderStates(&gBufferShader));
+/// gBuffer.display();
+///
+/// lightingShader.setUniform(albedoLocation, gBuffer.getTexture(0));
+/// lightingShader.setUniform(normalLocation, gBuffer.getTexture(1));
+/// \endcode
+///
 /// \see sf::RenderTarget, sf::RenderWindow, sf::View, sf::Texture
 ///
 ////////////////////////////////////////////////////////////
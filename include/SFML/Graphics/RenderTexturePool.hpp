@@ -0,0 +1,265 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/TextureFormat.hpp"
+
+#include "SFML/Window/ContextSettings.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class RenderTexture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Recycles transient render textures instead of reallocating them
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API RenderTexturePool
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty pool
+    ///
+    /// \param graphicsContext Graphics context the render textures are created with
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit RenderTexturePool(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Destroys all the render textures, including those still
+    /// acquired.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~RenderTexturePool();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    RenderTexturePool& operator=(const RenderTexturePool&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Acquire a render texture, reusing a released one if possible
+    ///
+    /// A released render texture is reused if it has the same
+    /// size, depth and stencil bits, antialiasing level and sRGB
+    /// capability, and a single `TextureFormat::RGBA8` color
+    /// attachment. Its contents are undefined, its view is reset
+    /// to the default view and its texture is neither smooth nor
+    /// repeated, like a newly created render texture.
+    ///
+    /// The render texture stays owned by the pool, and must be
+    /// given back with `release` once it is no longer needed.
+    ///
+    /// \param size            Width and height of the render texture
+    /// \param contextSettings Additional settings of the render texture
+    ///
+    /// \return Pointer to the render texture, `nullptr` if it could not be created
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(Vector2u size, const ContextSettings& contextSettings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Acquire a render texture with one or more color attachments, reusing a released one if possible
+    ///
+    /// A released render texture is only reused if its color
+    /// attachments have the same formats, in the same order.
+    /// Otherwise behaves like the `acquire` overload above.
+    ///
+    /// \param size                 Width and height of the render texture
+    /// \param colorFormats         Format of each color attachment
+    /// \param colorAttachmentCount Number of color attachments
+    /// \param contextSettings      Additional settings of the render texture
+    ///
+    /// \return Pointer to the render texture, `nullptr` if it could not be created
+    ///
+    /// \see RenderTexture::create
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RenderTexture* acquire(Vector2u               size,
+                                         const TextureFormat*   colorFormats,
+                                         std::size_t            colorAttachmentCount,
+                                         const ContextSettings& contextSettings = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Give back a render texture obtained from `acquire`
+    ///
+    /// The render texture is kept allocated, to be returned by a
+    /// later call to `acquire` with the same settings.
+    ///
+    ////////////////////////////////////////////////////////////
+    void release(RenderTexture& renderTexture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark the end of a frame and destroy the render textures unused for too long
+    ///
+    /// \see setMaxIdleFrames
+    ///
+    ////////////////////////////////////////////////////////////
+    void endFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of frames a released render texture is kept before being destroyed
+    ///
+    /// The default of a few frames lets render textures survive
+    /// the frames where an effect is briefly disabled, without
+    /// keeping the targets of old resolutions forever.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxIdleFrames(unsigned int maxIdleFrames);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of frames a released render texture is kept
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getMaxIdleFrames() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy all the released render textures
+    ///
+    /// Acquired render textures are left untouched.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRenderTextureCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of render textures currently acquired
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getAcquiredCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of `acquire` calls served without creating a render texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getReuseCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get an estimate of the graphics memory used by the render textures
+    ///
+    /// Counts the bytes per pixel of its format for each color
+    /// texture and each of its multisample color samples, and
+    /// 4 bytes per depth/stencil sample. Drivers
+    /// may add padding and alignment on top of this.
+    ///
+    /// \return Memory usage in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Render texture owned by the pool
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Entry
+    {
+        base::UniquePtr<RenderTexture> renderTexture;   //!< Render texture, stable in memory
+        Vector2u                       size;            //!< Size requested on creation
+        ContextSettings                contextSettings; //!< Settings requested on creation
+        std::vector<TextureFormat>     colorFormats;    //!< Format of each color attachment
+        std::size_t                    memoryUsage{};   //!< Estimated graphics memory, in bytes
+        unsigned int                   lastUsedFrame{}; //!< Frame of the last release
+        bool                           acquired{};      //!< Is the render texture in use?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destroy the released render textures matching a predicate
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Predicate>
+    void destroyReleased(Predicate&& predicate);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*   m_graphicsContext;   //!< The window context
+    std::vector<Entry> m_entries;           //!< All the render textures of the pool
+    unsigned int       m_frame{};           //!< Number of frames ended so far
+    unsigned int       m_maxIdleFrames{3u}; //!< Frames a released render texture is kept
+    std::size_t        m_reuseCount{};      //!< Number of acquisitions served by a released render texture
+    std::size_t        m_memoryUsage{};     //!< Sum of the memory usage of the entries
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::RenderTexturePool
+/// \ingroup graphics
+///
+/// Post-processing chains need intermediate render targets
+/// whose size follows the window, and whose number follows the
+/// enabled effects. Creating a `sf::RenderTexture` allocates a
+/// texture, renderbuffers and frame buffer objects, which is
+/// slow and fragments graphics memory when done every time the
+/// resolution or the settings change.
+///
+/// `sf::RenderTexturePool` keeps released render textures
+/// around and hands them out again when a render texture with
+/// the same size and settings is requested. Render textures
+/// unused for more than a few frames are destroyed by
+/// `endFrame`, so that the targets of an old resolution do not
+/// stay allocated forever.
+///
+/// Every graphics context owns a pool, returned by
+/// `sf::GraphicsContext::getRenderTexturePool`. Separate pools
+/// can also be created, for example to release all the targets
+/// of a subsystem at once.
+///
+/// Usage example:
+/// \code
+/// sf::RenderTexturePool& pool = graphicsContext.getRenderTexturePool();
+///
+/// while (window.isOpen())
+/// {
+///     // Half resolution targets for the blur passes, reused from the previous frame
+///     sf::RenderTexture* horizontal = pool.acquire(window.getSize() / 2u);
+///     sf::RenderTexture* vertical   = pool.acquire(window.getSize() / 2u);
+///
+///     // ... draw the blur passes ...
+///
+///     pool.release(*horizontal);
+///     pool.release(*vertical);
+///     pool.endFrame();
+/// }
+/// \endcode
+///
+/// \see sf::RenderTexture, sf::GraphicsContext
+///
+////////////////////////////////////////////////////////////
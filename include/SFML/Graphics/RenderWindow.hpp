@@ -14,6 +14,8 @@
 
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/UniquePtr.hpp"
+
 
 namespace sf
 {
@@ -139,6 +141,24 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setActive(bool active = true) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable damage tracking
+    ///
+    /// While damage tracking is enabled, the window is rendered
+    /// into an offscreen back buffer which keeps its contents
+    /// between frames, and which `display` copies to the screen.
+    /// Damage tracking requires support for framebuffer objects,
+    /// and isn't supported for multisampled windows on OpenGL ES.
+    ///
+    /// \param enabled True to enable damage tracking, false to disable it
+    ///
+    /// \return True if the operation was successful, false otherwise
+    ///
+    /// \see RenderTarget::setDamageTrackingEnabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setDamageTrackingEnabled(bool enabled) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Sets the size of the window and forwards to `WindowBase::setSize`
     ///
@@ -187,10 +207,39 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> filterEvent(base::Optional<Event> event);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish a frame, called by `Window::display` before presenting it
+    ///
+    /// If damage tracking is enabled, the back buffer is copied
+    /// to the window. The dirty region is emptied for the next
+    /// frame.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void finishFrame(Window& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the back buffer used by damage tracking, at the size of the window
+    ///
+    /// The window must be active.
+    ///
+    /// \return True if the back buffer was created, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool createBackBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the framebuffer to bind when targeting this window
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTargetFrameBuffer() const;
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    unsigned int m_defaultFrameBuffer{}; //!< Framebuffer to bind when targeting this window
+    struct BackBuffer;
+
+    unsigned int                m_defaultFrameBuffer{}; //!< Framebuffer of the window itself
+    base::UniquePtr<BackBuffer> m_backBuffer;           //!< Offscreen framebuffer rendered into while tracking damage
 };
 
 } // namespace sf
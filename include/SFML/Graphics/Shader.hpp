@@ -26,6 +26,7 @@ class GraphicsContext;
 class InputStream;
 class Path;
 class RenderTarget;
+class ShaderCompileQueue;
 class Texture;
 } // namespace sf
 
@@ -70,6 +71,17 @@ public:
     // NOLINTNEXTLINE(readability-identifier-naming)
     static inline constexpr CurrentTextureType CurrentTexture;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Uniform block binding point of the built-in view block
+    ///
+    /// Render targets bind the buffer holding their view-projection
+    /// matrix to this point. Programs declaring a uniform block named
+    /// `sf_u_ViewBlock` are associated to it automatically when linked.
+    /// Do not bind other buffers to this point.
+    ///
+    ////////////////////////////////////////////////////////////
+    static inline constexpr unsigned int ViewBlockBindingPoint{0u};
+
     ////////////////////////////////////////////////////////////
     /// \brief Type-safe wrapper over a non-null shader uniform location
     ///
@@ -323,6 +335,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Get the location ID of a shader uniform
     ///
+    /// All the active uniforms are reflected when the program is
+    /// linked, so this lookup does not query OpenGL. Arrays can be
+    /// looked up by their bare name or by the name of an element.
+    ///
     /// \param name Name of the uniform variable to search
     ///
     /// \return Location ID of the uniform, or `sf::base::nullOpt` if not found
@@ -330,6 +346,31 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<UniformLocation> getUniformLocation(std::string_view uniformName) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of a uniform block
+    ///
+    /// \param blockName Name of the uniform block in GLSL
+    ///
+    /// \return Index of the block, or `sf::base::nullOpt` if not found
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<unsigned int> getUniformBlockIndex(std::string_view blockName) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Associate a uniform block to a binding point
+    ///
+    /// The block reads its values from the `sf::UniformBuffer`
+    /// bound to \a bindingPoint at draw time. The association is
+    /// part of the program and persists until changed.
+    ///
+    /// \param blockName    Name of the uniform block in GLSL
+    /// \param bindingPoint Index of the binding point
+    ///
+    /// \return True if the block was found, false otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformBlockBinding(std::string_view blockName, unsigned int bindingPoint) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Specify value for \p float uniform
     ///
@@ -660,6 +701,7 @@ public:
 
 private:
     friend RenderTarget;
+    friend ShaderCompileQueue;
 
     ////////////////////////////////////////////////////////////
     /// \brief More efficient but less safe way of setting 4x4 matrix uniform
@@ -667,6 +709,16 @@ private:
     ////////////////////////////////////////////////////////////
     void setMat4Uniform(UniformLocation location, const float* matrixPtr) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set a per-draw 4x4 matrix uniform, skipping redundant uploads
+    ///
+    /// The last matrix uploaded this way is remembered, and uploading
+    /// it again to the same location is a no-op. The program must be
+    /// bound.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTransformUniform(UniformLocation location, const float* matrixPtr) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Compile the shader(s) and create the program
     ///
@@ -685,11 +737,34 @@ private:
                                                         std::string_view geometryShaderCode,
                                                         std::string_view fragmentShaderCode);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the missing vertex and fragment stages by the built-in ones where required
+    ///
+    /// OpenGL ES cannot link a program without both stages. The
+    /// sources must be substituted before computing cache keys,
+    /// so that programs compiled in different ways share them.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void substituteMissingStages(GraphicsContext&  graphicsContext,
+                                        std::string_view& vertexShaderCode,
+                                        std::string_view& fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set up a successfully linked program and wrap it
+    ///
+    /// Shared by programs linked from source and programs
+    /// restored from a `ShaderCache`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Shader> finalizeLinkedProgram(GraphicsContext& graphicsContext,
+                                                                      unsigned int     shaderProgram);
+
     ////////////////////////////////////////////////////////////
     /// \brief Bind all the textures used by the shader
     ///
-    /// This function each texture to a different unit, and
-    /// updates the corresponding variables in the shader accordingly.
+    /// Each sampler got its own texture unit at link time, so this
+    /// function only binds the textures of the units whose texture
+    /// changed since they were last bound in the active context.
     ///
     ////////////////////////////////////////////////////////////
     void bindTextures() const;
@@ -707,7 +782,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 192> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 256> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -823,6 +898,20 @@ private:
 /// sf::Shader::bind(nullptr);
 /// \endcode
 ///
-/// \see sf::Glsl
+/// Values shared by many shaders are better stored in a
+/// `sf::UniformBuffer` and read through a uniform block,
+/// see `setUniformBlockBinding`. Render targets provide their
+/// view-projection matrix to any block declared as
+/// \code
+/// layout(std140) uniform sf_u_ViewBlock
+/// {
+///     mat4 sf_u_viewProjectionMatrix;
+/// };
+/// \endcode
+/// along with a `mat4 sf_u_modelMatrix` uniform; the vertex shader
+/// returned by `sf::GraphicsContext::getBuiltInViewBlockShaderVertexSrc`
+/// uses them.
+///
+/// \see sf::Glsl, sf::UniformBuffer
 ///
 ////////////////////////////////////////////////////////////
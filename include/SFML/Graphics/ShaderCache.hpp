@@ -0,0 +1,192 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class Shader;
+class ShaderCompileQueue;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief On-disk cache of linked shader programs
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShaderCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a cache storing its programs in a directory
+    ///
+    /// The directory must exist. The cache does nothing until it
+    /// is installed with `GraphicsContext::setShaderCache`.
+    ///
+    /// \param graphicsContext Graphics context the programs are linked with
+    /// \param directory       Existing directory to read and write program binaries
+    ///
+    /// \return Shader cache on success, `base::nullOpt` if the directory
+    ///         does not exist or program binaries are not supported
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<ShaderCache> create(GraphicsContext& graphicsContext, const Path& directory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the driver can save and restore program binaries
+    ///
+    /// Requires OpenGL 4.1, `ARB_get_program_binary` or OpenGL ES 3.0,
+    /// and at least one binary format supported by the driver.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isAvailable(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory the program binaries are stored in
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Path& getDirectory() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of programs restored from the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getHitCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of programs compiled from source
+    ///
+    /// Includes the programs whose binary was rejected.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMissCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of cached binaries rejected by the driver
+    ///
+    /// Binaries are rejected when they are corrupted, or when the
+    /// driver changed in a way not reflected by its version string.
+    /// Rejected binaries are replaced after compiling from source.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getRejectedCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the hit, miss and rejection counters to zero
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetCounters();
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit ShaderCache(base::PassKey<ShaderCache>&&, const Path& directory, std::uint64_t driverHash);
+
+private:
+    friend Shader;
+    friend ShaderCompileQueue;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the key of a program from its sources and the driver
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint64_t computeKey(std::string_view vertexShaderCode,
+                                           std::string_view geometryShaderCode,
+                                           std::string_view fragmentShaderCode) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a program from its cached binary
+    ///
+    /// Updates the hit or miss counters.
+    ///
+    /// \return OpenGL identifier of the linked program, 0 on failure
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int loadProgram(std::uint64_t key);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the binary of a linked program to the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    void storeProgram(std::uint64_t key, unsigned int program) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the path of the binary of a program
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Path getProgramPath(std::uint64_t key) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Path          m_directory;       //!< Directory the binaries are stored in
+    std::uint64_t m_driverHash;      //!< Hash of the renderer and version strings
+    std::size_t   m_hitCount{};      //!< Number of programs restored from the cache
+    std::size_t   m_missCount{};     //!< Number of programs compiled from source
+    std::size_t   m_rejectedCount{}; //!< Number of binaries rejected by the driver
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShaderCache
+/// \ingroup graphics
+///
+/// Compiling and linking GLSL is slow, and applications using
+/// many shaders can spend a significant part of their startup
+/// in the driver compiler. `sf::ShaderCache` saves the binary
+/// of every program linked from source to a directory, and
+/// restores it the next time the same sources are loaded.
+///
+/// Programs are identified by a hash of their sources and of
+/// the `GL_VENDOR`, `GL_RENDERER` and `GL_VERSION` strings, so
+/// that updating the driver or switching graphics cards never
+/// restores an incompatible binary. If the driver rejects a
+/// binary anyway, the program is silently compiled from source
+/// and the binary is replaced.
+///
+/// Once installed on a graphics context, the cache is used by
+/// all the `sf::Shader::loadFrom*` functions.
+///
+/// Usage example:
+/// \code
+/// sf::GraphicsContext graphicsContext;
+///
+/// sf::base::Optional<sf::ShaderCache> shaderCache = sf::ShaderCache::create(graphicsContext, "shader-cache");
+/// if (shaderCache.hasValue())
+///     graphicsContext.setShaderCache(&*shaderCache);
+///
+/// // ... load all the shaders ...
+///
+/// if (shaderCache.hasValue())
+///     std::cout << shaderCache->getHitCount() << " programs restored, "
+///               << shaderCache->getMissCount() << " compiled\n";
+/// \endcode
+///
+/// \see sf::Shader, sf::GraphicsContext
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,236 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include <deque>
+#include <string_view>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class Shader;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Compiles shader programs without blocking the calling thread
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShaderCompileQueue
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a queued program
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief State of a queued program
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Status
+    {
+        Pending, //!< Still compiling or waiting to be compiled
+        Ready,   //!< Compiled and linked, `getShader` returns it
+        Failed   //!< Compilation or linking failed, the error was logged
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the queue
+    ///
+    /// \param graphicsContext       Graphics context the programs are linked with
+    /// \param maxCompilesPerUpdate  Maximum number of programs compiled by a single call
+    ///                              to `update` when parallel compilation is not available,
+    ///                              must not be zero
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit ShaderCompileQueue(GraphicsContext& graphicsContext, std::size_t maxCompilesPerUpdate = 4u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Programs still compiling are abandoned, compiled shaders are destroyed.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ShaderCompileQueue();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderCompileQueue(const ShaderCompileQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ShaderCompileQueue& operator=(const ShaderCompileQueue&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a program made of a vertex and a fragment shader
+    ///
+    /// The sources are copied. With parallel compilation, they are
+    /// submitted to the driver right away; otherwise they are compiled
+    /// by subsequent calls to `update`. Programs found in the shader
+    /// cache of the graphics context are ready immediately.
+    ///
+    /// \param vertexShaderCode   Source code of the vertex shader
+    /// \param fragmentShaderCode Source code of the fragment shader
+    ///
+    /// \return Identifier of the program
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Id push(std::string_view vertexShaderCode, std::string_view fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue a program made of a vertex, a geometry and a fragment shader
+    ///
+    /// \see push(std::string_view, std::string_view)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Id push(std::string_view vertexShaderCode,
+                          std::string_view geometryShaderCode,
+                          std::string_view fragmentShaderCode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Make progress on the pending programs
+    ///
+    /// Call this function once per frame. With parallel compilation,
+    /// it collects the programs the driver finished compiling and never
+    /// blocks. Otherwise, it compiles up to `maxCompilesPerUpdate`
+    /// programs on the calling thread.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until all the pending programs are ready or failed
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForCompletion();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state of a queued program
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Status getStatus(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a queued program if it is ready
+    ///
+    /// The returned pointer can be assigned to `RenderStates::shader`
+    /// directly: while the program is pending or if it failed, it is
+    /// null and render targets draw with the built-in shader. The
+    /// shader stays valid as long as the queue.
+    ///
+    /// \return Pointer to the shader, or `nullptr` if it is not ready
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Shader* getShader(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a queued program, or a fallback if it is not ready
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Shader& getShaderOr(Id id, const Shader& fallback) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of programs that are not ready nor failed yet
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the driver compiles programs in the background
+    ///
+    /// Requires `KHR_parallel_shader_compile` or `ARB_parallel_shader_compile`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool isParallelCompileAvailable(GraphicsContext& graphicsContext);
+
+private:
+    struct Entry;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Hand the sources of a program to the driver and start linking
+    ///
+    ////////////////////////////////////////////////////////////
+    void submit(Entry& entry) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check the outcome of a submitted program, blocking if needed
+    ///
+    ////////////////////////////////////////////////////////////
+    void finish(Entry& entry);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*  m_graphicsContext;      //!< Graphics context the programs are linked with
+    std::size_t       m_maxCompilesPerUpdate; //!< Compilation budget of `update` without parallel compilation
+    bool              m_parallelCompile;      //!< Does the driver compile in the background?
+    std::size_t       m_pendingCount{};       //!< Number of pending entries
+    std::deque<Entry> m_entries;              //!< Queued programs, never moved once added
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShaderCompileQueue
+/// \ingroup graphics
+///
+/// `sf::Shader::loadFromMemory` compiles and links on the spot,
+/// blocking the calling thread for as long as the driver needs.
+/// With dozens of programs, this freezes loading screens.
+///
+/// `sf::ShaderCompileQueue` compiles programs in the background
+/// when the driver supports `KHR_parallel_shader_compile`: all
+/// the sources are submitted at once, and `update` only collects
+/// the programs whose compilation completed, without ever waiting.
+/// Without the extension, `update` compiles a few programs per
+/// call, spreading the work over several frames.
+///
+/// A queued program is identified by an `Id`. Until it is ready,
+/// `getShader` returns a null pointer, so drawing with it falls
+/// back to the built-in shader; `getShaderOr` substitutes another
+/// fallback, and `getStatus` allows skipping the draw instead.
+///
+/// Usage example:
+/// \code
+/// sf::ShaderCompileQueue queue(graphicsContext);
+///
+/// const auto blurId  = queue.push(blurVertexSource, blurFragmentSource);
+/// const auto bloomId = queue.push(bloomVertexSource, bloomFragmentSource);
+///
+/// while (window.isOpen())
+/// {
+///     queue.update();
+///
+///     // Draws unblurred until the blur shader is ready
+///     window.draw(sprite, sf::RenderStates(queue.getShader(blurId)));
+///
+///     // Not drawn at all until the bloom shader is ready
+///     if (queue.getStatus(bloomId) == sf::ShaderCompileQueue::Status::Ready)
+///         window.draw(glowSprite, sf::RenderStates(queue.getShader(bloomId)));
+///
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Shader, sf::ShaderCache
+///
+////////////////////////////////////////////////////////////
@@ -20,8 +20,10 @@ namespace sf
 {
 struct RenderStates;
 class RenderTarget;
+class ShapeBatch;
 class Texture;
 struct Color;
+struct Vertex;
 
 ////////////////////////////////////////////////////////////
 /// \brief Base class for textured shapes with outline
@@ -210,8 +212,32 @@ protected:
     ////////////////////////////////////////////////////////////
     void update(const sf::Vector2f* points, std::size_t pointCount);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start recomputing the geometry by writing the points in place
+    ///
+    /// Alternative to `update` for derived classes that generate
+    /// their points: instead of copying them from a separate array,
+    /// the positions are written directly into the fill vertices,
+    /// whose storage is reused as long as the point count does not
+    /// grow. The returned vertices must have their `position` set,
+    /// then `finishUpdate` must be called.
+    ///
+    /// \param pointCount Number of points of the shape
+    ///
+    /// \return Pointer to `pointCount` vertices, `nullptr` if `pointCount` is less than 3
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vertex* beginUpdate(std::size_t pointCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Finish recomputing the geometry after `beginUpdate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void finishUpdate();
+
 private:
     friend RenderTarget;
+    friend ShapeBatch;
 
     ////////////////////////////////////////////////////////////
     /// \brief Draws the shape on `renderTarget` with the given `texture` and `states`
@@ -219,6 +245,32 @@ private:
     ////////////////////////////////////////////////////////////
     void drawOnto(RenderTarget& renderTarget, const Texture* texture, RenderStates states) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of points of the shape's geometry
+    ///
+    /// \return Number of points, 0 if the shape has no geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getGeometryPointCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the shape has outline geometry
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool hasOutlineGeometry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write the vertices of the shape for drawing as indexed triangle lists
+    ///
+    /// The fill is written as the center followed by the points
+    /// (`getGeometryPointCount() + 1` vertices), the outline as
+    /// the inner and outer vertex of each point (twice as many
+    /// vertices as points), unless the shape has no outline.
+    /// Positions are transformed by the shape's transform.
+    ///
+    ////////////////////////////////////////////////////////////
+    void writeIndexedVertices(Vertex* fillVertices, Vertex* outlineVertices) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the fill vertices' color
     ///
@@ -0,0 +1,242 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/IndexBuffer.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexBuffer.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class RenderTarget;
+class Shape;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Geometry of many shapes, drawn with a single draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API ShapeBatch
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a shape in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit ShapeBatch(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ShapeBatch(const ShapeBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ShapeBatch& operator=(const ShapeBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add the geometry of a shape to the batch
+    ///
+    /// The geometry is copied, transformed by the transform of
+    /// the shape: later changes to \a shape are not reflected
+    /// until `set` is called with it.
+    ///
+    /// \param shape Shape to add
+    ///
+    /// \return Handle to the geometry of the shape in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle add(const Shape& shape);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace the geometry of a shape of the batch
+    ///
+    /// If the shape has the same number of points and still has
+    /// (or still lacks) an outline, its vertices are overwritten
+    /// in place and only their range is uploaded on the next draw.
+    ///
+    /// \param handle Handle returned by `add`
+    /// \param shape  Shape to copy the geometry from
+    ///
+    ////////////////////////////////////////////////////////////
+    void set(Handle handle, const Shape& shape);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the shapes from the batch
+    ///
+    /// Invalidates all the handles.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of shapes in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getShapeCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of vertices of all the shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVertexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of indices of all the shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getIndexCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw all the shapes, untextured
+    ///
+    /// \param target Render target to draw to
+    /// \param states Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, RenderStates states) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw all the shapes, with their fill textured
+    ///
+    /// Outlines are never textured, so they are drawn with a
+    /// second draw call after all the fills.
+    ///
+    /// \param target  Render target to draw to
+    /// \param texture Texture of the fills, `nullptr` for none
+    /// \param states  Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const Texture* texture, RenderStates states) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Range of the vertices of a shape
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Slot
+    {
+        std::size_t vertexOffset; //!< Offset of the fill vertices, followed by the outline vertices
+        std::size_t pointCount;   //!< Number of points of the shape
+        bool        hasOutline;   //!< Does the shape have outline vertices?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark a range of vertices as needing an upload
+    ///
+    ////////////////////////////////////////////////////////////
+    void markDirty(std::size_t begin, std::size_t end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Regenerate the indices of all the shapes
+    ///
+    ////////////////////////////////////////////////////////////
+    void rebuildIndices() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload the dirty vertices and the indices if needed
+    ///
+    /// \return True if the geometry is in graphics memory, false if it must be streamed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool upload() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw a range of indices
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawRange(RenderTarget& target, bool uploaded, std::size_t firstIndex, std::size_t indexCount, const RenderStates& states) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*                    m_graphicsContext;      //!< The window context
+    std::vector<Slot>                   m_slots;                //!< Vertex range of each shape
+    std::vector<Vertex>                 m_vertices;             //!< Vertices of all the shapes, contiguous
+    mutable std::vector<IndexType>      m_indices;              //!< Fill indices of all the shapes, then outline indices
+    mutable std::size_t                 m_fillIndexCount{};     //!< Number of fill indices, at the start of `m_indices`
+    mutable bool                        m_indicesDirty{};       //!< Do the indices need to be regenerated?
+    mutable bool                        m_indexUploadNeeded{};  //!< Do the indices need to be uploaded?
+    mutable std::size_t                 m_dirtyBegin{};         //!< Start of the range of vertices to upload
+    mutable std::size_t                 m_dirtyEnd{};           //!< End of the range of vertices to upload
+    mutable VertexBuffer                m_vertexBuffer;         //!< Vertices in graphics memory
+    mutable base::Optional<IndexBuffer> m_indexBuffer;          //!< Indices in graphics memory, created on first draw
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::ShapeBatch
+/// \ingroup graphics
+///
+/// Drawing a `sf::Shape` takes one draw call for its fill and
+/// another for its outline, because triangle fans and strips
+/// cannot be merged. With thousands of shapes, the draw calls
+/// dominate the frame time.
+///
+/// `sf::ShapeBatch` stores the geometry of many shapes as
+/// indexed triangle lists, contiguously in graphics memory,
+/// and draws them all with a single draw call. The geometry is
+/// pre-transformed, so moving a shape requires calling `set`
+/// again; only the vertices of the shapes that changed are
+/// uploaded on the next draw.
+///
+/// Within a batch, all the outlines are drawn after all the
+/// fills. Shapes overlapping each other should be split into
+/// several batches if the order of their outlines matters.
+///
+/// Usage example:
+/// \code
+/// sf::ShapeBatch batch(graphicsContext);
+///
+/// std::vector<sf::CircleShape>          circles = makeCircles();
+/// std::vector<sf::ShapeBatch::Handle>   handles;
+///
+/// for (const sf::CircleShape& circle : circles)
+///     handles.push_back(batch.add(circle));
+///
+/// while (window.isOpen())
+/// {
+///     // Only the moved circle is uploaded again
+///     circles[0].move({1.f, 0.f});
+///     batch.set(handles[0], circles[0]);
+///
+///     window.draw(batch);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Shape, sf::IndexBuffer
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,286 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/StencilMode.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Image;
+class View;
+struct Vertex;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Render target rasterizing on the CPU into an image
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SoftwareRenderTarget
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Image sampled by a draw call, with its sampling settings
+    ///
+    /// The software target cannot read `sf::Texture` objects, which
+    /// live on the graphics card: textured draws sample an `sf::Image`
+    /// instead, with the same settings as `Texture::setSmooth` and
+    /// `Texture::setRepeated`. Brace-initialize it, so that omitted
+    /// members are zeroed.
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] TextureSource
+    {
+        const Image* image;    //!< Image to sample, `nullptr` to draw untextured geometry
+        bool         smooth;   //!< Filter the image bilinearly instead of taking the nearest pixel
+        bool         repeated; //!< Repeat the image outside of the [0, size] texture coordinates
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a software render target
+    ///
+    /// Draws are queued and rasterized in tiles by \a threadCount
+    /// threads, the calling thread included.
+    ///
+    /// \param size        Width and height of the target image, in pixels
+    /// \param threadCount Number of threads rasterizing the tiles, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SoftwareRenderTarget(Vector2u size, unsigned int threadCount = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Pending draws are discarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoftwareRenderTarget();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTarget(const SoftwareRenderTarget&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoftwareRenderTarget& operator=(const SoftwareRenderTarget&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the scissor area of the target with a single color
+    ///
+    /// \param color Fill color to use to clear the render target
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear(Color color = Color::Black);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the scissor area of the stencil buffer to a specific value
+    ///
+    /// \param stencilValue Stencil value to clear to
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearStencil(StencilValue stencilValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the scissor area of the target with a single color and stencil value
+    ///
+    /// \param color        Fill color to use to clear the render target
+    /// \param stencilValue Stencil value to clear to
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear(Color color, StencilValue stencilValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current active view
+    ///
+    /// Like `RenderTarget::setView`, the view applies to the
+    /// following draws and clears, including its viewport and
+    /// scissor rectangle.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setView(const View& view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the view currently in use
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const View& getView() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the default view, covering the whole target
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const View& getDefaultView() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by an array of vertices
+    ///
+    /// The vertices go through the same pipeline as the built-in
+    /// shader of `sf::RenderTarget`: they are transformed by
+    /// `states.transform` and the view, and the color of each
+    /// fragment is the interpolated vertex color multiplied by
+    /// the sampled texture, then blended with `states.blendMode`
+    /// and tested against `states.stencilMode`.
+    ///
+    /// Custom shaders and `states.texture` are not supported,
+    /// pass the image to sample as \a texture instead.
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param texture     Image to sample and its sampling settings
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(const Vertex*        vertices,
+              std::size_t          vertexCount,
+              PrimitiveType        type,
+              const RenderStates&  states  = RenderStates::Default,
+              const TextureSource& texture = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw primitives defined by indexed vertices
+    ///
+    /// \param vertices    Pointer to the vertices
+    /// \param vertexCount Number of vertices in the array
+    /// \param indices     Pointer to the indices into \a vertices
+    /// \param indexCount  Number of indices in the array
+    /// \param type        Type of primitives to draw
+    /// \param states      Render states to use for drawing
+    /// \param texture     Image to sample and its sampling settings
+    ///
+    /// \see draw
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexed(const Vertex*        vertices,
+                     std::size_t          vertexCount,
+                     const IndexType*     indices,
+                     std::size_t          indexCount,
+                     PrimitiveType        type,
+                     const RenderStates&  states  = RenderStates::Default,
+                     const TextureSource& texture = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize all the pending draws into the image
+    ///
+    /// Like `RenderTexture::display`, this must be called before
+    /// reading the image. The images passed to the pending draws
+    /// must stay alive and unchanged until then.
+    ///
+    ////////////////////////////////////////////////////////////
+    void display();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the image drawn to, as of the last call to `display`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Image& getImage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the target, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads rasterizing the tiles, the calling thread included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Clear the color and/or stencil buffers, `nullptr` leaving a buffer untouched
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearImpl(const Color* color, const StencilValue* stencilValue);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Transform and queue a single triangle, line or point
+    ///
+    ////////////////////////////////////////////////////////////
+    void appendPrimitive(const Vertex* const* vertices, std::size_t vertexCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the render states of the following primitives
+    ///
+    ////////////////////////////////////////////////////////////
+    void beginDraw(const RenderStates& states, const TextureSource& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rasterize the active tiles in `[begin, end)`, called by each thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void rasterizeTiles(std::size_t begin, std::size_t end);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoftwareRenderTarget
+/// \ingroup graphics
+///
+/// `sf::SoftwareRenderTarget` draws vertices into an `sf::Image`
+/// without any graphics driver, for example to render thumbnails
+/// or previews on a server. It follows the semantics of the
+/// built-in shader of `sf::RenderTarget`: views, viewports and
+/// scissor rectangles, transforms, vertex colors, textures
+/// in pixel or normalized coordinates, nearest or bilinear
+/// sampling, blend modes and stencil modes give the same
+/// results as on the graphics card, up to rounding.
+///
+/// Draws are not rasterized right away. They are queued, and
+/// `display` splits the target into tiles that the threads
+/// rasterize independently, each tile processing its primitives
+/// in the order they were drawn.
+///
+/// Lines and points are rasterized as one pixel wide quads.
+/// Custom shaders are not supported.
+///
+/// Usage example:
+/// \code
+/// const auto tileset = sf::Image::loadFromFile("tileset.png").value();
+///
+/// sf::SoftwareRenderTarget target({256u, 256u});
+/// target.clear(sf::Color::Black);
+///
+/// // Vertices built as for sf::RenderTarget, with texture coordinates in pixels
+/// target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, sf::RenderStates::Default, {&tileset});
+///
+/// target.display();
+/// (void)sf::ImageUtils::saveToFile(target.getImage(), "preview.png");
+/// \endcode
+///
+/// \see sf::RenderTexture, sf::Image
+///
+////////////////////////////////////////////////////////////
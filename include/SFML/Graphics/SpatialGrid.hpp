@@ -0,0 +1,248 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class View;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Uniform grid indexing the bounds of objects, to find the visible ones quickly
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpatialGrid
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of an object in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    using ObjectId = unsigned int;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty grid
+    ///
+    /// Objects may lie outside of \a area, but they are then
+    /// stored in the cells on its border, which makes queries
+    /// around them slower.
+    ///
+    /// \param area     Area of the world covered by the grid
+    /// \param cellSize Size of a cell, in world units
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SpatialGrid(const FloatRect& area, Vector2f cellSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object to the grid
+    ///
+    /// \param bounds Global bounds of the object, such as returned by `getGlobalBounds`
+    ///
+    /// \return Identifier of the object, valid until it is removed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ObjectId insert(const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the bounds of an object, after it moved
+    ///
+    /// Moves within the same cells only store the new bounds.
+    ///
+    /// \param objectId Identifier of the object
+    /// \param bounds   New global bounds of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(ObjectId objectId, const FloatRect& bounds);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object from the grid
+    ///
+    /// Its identifier may be reused by the next insertions.
+    ///
+    /// \param objectId Identifier of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(ObjectId objectId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the objects
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bounds of an object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const FloatRect& getBounds(ObjectId objectId) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getObjectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects overlapping an axis-aligned area
+    ///
+    /// Each object is reported once, in no particular order.
+    ///
+    /// \param area   Area to search, in world units
+    /// \param result Array to append the identifiers of the objects to
+    ///
+    /// \return Number of objects found
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t query(const FloatRect& area, std::vector<ObjectId>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find the objects visible through a view
+    ///
+    /// The area seen by the view is a rectangle rotated by the
+    /// rotation of the view: objects overlapping its bounding
+    /// box but not the rectangle itself are culled as well.
+    ///
+    /// The visible and culled counts of the query are available
+    /// through `getVisibleCount` and `getCulledCount`.
+    ///
+    /// \param view   View to test the objects against, usually `target.getView()`
+    /// \param result Array to append the identifiers of the visible objects to
+    ///
+    /// \return Number of visible objects
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t queryVisible(const View& view, std::vector<ObjectId>& result) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of visible objects found by the last call to `queryVisible`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getVisibleCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of objects culled by the last call to `queryVisible`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getCulledCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Object stored in the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Object
+    {
+        FloatRect    bounds;       //!< Global bounds of the object
+        Vector2u     cellBegin;    //!< First cell overlapped by the object
+        Vector2u     cellEnd;      //!< Last cell overlapped by the object, included
+        unsigned int queryStamp{}; //!< Last query reporting the object, to report it only once
+        bool         alive{};      //!< Is the object in the grid, rather than in the free list?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cell containing a point, clamped to the grid
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getCell(Vector2f point) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add an object to the cells it overlaps
+    ///
+    ////////////////////////////////////////////////////////////
+    void link(ObjectId objectId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove an object from the cells it overlaps
+    ///
+    ////////////////////////////////////////////////////////////
+    void unlink(ObjectId objectId);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call `func` once for each object overlapping the bounding box `area`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Func>
+    void forEachCandidate(const FloatRect& area, Func&& func) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    FloatRect                          m_area;           //!< Area of the world covered by the grid
+    Vector2f                           m_cellSize;       //!< Size of a cell, in world units
+    Vector2u                           m_gridSize;       //!< Number of cells along each axis
+    std::vector<std::vector<ObjectId>> m_cells;          //!< Objects overlapping each cell, row by row
+    mutable std::vector<Object>        m_objects;        //!< Objects, indexed by their identifier
+    std::vector<ObjectId>              m_freeIds;        //!< Identifiers of removed objects, to reuse
+    std::size_t                        m_objectCount{};  //!< Number of objects in the grid
+    mutable unsigned int               m_queryStamp{};   //!< Identifier of the last query
+    mutable std::size_t                m_visibleCount{}; //!< Visible objects found by the last `queryVisible`
+    mutable std::size_t                m_culledCount{};  //!< Objects culled by the last `queryVisible`
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpatialGrid
+/// \ingroup graphics
+///
+/// `sf::RenderTarget` has no notion of visibility: every object
+/// drawn is transformed and sent to the graphics card, even
+/// when it lies outside of the view. `sf::SpatialGrid` indexes
+/// the global bounds of the objects of a scene in a uniform
+/// grid, so that the objects visible through a view can be
+/// found without testing all of them.
+///
+/// The grid only stores bounds and identifiers, the objects
+/// themselves stay wherever the application keeps them: the
+/// identifiers returned by `insert` are usually used as indices
+/// into a parallel array. When an object moves, `update` only
+/// relinks it if it crossed a cell boundary.
+///
+/// The cell size should be in the order of the size of the
+/// objects: smaller cells make objects overlap many cells,
+/// larger cells make queries test more objects.
+///
+/// Usage example:
+/// \code
+/// sf::SpatialGrid grid(sf::FloatRect({0.f, 0.f}, {16384.f, 16384.f}), {256.f, 256.f});
+///
+/// std::vector<sf::Sprite> sprites = ...;
+/// for (const sf::Sprite& sprite : sprites)
+///     ids.push_back(grid.insert(sprite.getGlobalBounds())); // ids[i] == i for a new grid
+///
+/// // When a sprite moves
+/// sprites[i].move(velocity);
+/// grid.update(ids[i], sprites[i].getGlobalBounds());
+///
+/// // Draw the visible sprites only
+/// visible.clear();
+/// grid.queryVisible(window.getView(), visible);
+///
+/// for (const sf::SpatialGrid::ObjectId id : visible)
+///     window.draw(sprites[id], texture);
+///
+/// std::cout << grid.getVisibleCount() << " visible, " << grid.getCulledCount() << " culled\n";
+/// \endcode
+///
+/// \see sf::View
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,271 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/InPlacePImpl.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class RenderTarget;
+class Sprite;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Many sprites sharing a texture, stored attribute by attribute and drawn with a single draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API SpriteBatch
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a sprite in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    using Handle = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct an empty batch
+    ///
+    /// \param graphicsContext Graphics context owning the vertex buffers
+    /// \param threadCount     Number of threads generating the vertices, the calling thread included,
+    ///                        0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SpriteBatch(GraphicsContext& graphicsContext, unsigned int threadCount = 1u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SpriteBatch();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch(const SpriteBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite to the batch
+    ///
+    /// The position, rotation, scale, origin, texture rectangle
+    /// and color of \a sprite are copied: later changes to it
+    /// are not reflected until `set` is called with it.
+    ///
+    /// \param sprite Sprite to add
+    ///
+    /// \return Handle to the sprite in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Handle add(const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace all the attributes of a sprite of the batch
+    ///
+    /// \param handle Handle returned by `add`
+    /// \param sprite Sprite to copy the attributes from
+    ///
+    ////////////////////////////////////////////////////////////
+    void set(Handle handle, const Sprite& sprite);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the sprites from the batch
+    ///
+    /// Invalidates all the handles.
+    ///
+    ////////////////////////////////////////////////////////////
+    void clear();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Preallocate the storage for a number of sprites
+    ///
+    ////////////////////////////////////////////////////////////
+    void reserve(std::size_t spriteCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sprites in the batch
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getSpriteCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void setPosition(Handle handle, Vector2f position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move a sprite by an offset
+    ///
+    ////////////////////////////////////////////////////////////
+    void move(Handle handle, Vector2f offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the rotation of a sprite
+    ///
+    /// The sine and cosine of the angle are computed here, once,
+    /// rather than each time the vertices are generated.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRotation(Handle handle, Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void setScale(Handle handle, Vector2f factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void setOrigin(Handle handle, Vector2f origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the sub-rectangle of the texture displayed by a sprite
+    ///
+    /// As with `sf::Sprite`, negative sizes flip the sprite. The
+    /// coordinates of the rectangle must lie in [0, 65535].
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTextureRect(Handle handle, const IntRect& rectangle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the color of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void setColor(Handle handle, Color color);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getPosition(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the rotation of a sprite, in [0, 360) degrees
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Angle getRotation(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getScale(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2f getOrigin(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sub-rectangle of the texture displayed by a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const IntRect& getTextureRect(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the color of a sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Color getColor(Handle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads generating the vertices, the calling thread included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw all the sprites
+    ///
+    /// The vertices are regenerated if any sprite changed since
+    /// the last draw.
+    ///
+    /// \param target  Render target to draw to
+    /// \param texture Texture of the sprites
+    /// \param states  Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const Texture& texture, RenderStates states) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SpriteBatch
+/// \ingroup graphics
+///
+/// A `sf::Sprite` carries its own transformable state, cached
+/// transforms and four vertices, so iterating over many of them
+/// to move and draw them mostly waits for memory. Each sprite
+/// also costs a draw call.
+///
+/// `sf::SpriteBatch` stores each attribute of its sprites in
+/// its own contiguous array (positions, rotations, scales,
+/// origins, texture rectangles and colors), and keeps the sine
+/// and cosine of each rotation instead of full transforms. The
+/// vertices of all the sprites are generated in one pass,
+/// vectorized and split over several threads when requested,
+/// then drawn with a single draw call. As with `sf::Sprite`,
+/// the texture is passed when drawing.
+///
+/// Usage example:
+/// \code
+/// sf::SpriteBatch batch(graphicsContext, 0u); // One thread per hardware thread
+///
+/// std::vector<sf::SpriteBatch::Handle> handles;
+/// for (const sf::Sprite& sprite : makeSprites())
+///     handles.push_back(batch.add(sprite));
+///
+/// while (window.isOpen())
+/// {
+///     for (const sf::SpriteBatch::Handle handle : handles)
+///         batch.move(handle, {1.f, 0.f});
+///
+///     batch.draw(window, texture, sf::RenderStates::Default);
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::Sprite, sf::ShapeBatch
+///
+////////////////////////////////////////////////////////////
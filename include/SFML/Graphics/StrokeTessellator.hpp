@@ -0,0 +1,189 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Color.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+struct Vertex;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Shape of the corners between two segments of a stroke
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] LineJoin : unsigned char
+{
+    Miter, //!< Sharp corner, replaced by a bevel beyond the miter limit
+    Bevel, //!< Corner cut straight across
+    Round  //!< Circular arc around the corner
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Shape of the ends of an open stroke
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] LineCap : unsigned char
+{
+    Butt,   //!< Stroke ends exactly at the end points
+    Square, //!< Stroke extends past the end points by half its thickness
+    Round   //!< Half circle centered on the end points
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Appearance of a stroke
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] StrokeStyle
+{
+    float    thickness{1.f};         //!< Width of the stroke, in the units of the points
+    Color    color{Color::White};    //!< Color of the stroke
+    LineJoin join{LineJoin::Miter};  //!< Shape of the corners
+    LineCap  cap{LineCap::Butt};     //!< Shape of the ends of open strokes
+    float    miterLimit{4.f};        //!< Maximum ratio between the length of a miter and the thickness
+    float    antialiasingWidth{0.f}; //!< Width of the feathered fringe along the edges, 0 to disable it
+    float    roundTolerance{0.25f};  //!< Maximum distance between round joins or caps and their triangles
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Converts polylines into triangles ready to be drawn
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API StrokeTessellator
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the triangles of an open polyline to a vertex array
+    ///
+    /// The vertices are appended to `output` as independent
+    /// triangles, to be drawn with `sf::PrimitiveType::Triangles`.
+    /// Consecutive duplicate points are ignored. Nothing is
+    /// appended if the polyline has less than two distinct points.
+    ///
+    /// \param output     Vertex array to append the triangles to
+    /// \param points     Points of the polyline
+    /// \param pointCount Number of points of the polyline
+    /// \param style      Appearance of the stroke
+    ///
+    /// \return Number of vertices appended to `output`
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t appendPolyline(std::vector<Vertex>& output,
+                               const Vector2f*      points,
+                               std::size_t          pointCount,
+                               const StrokeStyle&   style);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the triangles of a closed polygon outline to a vertex array
+    ///
+    /// Same as `appendPolyline`, except that the last point is
+    /// joined back to the first one and `style.cap` is ignored.
+    /// Polygons with less than three distinct points are stroked
+    /// as open polylines.
+    ///
+    /// \see appendPolyline
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t appendPolygon(std::vector<Vertex>& output,
+                              const Vector2f*      points,
+                              std::size_t          pointCount,
+                              const StrokeStyle&   style);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Point of a polyline with the segment leading to the next point
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] PathPoint
+    {
+        Vector2f position;  //!< Position of the point
+        Vector2f direction; //!< Unit direction towards the next point
+        float    length;    //!< Distance to the next point
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append the triangles of an open or closed polyline
+    ///
+    ////////////////////////////////////////////////////////////
+    std::size_t append(std::vector<Vertex>& output,
+                       const Vector2f*      points,
+                       std::size_t          pointCount,
+                       const StrokeStyle&   style,
+                       bool                 closed);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<PathPoint> m_pathPoints; //!< Distinct points of the current polyline, storage reused between calls
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::StrokeTessellator
+/// \ingroup graphics
+///
+/// `sf::StrokeTessellator` turns open polylines and closed
+/// polygon outlines into triangles, with miter, bevel or round
+/// joins and butt, square or round caps.
+///
+/// When `StrokeStyle::antialiasingWidth` is positive, a fringe
+/// fading to full transparency is added along every edge of the
+/// stroke, smoothing it without multisampling. The fringe is
+/// centered on the geometric edge, so a width of about one
+/// pixel gives the best results.
+///
+/// The triangles are appended to a vertex array owned by the
+/// caller, so that many strokes can be accumulated and drawn in
+/// a single call. Clearing the array instead of destroying it,
+/// and keeping the tessellator alive between frames, means that
+/// no memory is allocated once the buffers reached their peak
+/// size.
+///
+/// Usage example:
+/// \code
+/// sf::StrokeTessellator   tessellator;
+/// std::vector<sf::Vertex> vertices;
+///
+/// const sf::StrokeStyle style{.thickness = 3.f,
+///                             .color = sf::Color::Green,
+///                             .join = sf::LineJoin::Round,
+///                             .cap = sf::LineCap::Round,
+///                             .antialiasingWidth = 1.f};
+///
+/// while (window.isOpen())
+/// {
+///     vertices.clear();
+///
+///     for (const std::vector<sf::Vector2f>& graph : graphs)
+///         tessellator.appendPolyline(vertices, graph.data(), graph.size(), style);
+///
+///     window.draw(vertices, sf::PrimitiveType::Triangles);
+/// }
+/// \endcode
+///
+/// \see sf::Shape, sf::Vertex
+///
+////////////////////////////////////////////////////////////
@@ -7,6 +7,8 @@
 #include "SFML/Graphics/Export.hpp"
 
 #include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+#include "SFML/Graphics/TextureFormat.hpp"
 
 #include "SFML/System/LifetimeDependee.hpp"
 #include "SFML/System/Rect.hpp"
@@ -79,6 +81,24 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Texture> create(GraphicsContext& graphicsContext, Vector2u size, bool sRgb = false);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the texture with a specific pixel format
+    ///
+    /// sRGB conversion only applies to the `RGBA8` format, it is
+    /// ignored for the other formats.
+    ///
+    /// \param size   Width and height of the texture
+    /// \param format Storage format of the pixels
+    /// \param sRgb   True to enable sRGB conversion, false to disable it
+    ///
+    /// \return Texture if creation was successful, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Texture> create(GraphicsContext& graphicsContext,
+                                                        Vector2u         size,
+                                                        TextureFormat    format,
+                                                        bool             sRgb = false);
+
     ////////////////////////////////////////////////////////////
     /// \brief Load the texture from a file on disk
     ///
@@ -308,11 +328,18 @@ public:
     /// Passing an image bigger than the texture will lead to an
     /// undefined behavior.
     ///
+    /// If the image has the size of the texture, the texture
+    /// becomes premultiplied if the image is, and stops being
+    /// premultiplied otherwise. A smaller image must use the same
+    /// alpha encoding as the texture.
+    ///
     /// This function does nothing if the texture was not
     /// previously created.
     ///
     /// \param image Image to copy to the texture
     ///
+    /// \see setAlphaPremultiplied
+    ///
     ////////////////////////////////////////////////////////////
     void update(const Image& image);
 
@@ -323,6 +350,8 @@ public:
     /// Passing an invalid combination of image size and destination
     /// will lead to an undefined behavior.
     ///
+    /// The image must use the same alpha encoding as the texture.
+    ///
     /// This function does nothing if the texture was not
     /// previously created.
     ///
@@ -332,6 +361,25 @@ public:
     ////////////////////////////////////////////////////////////
     void update(const Image& image, Vector2u dest);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the texture from externally stored pixels
+    ///
+    /// The pixels are uploaded directly from the viewed memory:
+    /// rows separated by padding (e.g. a sub-view of a larger
+    /// image) are handled by the driver through `GL_UNPACK_ROW_LENGTH`
+    /// and BGRA pixels are uploaded as such where supported.
+    /// The row stride of the view must be a multiple of 4 bytes.
+    ///
+    /// No additional check is performed on the size of the view.
+    /// Passing an invalid combination of view size and destination
+    /// will lead to an undefined behavior.
+    ///
+    /// \param view Pixels to copy to the texture
+    /// \param dest Coordinates of the destination position
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(ImageView view, Vector2u dest = {});
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the texture from the contents of a window
     ///
@@ -395,6 +443,34 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare whether the texels are stored with premultiplied alpha
+    ///
+    /// When a premultiplied texture is drawn with `sf::BlendAlpha`
+    /// (the default blend mode), `sf::BlendPremultipliedAlpha` is
+    /// used instead. Vertex colors are multiplied with the texels
+    /// as usual, so they must be premultiplied as well.
+    ///
+    /// Textures loaded from an image inherit the image's flag.
+    /// Premultiplied alpha is disabled by default.
+    ///
+    /// \param premultiplied True if the texels are premultiplied
+    ///
+    /// \see isAlphaPremultiplied, `sf::Image::premultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAlphaPremultiplied(bool premultiplied);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the texels are stored with premultiplied alpha
+    ///
+    /// \return True if the texture is premultiplied, false otherwise
+    ///
+    /// \see setAlphaPremultiplied
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isAlphaPremultiplied() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Tell whether the texture source is converted from sRGB or not
     ///
@@ -405,6 +481,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSrgb() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the storage format of the pixels
+    ///
+    /// \return Format passed to `create`, `TextureFormat::RGBA8` for loaded textures
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] TextureFormat getFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Enable or disable repeating
     ///
@@ -549,6 +633,8 @@ private:
     friend class Text;
     friend class RenderTexture;
     friend class RenderTarget;
+    friend class Shader;
+    friend class TextureStreamer;
 
     ////////////////////////////////////////////////////////////
     /// \brief Compute and return the texture matrix (used by shaders)
@@ -570,6 +656,7 @@ public:
                           Vector2u         size,
                           Vector2u         actualSize,
                           unsigned int     texture,
+                          TextureFormat    format,
                           bool             sRgb);
 
 private:
@@ -588,6 +675,53 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getValidSize(unsigned int size);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the texture, optionally without allocating level 0
+    ///
+    /// Textures created without storage have no level at all:
+    /// their levels must be allocated one by one with
+    /// `uploadMipLevel`. This is used by `TextureStreamer`, which
+    /// never allocates the levels it does not need.
+    ///
+    /// \param allocateStorage Whether to allocate level 0
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<Texture> createImpl(GraphicsContext& graphicsContext,
+                                                            Vector2u         size,
+                                                            TextureFormat    format,
+                                                            bool             sRgb,
+                                                            bool             allocateStorage);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Allocate a mipmap level and fill it with pixels
+    ///
+    /// \param level Index of the level
+    /// \param view  Contiguous RGBA pixels, of the size of the level
+    ///
+    ////////////////////////////////////////////////////////////
+    void uploadMipLevel(unsigned int level, ImageView view);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free the video memory of a mipmap level
+    ///
+    /// The level must be outside of the range set by `setMipLevelRange`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseMipLevel(unsigned int level);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Restrict sampling to a range of allocated mipmap levels
+    ///
+    /// The texture keeps its size, so texture coordinates are not
+    /// affected: sampling simply reads from `baseLevel` instead of
+    /// level 0 when the texture is magnified.
+    ///
+    /// \param baseLevel Index of the largest level to sample from
+    /// \param maxLevel  Index of the smallest level to sample from
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMipLevelRange(unsigned int baseLevel, unsigned int maxLevel);
+
     ////////////////////////////////////////////////////////////
     /// \brief Invalidate the mipmap if one exists
     ///
@@ -600,17 +734,19 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    GraphicsContext* m_graphicsContext; //!< The window context
-    Vector2u         m_size;            //!< Public texture size
-    Vector2u         m_actualSize;      //!< Actual texture size (can be greater than public size because of padding)
-    unsigned int     m_texture{};       //!< Internal texture identifier
-    bool             m_isSmooth{};      //!< Status of the smooth filter
-    bool             m_sRgb{};          //!< Should the texture source be converted from sRGB?
-    bool             m_isRepeated{};    //!< Is the texture in repeat mode?
-    mutable bool     m_pixelsFlipped{}; //!< To work around the inconsistency in Y orientation
-    bool             m_fboAttachment{}; //!< Is this texture owned by a framebuffer object?
-    bool             m_hasMipmap{};     //!< Has the mipmap been generated?
-    std::uint64_t    m_cacheId;         //!< Unique number that identifies the texture to the render target's cache
+    GraphicsContext* m_graphicsContext;      //!< The window context
+    Vector2u         m_size;                 //!< Public texture size
+    Vector2u         m_actualSize;           //!< Actual texture size (can be greater than public size because of padding)
+    unsigned int     m_texture{};            //!< Internal texture identifier
+    bool             m_isSmooth{};           //!< Status of the smooth filter
+    bool             m_sRgb{};               //!< Should the texture source be converted from sRGB?
+    TextureFormat    m_format{};             //!< Storage format of the pixels
+    bool             m_isRepeated{};         //!< Is the texture in repeat mode?
+    mutable bool     m_pixelsFlipped{};      //!< To work around the inconsistency in Y orientation
+    bool             m_fboAttachment{};      //!< Is this texture owned by a framebuffer object?
+    bool             m_hasMipmap{};          //!< Has the mipmap been generated?
+    bool             m_premultipliedAlpha{}; //!< Are the color components multiplied by alpha?
+    std::uint64_t    m_cacheId;              //!< Unique number that identifies the texture to the render target's cache
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
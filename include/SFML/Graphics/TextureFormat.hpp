@@ -0,0 +1,27 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup graphics
+/// \brief Storage formats of the pixels of a texture
+///
+/// Formats other than `RGBA8` are meant for render textures
+/// that store intermediate results, such as HDR lighting
+/// buffers or single channel masks. Updating such textures
+/// from 8-bit pixels relies on the conversion done by the
+/// driver, which OpenGL ES does not perform.
+///
+/// \see sf::Texture::create, sf::RenderTexture::create
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] TextureFormat : unsigned char
+{
+    RGBA8,        //!< 8-bit normalized red, green, blue and alpha channels, 4 bytes per pixel
+    RGBA16F,      //!< 16-bit floating point red, green, blue and alpha channels, 8 bytes per pixel
+    R11FG11FB10F, //!< Packed unsigned floating point red, green and blue channels without alpha, 4 bytes per pixel
+    R8            //!< 8-bit normalized red channel, 1 byte per pixel
+};
+
+} // namespace sf
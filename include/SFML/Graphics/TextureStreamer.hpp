@@ -0,0 +1,287 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <deque>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class MipChain;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Keeps the mipmap levels of textures resident within a memory budget
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureStreamer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Identifier of a streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    using Id = std::size_t;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Residency state of a streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Residency
+    {
+        unsigned int residentLevel{}; //!< Largest level in video memory
+        unsigned int desiredLevel{};  //!< Largest level needed by the last requests
+        unsigned int levelCount{};    //!< Number of levels of the mipmap chain
+        std::size_t  byteCount{};     //!< Video memory used by the resident levels
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the streamer
+    ///
+    /// \param graphicsContext   Graphics context used to create the textures
+    /// \param memoryBudget      Maximum video memory used by the resident levels, in bytes
+    /// \param uploadBudget      Maximum number of bytes uploaded by a single call to `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextureStreamer(GraphicsContext& graphicsContext,
+                                           std::size_t      memoryBudget,
+                                           std::size_t      uploadBudget = 4u * 1024u * 1024u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureStreamer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start streaming a texture
+    ///
+    /// Only the smallest level of the chain is uploaded right
+    /// away, so that the texture can be drawn immediately. The
+    /// larger levels are uploaded by `update`, once requested.
+    ///
+    /// \param mipChain Levels of the texture, kept in system memory
+    /// \param sRgb     True to enable sRGB conversion, false to disable it
+    ///
+    /// \return Identifier of the texture on success, `base::nullOpt` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Id> add(MipChain&& mipChain, bool sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop streaming a texture and destroy it
+    ///
+    /// The identifier may be reused by a subsequent call to `add`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Id id);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a streamed texture
+    ///
+    /// The texture has the size of level 0 of its mipmap chain,
+    /// whatever its resident levels, so it can be used with
+    /// sprites and texture rectangles like any other texture.
+    /// The reference stays valid until the texture is removed.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Texture& getTexture(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the mipmap chain of a streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const MipChain& getMipChain(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Declare that a texture is displayed at a given size
+    ///
+    /// Call this function every frame for each visible texture.
+    /// When a texture is requested several times in the same
+    /// frame, the largest size wins. Textures that were not
+    /// requested since the last `update` are considered hidden:
+    /// their large levels are the first to be evicted.
+    ///
+    /// \param id          Identifier of the texture
+    /// \param displaySize Size of the whole texture on screen, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void request(Id id, Vector2f displaySize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload and evict levels according to the last requests
+    ///
+    /// Call this function once per frame, after the requests.
+    /// Each texture is refined by at most one level per call,
+    /// largest deficits of visible textures first, until the
+    /// upload budget is spent. Levels are evicted when needed
+    /// to stay within the memory budget, starting with levels
+    /// that are no longer needed and with the textures that
+    /// were requested the longest time ago.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the memory budget
+    ///
+    /// Levels exceeding the new budget are evicted by the next call to `update`.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMemoryBudget(std::size_t memoryBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the memory budget, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getMemoryBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the maximum number of bytes uploaded per update
+    ///
+    /// At least one level is uploaded per update if needed, even
+    /// if it is larger than the upload budget.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUploadBudget(std::size_t uploadBudget);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of bytes uploaded per update
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getUploadBudget() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the residency state of a streamed texture
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Residency getResidency(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the video memory used by all the resident levels, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getResidentByteCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of textures being streamed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getTextureCount() const;
+
+private:
+    struct Entry;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a live entry from its identifier
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Entry&       getEntry(Id id);
+    [[nodiscard]] const Entry& getEntry(Id id) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Evict the largest resident level of the least important texture
+    ///
+    /// \param evictNeededLevels Whether levels needed by the last requests may be evicted
+    ///
+    /// \return False if no level could be evicted
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool evictOneLevel(bool evictNeededLevels);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*  m_graphicsContext;     //!< Graphics context used to create the textures
+    std::size_t       m_memoryBudget;        //!< Maximum video memory used by the resident levels
+    std::size_t       m_uploadBudget;        //!< Maximum number of bytes uploaded per update
+    std::size_t       m_residentByteCount{}; //!< Video memory currently used by the resident levels
+    std::size_t       m_textureCount{};      //!< Number of live entries
+    std::uint64_t     m_frame{1u};           //!< Number of calls to `update`, plus one
+    std::deque<Entry> m_entries;             //!< Streamed textures, never moved once added
+    std::vector<Id>   m_freeIds;             //!< Identifiers of removed entries, available for reuse
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureStreamer
+/// \ingroup graphics
+///
+/// `sf::TextureStreamer` loads large textures at the resolution
+/// they are displayed at, rather than at full resolution. Each
+/// texture is backed by an `sf::MipChain` in system memory; only
+/// the levels between the one matching its size on screen and
+/// the smallest one are uploaded to the graphics card.
+///
+/// Textures are refined progressively, one level at a time and
+/// within a per-frame upload budget, so that zooming in never
+/// stalls a frame: the texture just looks blurry for a few
+/// frames. When the memory budget is exceeded, the largest
+/// levels of the textures that are hidden, or drawn smaller
+/// than before, are evicted first.
+///
+/// A streamed texture always has the size of its level 0, even
+/// when only smaller levels are resident: sampling reads from
+/// the largest resident level. Because level 0 may be missing,
+/// streamed textures cannot be copied or read back with
+/// `copyToImage`.
+///
+/// Usage example:
+/// \code
+/// sf::TextureStreamer streamer(graphicsContext, 256u * 1024u * 1024u); // 256 MiB
+///
+/// auto chain = sf::MipChain::create(sf::Image::loadFromFile("region.png").value()).value();
+/// const sf::TextureStreamer::Id id = streamer.add(std::move(chain)).value();
+///
+/// sf::Sprite sprite(streamer.getTexture(id).getRect());
+///
+/// while (window.isOpen())
+/// {
+///     // ... handle events, move the view ...
+///
+///     // Declare the visible textures and their size on screen
+///     streamer.request(id, sprite.getGlobalBounds().size);
+///     streamer.update();
+///
+///     window.draw(sprite, streamer.getTexture(id));
+///     window.display();
+/// }
+/// \endcode
+///
+/// \see sf::MipChain, sf::Texture
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,269 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/IndexBuffer.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+#include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class RenderTarget;
+class Texture;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Large grid of textured tiles, stored in graphics memory by chunks
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TileMap : public Transformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Tile value leaving its cell of the map empty
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::uint32_t emptyTile = 0xFF'FF'FF'FFu;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Dimensions of the map and of its tileset
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Settings
+    {
+        Vector2u     mapSize;        //!< Size of the map, in tiles
+        Vector2u     tileSize;       //!< Size of a tile, in pixels, both in the map and in the tileset
+        unsigned int tilesetColumns; //!< Number of tiles per row of the tileset texture
+        unsigned int chunkSize{32u}; //!< Width and height of a chunk, in tiles
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an empty tile map
+    ///
+    /// No graphics memory is allocated until chunks holding
+    /// tiles are drawn for the first time.
+    ///
+    /// \param graphicsContext Graphics context owning the vertex buffers
+    /// \param settings        Dimensions of the map and of its tileset
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TileMap(GraphicsContext& graphicsContext, const Settings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TileMap();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(const TileMap&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap& operator=(const TileMap&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap(TileMap&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TileMap& operator=(TileMap&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change a tile of the map
+    ///
+    /// Only the modified range of the chunk holding the tile is
+    /// uploaded again, on the next draw.
+    ///
+    /// \param position Position of the tile in the map, in tiles
+    /// \param tile     Index of the tile in the tileset, row by row, or `emptyTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTile(Vector2u position, std::uint32_t tile);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a tile of the map
+    ///
+    /// \param position Position of the tile in the map, in tiles
+    ///
+    /// \return Index of the tile in the tileset, or `emptyTile`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::uint32_t getTile(Vector2u position) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change all the tiles of the map at once
+    ///
+    /// \param tiles Array of `mapSize.x * mapSize.y` tiles, row by row
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTiles(const std::uint32_t* tiles);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the map, in tiles
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getMapSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of a tile, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getTileSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks along each axis of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of chunks drawn by the last call to `draw`
+    ///
+    /// Chunks outside of the view and chunks without any tile
+    /// are not drawn.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getDrawnChunkCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getLocalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the global (non-minimal) bounding rectangle of the map
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getGlobalBounds() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the chunks of the map overlapping the view of the target
+    ///
+    /// \param target  Render target to draw to
+    /// \param tileset Texture containing the tiles
+    /// \param states  Current render states
+    ///
+    ////////////////////////////////////////////////////////////
+    void draw(RenderTarget& target, const Texture& tileset, RenderStates states) const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Square block of tiles stored in a single vertex buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Chunk
+    {
+        VertexBuffer vertexBuffer; //!< Four vertices per tile of the chunk, row by row
+        Vector2u     origin;       //!< Position of the top-left tile of the chunk in the map
+        Vector2u     size;         //!< Size of the chunk, smaller on the right and bottom edges of the map
+        std::size_t  tileCount{};  //!< Number of non-empty tiles
+        std::size_t  dirtyBegin{}; //!< First tile of the chunk to upload again
+        std::size_t  dirtyEnd{};   //!< One past the last tile of the chunk to upload again
+        bool         uploaded{};   //!< Was the vertex buffer created?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the chunk holding a tile
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Chunk& getChunk(Vector2u position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create or update the vertex buffer of a chunk
+    ///
+    /// \return True if the vertex buffer is up to date
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool uploadChunk(Chunk& chunk) const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext*           m_graphicsContext; //!< Graphics context owning the vertex buffers
+    Settings                   m_settings;        //!< Dimensions of the map and of its tileset
+    Vector2u                   m_chunkCount;      //!< Number of chunks along each axis
+    std::vector<std::uint32_t> m_tiles;           //!< Tiles of the whole map, row by row
+    mutable std::vector<Chunk> m_chunks;          //!< Chunks of the map, row by row
+    mutable base::Optional<IndexBuffer> m_indexBuffer;       //!< Two triangles per tile, shared by all the chunks
+    mutable std::vector<VertexPacked>   m_vertices;          //!< Vertices of the range being uploaded, storage reused
+    mutable std::size_t                 m_drawnChunkCount{}; //!< Number of chunks drawn by the last call to `draw`
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TileMap
+/// \ingroup graphics
+///
+/// `sf::TileMap` draws maps too large to be rebuilt every frame,
+/// such as the levels of tile-based games. The map is split into
+/// square chunks, each stored in a static `sf::VertexBuffer`:
+///
+/// \li drawing the map only issues one draw call per chunk
+///     overlapping the view of the target, and uploads nothing
+///     unless tiles changed;
+/// \li changing a tile only uploads the modified range of its
+///     chunk, on the next draw;
+/// \li chunks are uploaded the first time they are drawn, and
+///     chunks without any tile never use graphics memory.
+///
+/// Tiles are identified by their index in the tileset texture,
+/// counted row by row, with `tilesetColumns` tiles per row.
+/// Vertices are stored as `sf::VertexPacked`, with positions
+/// relative to their chunk: a chunk must be at most 32767
+/// pixels wide, and the tileset at most 65535 pixels wide.
+///
+/// Usage example:
+/// \code
+/// const auto tileset = sf::Texture::loadFromFile(graphicsContext, "tileset.png").value();
+///
+/// sf::TileMap map(graphicsContext, {.mapSize{4096u, 4096u}, .tileSize{16u, 16u}, .tilesetColumns = 32u});
+/// map.setTiles(level.data());
+///
+/// // Later, only the chunk holding the tile is updated
+/// map.setTile({120u, 37u}, 5u);
+///
+/// window.setView(camera);
+/// map.draw(window, tileset, sf::RenderStates::Default);
+/// \endcode
+///
+/// \see sf::VertexBuffer, sf::VertexPacked
+///
+////////////////////////////////////////////////////////////
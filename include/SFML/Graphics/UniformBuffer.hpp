@@ -0,0 +1,245 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Buffer of uniform values shared by shader programs
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBuffer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Usage specifiers
+    ///
+    /// If data is going to be updated once or more every frame,
+    /// set the usage to Stream. If data is going to be set once
+    /// and used for a long time without being modified, set the
+    /// usage to Static. For everything else Dynamic should be a
+    /// good compromise.
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Usage
+    {
+        Stream,  //!< Constantly changing data
+        Dynamic, //!< Occasionally changing data
+        Static   //!< Rarely changing data
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the uniform buffer
+    ///
+    /// The contents of the buffer are undefined until `update`
+    /// is called.
+    ///
+    /// \param byteCount Size of the buffer, in bytes
+    /// \param usage     Usage specifier
+    ///
+    /// \return Uniform buffer if creation was successful, otherwise `base::nullOpt`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<UniformBuffer> create(GraphicsContext& graphicsContext,
+                                                              std::size_t      byteCount,
+                                                              Usage            usage = Usage::Dynamic);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBuffer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(const UniformBuffer&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBuffer& operator=(UniformBuffer&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a range of the buffer
+    ///
+    /// Only the given range is uploaded, the rest of the buffer
+    /// is left untouched. The data must follow the memory layout
+    /// of the uniform block it is read from, typically `std140`.
+    ///
+    /// \param data      Bytes to copy to the buffer
+    /// \param byteCount Number of bytes to copy
+    /// \param offset    Offset in the buffer to copy to, in bytes
+    ///
+    /// \return True if the update was successful, false if the range exceeds the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, std::size_t byteCount, std::size_t offset = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the whole buffer to a uniform block binding point
+    ///
+    /// All the uniform blocks associated to \a bindingPoint (see
+    /// `Shader::setUniformBlockBinding`) read from this buffer
+    /// until another buffer is bound to the same point.
+    ///
+    /// \param bindingPoint Index of the binding point
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind(unsigned int bindingPoint) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a range of the buffer to a uniform block binding point
+    ///
+    /// This allows to store the data of several blocks in a single
+    /// buffer. \a offset must be a multiple of `getOffsetAlignment`.
+    ///
+    /// \param bindingPoint Index of the binding point
+    /// \param offset       Offset of the range, in bytes
+    /// \param byteCount    Size of the range, in bytes
+    ///
+    /// \return True if the range was bound, false if it is misaligned or exceeds the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool bindRange(unsigned int bindingPoint, std::size_t offset, std::size_t byteCount) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the buffer, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getByteCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the usage specifier of the buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Usage getUsage() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the buffer
+    ///
+    /// \return OpenGL handle of the uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the alignment required for offsets passed to `bindRange`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::size_t getOffsetAlignment(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of uniform block binding points
+    ///
+    /// Binding point `Shader::ViewBlockBindingPoint` is used
+    /// by render targets, the others are free to use.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaximumBindingPoints(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Directly initialize data members
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit UniformBuffer(base::PassKey<UniformBuffer>&&,
+                                         GraphicsContext& graphicsContext,
+                                         unsigned int     buffer,
+                                         std::size_t      byteCount,
+                                         Usage            usage);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext; //!< The window context
+    unsigned int     m_buffer;          //!< Internal buffer identifier
+    std::size_t      m_byteCount;       //!< Size of the buffer, in bytes
+    Usage            m_usage;           //!< How this uniform buffer is to be used
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBuffer
+/// \ingroup graphics
+///
+/// `sf::UniformBuffer` stores uniform values in graphics memory,
+/// where they can be read by any number of shader programs
+/// through a uniform block. Instead of setting the same values
+/// on every program with `sf::Shader::setUniform`, they are
+/// uploaded once and shared.
+///
+/// A uniform block is connected to a buffer through a binding
+/// point: the block is associated to the point once per program
+/// with `sf::Shader::setUniformBlockBinding`, and the buffer is
+/// bound to the point with `bind` or `bindRange`.
+///
+/// Usage example:
+/// \code
+/// // GLSL:
+/// // layout(std140) uniform Lighting
+/// // {
+/// //     vec4 ambient;
+/// //     vec4 sunDirection;
+/// // };
+///
+/// struct Lighting
+/// {
+///     float ambient[4];
+///     float sunDirection[4];
+/// };
+///
+/// auto lightingBuffer = sf::UniformBuffer::create(graphicsContext, sizeof(Lighting)).value();
+///
+/// for (sf::Shader* shader : {&terrainShader, &waterShader})
+///     if (!shader->setUniformBlockBinding("Lighting", 1u))
+///         std::cerr << "Shader has no lighting block\n";
+///
+/// lightingBuffer.bind(1u);
+///
+/// // Once per frame, for all the shaders at once
+/// const Lighting lighting{{0.2f, 0.2f, 0.3f, 1.f}, {0.f, -1.f, 0.f, 0.f}};
+/// if (!lightingBuffer.update(&lighting, sizeof(lighting)))
+///     std::cerr << "Failed to update lighting\n";
+/// \endcode
+///
+/// \see sf::Shader
+///
+////////////////////////////////////////////////////////////
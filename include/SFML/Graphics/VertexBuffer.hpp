@@ -7,6 +7,7 @@
 #include "SFML/Graphics/Export.hpp"
 
 #include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
 
 #include <cstddef>
 
@@ -17,6 +18,8 @@ class GraphicsContext;
 class RenderTarget;
 struct RenderStates;
 struct Vertex;
+struct VertexCompact;
+struct VertexPacked;
 
 ////////////////////////////////////////////////////////////
 /// \brief Vertex buffer storage for one or more 2D primitives
@@ -107,12 +110,16 @@ public:
     /// as \p vertexCount. Don't forget to recreate with a non-zero
     /// value when graphics memory should be allocated again.
     ///
-    /// \param vertexCount Number of vertices worth of memory to allocate
+    /// The buffer can then only be updated with vertices of the
+    /// given format.
+    ///
+    /// \param vertexCount  Number of vertices worth of memory to allocate
+    /// \param vertexFormat Memory layout of the vertices
     ///
     /// \return True if creation was successful
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool create(std::size_t vertexCount);
+    [[nodiscard]] bool create(std::size_t vertexCount, VertexFormat vertexFormat = VertexFormat::Standard);
 
     ////////////////////////////////////////////////////////////
     /// \brief Return the vertex count
@@ -122,6 +129,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] std::size_t getVertexCount() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the memory layout of the vertices
+    ///
+    /// \return Vertex format passed to `create`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] VertexFormat getVertexFormat() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the whole buffer from an array of vertices
     ///
@@ -175,6 +190,26 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of compact vertices
+    ///
+    /// The buffer must have been created with `VertexFormat::Compact`.
+    ///
+    /// \see update(const Vertex*, std::size_t, unsigned int)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const VertexCompact* vertices, std::size_t vertexCount, unsigned int offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from an array of packed vertices
+    ///
+    /// The buffer must have been created with `VertexFormat::Packed`.
+    ///
+    /// \see update(const Vertex*, std::size_t, unsigned int)
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const VertexPacked* vertices, std::size_t vertexCount, unsigned int offset);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy the contents of another buffer into this buffer
     ///
@@ -308,6 +343,15 @@ public:
 private:
     friend RenderTarget;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the buffer from vertices of any format
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool updateData(const void*  vertexData,
+                                  std::size_t  vertexCount,
+                                  unsigned int offset,
+                                  VertexFormat vertexFormat);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
@@ -316,6 +360,7 @@ private:
     std::size_t      m_size{};                               //!< Size in Vertices of the currently allocated buffer
     PrimitiveType    m_primitiveType{PrimitiveType::Points}; //!< Type of primitives to draw
     Usage            m_usage{Usage::Stream};                 //!< How this vertex buffer is to be used
+    VertexFormat     m_vertexFormat{VertexFormat::Standard}; //!< Memory layout of the vertices
 };
 
 ////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Vertex with 16-bit texture coordinates
+///
+/// By default, the vertex color is white and texture coordinates are (0, 0).
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] VertexCompact
+{
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2f               position;            //!< 2D position of the vertex
+    Color                  color{Color::White}; //!< Color of the vertex
+    Vector2<std::uint16_t> texCoords{};         //!< Coordinates of the texture's pixel to map to the vertex
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::VertexCompact
+/// \ingroup graphics
+///
+/// `sf::VertexCompact` is a 16 bytes alternative to the 20 bytes
+/// `sf::Vertex`, for geometry whose texture coordinates are whole
+/// pixels, such as sprites cut from an atlas. Positions keep their
+/// full precision, so the vertices can be pre-transformed.
+///
+/// With `sf::CoordinateType::Pixels`, the texture coordinates are
+/// pixels of the texture. With `sf::CoordinateType::Normalized`,
+/// they are fixed-point fractions of the texture size, 65535
+/// mapping to 1.
+///
+/// Example:
+/// \code
+/// // A 32x32 sprite cut from the pixel (64, 0) of an atlas
+/// const sf::VertexCompact vertices[]{{{0.f, 0.f}, sf::Color::White, {64, 0}},
+///                                    {{32.f, 0.f}, sf::Color::White, {96, 0}},
+///                                    {{0.f, 32.f}, sf::Color::White, {64, 32}},
+///                                    {{32.f, 32.f}, sf::Color::White, {96, 32}}};
+///
+/// window.draw(vertices, 4, sf::PrimitiveType::TriangleStrip, sf::RenderStates(&atlas));
+/// \endcode
+///
+/// \see sf::Vertex, sf::VertexPacked, sf::VertexFormat
+///
+////////////////////////////////////////////////////////////
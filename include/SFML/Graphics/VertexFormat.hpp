@@ -0,0 +1,26 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \ingroup graphics
+/// \brief Memory layouts of the vertices uploaded to the graphics card
+///
+/// The compact layouts trade precision for bandwidth: they are
+/// meant for large batches of pixel-aligned geometry, such as
+/// sprites and tile maps, whose upload dominates the frame time.
+/// The graphics card converts their attributes to floating
+/// point, so they are drawn by the same shaders as `sf::Vertex`.
+///
+/// \see sf::Vertex, sf::VertexCompact, sf::VertexPacked, sf::VertexBuffer::create
+///
+////////////////////////////////////////////////////////////
+enum class [[nodiscard]] VertexFormat : unsigned char
+{
+    Standard, //!< `sf::Vertex`: float position and texture coordinates, 20 bytes per vertex
+    Compact,  //!< `sf::VertexCompact`: float position, 16-bit texture coordinates, 16 bytes per vertex
+    Packed    //!< `sf::VertexPacked`: 16-bit position and texture coordinates, 12 bytes per vertex
+};
+
+} // namespace sf
@@ -0,0 +1,60 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Vertex with 16-bit position and texture coordinates
+///
+/// By default, the vertex color is white and texture coordinates are (0, 0).
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] VertexPacked
+{
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Vector2<std::int16_t>  position;            //!< 2D position of the vertex, in whole units
+    Color                  color{Color::White}; //!< Color of the vertex
+    Vector2<std::uint16_t> texCoords{};         //!< Coordinates of the texture's pixel to map to the vertex
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \struct sf::VertexPacked
+/// \ingroup graphics
+///
+/// `sf::VertexPacked` is a 12 bytes alternative to the 20 bytes
+/// `sf::Vertex`, for geometry laid out on a grid of whole units,
+/// such as tile maps and pixel art, whose positions fit in the
+/// [-32768, 32767] range. Scaling, rotation and subpixel offsets
+/// are still available through the transform of the render states.
+///
+/// Texture coordinates follow the same rules as `sf::VertexCompact`.
+///
+/// Example:
+/// \code
+/// // A 16x16 tile at the grid cell (3, 5), cut from the pixel (32, 16) of a tileset
+/// const sf::VertexPacked vertices[]{{{48, 80}, sf::Color::White, {32, 16}},
+///                                   {{64, 80}, sf::Color::White, {48, 16}},
+///                                   {{48, 96}, sf::Color::White, {32, 32}},
+///                                   {{64, 96}, sf::Color::White, {48, 32}}};
+///
+/// window.draw(vertices, 4, sf::PrimitiveType::TriangleStrip, sf::RenderStates(&tileset));
+/// \endcode
+///
+/// \see sf::Vertex, sf::VertexCompact, sf::VertexFormat
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Export.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Precise frame limiter, measuring the time between frames
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API FramePacer
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Frame times measured over the last frames
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] Statistics
+    {
+        Time        minimum;      //!< Shortest frame time
+        Time        average;      //!< Average frame time
+        Time        percentile99; //!< Frame time exceeded by 1% of the frames
+        Time        maximum;      //!< Longest frame time
+        std::size_t frameCount{}; //!< Number of frames measured, at most `sampleCapacity`
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of frames kept to compute the statistics
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t sampleCapacity = 256u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The frame rate is not limited by default.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FramePacer();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the duration of a frame
+    ///
+    /// The deadlines of the next frames are scheduled from the
+    /// next call to `waitForNextFrame`.
+    ///
+    /// \param frameTime Time between two frames, `Time::Zero` to disable the limit
+    ///
+    ////////////////////////////////////////////////////////////
+    void setTargetFrameTime(Time frameTime);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the duration of a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getTargetFrameTime() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time spent spinning before each deadline
+    ///
+    /// The thread sleeps until this duration before the
+    /// deadline, then yields in a loop until the deadline.
+    /// Longer durations absorb more of the wakeup latency of
+    /// the operating system, at the cost of CPU time.
+    ///
+    /// \param duration Spinning duration, 1 millisecond by default
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSpinDuration(Time duration);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time spent spinning before each deadline
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getSpinDuration() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for the deadline of the current frame, and record its duration
+    ///
+    /// Deadlines are spaced by exactly the target frame time,
+    /// so that the error of a wait does not delay the following
+    /// frames. If the application falls behind by more than a
+    /// frame, the schedule restarts from the current time
+    /// rather than rushing through the missed frames.
+    ///
+    /// Without a target frame time, only records the duration
+    /// of the frame.
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitForNextFrame();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frame times measured over the last `sampleCapacity` frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Statistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Discard the measured frame times
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Time              m_targetFrameTime;               //!< Time between two deadlines, zero if not limited
+    Time              m_spinDuration{milliseconds(1)}; //!< Time spent spinning before each deadline
+    Time              m_nextDeadline;                  //!< Deadline of the current frame, in monotonic time
+    Time              m_lastFrameEnd;                  //!< End of the last frame, in monotonic time
+    bool              m_scheduled{};                   //!< Is `m_nextDeadline` valid?
+    bool              m_started{};                     //!< Is `m_lastFrameEnd` valid?
+    Time              m_samples[sampleCapacity]{};     //!< Ring buffer of the last frame times
+    std::size_t       m_sampleCount{};                 //!< Number of valid samples in `m_samples`
+    std::size_t       m_nextSample{};                  //!< Index of the next sample to overwrite
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FramePacer
+/// \ingroup system
+///
+/// Limiting the frame rate with `sf::sleep` makes each frame
+/// last the requested time plus the wakeup latency of the
+/// operating system, which varies from frame to frame. At high
+/// refresh rates, this shows up as frame time spikes, and the
+/// average frame rate ends up lower than requested.
+///
+/// `sf::FramePacer` schedules the frames against fixed
+/// deadlines, sleeps until shortly before each deadline then
+/// yields in a loop until the deadline itself. On Linux and
+/// BSDs, the sleep targets an absolute time of the monotonic
+/// clock, so that time spent before sleeping is not added to
+/// the sleep.
+///
+/// The pacer also records the time between consecutive calls
+/// to `waitForNextFrame`, and summarizes the last frames in
+/// `getStatistics`.
+///
+/// `sf::Window` uses a frame pacer to implement
+/// `setFramerateLimit`, and exposes its statistics through
+/// `getFrameTimeStatistics`.
+///
+/// Usage example:
+/// \code
+/// sf::FramePacer pacer;
+/// pacer.setTargetFrameTime(sf::seconds(1.f / 144.f));
+///
+/// while (running)
+/// {
+///     update();
+///     render();
+///     pacer.waitForNextFrame();
+/// }
+///
+/// const sf::FramePacer::Statistics stats = pacer.getStatistics();
+/// std::cout << "p99: " << stats.percentile99.asMicroseconds() << "us\n";
+/// \endcode
+///
+/// \see sf::sleep, sf::Window::setFramerateLimit
+///
+////////////////////////////////////////////////////////////
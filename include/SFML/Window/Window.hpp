@@ -8,6 +8,8 @@
 #include "SFML/Window/WindowBase.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 
+#include "SFML/System/FramePacer.hpp"
+
 #include "SFML/Base/InPlacePImpl.hpp"
 
 
@@ -111,20 +113,31 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Limit the framerate to a maximum fixed frequency
     ///
-    /// If a limit is set, the window will use a small delay after
-    /// each call to display() to ensure that the current frame
-    /// lasted long enough to match the framerate limit.
-    /// SFML will try to match the given limit as much as it can,
-    /// but since it internally uses sf::sleep, whose precision
-    /// depends on the underlying OS, the results may be a little
-    /// imprecise as well (for example, you can get 65 FPS when
-    /// requesting 60).
+    /// If a limit is set, the window will wait after each call to
+    /// display() until the deadline of the current frame. The
+    /// deadlines are spaced by exactly the frame time, and the
+    /// end of each wait spins instead of sleeping, so that the
+    /// imprecision of the OS sleep does not accumulate over the
+    /// frames.
     ///
     /// \param limit Framerate limit, in frames per seconds (use 0 to disable limit)
     ///
+    /// \see sf::FramePacer
+    ///
     ////////////////////////////////////////////////////////////
     void setFramerateLimit(unsigned int limit);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the times between the last calls to `display`
+    ///
+    /// The frame times are measured whether the framerate is
+    /// limited or not.
+    ///
+    /// \return Minimum, average, 99th percentile and maximum frame times of the last frames
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FramePacer::Statistics getFrameTimeStatistics() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the window as the current target
     ///        for OpenGL rendering
@@ -153,6 +166,25 @@ public:
     ////////////////////////////////////////////////////////////
     void display();
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function called by `display` before presenting a frame
+    ///
+    ////////////////////////////////////////////////////////////
+    using DisplayHook = void (*)(Window& window);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the function called by `display` before presenting a frame
+    ///
+    /// The hook is called with the window active, and lets
+    /// derived classes finish the rendering of a frame without
+    /// making `Window` polymorphic.
+    ///
+    /// \param hook Function to call, `nullptr` to call none
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDisplayHook(DisplayHook hook);
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Construct a window and a GL context, and a window base
@@ -170,7 +202,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 128> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 64 + sizeof(FramePacer)> m_impl; //!< Implementation details, mostly the frame time samples
 };
 
 } // namespace sf
@@ -17,6 +17,7 @@
 namespace sf::priv
 {
 class GlContext;
+class GLStateCache;
 class WindowImpl;
 } // namespace sf::priv
 
@@ -36,6 +37,16 @@ namespace sf
 class [[nodiscard]] WindowContext
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of GL state changes forwarded and skipped by the state cache of a context
+    ///
+    ////////////////////////////////////////////////////////////
+    struct [[nodiscard]] GLStateCacheStatistics
+    {
+        std::uint64_t issuedCalls{};  //!< State changes forwarded to OpenGL
+        std::uint64_t skippedCalls{}; //!< Redundant state changes filtered out
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -100,6 +111,37 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool hasActiveThreadLocalOrSharedGlContext() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the state cache of the active context
+    ///
+    /// All the GL state changes made by SFML go through the
+    /// state cache of the context they apply to, so that
+    /// redundant changes are filtered out in one place.
+    ///
+    /// A context must be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] priv::GLStateCache& getActiveGLStateCache() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of state changes forwarded and skipped in the active context
+    ///
+    /// The counters start when the context is created, or when
+    /// `resetGLStateCacheStatistics` was last called.
+    ///
+    /// A context must be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] GLStateCacheStatistics getGLStateCacheStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the counters of forwarded and skipped state changes of the active context
+    ///
+    /// A context must be active.
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetGLStateCacheStatistics();
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -29,6 +29,7 @@ const BlendMode BlendMultiply(BlendMode::Factor::DstColor, BlendMode::Factor::Ze
 const BlendMode BlendMin(BlendMode::Factor::One, BlendMode::Factor::One, BlendMode::Equation::Min);
 const BlendMode BlendMax(BlendMode::Factor::One, BlendMode::Factor::One, BlendMode::Equation::Max);
 const BlendMode BlendNone(BlendMode::Factor::One, BlendMode::Factor::Zero, BlendMode::Equation::Add);
+const BlendMode BlendPremultipliedAlpha(BlendMode::Factor::One, BlendMode::Factor::OneMinusSrcAlpha, BlendMode::Equation::Add);
 
 
 ////////////////////////////////////////////////////////////
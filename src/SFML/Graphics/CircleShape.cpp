@@ -4,11 +4,13 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/CircleShape.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Vertex.hpp"
 
 #include "SFML/System/Angle.hpp"
 #include "SFML/System/Vector2.hpp"
 
-#include <vector>
+#include <cstddef>
 
 
 namespace
@@ -22,6 +24,14 @@ sf::Vector2f computeCirclePoint(std::size_t index, std::size_t pointCount, float
     return sf::Vector2f{radius, radius}.movedTowards(radius, angle);
 }
 
+
+////////////////////////////////////////////////////////////
+sf::Vector2f scaleUnitCirclePoint(sf::Vector2f unitPoint, float radius)
+{
+    // Matches `computeCirclePoint` exactly, `fromAngle` multiplies the radius by the cosine and sine the same way
+    return sf::Vector2f{radius, radius} + unitPoint * radius;
+}
+
 } // namespace
 
 
@@ -30,13 +40,23 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct CircleShape::Impl
 {
-    float                 radius; //!< Radius of the circle
-    std::vector<Vector2f> points; //!< Points composing the circle
+    float            radius;          //!< Radius of the circle
+    std::size_t      pointCount;      //!< Number of points composing the circle
+    GraphicsContext* graphicsContext; //!< Provider of the unit-circle tables, if any
+    const Vector2f*  unitCircle;      //!< Unit-circle table of the current point count, if any
 };
 
 
 ////////////////////////////////////////////////////////////
-CircleShape::CircleShape(float radius, std::size_t pointCount) : m_impl(radius, std::vector<Vector2f>{})
+CircleShape::CircleShape(float radius, std::size_t pointCount) : m_impl(radius, pointCount, nullptr, nullptr)
+{
+    update(radius, pointCount);
+}
+
+
+////////////////////////////////////////////////////////////
+CircleShape::CircleShape(GraphicsContext& graphicsContext, float radius, std::size_t pointCount) :
+m_impl(radius, pointCount, &graphicsContext, nullptr)
 {
     update(radius, pointCount);
 }
@@ -66,7 +86,7 @@ CircleShape& CircleShape::operator=(CircleShape&&) noexcept = default;
 void CircleShape::setRadius(float radius)
 {
     m_impl->radius = radius;
-    update(radius, m_impl->points.size());
+    update(radius, m_impl->pointCount);
 }
 
 
@@ -86,14 +106,17 @@ void CircleShape::setPointCount(std::size_t count)
 ////////////////////////////////////////////////////////////
 std::size_t CircleShape::getPointCount() const
 {
-    return m_impl->points.size();
+    return m_impl->pointCount;
 }
 
 
 ////////////////////////////////////////////////////////////
 Vector2f CircleShape::getPoint(std::size_t index) const
 {
-    return m_impl->points[index];
+    if (m_impl->unitCircle != nullptr)
+        return scaleUnitCirclePoint(m_impl->unitCircle[index], m_impl->radius);
+
+    return computeCirclePoint(index, m_impl->pointCount, m_impl->radius);
 }
 
 
@@ -107,12 +130,30 @@ Vector2f CircleShape::getGeometricCenter() const
 ////////////////////////////////////////////////////////////
 void CircleShape::update(float radius, std::size_t pointCount)
 {
-    m_impl->points.resize(pointCount);
-
-    for (std::size_t i = 0; i < pointCount; ++i)
-        m_impl->points[i] = computeCirclePoint(i, pointCount, radius);
-
-    Shape::update(m_impl->points.data(), m_impl->points.size());
+    // The table only needs to be looked up when the point count changes
+    if (m_impl->graphicsContext != nullptr && (m_impl->unitCircle == nullptr || pointCount != m_impl->pointCount))
+        m_impl->unitCircle = m_impl->graphicsContext->getUnitCircleTable(pointCount);
+
+    m_impl->pointCount = pointCount;
+
+    // Write the points straight into the shape's vertices, without intermediate storage
+    Vertex* const vertices = beginUpdate(pointCount);
+
+    if (vertices == nullptr)
+        return;
+
+    if (m_impl->unitCircle != nullptr)
+    {
+        for (std::size_t i = 0; i < pointCount; ++i)
+            vertices[i].position = scaleUnitCirclePoint(m_impl->unitCircle[i], radius);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < pointCount; ++i)
+            vertices[i].position = computeCirclePoint(i, pointCount, radius);
+    }
+
+    finishUpdate();
 }
 
 } // namespace sf
@@ -91,7 +91,7 @@ struct Font::Page
 
     using GlyphTable = std::unordered_map<std::uint64_t, Glyph>; //!< Table mapping a codepoint to its glyph
 
-    [[nodiscard]] static base::Optional<Page> create(GraphicsContext& graphicsContext, bool smooth);
+    [[nodiscard]] static base::Optional<Page> create(GraphicsContext& graphicsContext, bool smooth, bool premultipliedAlpha);
     explicit Page(Texture&& texture);
 
     GlyphTable       glyphs;     //!< Table mapping code points to their corresponding glyph
@@ -145,11 +145,12 @@ struct Font::Impl
 
     using PageTable = std::unordered_map<unsigned int, Page>; //!< Table mapping a character size to its page (texture)
 
-    GraphicsContext*             graphicsContext; //!< The window context
-    std::shared_ptr<FontHandles> fontHandles;     //!< Shared information about the internal font instance
-    bool                         isSmooth{true};  //!< Status of the smooth filter
-    FontInfo                     info;            //!< Information about the font
-    mutable PageTable            pages;           //!< Table containing the glyphs pages by character size
+    GraphicsContext*             graphicsContext;        //!< The window context
+    std::shared_ptr<FontHandles> fontHandles;            //!< Shared information about the internal font instance
+    bool                         isSmooth{true};         //!< Status of the smooth filter
+    bool                         isAlphaPremultiplied{}; //!< Are the glyph pages stored with premultiplied alpha?
+    FontInfo                     info;                   //!< Information about the font
+    mutable PageTable            pages;                  //!< Table containing the glyphs pages by character size
     mutable std::vector<std::uint8_t> pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
 #ifdef SFML_SYSTEM_ANDROID
     base::UniquePtr<priv::ResourceStream> m_stream; //!< Asset file streamer (if loaded from file)
@@ -516,13 +517,33 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setAlphaPremultiplied(bool premultiplied)
+{
+    if (premultiplied != m_impl->isAlphaPremultiplied)
+    {
+        m_impl->isAlphaPremultiplied = premultiplied;
+
+        // Glyphs have to be rasterized again in the new format
+        m_impl->pages.clear();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isAlphaPremultiplied() const
+{
+    return m_impl->isAlphaPremultiplied;
+}
+
+
 ////////////////////////////////////////////////////////////
 Font::Page& Font::loadPage(GraphicsContext& graphicsContext, unsigned int characterSize) const
 {
     if (const auto it = m_impl->pages.find(characterSize); it != m_impl->pages.end())
         return it->second;
 
-    auto page = Page::create(graphicsContext, m_impl->isSmooth);
+    auto page = Page::create(graphicsContext, m_impl->isSmooth, m_impl->isAlphaPremultiplied);
     SFML_BASE_ASSERT(page.hasValue() && "Font::loadPage() Failed to load page");
 
     return m_impl->pages.emplace(characterSize, SFML_BASE_MOVE(*page)).first->second;
@@ -631,19 +652,34 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
         glyph.bounds.size     = Vector2u(bitmap.width, bitmap.rows).to<Vector2f>();
 
         // Resize the pixel buffer to the new size and fill it with transparent white pixels
+        // (or transparent black pixels, their premultiplied equivalent)
         m_impl->pixelBuffer.resize(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
 
         std::uint8_t* current = m_impl->pixelBuffer.data();
         std::uint8_t* end     = current + size.x * size.y * 4;
 
+        const bool         premultiplied = m_impl->isAlphaPremultiplied;
+        const std::uint8_t colorValue    = premultiplied ? 0 : 255;
+
         while (current != end)
         {
-            (*current++) = 255;
-            (*current++) = 255;
-            (*current++) = 255;
+            (*current++) = colorValue;
+            (*current++) = colorValue;
+            (*current++) = colorValue;
             (*current++) = 0;
         }
 
+        // Write the coverage of a pixel, to all channels if premultiplied
+        const auto writeCoverage = [&](std::size_t index, std::uint8_t coverage)
+        {
+            std::uint8_t* pixel = m_impl->pixelBuffer.data() + index * 4;
+
+            if (premultiplied)
+                pixel[0] = pixel[1] = pixel[2] = coverage;
+
+            pixel[3] = coverage;
+        };
+
         // Extract the glyph's pixels from the bitmap
         const std::uint8_t* pixels = bitmap.buffer;
         if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
@@ -653,11 +689,11 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
             {
                 for (unsigned int x = padding; x < size.x - padding; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
+                    // Only the coverage of the pixel varies
                     const std::size_t index = x + y * size.x;
-                    m_impl->pixelBuffer[index * 4 + 3] = ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8))))
-                                                             ? 255
-                                                             : 0;
+                    writeCoverage(index,
+                                  ((pixels[(x - padding) / 8]) & (1 << (7 - ((x - padding) % 8)))) ? std::uint8_t{255}
+                                                                                                   : std::uint8_t{0});
                 }
                 pixels += bitmap.pitch;
             }
@@ -669,9 +705,9 @@ Glyph Font::loadGlyph(std::uint32_t codePoint, unsigned int characterSize, bool
             {
                 for (unsigned int x = padding; x < size.x - padding; ++x)
                 {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index            = x + y * size.x;
-                    m_impl->pixelBuffer[index * 4 + 3] = pixels[x - padding];
+                    // Only the coverage of the pixel varies
+                    const std::size_t index = x + y * size.x;
+                    writeCoverage(index, pixels[x - padding]);
                 }
                 pixels += bitmap.pitch;
             }
@@ -740,6 +776,7 @@ IntRect Font::findGlyphRect(GraphicsContext& graphicsContext, Page& page, Vector
                 }
 
                 newTexture->setSmooth(m_impl->isSmooth);
+                newTexture->setAlphaPremultiplied(m_impl->isAlphaPremultiplied);
                 newTexture->update(page.texture);
                 page.texture.swap(*newTexture);
             }
@@ -812,7 +849,7 @@ bool Font::setCurrentSize(unsigned int characterSize) const
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Font::Page> Font::Page::create(GraphicsContext& graphicsContext, bool smooth)
+base::Optional<Font::Page> Font::Page::create(GraphicsContext& graphicsContext, bool smooth, bool premultipliedAlpha)
 {
     // Make sure that the texture is initialized by default
     auto image = *Image::create({128, 128}, Color::Transparent);
@@ -831,6 +868,7 @@ base::Optional<Font::Page> Font::Page::create(GraphicsContext& graphicsContext,
     }
 
     texture->setSmooth(smooth);
+    texture->setAlphaPremultiplied(premultipliedAlpha);
     return base::makeOptional<Page>(SFML_BASE_MOVE(*texture));
 }
 
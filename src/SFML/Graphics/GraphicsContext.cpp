@@ -5,6 +5,7 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderTexturePool.hpp"
 #include "SFML/Graphics/Shader.hpp"
 #include "SFML/Graphics/Texture.hpp"
 
@@ -15,9 +16,16 @@
 #include "SFML/System/Err.hpp"
 #endif
 
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Vector2.hpp"
+
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
 
+#include <vector>
+
+#include <cstddef>
 #include <cstdlib>
 
 
@@ -50,6 +58,38 @@ void main()
 )glsl";
 
 
+////////////////////////////////////////////////////////////
+constexpr const char* builtInViewBlockShaderVertexSrc = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+layout(std140) uniform sf_u_ViewBlock
+{
+    mat4 sf_u_viewProjectionMatrix;
+};
+
+uniform mat4 sf_u_modelMatrix;
+uniform mat4 sf_u_textureMatrix;
+
+in vec2 sf_a_position;
+in vec4 sf_a_color;
+in vec2 sf_a_texCoord;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+
+void main()
+{
+    gl_Position = sf_u_viewProjectionMatrix * (sf_u_modelMatrix * vec4(sf_a_position, 0.0, 1.0));
+    sf_v_color = sf_a_color;
+    sf_v_texCoord = (sf_u_textureMatrix * vec4(sf_a_texCoord, 0.0, 1.0)).xy;
+}
+
+)glsl";
+
+
 ////////////////////////////////////////////////////////////
 constexpr const char* builtInShaderFragmentSrc = R"glsl(#version 300 es
 
@@ -84,6 +124,17 @@ void main()
     return shader;
 }
 
+
+////////////////////////////////////////////////////////////
+/// \brief Points of a regular polygon inscribed in the unit circle
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] UnitCircleTable
+{
+    std::size_t               pointCount; //!< Number of points of the polygon
+    std::vector<sf::Vector2f> points;     //!< Points, starting at the top
+};
+
 } // namespace
 
 
@@ -93,7 +144,13 @@ namespace sf
 struct GraphicsContext::Impl
 {
     base::Optional<Shader>  builtInShader;
+    base::Optional<Shader>  builtInViewBlockShader;
     base::Optional<Texture> builtInWhiteDotTexture;
+    ShaderCache*            shaderCache{};
+
+    std::vector<UnitCircleTable> unitCircleTables; //!< Sorted by point count, the points never move once computed
+
+    base::Optional<RenderTexturePool> renderTexturePool; //!< Created on first use, destroyed first
 };
 
 
@@ -115,6 +172,8 @@ GraphicsContext::GraphicsContext()
 #endif
 
     m_impl->builtInShader.emplace(createBuiltInShader(*this, builtInShaderVertexSrc, builtInShaderFragmentSrc));
+    m_impl->builtInViewBlockShader.emplace(
+        createBuiltInShader(*this, builtInViewBlockShaderVertexSrc, builtInShaderFragmentSrc));
     m_impl->builtInWhiteDotTexture = Texture::loadFromImage(*this, *Image::create({1u, 1u}, Color::White));
 }
 
@@ -135,6 +194,13 @@ GraphicsContext::~GraphicsContext()
 }
 
 
+////////////////////////////////////////////////////////////
+[[nodiscard]] Shader& GraphicsContext::getBuiltInViewBlockShader()
+{
+    return *m_impl->builtInViewBlockShader;
+}
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard]] Texture& GraphicsContext::getBuiltInWhiteDotTexture()
 {
@@ -142,6 +208,74 @@ GraphicsContext::~GraphicsContext()
 }
 
 
+////////////////////////////////////////////////////////////
+void GraphicsContext::setShaderCache(ShaderCache* shaderCache)
+{
+    m_impl->shaderCache = shaderCache;
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCache* GraphicsContext::getShaderCache() const
+{
+    return m_impl->shaderCache;
+}
+
+
+////////////////////////////////////////////////////////////
+const Vector2f* GraphicsContext::getUnitCircleTable(std::size_t pointCount)
+{
+    if (pointCount == 0u)
+        return nullptr;
+
+    std::vector<UnitCircleTable>& tables = m_impl->unitCircleTables;
+
+    // Binary search for the first table with at least `pointCount` points
+    std::size_t first = 0u;
+    std::size_t count = tables.size();
+
+    while (count > 0u)
+    {
+        const std::size_t half = count / 2u;
+
+        if (tables[first + half].pointCount < pointCount)
+        {
+            first += half + 1u;
+            count -= half + 1u;
+        }
+        else
+            count = half;
+    }
+
+    if (first < tables.size() && tables[first].pointCount == pointCount)
+        return tables[first].points.data();
+
+    // Same formula as the trigonometric path of `sf::CircleShape`, so that both produce identical points
+    std::vector<Vector2f> points(pointCount);
+
+    for (std::size_t i = 0u; i < pointCount; ++i)
+    {
+        const Angle angle = static_cast<float>(i) / static_cast<float>(pointCount) * degrees(360.f) - degrees(90.f);
+        points[i]         = Vector2f::fromAngle(1.f, angle);
+    }
+
+    // Moving the vector into the table list keeps its buffer, and with it the pointers handed out before
+    const auto it = tables.insert(tables.begin() + static_cast<std::ptrdiff_t>(first),
+                                  {pointCount, SFML_BASE_MOVE(points)});
+    return it->points.data();
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool& GraphicsContext::getRenderTexturePool()
+{
+    if (!m_impl->renderTexturePool.hasValue())
+        m_impl->renderTexturePool.emplace(*this);
+
+    return *m_impl->renderTexturePool;
+}
+
+
 ////////////////////////////////////////////////////////////
 const char* GraphicsContext::getBuiltInShaderVertexSrc() const
 {
@@ -149,6 +283,13 @@ const char* GraphicsContext::getBuiltInShaderVertexSrc() const
 }
 
 
+////////////////////////////////////////////////////////////
+const char* GraphicsContext::getBuiltInViewBlockShaderVertexSrc() const
+{
+    return builtInViewBlockShaderVertexSrc;
+}
+
+
 ////////////////////////////////////////////////////////////
 const char* GraphicsContext::getBuiltInShaderFragmentSrc() const
 {
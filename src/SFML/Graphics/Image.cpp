@@ -4,6 +4,9 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImagePixelOps.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+#include "SFML/Graphics/ImageView.hpp"
 
 #include "SFML/System/Err.hpp"
 #include "SFML/System/InputStream.hpp"
@@ -13,6 +16,7 @@
 
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 #include "SFML/Base/UniquePtr.hpp"
@@ -64,6 +68,36 @@ struct StbDeleter
     }
 };
 using StbPtr = sf::base::UniquePtr<stbi_uc, StbDeleter>;
+
+// Composite premultiplied `src` over premultiplied `dst`, for images with premultiplied alpha
+void blendOverPremultiplied(std::uint8_t* dst, const std::uint8_t* src, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i, src += 4, dst += 4)
+    {
+        const unsigned int inverseSrcAlpha = 255u - src[3];
+
+        for (int k = 0; k < 4; ++k)
+        {
+            const int value = src[k] + sf::priv::mulDiv255(dst[k], inverseSrcAlpha);
+            dst[k]          = static_cast<std::uint8_t>(sf::base::min(value, 255));
+        }
+    }
+}
+
+// Optionally convert a freshly decoded image to premultiplied alpha
+[[nodiscard]] sf::base::Optional<sf::Image> finalizeLoadedImage(sf::base::Optional<sf::Image>&& image, bool premultiplyAlpha)
+{
+    if (premultiplyAlpha)
+        image->premultiplyAlpha();
+
+    return SFML_BASE_MOVE(image);
+}
+
+// Split `sourceSize` into `targetSize` contiguous spans, returning the first index of span `index`
+[[nodiscard]] std::size_t spanStart(std::size_t index, std::size_t sourceSize, std::size_t targetSize)
+{
+    return index * sourceSize / targetSize;
+}
 } // namespace
 
 
@@ -72,8 +106,9 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct [[nodiscard]] Image::Impl
 {
-    Vector2u                  size;   //!< Image size
-    std::vector<std::uint8_t> pixels; //!< Pixels of the image
+    Vector2u                  size;                 //!< Image size
+    std::vector<std::uint8_t> pixels;               //!< Pixels of the image
+    bool                      premultipliedAlpha{}; //!< Are the color components multiplied by alpha?
 
     template <typename... VectorArgs>
     [[nodiscard]] explicit Impl(Vector2u theSize, VectorArgs&&... vectorArgs) :
@@ -152,6 +187,32 @@ base::Optional<Image> Image::create(Vector2u size, const std::uint8_t* pixels)
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<Image> Image::create(ImageView view)
+{
+    base::Optional<Image> result; // Use a single local variable for NRVO
+
+    if (view.size.x == 0 || view.size.y == 0)
+    {
+        priv::err() << "Failed to create image, invalid size (zero) provided";
+        return result; // Empty optional
+    }
+
+    if (view.pixels == nullptr)
+    {
+        priv::err() << "Failed to create image, null pixels pointer provided";
+        return result; // Empty optional
+    }
+
+    result.emplace(base::PassKey<Image>{}, view.size, static_cast<std::size_t>(view.size.x) * static_cast<std::size_t>(view.size.y) * 4);
+
+    [[maybe_unused]] const bool copied = result->copy(view, {0u, 0u});
+    SFML_BASE_ASSERT(copied);
+
+    return result;
+}
+
+
 ////////////////////////////////////////////////////////////
 template <typename... VectorArgs>
 Image::Image(base::PassKey<Image>&&, Vector2u size, VectorArgs&&... vectorArgs) :
@@ -164,14 +225,14 @@ m_impl(size, static_cast<VectorArgs&&>(vectorArgs)...)
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Image> Image::loadFromFile(const Path& filename)
+base::Optional<Image> Image::loadFromFile(const Path& filename, bool premultiplyAlpha)
 {
 #ifdef SFML_SYSTEM_ANDROID
 
     if (priv::getActivityStatesPtr() != nullptr)
     {
         priv::ResourceStream stream(filename);
-        return loadFromStream(stream);
+        return loadFromStream(stream, premultiplyAlpha);
     }
 
 #endif
@@ -187,10 +248,11 @@ base::Optional<Image> Image::loadFromFile(const Path& filename)
         SFML_BASE_ASSERT(width > 0 && "Loaded image from file with width == 0");
         SFML_BASE_ASSERT(height > 0 && "Loaded image from file with height == 0");
 
-        return base::makeOptional<Image>(base::PassKey<Image>{},
-                                         Vector2i{width, height}.to<Vector2u>(),
-                                         ptr.get(),
-                                         ptr.get() + width * height * 4);
+        return finalizeLoadedImage(base::makeOptional<Image>(base::PassKey<Image>{},
+                                                             Vector2i{width, height}.to<Vector2u>(),
+                                                             ptr.get(),
+                                                             ptr.get() + width * height * 4),
+                                   premultiplyAlpha);
     }
 
     // Error, failed to load the image
@@ -202,7 +264,7 @@ base::Optional<Image> Image::loadFromFile(const Path& filename)
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
+base::Optional<Image> Image::loadFromMemory(const void* data, std::size_t size, bool premultiplyAlpha)
 {
     // Check input parameters
     if (data == nullptr || size == 0)
@@ -228,15 +290,16 @@ base::Optional<Image> Image::loadFromMemory(const void* data, std::size_t size)
     SFML_BASE_ASSERT(width > 0 && "Loaded image from memory with width == 0");
     SFML_BASE_ASSERT(height > 0 && "Loaded image from memory with height == 0");
 
-    return base::makeOptional<Image>(base::PassKey<Image>{},
-                                     Vector2i{width, height}.to<Vector2u>(),
-                                     ptr.get(),
-                                     ptr.get() + width * height * 4);
+    return finalizeLoadedImage(base::makeOptional<Image>(base::PassKey<Image>{},
+                                                         Vector2i{width, height}.to<Vector2u>(),
+                                                         ptr.get(),
+                                                         ptr.get() + width * height * 4),
+                               premultiplyAlpha);
 }
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Image> Image::loadFromStream(InputStream& stream)
+base::Optional<Image> Image::loadFromStream(InputStream& stream, bool premultiplyAlpha)
 {
     // Make sure that the stream's reading position is at the beginning
     if (!stream.seek(0).hasValue())
@@ -267,10 +330,11 @@ base::Optional<Image> Image::loadFromStream(InputStream& stream)
     SFML_BASE_ASSERT(width > 0 && "Loaded image from stream with width == 0");
     SFML_BASE_ASSERT(height > 0 && "Loaded image from stream with height == 0");
 
-    return base::makeOptional<Image>(base::PassKey<Image>{},
-                                     Vector2i{width, height}.to<Vector2u>(),
-                                     ptr.get(),
-                                     ptr.get() + width * height * 4);
+    return finalizeLoadedImage(base::makeOptional<Image>(base::PassKey<Image>{},
+                                                         Vector2i{width, height}.to<Vector2u>(),
+                                                         ptr.get(),
+                                                         ptr.get() + width * height * 4),
+                               premultiplyAlpha);
 }
 
 
@@ -286,25 +350,39 @@ void Image::createMaskFromColor(Color color, std::uint8_t alpha)
 {
     // Make sure that the image is not empty
     SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    SFML_BASE_ASSERT(!m_impl->premultipliedAlpha && "Image::createMaskFromColor() requires straight alpha");
 
     // Replace the alpha of the pixels that match the transparent color
-    std::uint8_t* ptr = m_impl->pixels.data();
-    std::uint8_t* end = ptr + m_impl->pixels.size();
+    ImageUtils::createMaskFromColor(asMutableImageView(), color, alpha);
+}
 
-    while (ptr < end)
-    {
-        if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-            ptr[3] = alpha;
-        ptr += 4;
-    }
+
+////////////////////////////////////////////////////////////
+void Image::applyColorKey(Color key, std::uint8_t alpha)
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    SFML_BASE_ASSERT(!m_impl->premultipliedAlpha && "Image::applyColorKey() requires straight alpha");
+
+    ImageUtils::applyColorKey(asMutableImageView(), key, alpha);
 }
 
 
 ////////////////////////////////////////////////////////////
 bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect, bool applyAlpha)
+{
+    SFML_BASE_ASSERT(source.m_impl->premultipliedAlpha == m_impl->premultipliedAlpha &&
+                     "Image::copy() source and destination must use the same alpha encoding");
+
+    return copy(source.asImageView(), dest, sourceRect, applyAlpha);
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::copy(ImageView source, Vector2u dest, const IntRect& sourceRect, bool applyAlpha)
 {
     // Make sure that both images are valid
-    SFML_BASE_ASSERT(source.m_impl->size.x > 0 && source.m_impl->size.y > 0 && m_impl->size.x > 0 && m_impl->size.y > 0);
+    SFML_BASE_ASSERT(source.pixels != nullptr && source.size.x > 0 && source.size.y > 0 && m_impl->size.x > 0 &&
+                     m_impl->size.y > 0);
 
     // Make sure the sourceRect components are non-negative before casting them to unsigned values
     if (sourceRect.position.x < 0 || sourceRect.position.y < 0 || sourceRect.size.x < 0 || sourceRect.size.y < 0)
@@ -315,15 +393,14 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     // Use the whole source image as srcRect if the provided source rectangle is empty
     if (srcRect.size.x == 0 || srcRect.size.y == 0)
     {
-        srcRect = Rect<unsigned int>({0, 0}, source.m_impl->size);
+        srcRect = Rect<unsigned int>({0, 0}, source.size);
     }
     // Otherwise make sure the provided source rectangle fits into the source image
     else
     {
         // Checking the bottom right corner is enough because
         // left and top are non-negative and width and height are positive.
-        if (source.m_impl->size.x < srcRect.position.x + srcRect.size.x ||
-            source.m_impl->size.y < srcRect.position.y + srcRect.size.y)
+        if (source.size.x < srcRect.position.x + srcRect.size.x || source.size.y < srcRect.position.y + srcRect.size.y)
             return false;
     }
 
@@ -336,42 +413,37 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
                            base::min(m_impl->size.y - dest.y, srcRect.size.y));
 
     // Precompute as much as possible
-    const std::size_t  pitch     = static_cast<std::size_t>(dstSize.x) * 4;
-    const unsigned int srcStride = source.m_impl->size.x * 4;
-    const unsigned int dstStride = m_impl->size.x * 4;
+    const std::size_t pitch       = static_cast<std::size_t>(dstSize.x) * 4;
+    const std::size_t dstStride   = static_cast<std::size_t>(m_impl->size.x) * 4;
+    const bool        swapRedBlue = source.format == PixelFormat::BGRA;
+
+    const ImageView srcView   = source.getSubView(srcRect.position, dstSize);
+    std::uint8_t*   dstPixels = m_impl->pixels.data() + (dest.x + dest.y * m_impl->size.x) * 4;
 
-    const std::uint8_t* srcPixels = source.m_impl->pixels.data() +
-                                    (srcRect.position.x + srcRect.position.y * source.m_impl->size.x) * 4;
-    std::uint8_t* dstPixels = m_impl->pixels.data() + (dest.x + dest.y * m_impl->size.x) * 4;
+    const priv::ImagePixelOps& ops = priv::getImagePixelOps();
 
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
+        // Interpolation using alpha values, row by row using the vectorized kernel
+        // (BGRA rows are converted into a scratch row first)
+        std::vector<std::uint8_t> convertedRow(swapRedBlue ? pitch : 0);
+
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
+            const std::uint8_t* srcPixels = srcView.getRow(i);
+
+            if (swapRedBlue)
             {
-                // Get a direct pointer to the components of the current pixel
-                const std::uint8_t* src = srcPixels + j * 4;
-                std::uint8_t*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const std::uint8_t srcAlpha = src[3];
-                const std::uint8_t dstAlpha = dst[3];
-                const auto outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
+                std::memcpy(convertedRow.data(), srcPixels, pitch);
+                ops.swapRedBlue(convertedRow.data(), dstSize.x);
+                srcPixels = convertedRow.data();
             }
 
-            srcPixels += srcStride;
+            if (m_impl->premultipliedAlpha)
+                blendOverPremultiplied(dstPixels, srcPixels, dstSize.x);
+            else
+                ops.blendOver(dstPixels, srcPixels, dstSize.x);
             dstPixels += dstStride;
         }
     }
@@ -380,8 +452,11 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
         // Optimized copy ignoring alpha values, row by row (faster)
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            std::memcpy(dstPixels, srcPixels, pitch);
-            srcPixels += srcStride;
+            std::memcpy(dstPixels, srcView.getRow(i), pitch);
+
+            if (swapRedBlue)
+                ops.swapRedBlue(dstPixels, dstSize.x);
+
             dstPixels += dstStride;
         }
     }
@@ -427,46 +502,203 @@ const std::uint8_t* Image::getPixelsPtr() const
 }
 
 
+////////////////////////////////////////////////////////////
+ImageView Image::asImageView() const
+{
+    return {m_impl->pixels.data(), m_impl->size};
+}
+
+
+////////////////////////////////////////////////////////////
+MutableImageView Image::asMutableImageView()
+{
+    return {m_impl->pixels.data(), m_impl->size};
+}
+
+
 ////////////////////////////////////////////////////////////
 void Image::flipHorizontally()
 {
     SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    ImageUtils::flipHorizontally(asMutableImageView());
+}
 
-    const std::size_t rowSize = m_impl->size.x * 4;
 
-    for (std::size_t y = 0; y < m_impl->size.y; ++y)
-    {
-        auto left = m_impl->pixels.begin() + static_cast<decltype(m_impl->pixels)::difference_type>(y * rowSize);
-        auto right = m_impl->pixels.begin() + static_cast<decltype(m_impl->pixels)::difference_type>((y + 1) * rowSize - 4);
+////////////////////////////////////////////////////////////
+void Image::flipVertically()
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    ImageUtils::flipVertically(asMutableImageView());
+}
 
-        for (std::size_t x = 0; x < m_impl->size.x / 2; ++x)
-        {
-            base::swapRanges(left, left + 4, right);
 
-            left += 4;
-            right -= 4;
-        }
-    }
+////////////////////////////////////////////////////////////
+void Image::premultiplyAlpha()
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    SFML_BASE_ASSERT(!m_impl->premultipliedAlpha && "Image::premultiplyAlpha() image is already premultiplied");
+
+    ImageUtils::premultiplyAlpha(asMutableImageView());
+    m_impl->premultipliedAlpha = true;
 }
 
 
 ////////////////////////////////////////////////////////////
-void Image::flipVertically()
+void Image::unpremultiplyAlpha()
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    SFML_BASE_ASSERT(m_impl->premultipliedAlpha && "Image::unpremultiplyAlpha() image is not premultiplied");
+
+    ImageUtils::unpremultiplyAlpha(asMutableImageView());
+    m_impl->premultipliedAlpha = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::setAlphaPremultiplied(bool premultiplied)
+{
+    m_impl->premultipliedAlpha = premultiplied;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Image::isAlphaPremultiplied() const
+{
+    return m_impl->premultipliedAlpha;
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::swapRedBlueChannels()
 {
     SFML_BASE_ASSERT(!m_impl->pixels.empty());
+    ImageUtils::swapRedBlueChannels(asMutableImageView());
+}
+
 
-    const auto rowSize = static_cast<decltype(m_impl->pixels)::difference_type>(m_impl->size.x * 4);
+////////////////////////////////////////////////////////////
+base::Optional<Image> Image::createDownscaled(Vector2u size, DownscaleFilter filter) const
+{
+    SFML_BASE_ASSERT(!m_impl->pixels.empty());
 
-    auto top    = m_impl->pixels.begin();
-    auto bottom = m_impl->pixels.end() - rowSize;
+    base::Optional<Image> result; // Use a single local variable for NRVO
 
-    for (std::size_t y = 0; y < m_impl->size.y / 2; ++y)
+    if (size.x == 0 || size.y == 0)
     {
-        base::swapRanges(top, top + rowSize, bottom);
+        priv::err() << "Failed to downscale image, invalid size (zero) provided";
+        return result; // Empty optional
+    }
 
-        top += rowSize;
-        bottom -= rowSize;
+    if (size.x > m_impl->size.x || size.y > m_impl->size.y)
+    {
+        priv::err() << "Failed to downscale image, target size is larger than the source size";
+        return result; // Empty optional
     }
+
+    result.emplace(base::PassKey<Image>{}, size, static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4);
+    result->m_impl->premultipliedAlpha = m_impl->premultipliedAlpha;
+
+    const std::size_t   srcWidth  = m_impl->size.x;
+    const std::size_t   srcHeight = m_impl->size.y;
+    const std::uint8_t* srcPixels = m_impl->pixels.data();
+    std::uint8_t*       dstPixels = result->m_impl->pixels.data();
+
+    if (filter == DownscaleFilter::Box)
+    {
+        // Each destination pixel is the rounded average of the source pixels it covers;
+        // rows are first summed vertically, then each span is summed horizontally
+        std::vector<std::uint32_t> columnSums(srcWidth * 4);
+
+        for (std::size_t dy = 0; dy < size.y; ++dy)
+        {
+            const std::size_t y0 = spanStart(dy, srcHeight, size.y);
+            const std::size_t y1 = spanStart(dy + 1, srcHeight, size.y);
+
+            std::memset(columnSums.data(), 0, columnSums.size() * sizeof(std::uint32_t));
+
+            for (std::size_t y = y0; y < y1; ++y)
+            {
+                const std::uint8_t* row = srcPixels + y * srcWidth * 4;
+
+                for (std::size_t i = 0; i < srcWidth * 4; ++i)
+                    columnSums[i] += row[i];
+            }
+
+            for (std::size_t dx = 0; dx < size.x; ++dx)
+            {
+                const std::size_t x0 = spanStart(dx, srcWidth, size.x);
+                const std::size_t x1 = spanStart(dx + 1, srcWidth, size.x);
+
+                const std::uint64_t count = (x1 - x0) * (y1 - y0);
+
+                for (std::size_t k = 0; k < 4; ++k)
+                {
+                    std::uint64_t sum = 0;
+
+                    for (std::size_t x = x0; x < x1; ++x)
+                        sum += columnSums[x * 4 + k];
+
+                    *dstPixels++ = static_cast<std::uint8_t>((sum + count / 2) / count);
+                }
+            }
+        }
+    }
+    else
+    {
+        // Sample the source at the center of each destination pixel, using 8-bit fixed point weights
+        struct Sample
+        {
+            std::size_t   index0;
+            std::size_t   index1;
+            std::uint32_t weight; // Weight of `index1`, in [0, 256]
+        };
+
+        const auto computeSamples = [](std::size_t srcSize, std::size_t dstSize)
+        {
+            std::vector<Sample> samples(dstSize);
+
+            for (std::size_t i = 0; i < dstSize; ++i)
+            {
+                const double position = base::max(0.0,
+                                                  (static_cast<double>(i) + 0.5) * static_cast<double>(srcSize) /
+                                                          static_cast<double>(dstSize) -
+                                                      0.5);
+
+                const auto index0 = base::min(static_cast<std::size_t>(position), srcSize - 1);
+
+                samples[i] = {index0,
+                              base::min(index0 + 1, srcSize - 1),
+                              static_cast<std::uint32_t>((position - static_cast<double>(index0)) * 256.0 + 0.5)};
+            }
+
+            return samples;
+        };
+
+        const std::vector<Sample> columns = computeSamples(srcWidth, size.x);
+        const std::vector<Sample> rows    = computeSamples(srcHeight, size.y);
+
+        for (const Sample& row : rows)
+        {
+            const std::uint8_t* top    = srcPixels + row.index0 * srcWidth * 4;
+            const std::uint8_t* bottom = srcPixels + row.index1 * srcWidth * 4;
+
+            for (const Sample& column : columns)
+            {
+                for (std::size_t k = 0; k < 4; ++k)
+                {
+                    const std::uint32_t upper = top[column.index0 * 4 + k] * (256u - column.weight) +
+                                                top[column.index1 * 4 + k] * column.weight;
+                    const std::uint32_t lower = bottom[column.index0 * 4 + k] * (256u - column.weight) +
+                                                bottom[column.index1 * 4 + k] * column.weight;
+
+                    *dstPixels++ = static_cast<std::uint8_t>(
+                        (upper * (256u - row.weight) + lower * row.weight + 32768u) >> 16);
+                }
+            }
+        }
+    }
+
+    return result;
 }
 
 } // namespace sf
@@ -0,0 +1,207 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageEncodeQueue.hpp"
+#include "SFML/Graphics/ImageEncoder.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ImageEncodeQueue::Impl
+{
+    struct Job
+    {
+        Image                  image;
+        Path                   filename;  // Used if `onEncoded` is empty
+        ImageUtils::SaveFormat format;    // Used if `onEncoded` is set
+        CompletionCallback     onEncoded;
+        ImageSaveOptions       options;
+    };
+
+    explicit Impl(std::size_t theMaxPendingJobs) : maxPendingJobs(theMaxPendingJobs)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    template <typename... Args>
+    [[nodiscard]] bool tryEmplaceJob(Args&&... args)
+    {
+        {
+            const std::lock_guard lock(mutex);
+
+            // Check before constructing the job, so that a rejected image is not moved from
+            if (jobs.size() + runningJobs >= maxPendingJobs)
+                return false;
+
+            jobs.push_back(Job{SFML_BASE_FORWARD(args)...});
+        }
+
+        jobAvailable.notify_one();
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool process(Job& job, ImageEncoder& encoder, std::vector<std::uint8_t>& buffer)
+    {
+        // Image formats store straight alpha, the queue owns the image so it can be converted in place
+        if (job.image.isAlphaPremultiplied())
+            job.image.unpremultiplyAlpha();
+
+        const ImageView view = job.image.asImageView();
+
+        if (!job.onEncoded)
+            return encoder.encodeToFile(view, job.filename, job.options);
+
+        const bool success = encoder.encode(view, job.format, buffer, job.options);
+        job.onEncoded(success, buffer.data(), buffer.size());
+
+        return success;
+    }
+
+    const std::size_t        maxPendingJobs; //!< Maximum number of queued or running jobs
+    mutable std::mutex       mutex;          //!< Protects all the members below
+    std::condition_variable  jobAvailable;   //!< Signaled when a job is queued or the queue stops
+    std::condition_variable  jobsFinished;   //!< Signaled when the last pending job completes
+    std::deque<Job>          jobs;           //!< Jobs waiting for a worker
+    std::size_t              runningJobs{};  //!< Jobs currently processed by a worker
+    std::size_t              failedJobs{};   //!< Jobs that failed since the queue was created
+    bool                     stopping{};     //!< Whether the workers must exit once the queue is empty
+    std::vector<std::thread> workers;        //!< Worker threads
+};
+
+
+////////////////////////////////////////////////////////////
+ImageEncodeQueue::ImageEncodeQueue(unsigned int workerCount, std::size_t maxPendingJobs) : m_impl(maxPendingJobs)
+{
+    SFML_BASE_ASSERT(maxPendingJobs > 0u && "ImageEncodeQueue::ImageEncodeQueue() maxPendingJobs must be positive");
+
+    if (workerCount == 0u)
+        workerCount = 1u;
+
+    m_impl->workers.reserve(workerCount);
+
+    for (unsigned int i = 0u; i < workerCount; ++i)
+        m_impl->workers.emplace_back([this] { runWorker(); });
+}
+
+
+////////////////////////////////////////////////////////////
+ImageEncodeQueue::~ImageEncodeQueue()
+{
+    {
+        const std::lock_guard lock(m_impl->mutex);
+        m_impl->stopping = true;
+    }
+
+    m_impl->jobAvailable.notify_all();
+
+    for (std::thread& worker : m_impl->workers)
+        worker.join();
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageEncodeQueue::push(Image&& image, const Path& filename, const ImageSaveOptions& options)
+{
+    SFML_BASE_ASSERT(image.getSize().x > 0u && image.getSize().y > 0u);
+
+    return m_impl->tryEmplaceJob(SFML_BASE_MOVE(image), filename, ImageUtils::SaveFormat::PNG, CompletionCallback{}, options);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageEncodeQueue::push(Image&& image, ImageUtils::SaveFormat format, CompletionCallback onEncoded, const ImageSaveOptions& options)
+{
+    SFML_BASE_ASSERT(image.getSize().x > 0u && image.getSize().y > 0u);
+    SFML_BASE_ASSERT(onEncoded && "ImageEncodeQueue::push() completion callback must not be empty");
+
+    return m_impl->tryEmplaceJob(SFML_BASE_MOVE(image), Path{}, format, SFML_BASE_MOVE(onEncoded), options);
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageEncodeQueue::waitForCompletion()
+{
+    std::unique_lock lock(m_impl->mutex);
+    m_impl->jobsFinished.wait(lock, [this] { return m_impl->jobs.empty() && m_impl->runningJobs == 0u; });
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageEncodeQueue::getPendingJobCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->jobs.size() + m_impl->runningJobs;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ImageEncodeQueue::getFailedJobCount() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->failedJobs;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageEncodeQueue::runWorker()
+{
+    // Kept alive across jobs so that their memory is reused
+    ImageEncoder              encoder;
+    std::vector<std::uint8_t> buffer;
+
+    while (true)
+    {
+        base::Optional<Impl::Job> job;
+
+        {
+            std::unique_lock lock(m_impl->mutex);
+            m_impl->jobAvailable.wait(lock, [this] { return m_impl->stopping || !m_impl->jobs.empty(); });
+
+            if (m_impl->jobs.empty()) // Stopping, and no job left
+                return;
+
+            job.emplace(SFML_BASE_MOVE(m_impl->jobs.front()));
+            m_impl->jobs.pop_front();
+            ++m_impl->runningJobs;
+        }
+
+        const bool success = Impl::process(*job, encoder, buffer);
+        job.reset(); // Release the image before signaling completion
+
+        {
+            const std::lock_guard lock(m_impl->mutex);
+
+            --m_impl->runningJobs;
+
+            if (!success)
+                ++m_impl->failedJobs;
+
+            if (m_impl->jobs.empty() && m_impl->runningJobs == 0u)
+                m_impl->jobsFinished.notify_all();
+        }
+    }
+}
+
+} // namespace sf
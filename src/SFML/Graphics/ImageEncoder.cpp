@@ -0,0 +1,562 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ImageEncoder.hpp"
+#include "SFML/Graphics/ImagePixelOps.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Path.hpp"
+#include "SFML/System/PathUtils.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <cstdio>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ImageEncoderImpl
+{
+// Largest chunk payload allowed by the PNG specification
+constexpr std::size_t maxPngChunkSize = 0x7FFFFFFFu;
+
+// Largest payload of a stored (uncompressed) deflate block
+constexpr std::size_t maxStoredBlockSize = 0xFFFFu;
+
+// Compression levels understood by `stbi_zlib_compress` (5 is its minimum)
+constexpr int zlibQualityFast    = 5;
+constexpr int zlibQualityDefault = 8;
+
+
+////////////////////////////////////////////////////////////
+// Forwards encoded bytes to a sink, remembering whether any write failed
+struct SinkWriter
+{
+    const sf::ImageEncoder::Sink& sink;
+    bool                          good{true};
+
+    void write(const void* data, std::size_t size)
+    {
+        if (good && size > 0)
+            good = sink(static_cast<const std::uint8_t*>(data), size);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+// stb_image_write callback writing to a `SinkWriter`
+void stbWriteCallback(void* context, void* data, int size)
+{
+    static_cast<SinkWriter*>(context)->write(data, static_cast<std::size_t>(size));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::ImageUtils::SaveFormat> formatFromExtension(const sf::Path& extension)
+{
+    if (extension == ".bmp")
+        return sf::base::makeOptional(sf::ImageUtils::SaveFormat::BMP);
+
+    if (extension == ".tga")
+        return sf::base::makeOptional(sf::ImageUtils::SaveFormat::TGA);
+
+    if (extension == ".png")
+        return sf::base::makeOptional(sf::ImageUtils::SaveFormat::PNG);
+
+    if (extension == ".jpg" || extension == ".jpeg")
+        return sf::base::makeOptional(sf::ImageUtils::SaveFormat::JPG);
+
+    return sf::base::nullOpt;
+}
+
+
+////////////////////////////////////////////////////////////
+struct Crc32Table
+{
+    std::uint32_t values[256];
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr Crc32Table makeCrc32Table()
+{
+    Crc32Table table{};
+
+    for (std::uint32_t i = 0u; i < 256u; ++i)
+    {
+        std::uint32_t value = i;
+
+        for (int bit = 0; bit < 8; ++bit)
+            value = (value & 1u) != 0u ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+
+        table.values[i] = value;
+    }
+
+    return table;
+}
+
+
+////////////////////////////////////////////////////////////
+constexpr Crc32Table crc32Table = makeCrc32Table();
+
+
+////////////////////////////////////////////////////////////
+void storeBigEndian(std::uint8_t* out, std::uint32_t value)
+{
+    out[0] = static_cast<std::uint8_t>(value >> 24);
+    out[1] = static_cast<std::uint8_t>(value >> 16);
+    out[2] = static_cast<std::uint8_t>(value >> 8);
+    out[3] = static_cast<std::uint8_t>(value);
+}
+
+
+////////////////////////////////////////////////////////////
+// Writes a PNG chunk piece by piece, computing its CRC on the fly
+struct PngChunkWriter
+{
+    SinkWriter&   writer;
+    std::uint32_t crc{0xFFFFFFFFu};
+
+    void begin(const char* tag, std::size_t length)
+    {
+        SFML_BASE_ASSERT(length <= maxPngChunkSize);
+
+        std::uint8_t header[8];
+        storeBigEndian(header, static_cast<std::uint32_t>(length));
+        std::memcpy(header + 4, tag, 4);
+
+        writer.write(header, 4);
+        write(header + 4, 4); // The tag is part of the CRC, the length is not
+    }
+
+    void write(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+
+        for (std::size_t i = 0; i < size; ++i)
+            crc = crc32Table.values[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+
+        writer.write(data, size);
+    }
+
+    void end()
+    {
+        std::uint8_t footer[4];
+        storeBigEndian(footer, ~crc);
+        writer.write(footer, 4);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+// Writes raw bytes as a sequence of stored deflate blocks, computing their Adler-32 on the fly
+struct StoredDeflateWriter
+{
+    PngChunkWriter& chunk;
+    std::size_t     remaining;        // Bytes left to write over all blocks
+    std::size_t     blockRemaining{}; // Bytes left to write in the current block
+    std::uint32_t   adlerA{1u};
+    std::uint32_t   adlerB{0u};
+
+    void write(const std::uint8_t* data, std::size_t size)
+    {
+        updateAdler32(data, size);
+
+        while (size > 0)
+        {
+            if (blockRemaining == 0)
+            {
+                const std::size_t blockSize = remaining < maxStoredBlockSize ? remaining : maxStoredBlockSize;
+                const auto        length    = static_cast<std::uint16_t>(blockSize);
+
+                // BFINAL flag and BTYPE = 0 (stored), followed by the length and its one's complement
+                const std::uint8_t header[5]{static_cast<std::uint8_t>(blockSize == remaining ? 1u : 0u),
+                                             static_cast<std::uint8_t>(length),
+                                             static_cast<std::uint8_t>(length >> 8),
+                                             static_cast<std::uint8_t>(~length),
+                                             static_cast<std::uint8_t>(~length >> 8)};
+
+                chunk.write(header, sizeof(header));
+                blockRemaining = blockSize;
+            }
+
+            const std::size_t count = size < blockRemaining ? size : blockRemaining;
+            chunk.write(data, count);
+
+            data += count;
+            size -= count;
+            blockRemaining -= count;
+            remaining -= count;
+        }
+    }
+
+    void updateAdler32(const std::uint8_t* data, std::size_t size)
+    {
+        // 5552 is the largest number of bytes that can be summed before the 32-bit sums overflow
+        while (size > 0)
+        {
+            const std::size_t count = size < 5552u ? size : 5552u;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                adlerA += data[i];
+                adlerB += adlerA;
+            }
+
+            adlerA %= 65521u;
+            adlerB %= 65521u;
+
+            data += count;
+            size -= count;
+        }
+    }
+
+    [[nodiscard]] std::uint32_t getAdler32() const
+    {
+        return (adlerB << 16) | adlerA;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+void writePngHeader(SinkWriter& writer, sf::Vector2u size)
+{
+    static constexpr std::uint8_t signature[8]{137, 80, 78, 71, 13, 10, 26, 10};
+    writer.write(signature, sizeof(signature));
+
+    std::uint8_t header[13]{};
+    storeBigEndian(header, size.x);
+    storeBigEndian(header + 4, size.y);
+    header[8] = 8; // Bit depth
+    header[9] = 6; // Color type: RGBA
+
+    PngChunkWriter chunk{writer};
+    chunk.begin("IHDR", sizeof(header));
+    chunk.write(header, sizeof(header));
+    chunk.end();
+}
+
+
+////////////////////////////////////////////////////////////
+void writePngFooter(SinkWriter& writer)
+{
+    PngChunkWriter chunk{writer};
+    chunk.begin("IEND", 0);
+    chunk.end();
+}
+
+
+////////////////////////////////////////////////////////////
+// PNG "Sub" filter: difference with the pixel on the left
+void filterSub(std::uint8_t* out, const std::uint8_t* row, std::size_t rowSize)
+{
+    std::memcpy(out, row, 4);
+
+    for (std::size_t i = 4; i < rowSize; ++i)
+        out[i] = static_cast<std::uint8_t>(row[i] - row[i - 4]);
+}
+
+
+////////////////////////////////////////////////////////////
+// PNG "Up" filter: difference with the pixel above
+void filterUp(std::uint8_t* out, const std::uint8_t* row, const std::uint8_t* previousRow, std::size_t rowSize)
+{
+    for (std::size_t i = 0; i < rowSize; ++i)
+        out[i] = static_cast<std::uint8_t>(row[i] - previousRow[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+// Pick the best of the five PNG filters for each row, exactly like `stbi_write_png`
+void filterAdaptive(std::uint8_t* out, const std::uint8_t* pixels, std::size_t stride, sf::Vector2u size)
+{
+    const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4;
+    auto*             source  = const_cast<unsigned char*>(pixels); // stb does not take const pointers, but only reads
+
+    const auto width  = static_cast<int>(size.x);
+    const auto height = static_cast<int>(size.y);
+
+    for (int y = 0; y < height; ++y)
+    {
+        std::uint8_t* filterType = out + static_cast<std::size_t>(y) * (rowSize + 1);
+        auto*         line       = reinterpret_cast<signed char*>(filterType + 1);
+
+        int bestFilter   = 0;
+        int bestEstimate = 0x7FFFFFFF;
+
+        for (int filter = 0; filter < 5; ++filter)
+        {
+            stbiw__encode_png_line(source, static_cast<int>(stride), width, height, y, 4, filter, line);
+
+            // Estimate the entropy of the line using this filter; the less, the better
+            int estimate = 0;
+            for (std::size_t i = 0; i < rowSize; ++i)
+                estimate += line[i] < 0 ? -line[i] : line[i];
+
+            if (estimate < bestEstimate)
+            {
+                bestEstimate = estimate;
+                bestFilter   = filter;
+            }
+        }
+
+        if (bestFilter != 4) // The last filter tried is still in the buffer
+            stbiw__encode_png_line(source, static_cast<int>(stride), width, height, y, 4, bestFilter, line);
+
+        *filterType = static_cast<std::uint8_t>(bestFilter);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Filter the first row with "Sub" and every other row with "Up", which is cheap and suits rendered frames well
+void filterFast(std::uint8_t* out, const std::uint8_t* pixels, std::size_t stride, sf::Vector2u size)
+{
+    const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4;
+
+    out[0] = 1; // Sub
+    filterSub(out + 1, pixels, rowSize);
+
+    for (std::size_t y = 1; y < size.y; ++y)
+    {
+        std::uint8_t*       filtered = out + y * (rowSize + 1);
+        const std::uint8_t* row      = pixels + y * stride;
+
+        filtered[0] = 2; // Up
+        filterUp(filtered + 1, row, row - stride, rowSize);
+    }
+}
+
+} // namespace ImageEncoderImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+bool ImageEncoder::encode(ImageView view, ImageUtils::SaveFormat format, const Sink& sink, const ImageSaveOptions& options)
+{
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
+
+    if (format == ImageUtils::SaveFormat::PNG)
+        return encodePng(view, sink, options.pngCompression);
+
+    const auto                   convertedSize = view.size.to<Vector2i>();
+    const std::uint8_t*          pixels        = priv::getPackedRgbaPixels(view, m_packedPixels);
+    ImageEncoderImpl::SinkWriter writer{sink};
+
+    using ImageEncoderImpl::stbWriteCallback;
+
+    int result = 0;
+
+    if (format == ImageUtils::SaveFormat::BMP)
+    {
+        result = stbi_write_bmp_to_func(stbWriteCallback, &writer, convertedSize.x, convertedSize.y, 4, pixels);
+    }
+    else if (format == ImageUtils::SaveFormat::TGA)
+    {
+        result = stbi_write_tga_to_func(stbWriteCallback, &writer, convertedSize.x, convertedSize.y, 4, pixels);
+    }
+    else
+    {
+        SFML_BASE_ASSERT(format == ImageUtils::SaveFormat::JPG);
+
+        const int quality = options.jpgQuality < 1 ? 1 : options.jpgQuality > 100 ? 100 : options.jpgQuality;
+        result = stbi_write_jpg_to_func(stbWriteCallback, &writer, convertedSize.x, convertedSize.y, 4, pixels, quality);
+    }
+
+    return result != 0 && writer.good;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageEncoder::encode(ImageView view, ImageUtils::SaveFormat format, std::vector<std::uint8_t>& output, const ImageSaveOptions& options)
+{
+    output.clear();
+
+    const bool success = encode(
+        view,
+        format,
+        [&output](const std::uint8_t* data, std::size_t size)
+        {
+            output.insert(output.end(), data, data + size);
+            return true;
+        },
+        options);
+
+    if (success)
+        return true;
+
+    output.clear();
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageEncoder::encodeToFile(ImageView view, const Path& filename, const ImageSaveOptions& options)
+{
+    const Path extension = filename.extension();
+
+    const base::Optional<ImageUtils::SaveFormat> format = ImageEncoderImpl::formatFromExtension(extension);
+    if (!format.hasValue())
+    {
+        priv::err() << "Image file extension " << extension << " not supported\n";
+        priv::err() << "Failed to save image\n" << priv::PathDebugFormatter{filename};
+        return false;
+    }
+
+#ifdef SFML_SYSTEM_WINDOWS
+    std::FILE* file = _wfopen(filename.c_str(), L"wb");
+#else
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+#endif
+
+    if (file == nullptr)
+    {
+        priv::err() << "Failed to open image file for writing\n" << priv::PathDebugFormatter{filename};
+        return false;
+    }
+
+    const bool encoded = encode(
+        view,
+        *format,
+        [file](const std::uint8_t* data, std::size_t size) { return std::fwrite(data, 1, size, file) == size; },
+        options);
+    const bool closed  = std::fclose(file) == 0;
+
+    if (encoded && closed)
+        return true;
+
+    priv::err() << "Failed to save image\n" << priv::PathDebugFormatter{filename};
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageEncoder::releaseMemory()
+{
+    m_packedPixels = {};
+    m_scanlines    = {};
+}
+
+
+////////////////////////////////////////////////////////////
+bool ImageEncoder::encodePng(ImageView view, const Sink& sink, PngCompression compression)
+{
+    namespace Impl = ImageEncoderImpl;
+
+    const std::size_t rowSize       = static_cast<std::size_t>(view.size.x) * 4;
+    const std::size_t scanlinesSize = (rowSize + 1) * view.size.y; // Each row is prefixed by its filter type
+
+    Impl::SinkWriter writer{sink};
+
+    if (compression == PngCompression::None)
+    {
+        // Stream the rows straight from the view into stored deflate blocks
+        const std::size_t blockCount = (scanlinesSize + Impl::maxStoredBlockSize - 1) / Impl::maxStoredBlockSize;
+        const std::size_t idatSize   = 2 + blockCount * 5 + scanlinesSize + 4;
+
+        if (idatSize > Impl::maxPngChunkSize)
+        {
+            priv::err() << "Image is too large to be saved as an uncompressed PNG\n";
+            return false;
+        }
+
+        if (view.format == PixelFormat::BGRA)
+            m_scanlines.resize(rowSize);
+
+        Impl::writePngHeader(writer, view.size);
+
+        Impl::PngChunkWriter idat{writer};
+        idat.begin("IDAT", idatSize);
+
+        static constexpr std::uint8_t zlibHeader[2]{0x78, 0x01}; // 32K window, fastest compression
+        idat.write(zlibHeader, sizeof(zlibHeader));
+
+        Impl::StoredDeflateWriter deflate{idat, scanlinesSize};
+
+        for (unsigned int y = 0; y < view.size.y && writer.good; ++y)
+        {
+            static constexpr std::uint8_t filterNone = 0;
+            deflate.write(&filterNone, 1);
+
+            if (view.format == PixelFormat::BGRA)
+            {
+                std::memcpy(m_scanlines.data(), view.getRow(y), rowSize);
+                priv::getImagePixelOps().swapRedBlue(m_scanlines.data(), view.size.x);
+                deflate.write(m_scanlines.data(), rowSize);
+            }
+            else
+            {
+                deflate.write(view.getRow(y), rowSize);
+            }
+        }
+
+        std::uint8_t adler[4];
+        Impl::storeBigEndian(adler, deflate.getAdler32());
+        idat.write(adler, sizeof(adler));
+        idat.end();
+
+        Impl::writePngFooter(writer);
+        return writer.good;
+    }
+
+    if (scanlinesSize > Impl::maxPngChunkSize)
+    {
+        priv::err() << "Image is too large to be saved as a PNG\n";
+        return false;
+    }
+
+    // Filter the rows into the reusable scanline buffer
+    const std::uint8_t* pixels = view.pixels;
+    std::size_t         stride = view.getRowStride();
+
+    if (view.format == PixelFormat::BGRA)
+    {
+        pixels = priv::getPackedRgbaPixels(view, m_packedPixels);
+        stride = rowSize;
+    }
+
+    m_scanlines.resize(scanlinesSize);
+
+    if (compression == PngCompression::Fast)
+        Impl::filterFast(m_scanlines.data(), pixels, stride, view.size);
+    else
+        Impl::filterAdaptive(m_scanlines.data(), pixels, stride, view.size);
+
+    int            zlibSize = 0;
+    unsigned char* zlibData = stbi_zlib_compress(m_scanlines.data(),
+                                                 static_cast<int>(scanlinesSize),
+                                                 &zlibSize,
+                                                 compression == PngCompression::Fast ? Impl::zlibQualityFast
+                                                                                     : Impl::zlibQualityDefault);
+
+    if (zlibData == nullptr)
+        return false;
+
+    Impl::writePngHeader(writer, view.size);
+
+    Impl::PngChunkWriter idat{writer};
+    idat.begin("IDAT", static_cast<std::size_t>(zlibSize));
+    idat.write(zlibData, static_cast<std::size_t>(zlibSize));
+    idat.end();
+
+    STBIW_FREE(zlibData);
+
+    Impl::writePngFooter(writer);
+    return writer.good;
+}
+
+} // namespace sf
@@ -0,0 +1,829 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ImagePixelOps.hpp"
+#include "SFML/Graphics/ImageView.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_PRIV_IMAGE_PIXEL_OPS_SSE2
+#include <emmintrin.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SFML_PRIV_IMAGE_PIXEL_OPS_AVX2
+#include <immintrin.h>
+#endif
+
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SFML_PRIV_IMAGE_PIXEL_OPS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace
+{
+namespace ImagePixelOpsImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline std::uint32_t loadPixel(const std::uint8_t* ptr)
+{
+    std::uint32_t result{};
+    std::memcpy(&result, ptr, sizeof(result));
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline void storePixel(std::uint8_t* ptr, std::uint32_t value)
+{
+    std::memcpy(ptr, &value, sizeof(value));
+}
+
+
+////////////////////////////////////////////////////////////
+// Scalar reference kernels, also used to process the tails of the vectorized ones
+////////////////////////////////////////////////////////////
+void maskFromColorScalar(std::uint8_t* pixels, std::size_t pixelCount, std::uint32_t key, std::uint32_t compareMask, std::uint8_t alpha)
+{
+    key &= compareMask;
+
+    for (std::size_t i = 0; i < pixelCount; ++i, pixels += 4)
+        if ((loadPixel(pixels) & compareMask) == key)
+            pixels[3] = alpha;
+}
+
+
+////////////////////////////////////////////////////////////
+void swapRedBlueScalar(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i, pixels += 4)
+    {
+        const std::uint8_t red = pixels[0];
+        pixels[0]              = pixels[2];
+        pixels[2]              = red;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void reverseRowRange(std::uint8_t* pixels, std::size_t begin, std::size_t end)
+{
+    while (begin + 1 < end)
+    {
+        --end;
+
+        const std::uint32_t left = loadPixel(pixels + begin * 4);
+        storePixel(pixels + begin * 4, loadPixel(pixels + end * 4));
+        storePixel(pixels + end * 4, left);
+
+        ++begin;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void reverseRowScalar(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    reverseRowRange(pixels, 0, pixelCount);
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyAlphaScalar(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i, pixels += 4)
+    {
+        const unsigned int a = pixels[3];
+
+        pixels[0] = sf::priv::mulDiv255(pixels[0], a);
+        pixels[1] = sf::priv::mulDiv255(pixels[1], a);
+        pixels[2] = sf::priv::mulDiv255(pixels[2], a);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyAlphaScalar(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i, pixels += 4)
+    {
+        const unsigned int a = pixels[3];
+
+        if (a == 0)
+            continue;
+
+        for (int k = 0; k < 3; ++k)
+        {
+            const unsigned int value = (pixels[k] * 255u + a / 2u) / a;
+            pixels[k]                = static_cast<std::uint8_t>(value > 255u ? 255u : value);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void blendOverScalar(std::uint8_t* dst, const std::uint8_t* src, std::size_t pixelCount)
+{
+    for (std::size_t i = 0; i < pixelCount; ++i, src += 4, dst += 4)
+    {
+        // Interpolate RGBA components using the alpha values of the destination and source pixels
+        const std::uint8_t srcAlpha = src[3];
+        const std::uint8_t dstAlpha = dst[3];
+        const auto         outAlpha = static_cast<std::uint8_t>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+        dst[3] = outAlpha;
+
+        if (outAlpha)
+            for (int k = 0; k < 3; k++)
+                dst[k] = static_cast<std::uint8_t>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+        else
+            for (int k = 0; k < 3; k++)
+                dst[k] = src[k];
+    }
+}
+
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_SSE2
+
+////////////////////////////////////////////////////////////
+// SSE2 kernels, four pixels per iteration
+////////////////////////////////////////////////////////////
+void maskFromColorSSE2(std::uint8_t* pixels, std::size_t pixelCount, std::uint32_t key, std::uint32_t compareMask, std::uint8_t alpha)
+{
+    const std::uint32_t alphaLane = sf::priv::packPixel(0, 0, 0, 0xFF);
+
+    const __m128i vKey       = _mm_set1_epi32(static_cast<int>(key & compareMask));
+    const __m128i vMask      = _mm_set1_epi32(static_cast<int>(compareMask));
+    const __m128i vAlphaLane = _mm_set1_epi32(static_cast<int>(alphaLane));
+    const __m128i vAlpha     = _mm_set1_epi32(static_cast<int>(sf::priv::packPixel(0, 0, 0, alpha)));
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         ptr      = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i p        = _mm_loadu_si128(ptr);
+        const __m128i selected = _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(p, vMask), vKey), vAlphaLane);
+
+        _mm_storeu_si128(ptr, _mm_or_si128(_mm_andnot_si128(selected, p), _mm_and_si128(selected, vAlpha)));
+    }
+
+    maskFromColorScalar(pixels + i * 4, pixelCount - i, key, compareMask, alpha);
+}
+
+
+////////////////////////////////////////////////////////////
+void swapRedBlueSSE2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    const __m128i vGreenAlpha = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i vLow        = _mm_set1_epi32(0x000000FF);
+    const __m128i vHigh       = _mm_set1_epi32(0x00FF0000);
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         ptr = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i p   = _mm_loadu_si128(ptr);
+
+        const __m128i result = _mm_or_si128(_mm_and_si128(p, vGreenAlpha),
+                                            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), vLow),
+                                                         _mm_and_si128(_mm_slli_epi32(p, 16), vHigh)));
+
+        _mm_storeu_si128(ptr, result);
+    }
+
+    swapRedBlueScalar(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+void reverseRowSSE2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t begin = 0;
+    std::size_t end   = pixelCount;
+
+    for (; end - begin >= 8; begin += 4, end -= 4)
+    {
+        auto* left  = reinterpret_cast<__m128i*>(pixels + begin * 4);
+        auto* right = reinterpret_cast<__m128i*>(pixels + (end - 4) * 4);
+
+        const __m128i l = _mm_loadu_si128(left);
+        const __m128i r = _mm_loadu_si128(right);
+
+        _mm_storeu_si128(left, _mm_shuffle_epi32(r, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(right, _mm_shuffle_epi32(l, _MM_SHUFFLE(0, 1, 2, 3)));
+    }
+
+    reverseRowRange(pixels, begin, end);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i premultiplyHalfSSE2(__m128i p16, __m128i alphaLaneOnes)
+{
+    // Broadcast alpha of each of the two pixels, and force the multiplier of the alpha lane itself to 255
+    __m128i a16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(p16, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    a16         = _mm_or_si128(a16, alphaLaneOnes);
+
+    const __m128i t = _mm_add_epi16(_mm_mullo_epi16(p16, a16), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyAlphaSSE2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    const __m128i zero          = _mm_setzero_si128();
+    const __m128i alphaLaneOnes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         ptr = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i p   = _mm_loadu_si128(ptr);
+
+        const __m128i lo = premultiplyHalfSSE2(_mm_unpacklo_epi8(p, zero), alphaLaneOnes);
+        const __m128i hi = premultiplyHalfSSE2(_mm_unpackhi_epi8(p, zero), alphaLaneOnes);
+
+        _mm_storeu_si128(ptr, _mm_packus_epi16(lo, hi));
+    }
+
+    premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+// The division-based kernels below work on four pixels at once, one channel per register (x86 is little-endian)
+////////////////////////////////////////////////////////////
+template <int Shift>
+[[nodiscard, gnu::always_inline]] inline __m128i channelSSE2(__m128i p)
+{
+    return _mm_and_si128(_mm_srli_epi32(p, Shift), _mm_set1_epi32(0xFF));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i mul16SSE2(__m128i a, __m128i b)
+{
+    // Exact for 32-bit lanes holding values whose product fits in 16 bits
+    return _mm_mullo_epi16(a, b);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i divideSSE2(__m128i num, __m128i den, __m128 reciprocal)
+{
+    // The float estimate is off by at most one, fix it up using the exact integer remainder
+    __m128i       q         = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(num), reciprocal));
+    const __m128i remainder = _mm_sub_epi32(num, mul16SSE2(q, den));
+
+    q = _mm_add_epi32(q, _mm_cmplt_epi32(remainder, _mm_setzero_si128()));
+    q = _mm_sub_epi32(q, _mm_cmpgt_epi32(remainder, _mm_sub_epi32(den, _mm_set1_epi32(1))));
+
+    return q;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i selectSSE2(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyAlphaSSE2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    const __m128i c255 = _mm_set1_epi32(255);
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         ptr = reinterpret_cast<__m128i*>(pixels + i * 4);
+        const __m128i p   = _mm_loadu_si128(ptr);
+
+        const __m128i a           = _mm_srli_epi32(p, 24);
+        const __m128i halfA       = _mm_srli_epi32(a, 1);
+        const __m128  reciprocal  = _mm_div_ps(_mm_set1_ps(1.f), _mm_cvtepi32_ps(a));
+        const __m128i transparent = _mm_cmpeq_epi32(a, _mm_setzero_si128());
+
+        const auto unpremultiply = [&](const __m128i c)
+        {
+            const __m128i value = divideSSE2(_mm_add_epi32(mul16SSE2(c, c255), halfA), a, reciprocal);
+            return selectSSE2(transparent, c, selectSSE2(_mm_cmpgt_epi32(value, c255), c255, value));
+        };
+
+        const __m128i r = unpremultiply(channelSSE2<0>(p));
+        const __m128i g = unpremultiply(channelSSE2<8>(p));
+        const __m128i b = unpremultiply(channelSSE2<16>(p));
+
+        _mm_storeu_si128(ptr,
+                         _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                      _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24))));
+    }
+
+    unpremultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+void blendOverSSE2(std::uint8_t* dst, const std::uint8_t* src, std::size_t pixelCount)
+{
+    const __m128i one = _mm_set1_epi32(1);
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        auto*         dstPtr = reinterpret_cast<__m128i*>(dst + i * 4);
+        const __m128i d      = _mm_loadu_si128(dstPtr);
+        const __m128i s      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+
+        const __m128i srcAlpha = _mm_srli_epi32(s, 24);
+        const __m128i dstAlpha = _mm_srli_epi32(d, 24);
+
+        // outAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255, with an exact division by 255 for x < 65536
+        const __m128i product  = mul16SSE2(srcAlpha, dstAlpha);
+        const __m128i div255   = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(product, one), _mm_srli_epi32(product, 8)), 8);
+        const __m128i outAlpha = _mm_sub_epi32(_mm_add_epi32(srcAlpha, dstAlpha), div255);
+
+        const __m128i dstWeight   = _mm_sub_epi32(outAlpha, srcAlpha);
+        const __m128  reciprocal  = _mm_div_ps(_mm_set1_ps(1.f), _mm_cvtepi32_ps(outAlpha));
+        const __m128i transparent = _mm_cmpeq_epi32(outAlpha, _mm_setzero_si128());
+
+        // color = (src * srcAlpha + dst * (outAlpha - srcAlpha)) / outAlpha, or src if outAlpha is zero
+        const auto blend = [&](const __m128i srcColor, const __m128i dstColor)
+        {
+            const __m128i num = _mm_add_epi32(mul16SSE2(srcColor, srcAlpha), mul16SSE2(dstColor, dstWeight));
+            return selectSSE2(transparent, srcColor, divideSSE2(num, outAlpha, reciprocal));
+        };
+
+        const __m128i r = blend(channelSSE2<0>(s), channelSSE2<0>(d));
+        const __m128i g = blend(channelSSE2<8>(s), channelSSE2<8>(d));
+        const __m128i b = blend(channelSSE2<16>(s), channelSSE2<16>(d));
+
+        _mm_storeu_si128(dstPtr,
+                         _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                      _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(outAlpha, 24))));
+    }
+
+    blendOverScalar(dst + i * 4, src + i * 4, pixelCount - i);
+}
+
+#endif // SFML_PRIV_IMAGE_PIXEL_OPS_SSE2
+
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_AVX2
+
+////////////////////////////////////////////////////////////
+// AVX2 kernels, eight pixels per iteration, compiled for AVX2 regardless of the global target
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void maskFromColorAVX2(
+    std::uint8_t* pixels,
+    std::size_t   pixelCount,
+    std::uint32_t key,
+    std::uint32_t compareMask,
+    std::uint8_t  alpha)
+{
+    const std::uint32_t alphaLane = sf::priv::packPixel(0, 0, 0, 0xFF);
+
+    const __m256i vKey       = _mm256_set1_epi32(static_cast<int>(key & compareMask));
+    const __m256i vMask      = _mm256_set1_epi32(static_cast<int>(compareMask));
+    const __m256i vAlphaLane = _mm256_set1_epi32(static_cast<int>(alphaLane));
+    const __m256i vAlpha     = _mm256_set1_epi32(static_cast<int>(sf::priv::packPixel(0, 0, 0, alpha)));
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto*         ptr      = reinterpret_cast<__m256i*>(pixels + i * 4);
+        const __m256i p        = _mm256_loadu_si256(ptr);
+        const __m256i selected = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_and_si256(p, vMask), vKey), vAlphaLane);
+
+        _mm256_storeu_si256(ptr, _mm256_blendv_epi8(p, vAlpha, selected));
+    }
+
+    maskFromColorSSE2(pixels + i * 4, pixelCount - i, key, compareMask, alpha);
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void swapRedBlueAVX2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                             2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto* ptr = reinterpret_cast<__m256i*>(pixels + i * 4);
+        _mm256_storeu_si256(ptr, _mm256_shuffle_epi8(_mm256_loadu_si256(ptr), shuffle));
+    }
+
+    swapRedBlueSSE2(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void reverseRowAVX2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    std::size_t begin = 0;
+    std::size_t end   = pixelCount;
+
+    for (; end - begin >= 16; begin += 8, end -= 8)
+    {
+        auto* left  = reinterpret_cast<__m256i*>(pixels + begin * 4);
+        auto* right = reinterpret_cast<__m256i*>(pixels + (end - 8) * 4);
+
+        const __m256i l = _mm256_loadu_si256(left);
+        const __m256i r = _mm256_loadu_si256(right);
+
+        _mm256_storeu_si256(left, _mm256_permutevar8x32_epi32(r, reverse));
+        _mm256_storeu_si256(right, _mm256_permutevar8x32_epi32(l, reverse));
+    }
+
+    reverseRowRange(pixels, begin, end);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::target("avx2")]] inline __m256i premultiplyHalfAVX2(__m256i p16,
+                                                                                        __m256i alphaShuffle,
+                                                                                        __m256i alphaLaneOnes)
+{
+    const __m256i a16 = _mm256_or_si256(_mm256_shuffle_epi8(p16, alphaShuffle), alphaLaneOnes);
+    const __m256i t   = _mm256_add_epi16(_mm256_mullo_epi16(p16, a16), _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void premultiplyAlphaAVX2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    // Unpack and pack both operate within 128-bit lanes, so the pixel order is preserved
+    const __m256i zero          = _mm256_setzero_si256();
+    const __m256i alphaLaneOnes = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+    const __m256i alphaShuffle  = _mm256_setr_epi8(6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+                                                  6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto*         ptr = reinterpret_cast<__m256i*>(pixels + i * 4);
+        const __m256i p   = _mm256_loadu_si256(ptr);
+
+        const __m256i lo = premultiplyHalfAVX2(_mm256_unpacklo_epi8(p, zero), alphaShuffle, alphaLaneOnes);
+        const __m256i hi = premultiplyHalfAVX2(_mm256_unpackhi_epi8(p, zero), alphaShuffle, alphaLaneOnes);
+
+        _mm256_storeu_si256(ptr, _mm256_packus_epi16(lo, hi));
+    }
+
+    premultiplyAlphaSSE2(pixels + i * 4, pixelCount - i);
+}
+
+////////////////////////////////////////////////////////////
+template <int Shift>
+[[nodiscard, gnu::always_inline, gnu::target("avx2")]] inline __m256i channelAVX2(__m256i p)
+{
+    return _mm256_and_si256(_mm256_srli_epi32(p, Shift), _mm256_set1_epi32(0xFF));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::target("avx2")]] inline __m256i divideAVX2(__m256i num, __m256i den, __m256 reciprocal)
+{
+    __m256i       q         = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_cvtepi32_ps(num), reciprocal));
+    const __m256i remainder = _mm256_sub_epi32(num, _mm256_mullo_epi16(q, den));
+
+    q = _mm256_add_epi32(q, _mm256_cmpgt_epi32(_mm256_setzero_si256(), remainder));
+    q = _mm256_sub_epi32(q, _mm256_cmpgt_epi32(remainder, _mm256_sub_epi32(den, _mm256_set1_epi32(1))));
+
+    return q;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::target("avx2")]] inline __m256i unpremultiplyChannelAVX2(
+    __m256i c,
+    __m256i a,
+    __m256i halfA,
+    __m256  reciprocal,
+    __m256i transparent)
+{
+    const __m256i c255  = _mm256_set1_epi32(255);
+    const __m256i value = divideAVX2(_mm256_add_epi32(_mm256_mullo_epi16(c, c255), halfA), a, reciprocal);
+
+    return _mm256_blendv_epi8(_mm256_min_epi32(value, c255), c, transparent);
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void unpremultiplyAlphaAVX2(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto*         ptr = reinterpret_cast<__m256i*>(pixels + i * 4);
+        const __m256i p   = _mm256_loadu_si256(ptr);
+
+        const __m256i a           = _mm256_srli_epi32(p, 24);
+        const __m256i halfA       = _mm256_srli_epi32(a, 1);
+        const __m256  reciprocal  = _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_cvtepi32_ps(a));
+        const __m256i transparent = _mm256_cmpeq_epi32(a, _mm256_setzero_si256());
+
+        const __m256i r = unpremultiplyChannelAVX2(channelAVX2<0>(p), a, halfA, reciprocal, transparent);
+        const __m256i g = unpremultiplyChannelAVX2(channelAVX2<8>(p), a, halfA, reciprocal, transparent);
+        const __m256i b = unpremultiplyChannelAVX2(channelAVX2<16>(p), a, halfA, reciprocal, transparent);
+
+        _mm256_storeu_si256(ptr,
+                            _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                                            _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(a, 24))));
+    }
+
+    unpremultiplyAlphaSSE2(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::target("avx2")]] inline __m256i blendChannelAVX2(
+    __m256i srcColor,
+    __m256i dstColor,
+    __m256i srcAlpha,
+    __m256i dstWeight,
+    __m256i outAlpha,
+    __m256  reciprocal,
+    __m256i transparent)
+{
+    const __m256i num = _mm256_add_epi32(_mm256_mullo_epi16(srcColor, srcAlpha), _mm256_mullo_epi16(dstColor, dstWeight));
+    return _mm256_blendv_epi8(divideAVX2(num, outAlpha, reciprocal), srcColor, transparent);
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::target("avx2")]] void blendOverAVX2(std::uint8_t* dst, const std::uint8_t* src, std::size_t pixelCount)
+{
+    const __m256i one = _mm256_set1_epi32(1);
+
+    std::size_t i = 0;
+
+    for (; i + 8 <= pixelCount; i += 8)
+    {
+        auto*         dstPtr = reinterpret_cast<__m256i*>(dst + i * 4);
+        const __m256i d      = _mm256_loadu_si256(dstPtr);
+        const __m256i s      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+
+        const __m256i srcAlpha = _mm256_srli_epi32(s, 24);
+        const __m256i dstAlpha = _mm256_srli_epi32(d, 24);
+
+        const __m256i product = _mm256_mullo_epi16(srcAlpha, dstAlpha);
+        const __m256i div255 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(product, one), _mm256_srli_epi32(product, 8)),
+                                                 8);
+        const __m256i outAlpha = _mm256_sub_epi32(_mm256_add_epi32(srcAlpha, dstAlpha), div255);
+
+        const __m256i dstWeight   = _mm256_sub_epi32(outAlpha, srcAlpha);
+        const __m256  reciprocal  = _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_cvtepi32_ps(outAlpha));
+        const __m256i transparent = _mm256_cmpeq_epi32(outAlpha, _mm256_setzero_si256());
+
+        const __m256i r = blendChannelAVX2(channelAVX2<0>(s), channelAVX2<0>(d), srcAlpha, dstWeight, outAlpha, reciprocal, transparent);
+        const __m256i g = blendChannelAVX2(channelAVX2<8>(s), channelAVX2<8>(d), srcAlpha, dstWeight, outAlpha, reciprocal, transparent);
+        const __m256i b = blendChannelAVX2(channelAVX2<16>(s), channelAVX2<16>(d), srcAlpha, dstWeight, outAlpha, reciprocal, transparent);
+
+        _mm256_storeu_si256(dstPtr,
+                            _mm256_or_si256(_mm256_or_si256(r, _mm256_slli_epi32(g, 8)),
+                                            _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(outAlpha, 24))));
+    }
+
+    blendOverSSE2(dst + i * 4, src + i * 4, pixelCount - i);
+}
+
+#endif // SFML_PRIV_IMAGE_PIXEL_OPS_AVX2
+
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_NEON
+
+////////////////////////////////////////////////////////////
+// NEON kernels, sixteen pixels per iteration using de-interleaving loads
+////////////////////////////////////////////////////////////
+void maskFromColorNEON(std::uint8_t* pixels, std::size_t pixelCount, std::uint32_t key, std::uint32_t compareMask, std::uint8_t alpha)
+{
+    const uint32x4_t vKey       = vdupq_n_u32(key & compareMask);
+    const uint32x4_t vMask      = vdupq_n_u32(compareMask);
+    const uint32x4_t vAlphaLane = vdupq_n_u32(sf::priv::packPixel(0, 0, 0, 0xFF));
+    const uint32x4_t vAlpha     = vdupq_n_u32(sf::priv::packPixel(0, 0, 0, alpha));
+
+    std::size_t i = 0;
+
+    for (; i + 4 <= pixelCount; i += 4)
+    {
+        std::uint8_t*    ptr      = pixels + i * 4;
+        const uint32x4_t p        = vreinterpretq_u32_u8(vld1q_u8(ptr));
+        const uint32x4_t selected = vandq_u32(vceqq_u32(vandq_u32(p, vMask), vKey), vAlphaLane);
+
+        vst1q_u8(ptr, vreinterpretq_u8_u32(vbslq_u32(selected, vAlpha, p)));
+    }
+
+    maskFromColorScalar(pixels + i * 4, pixelCount - i, key, compareMask, alpha);
+}
+
+
+////////////////////////////////////////////////////////////
+void swapRedBlueNEON(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        uint8x16x4_t     p   = vld4q_u8(pixels + i * 4);
+        const uint8x16_t red = p.val[0];
+
+        p.val[0] = p.val[2];
+        p.val[2] = red;
+
+        vst4q_u8(pixels + i * 4, p);
+    }
+
+    swapRedBlueScalar(pixels + i * 4, pixelCount - i);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline uint32x4_t reverseNEON(uint32x4_t value)
+{
+    const uint32x4_t swapped = vrev64q_u32(value);
+    return vcombine_u32(vget_high_u32(swapped), vget_low_u32(swapped));
+}
+
+
+////////////////////////////////////////////////////////////
+void reverseRowNEON(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t begin = 0;
+    std::size_t end   = pixelCount;
+
+    for (; end - begin >= 8; begin += 4, end -= 4)
+    {
+        std::uint8_t* left  = pixels + begin * 4;
+        std::uint8_t* right = pixels + (end - 4) * 4;
+
+        const uint32x4_t l = vreinterpretq_u32_u8(vld1q_u8(left));
+        const uint32x4_t r = vreinterpretq_u32_u8(vld1q_u8(right));
+
+        vst1q_u8(left, vreinterpretq_u8_u32(reverseNEON(r)));
+        vst1q_u8(right, vreinterpretq_u8_u32(reverseNEON(l)));
+    }
+
+    reverseRowRange(pixels, begin, end);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline uint8x8_t mulDiv255NEON(uint8x8_t c, uint8x8_t a)
+{
+    // (t + 128 + ((t + 128) >> 8)) >> 8, identical to the scalar rounding
+    const uint16x8_t t = vmull_u8(c, a);
+    return vrshrn_n_u16(vrsraq_n_u16(t, t, 8), 8);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline uint8x16_t mulDiv255NEON(uint8x16_t c, uint8x16_t a)
+{
+    return vcombine_u8(mulDiv255NEON(vget_low_u8(c), vget_low_u8(a)), mulDiv255NEON(vget_high_u8(c), vget_high_u8(a)));
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyAlphaNEON(std::uint8_t* pixels, std::size_t pixelCount)
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= pixelCount; i += 16)
+    {
+        uint8x16x4_t p = vld4q_u8(pixels + i * 4);
+
+        p.val[0] = mulDiv255NEON(p.val[0], p.val[3]);
+        p.val[1] = mulDiv255NEON(p.val[1], p.val[3]);
+        p.val[2] = mulDiv255NEON(p.val[2], p.val[3]);
+
+        vst4q_u8(pixels + i * 4, p);
+    }
+
+    premultiplyAlphaScalar(pixels + i * 4, pixelCount - i);
+}
+
+#endif // SFML_PRIV_IMAGE_PIXEL_OPS_NEON
+
+
+////////////////////////////////////////////////////////////
+#if !defined(SFML_PRIV_IMAGE_PIXEL_OPS_SSE2) && !defined(SFML_PRIV_IMAGE_PIXEL_OPS_NEON)
+constexpr sf::priv::ImagePixelOps scalarOps{maskFromColorScalar,
+                                            swapRedBlueScalar,
+                                            reverseRowScalar,
+                                            premultiplyAlphaScalar,
+                                            unpremultiplyAlphaScalar,
+                                            blendOverScalar,
+                                            "scalar"};
+#endif
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_SSE2
+constexpr sf::priv::ImagePixelOps sse2Ops{maskFromColorSSE2,
+                                          swapRedBlueSSE2,
+                                          reverseRowSSE2,
+                                          premultiplyAlphaSSE2,
+                                          unpremultiplyAlphaSSE2,
+                                          blendOverSSE2,
+                                          "SSE2"};
+#endif
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_AVX2
+constexpr sf::priv::ImagePixelOps avx2Ops{maskFromColorAVX2,
+                                          swapRedBlueAVX2,
+                                          reverseRowAVX2,
+                                          premultiplyAlphaAVX2,
+                                          unpremultiplyAlphaAVX2,
+                                          blendOverAVX2,
+                                          "AVX2"};
+#endif
+
+#ifdef SFML_PRIV_IMAGE_PIXEL_OPS_NEON
+// Division-heavy kernels keep the scalar implementation
+constexpr sf::priv::ImagePixelOps neonOps{maskFromColorNEON,
+                                          swapRedBlueNEON,
+                                          reverseRowNEON,
+                                          premultiplyAlphaNEON,
+                                          unpremultiplyAlphaScalar,
+                                          blendOverScalar,
+                                          "NEON"};
+#endif
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] const sf::priv::ImagePixelOps& selectImagePixelOps()
+{
+#if defined(SFML_PRIV_IMAGE_PIXEL_OPS_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return avx2Ops;
+
+    return sse2Ops;
+#elif defined(SFML_PRIV_IMAGE_PIXEL_OPS_SSE2)
+    return sse2Ops;
+#elif defined(SFML_PRIV_IMAGE_PIXEL_OPS_NEON)
+    return neonOps;
+#else
+    return scalarOps;
+#endif
+}
+
+} // namespace ImagePixelOpsImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+const ImagePixelOps& getImagePixelOps()
+{
+    static const ImagePixelOps& ops = ImagePixelOpsImpl::selectImagePixelOps();
+    return ops;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t packPixel(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a)
+{
+    const std::uint8_t bytes[4]{r, g, b, a};
+    return ImagePixelOpsImpl::loadPixel(bytes);
+}
+
+
+////////////////////////////////////////////////////////////
+const std::uint8_t* getPackedRgbaPixels(ImageView view, std::vector<std::uint8_t>& storage)
+{
+    if (view.isContiguous() && view.format == PixelFormat::RGBA)
+        return view.pixels;
+
+    const std::size_t rowSize = static_cast<std::size_t>(view.size.x) * 4;
+    storage.resize(rowSize * view.size.y);
+
+    for (unsigned int y = 0; y < view.size.y; ++y)
+        std::memcpy(storage.data() + y * rowSize, view.getRow(y), rowSize);
+
+    if (view.format == PixelFormat::BGRA)
+        getImagePixelOps().swapRedBlue(storage.data(), storage.size() / 4);
+
+    return storage.data();
+}
+
+} // namespace sf::priv
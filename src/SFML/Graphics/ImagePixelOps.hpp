@@ -0,0 +1,108 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ImageView.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Table of bulk kernels operating on tightly packed RGBA8 pixels
+///
+/// Every kernel processes `pixelCount` consecutive 4-byte pixels
+/// and produces bit-identical results regardless of the instruction
+/// set it was compiled for. The best table for the running CPU is
+/// selected once, on first use.
+///
+////////////////////////////////////////////////////////////
+struct ImagePixelOps
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the alpha of every pixel matching `key` on the bits of `compareMask` to `alpha`
+    ///
+    /// `key` and `compareMask` are 4-byte RGBA patterns read in native byte order
+    /// (see `packPixel`), so that a mask with a zero alpha byte ignores the alpha channel.
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*maskFromColor)(std::uint8_t* pixels, std::size_t pixelCount, std::uint32_t key, std::uint32_t compareMask, std::uint8_t alpha);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Swap the red and blue channels (RGBA <-> BGRA)
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*swapRedBlue)(std::uint8_t* pixels, std::size_t pixelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reverse the order of the pixels of a single row
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*reverseRow)(std::uint8_t* pixels, std::size_t pixelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color channels by alpha, rounding to nearest
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*premultiplyAlpha)(std::uint8_t* pixels, std::size_t pixelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color channels by alpha, rounding to nearest
+    ///
+    /// Fully transparent pixels are left untouched.
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*unpremultiplyAlpha)(std::uint8_t* pixels, std::size_t pixelCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Composite `src` over `dst` using straight alpha
+    ///
+    /// Uses the same integer formula as the historical
+    /// `sf::Image::copy(..., applyAlpha = true)` implementation.
+    ///
+    ////////////////////////////////////////////////////////////
+    void (*blendOver)(std::uint8_t* dst, const std::uint8_t* src, std::size_t pixelCount);
+
+    const char* name; //!< Name of the instruction set used by the kernels
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Get the fastest kernel table supported by the running CPU
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] const ImagePixelOps& getImagePixelOps();
+
+////////////////////////////////////////////////////////////
+/// \brief Pack four channel values into a 4-byte pattern in native byte order
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint32_t packPixel(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a);
+
+////////////////////////////////////////////////////////////
+/// \brief Compute `c * a / 255`, rounding to nearest
+///
+/// Exact for all 8-bit inputs, used to premultiply a color channel by alpha.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline std::uint8_t mulDiv255(unsigned int c, unsigned int a)
+{
+    const unsigned int t = c * a + 128u;
+    return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+}
+
+////////////////////////////////////////////////////////////
+/// \brief Get the pixels of a view as tightly packed RGBA
+///
+/// Returns `view.pixels` directly if the view already has that
+/// layout, otherwise repacks the pixels into `storage`.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] const std::uint8_t* getPackedRgbaPixels(ImageView view, std::vector<std::uint8_t>& storage);
+
+} // namespace sf::priv
@@ -4,113 +4,193 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageEncoder.hpp"
+#include "SFML/Graphics/ImagePixelOps.hpp"
 #include "SFML/Graphics/ImageUtils.hpp"
+#include "SFML/Graphics/ImageView.hpp"
 
-#include "SFML/System/Err.hpp"
 #include "SFML/System/Path.hpp"
-#include "SFML/System/PathUtils.hpp"
 #include "SFML/System/Vector2.hpp"
 
 #include "SFML/Base/Assert.hpp"
-
-#define STB_IMAGE_WRITE_STATIC
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <stb_image_write.h>
-
-#include <string>
+#include "SFML/Base/Optional.hpp"
 
 #include <cstring>
 
 
 namespace
 {
-// stb_image callback for constructing a buffer
-void bufferFromCallback(void* context, void* data, int size)
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ImageUtilsImpl
+{
+// Image formats store straight alpha: undo the premultiplication on a copy if needed
+[[nodiscard]] sf::ImageView getStraightAlphaView(const sf::Image& image, sf::base::Optional<sf::Image>& storage)
+{
+    if (!image.isAlphaPremultiplied())
+        return image.asImageView();
+
+    storage.emplace(image);
+    storage->unpremultiplyAlpha();
+    return storage->asImageView();
+}
+
+// Run a kernel over all the pixels of a view, in a single call if the rows are contiguous
+template <typename Kernel>
+void forEachRow(sf::MutableImageView view, Kernel&& kernel)
+{
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
+
+    if (view.isContiguous())
+    {
+        kernel(view.pixels, static_cast<std::size_t>(view.size.x) * view.size.y);
+        return;
+    }
+
+    for (unsigned int y = 0; y < view.size.y; ++y)
+        kernel(view.getRow(y), static_cast<std::size_t>(view.size.x));
+}
+
+// Pack a color into the native byte order of a view's pixels
+[[nodiscard]] std::uint32_t packColor(sf::PixelFormat format, sf::Color color, std::uint8_t alpha)
+{
+    return format == sf::PixelFormat::BGRA ? sf::priv::packPixel(color.b, color.g, color.r, alpha)
+                                           : sf::priv::packPixel(color.r, color.g, color.b, alpha);
+}
+
+// Swap two non-overlapping byte ranges in cache-friendly chunks
+void swapRows(std::uint8_t* a, std::uint8_t* b, std::size_t size)
 {
-    const auto* source = static_cast<std::uint8_t*>(data);
-    auto*       dest   = static_cast<std::vector<std::uint8_t>*>(context);
+    std::uint8_t buffer[512];
 
-    dest->insert(dest->end(), source, source + size);
+    while (size > 0)
+    {
+        const std::size_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+
+        std::memcpy(buffer, a, chunk);
+        std::memcpy(a, b, chunk);
+        std::memcpy(b, buffer, chunk);
+
+        a += chunk;
+        b += chunk;
+        size -= chunk;
+    }
 }
 
+} // namespace ImageUtilsImpl
 } // namespace
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-bool ImageUtils::saveToFile(const Image& image, const Path& filename)
+bool ImageUtils::saveToFile(const Image& image, const Path& filename, const ImageSaveOptions& options)
+{
+    base::Optional<Image> straightImage;
+    return saveToFile(ImageUtilsImpl::getStraightAlphaView(image, straightImage), filename, options);
+}
+
+
+////////////////////////////////////////////////////////////
+std::vector<std::uint8_t> ImageUtils::saveToMemory(const Image& image, SaveFormat format, const ImageSaveOptions& options)
 {
-    // Extract the extension
-    const Path extension     = filename.extension();
-    const auto convertedSize = image.getSize().to<Vector2i>();
+    base::Optional<Image> straightImage;
+    return saveToMemory(ImageUtilsImpl::getStraightAlphaView(image, straightImage), format, options);
+}
 
-    // Deduce the image type from its extension
-    if (extension == ".bmp")
-    {
-        // BMP format
-        if (stbi_write_bmp(filename.to<std::string>().c_str(), convertedSize.x, convertedSize.y, 4, image.getPixelsPtr()))
-            return true;
-    }
-    else if (extension == ".tga")
-    {
-        // TGA format
-        if (stbi_write_tga(filename.to<std::string>().c_str(), convertedSize.x, convertedSize.y, 4, image.getPixelsPtr()))
-            return true;
-    }
-    else if (extension == ".png")
-    {
-        // PNG format
-        if (stbi_write_png(filename.to<std::string>().c_str(), convertedSize.x, convertedSize.y, 4, image.getPixelsPtr(), 0))
-            return true;
-    }
-    else if (extension == ".jpg" || extension == ".jpeg")
-    {
-        // JPG format
-        if (stbi_write_jpg(filename.to<std::string>().c_str(), convertedSize.x, convertedSize.y, 4, image.getPixelsPtr(), 90))
-            return true;
-    }
-    else
-    {
-        priv::err() << "Image file extension " << extension << " not supported\n";
-    }
 
-    priv::err() << "Failed to save image\n" << priv::PathDebugFormatter{filename};
-    return false;
+////////////////////////////////////////////////////////////
+bool ImageUtils::saveToFile(ImageView view, const Path& filename, const ImageSaveOptions& options)
+{
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
+
+    ImageEncoder encoder;
+    return encoder.encodeToFile(view, filename, options);
 }
 
 
 ////////////////////////////////////////////////////////////
-std::vector<std::uint8_t> ImageUtils::saveToMemory(const Image& image, SaveFormat format)
+std::vector<std::uint8_t> ImageUtils::saveToMemory(ImageView view, SaveFormat format, const ImageSaveOptions& options)
 {
-    // Choose function based on format
-    const auto convertedSize = image.getSize().to<Vector2i>();
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
 
     std::vector<std::uint8_t> buffer; // Use a single local variable for NRVO
 
-    if (format == SaveFormat::BMP)
-    {
-        if (stbi_write_bmp_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, image.getPixelsPtr()))
-            return buffer; // Non-empty
-    }
-    else if (format == SaveFormat::TGA)
-    {
-        if (stbi_write_tga_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, image.getPixelsPtr()))
-            return buffer; // Non-empty
-    }
-    else if (format == SaveFormat::PNG)
-    {
-        if (stbi_write_png_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, image.getPixelsPtr(), 0))
-            return buffer; // Non-empty
-    }
-    else if (format == SaveFormat::JPG)
-    {
-        if (stbi_write_jpg_to_func(bufferFromCallback, &buffer, convertedSize.x, convertedSize.y, 4, image.getPixelsPtr(), 90))
-            return buffer; // Non-empty
-    }
+    ImageEncoder encoder;
+    [[maybe_unused]] const bool success = encoder.encode(view, format, buffer, options);
+    SFML_BASE_ASSERT(success || buffer.empty());
 
-    SFML_BASE_ASSERT(false);
     return buffer;
 }
 
+
+////////////////////////////////////////////////////////////
+void ImageUtils::createMaskFromColor(MutableImageView view, Color color, std::uint8_t alpha)
+{
+    const priv::ImagePixelOps& ops = priv::getImagePixelOps();
+    const std::uint32_t        key = ImageUtilsImpl::packColor(view.format, color, color.a);
+
+    ImageUtilsImpl::forEachRow(view,
+                               [&](std::uint8_t* pixels, std::size_t count)
+                               { ops.maskFromColor(pixels, count, key, 0xFFFFFFFFu, alpha); });
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::applyColorKey(MutableImageView view, Color key, std::uint8_t alpha)
+{
+    const priv::ImagePixelOps& ops         = priv::getImagePixelOps();
+    const std::uint32_t        packedKey   = ImageUtilsImpl::packColor(view.format, key, 0);
+    const std::uint32_t        compareMask = priv::packPixel(0xFF, 0xFF, 0xFF, 0);
+
+    // Compare the color channels only, the current alpha of the pixels is irrelevant
+    ImageUtilsImpl::forEachRow(view,
+                               [&](std::uint8_t* pixels, std::size_t count)
+                               { ops.maskFromColor(pixels, count, packedKey, compareMask, alpha); });
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::flipHorizontally(MutableImageView view)
+{
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
+
+    const priv::ImagePixelOps& ops = priv::getImagePixelOps();
+
+    for (unsigned int y = 0; y < view.size.y; ++y)
+        ops.reverseRow(view.getRow(y), view.size.x);
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::flipVertically(MutableImageView view)
+{
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.size.x > 0 && view.size.y > 0);
+
+    const std::size_t rowSize = static_cast<std::size_t>(view.size.x) * 4;
+
+    for (unsigned int y = 0; y < view.size.y / 2; ++y)
+        ImageUtilsImpl::swapRows(view.getRow(y), view.getRow(view.size.y - 1 - y), rowSize);
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::premultiplyAlpha(MutableImageView view)
+{
+    ImageUtilsImpl::forEachRow(view, priv::getImagePixelOps().premultiplyAlpha);
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::unpremultiplyAlpha(MutableImageView view)
+{
+    ImageUtilsImpl::forEachRow(view, priv::getImagePixelOps().unpremultiplyAlpha);
+}
+
+
+////////////////////////////////////////////////////////////
+void ImageUtils::swapRedBlueChannels(MutableImageView view)
+{
+    ImageUtilsImpl::forEachRow(view, priv::getImagePixelOps().swapRedBlue);
+}
+
 } // namespace sf
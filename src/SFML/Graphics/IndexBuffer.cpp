@@ -0,0 +1,185 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace IndexBufferImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum usageToGlEnum(sf::IndexBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::IndexBuffer::Usage::Static:
+            return GL_STATIC_DRAW;
+        case sf::IndexBuffer::Usage::Dynamic:
+            return GL_DYNAMIC_DRAW;
+        default:
+            return GL_STREAM_DRAW;
+    }
+}
+
+} // namespace IndexBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::Optional<IndexBuffer> IndexBuffer::create(GraphicsContext& graphicsContext, std::size_t indexCount, Usage usage)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    if (indexCount == 0u)
+    {
+        priv::err() << "Failed to create index buffer, size is zero";
+        return base::nullOpt;
+    }
+
+    GLuint buffer{};
+    glCheck(glGenBuffers(1, &buffer));
+
+    if (!buffer)
+    {
+        priv::err() << "Failed to create index buffer, generation failed";
+        return base::nullOpt;
+    }
+
+    // `GL_ELEMENT_ARRAY_BUFFER` is vertex array state, use a target that leaves the bound vertex array untouched
+    graphicsContext.getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+    glCheck(glBufferData(GL_COPY_WRITE_BUFFER,
+                         static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                         nullptr,
+                         IndexBufferImpl::usageToGlEnum(usage)));
+    graphicsContext.getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    return base::makeOptional<IndexBuffer>(base::PassKey<IndexBuffer>{}, graphicsContext, buffer, indexCount, usage);
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(base::PassKey<IndexBuffer>&&,
+                         GraphicsContext& graphicsContext,
+                         unsigned int     buffer,
+                         std::size_t      indexCount,
+                         Usage            usage) :
+m_graphicsContext(&graphicsContext),
+m_buffer(buffer),
+m_indexCount(indexCount),
+m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::~IndexBuffer()
+{
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+        priv::GLStateCache::invalidateObjectBindings();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::IndexBuffer(IndexBuffer&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_buffer(base::exchange(right.m_buffer, 0u)),
+m_indexCount(base::exchange(right.m_indexCount, 0u)),
+m_usage(right.m_usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer& IndexBuffer::operator=(IndexBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+        priv::GLStateCache::invalidateObjectBindings();
+    }
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_buffer          = base::exchange(right.m_buffer, 0u);
+    m_indexCount      = base::exchange(right.m_indexCount, 0u);
+    m_usage           = right.m_usage;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool IndexBuffer::update(const IndexType* indices, std::size_t indexCount, std::size_t offset)
+{
+    SFML_BASE_ASSERT(indices != nullptr || indexCount == 0u);
+
+    if (offset > m_indexCount || indexCount > m_indexCount - offset)
+    {
+        priv::err() << "Failed to update index buffer, range [" << offset << ", " << offset + indexCount
+                    << ") exceeds the buffer size " << m_indexCount;
+        return false;
+    }
+
+    if (indexCount == 0u)
+        return true;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
+    glCheck(glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(sizeof(IndexType) * offset),
+                            static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                            indices));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t IndexBuffer::getIndexCount() const
+{
+    return m_indexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+IndexBuffer::Usage IndexBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int IndexBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+} // namespace sf
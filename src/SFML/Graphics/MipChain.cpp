@@ -0,0 +1,191 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/MipChain.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MipChain::MipChain(base::PassKey<MipChain>&&, std::vector<Image>&& levels) : m_levels(SFML_BASE_MOVE(levels))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<MipChain> MipChain::create(const Image& image)
+{
+    base::Optional<MipChain> result; // Use a single local variable for NRVO
+
+    const Vector2u     size       = image.getSize();
+    const unsigned int levelCount = getFullLevelCount(size);
+
+    std::vector<Image> levels;
+    levels.reserve(levelCount);
+    levels.push_back(image);
+
+    // Downscale each level from the previous one rather than from level 0, which is much cheaper
+    for (unsigned int level = 1u; level < levelCount; ++level)
+    {
+        base::Optional<Image> downscaled = levels.back().createDownscaled(getLevelSize(size, level));
+
+        if (!downscaled.hasValue())
+        {
+            priv::err() << "Failed to create mipmap chain, could not downscale level " << level;
+            return result; // Empty optional
+        }
+
+        levels.push_back(SFML_BASE_MOVE(*downscaled));
+    }
+
+    result.emplace(base::PassKey<MipChain>{}, SFML_BASE_MOVE(levels));
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<MipChain> MipChain::create(std::vector<Image>&& levels)
+{
+    base::Optional<MipChain> result; // Use a single local variable for NRVO
+
+    if (levels.empty())
+    {
+        priv::err() << "Failed to create mipmap chain, no level provided";
+        return result; // Empty optional
+    }
+
+    const Vector2u size = levels.front().getSize();
+
+    if (levels.size() > getFullLevelCount(size))
+    {
+        priv::err() << "Failed to create mipmap chain, too many levels (" << levels.size() << ") for a " << size.x
+                    << "x" << size.y << " image";
+        return result; // Empty optional
+    }
+
+    for (unsigned int level = 1u; level < levels.size(); ++level)
+    {
+        const Vector2u expectedSize = getLevelSize(size, level);
+        const Vector2u actualSize   = levels[level].getSize();
+
+        if (actualSize != expectedSize)
+        {
+            priv::err() << "Failed to create mipmap chain, level " << level << " is " << actualSize.x << "x"
+                        << actualSize.y << " instead of " << expectedSize.x << "x" << expectedSize.y;
+            return result; // Empty optional
+        }
+    }
+
+    result.emplace(base::PassKey<MipChain>{}, SFML_BASE_MOVE(levels));
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int MipChain::getFullLevelCount(Vector2u size)
+{
+    unsigned int largest    = size.x > size.y ? size.x : size.y;
+    unsigned int levelCount = 1u;
+
+    while (largest > 1u)
+    {
+        largest >>= 1u;
+        ++levelCount;
+    }
+
+    return levelCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u MipChain::getLevelSize(Vector2u size, unsigned int level)
+{
+    SFML_BASE_ASSERT(level < 32u);
+
+    const unsigned int width  = size.x >> level;
+    const unsigned int height = size.y >> level;
+
+    return {width > 0u ? width : 1u, height > 0u ? height : 1u};
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int MipChain::getLevelCount() const
+{
+    return static_cast<unsigned int>(m_levels.size());
+}
+
+
+////////////////////////////////////////////////////////////
+const Image& MipChain::getLevel(unsigned int level) const
+{
+    SFML_BASE_ASSERT(level < m_levels.size() && "MipChain::getLevel() level index out of range");
+    return m_levels[level];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u MipChain::getSize() const
+{
+    return m_levels.front().getSize();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MipChain::getLevelByteCount(unsigned int level) const
+{
+    const Vector2u size = getLevel(level).getSize();
+    return static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y) * 4u;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t MipChain::getByteCount(unsigned int firstLevel) const
+{
+    std::size_t byteCount = 0u;
+
+    for (unsigned int level = firstLevel; level < m_levels.size(); ++level)
+        byteCount += getLevelByteCount(level);
+
+    return byteCount;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int MipChain::selectLevel(Vector2f displaySize) const
+{
+    unsigned int level = 0u;
+
+    while (level + 1u < m_levels.size())
+    {
+        const Vector2u size     = m_levels[level].getSize();
+        const Vector2u nextSize = m_levels[level + 1u].getSize();
+
+        // An axis that stopped shrinking (already 1 pixel) loses nothing in the next level
+        const bool xIsEnough = nextSize.x == size.x || static_cast<float>(nextSize.x) >= displaySize.x;
+        const bool yIsEnough = nextSize.y == size.y || static_cast<float>(nextSize.y) >= displaySize.y;
+
+        if (!xIsEnough || !yIsEnough)
+            break;
+
+        ++level;
+    }
+
+    return level;
+}
+
+} // namespace sf
@@ -0,0 +1,121 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ParallelFor.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+ParallelFor::ParallelFor(unsigned int threadCount) :
+m_threadCount(threadCount == 0u ? base::max(std::thread::hardware_concurrency(), 1u) : threadCount)
+{
+    m_workers.reserve(m_threadCount - 1u);
+
+    // The thread calling `run` processes blocks as well
+    for (unsigned int i = 1u; i < m_threadCount; ++i)
+        m_workers.emplace_back([this] { runWorker(); });
+}
+
+
+////////////////////////////////////////////////////////////
+ParallelFor::~ParallelFor()
+{
+    {
+        const std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+
+    m_workAvailable.notify_all();
+
+    for (std::thread& worker : m_workers)
+        worker.join();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ParallelFor::getThreadCount() const
+{
+    return m_threadCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParallelFor::dispatch(std::size_t itemCount, std::size_t blockSize, BlockFunc blockFunc, const void* context)
+{
+    SFML_BASE_ASSERT(blockSize > 0u);
+
+    m_itemCount = itemCount;
+    m_blockSize = blockSize;
+    m_blockFunc = blockFunc;
+    m_context   = context;
+    m_nextBlock.store(0u, std::memory_order_relaxed);
+
+    if (m_workers.empty() || itemCount <= blockSize)
+    {
+        processBlocks();
+        return;
+    }
+
+    // The workers read the parameters of the run after locking the mutex, which publishes them
+    {
+        const std::lock_guard lock(m_mutex);
+        m_busyWorkers = static_cast<unsigned int>(m_workers.size());
+        ++m_generation;
+    }
+
+    m_workAvailable.notify_all();
+    processBlocks();
+
+    std::unique_lock lock(m_mutex);
+    m_workFinished.wait(lock, [&] { return m_busyWorkers == 0u; });
+}
+
+
+////////////////////////////////////////////////////////////
+void ParallelFor::processBlocks()
+{
+    for (std::size_t block = m_nextBlock.fetch_add(1u, std::memory_order_relaxed);
+         block * m_blockSize < m_itemCount;
+         block = m_nextBlock.fetch_add(1u, std::memory_order_relaxed))
+    {
+        const std::size_t begin = block * m_blockSize;
+        m_blockFunc(m_context, begin, base::min(begin + m_blockSize, m_itemCount));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ParallelFor::runWorker()
+{
+    unsigned int seenGeneration = 0u;
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_workAvailable.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+
+            if (m_stopping)
+                return;
+
+            seenGeneration = m_generation;
+        }
+
+        processBlocks();
+
+        {
+            const std::lock_guard lock(m_mutex);
+
+            if (--m_busyWorkers == 0u)
+                m_workFinished.notify_one();
+        }
+    }
+}
+
+} // namespace sf::priv
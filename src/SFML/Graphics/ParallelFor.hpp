@@ -0,0 +1,127 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Pool of worker threads processing a range of items in blocks
+///
+/// The thread calling `run` processes blocks as well, so a
+/// pool of `threadCount` threads starts `threadCount - 1`
+/// workers. The workers sleep between two calls to `run`.
+///
+////////////////////////////////////////////////////////////
+class ParallelFor
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// \param threadCount Number of threads, the calling thread included, 0 to use one per hardware thread
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit ParallelFor(unsigned int threadCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop and join the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    ~ParallelFor();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ParallelFor(const ParallelFor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    ParallelFor& operator=(const ParallelFor&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Call `func(begin, end)` for each block of `[0, itemCount)`, spread over the threads
+    ///
+    /// Blocks don't overlap, so each item is only ever processed
+    /// by one thread. Returns once all the blocks are processed.
+    /// Ranges of a single block are processed by the calling
+    /// thread only, without waking the workers.
+    ///
+    /// \param itemCount Number of items to process
+    /// \param blockSize Number of items processed by a thread at once
+    /// \param func      Function processing the items of a block
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Func>
+    void run(std::size_t itemCount, std::size_t blockSize, const Func& func)
+    {
+        dispatch(itemCount,
+                 blockSize,
+                 [](const void* context, std::size_t begin, std::size_t end)
+                 { (*static_cast<const Func*>(context))(begin, end); },
+                 &func);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of threads, the calling thread included
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getThreadCount() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function processing the items of a block
+    ///
+    ////////////////////////////////////////////////////////////
+    using BlockFunc = void (*)(const void* context, std::size_t begin, std::size_t end);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Type erased implementation of `run`
+    ///
+    ////////////////////////////////////////////////////////////
+    void dispatch(std::size_t itemCount, std::size_t blockSize, BlockFunc blockFunc, const void* context);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process the blocks left, called by each thread
+    ///
+    ////////////////////////////////////////////////////////////
+    void processBlocks();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Loop of the worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    void runWorker();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::size_t              m_itemCount{};   //!< Number of items of the current run
+    std::size_t              m_blockSize{};   //!< Number of items per block of the current run
+    BlockFunc                m_blockFunc{};   //!< Function of the current run
+    const void*              m_context{};     //!< Context passed to the function of the current run
+    std::atomic<std::size_t> m_nextBlock{};   //!< Next block to process
+    unsigned int             m_threadCount;   //!< Number of threads, the calling thread included
+    std::mutex               m_mutex;         //!< Protects the members below
+    std::condition_variable  m_workAvailable; //!< Wakes the workers when a run starts
+    std::condition_variable  m_workFinished;  //!< Wakes `run` when the workers are done
+    unsigned int             m_generation{};  //!< Incremented by each run dispatched to the workers
+    unsigned int             m_busyWorkers{}; //!< Number of workers still processing blocks
+    bool                     m_stopping{};    //!< Set by the destructor to stop the workers
+    std::vector<std::thread> m_workers;       //!< Worker threads
+};
+
+} // namespace sf::priv
@@ -0,0 +1,516 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/ParallelFor.hpp"
+#include "SFML/Graphics/ParticleSystem.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_PRIV_PARTICLE_SYSTEM_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ParticleSystemImpl
+{
+////////////////////////////////////////////////////////////
+// Number of particles processed by a thread at once, large enough to amortize the scheduling
+constexpr std::size_t blockSize = 16'384u;
+
+
+////////////////////////////////////////////////////////////
+// Attributes of the particles, one array each, indexed by particle
+struct Particles
+{
+    std::vector<float>     positionsX;       //!< Horizontal positions
+    std::vector<float>     positionsY;       //!< Vertical positions
+    std::vector<float>     velocitiesX;      //!< Horizontal velocities
+    std::vector<float>     velocitiesY;      //!< Vertical velocities
+    std::vector<float>     remainingTimes;   //!< Remaining lifetimes, the particle expires at 0
+    std::vector<float>     inverseLifetimes; //!< Inverses of the initial lifetimes, to compute the age fraction
+    std::vector<float>     sizes;            //!< Widths and heights
+    std::vector<sf::Color> colors;           //!< Emitted colors
+};
+
+
+////////////////////////////////////////////////////////////
+// Parameters of the integration of an update, shared by all the particles
+struct IntegrationParams
+{
+    float deltaTime;     //!< Time elapsed since the last update, in seconds
+    float velocityScale; //!< Drag factor applied to the velocities
+    float accelerationX; //!< Velocity gained along X, already multiplied by the delta time
+    float accelerationY; //!< Velocity gained along Y, already multiplied by the delta time
+};
+
+
+////////////////////////////////////////////////////////////
+void integrateScalar(Particles& particles, std::size_t begin, std::size_t end, const IntegrationParams& params)
+{
+    float* const positionsX     = particles.positionsX.data();
+    float* const positionsY     = particles.positionsY.data();
+    float* const velocitiesX    = particles.velocitiesX.data();
+    float* const velocitiesY    = particles.velocitiesY.data();
+    float* const remainingTimes = particles.remainingTimes.data();
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        velocitiesX[i] = (velocitiesX[i] + params.accelerationX) * params.velocityScale;
+        velocitiesY[i] = (velocitiesY[i] + params.accelerationY) * params.velocityScale;
+        positionsX[i] += velocitiesX[i] * params.deltaTime;
+        positionsY[i] += velocitiesY[i] * params.deltaTime;
+        remainingTimes[i] -= params.deltaTime;
+    }
+}
+
+
+#ifdef SFML_PRIV_PARTICLE_SYSTEM_SSE2
+
+////////////////////////////////////////////////////////////
+// SSE2 kernel, four particles per iteration, same operations as the scalar one
+void integrateSSE2(Particles& particles, std::size_t begin, std::size_t end, const IntegrationParams& params)
+{
+    float* const positionsX     = particles.positionsX.data();
+    float* const positionsY     = particles.positionsY.data();
+    float* const velocitiesX    = particles.velocitiesX.data();
+    float* const velocitiesY    = particles.velocitiesY.data();
+    float* const remainingTimes = particles.remainingTimes.data();
+
+    const __m128 vDeltaTime     = _mm_set1_ps(params.deltaTime);
+    const __m128 vVelocityScale = _mm_set1_ps(params.velocityScale);
+    const __m128 vAccelerationX = _mm_set1_ps(params.accelerationX);
+    const __m128 vAccelerationY = _mm_set1_ps(params.accelerationY);
+
+    std::size_t i = begin;
+
+    for (; i + 4u <= end; i += 4u)
+    {
+        const __m128 velocityX = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocitiesX + i), vAccelerationX), vVelocityScale);
+        const __m128 velocityY = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocitiesY + i), vAccelerationY), vVelocityScale);
+
+        _mm_storeu_ps(velocitiesX + i, velocityX);
+        _mm_storeu_ps(velocitiesY + i, velocityY);
+        _mm_storeu_ps(positionsX + i, _mm_add_ps(_mm_loadu_ps(positionsX + i), _mm_mul_ps(velocityX, vDeltaTime)));
+        _mm_storeu_ps(positionsY + i, _mm_add_ps(_mm_loadu_ps(positionsY + i), _mm_mul_ps(velocityY, vDeltaTime)));
+        _mm_storeu_ps(remainingTimes + i, _mm_sub_ps(_mm_loadu_ps(remainingTimes + i), vDeltaTime));
+    }
+
+    integrateScalar(particles, i, end, params);
+}
+
+#endif // SFML_PRIV_PARTICLE_SYSTEM_SSE2
+
+
+////////////////////////////////////////////////////////////
+void integrate(Particles& particles, std::size_t begin, std::size_t end, const IntegrationParams& params)
+{
+#ifdef SFML_PRIV_PARTICLE_SYSTEM_SSE2
+    integrateSSE2(particles, begin, end, params);
+#else
+    integrateScalar(particles, begin, end, params);
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+// Texture coordinates of the corners of the particles, in pixels
+struct TexCoordsRect
+{
+    std::uint16_t left;   //!< Left coordinate
+    std::uint16_t top;    //!< Top coordinate
+    std::uint16_t right;  //!< Right coordinate
+    std::uint16_t bottom; //!< Bottom coordinate
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint16_t toTexCoord(int coordinate)
+{
+    return static_cast<std::uint16_t>(sf::base::clamp(coordinate, 0, 65'535));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] TexCoordsRect toTexCoordsRect(const sf::IntRect& rect)
+{
+    return {toTexCoord(rect.position.x),
+            toTexCoord(rect.position.y),
+            toTexCoord(rect.position.x + rect.size.x),
+            toTexCoord(rect.position.y + rect.size.y)};
+}
+
+
+////////////////////////////////////////////////////////////
+void writeVertices(const Particles&     particles,
+                   std::size_t          begin,
+                   std::size_t          end,
+                   const TexCoordsRect& texCoords,
+                   bool                 fadeOut,
+                   sf::VertexCompact*   vertices)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const float halfSize = particles.sizes[i] * 0.5f;
+        const float left     = particles.positionsX[i] - halfSize;
+        const float top      = particles.positionsY[i] - halfSize;
+        const float right    = particles.positionsX[i] + halfSize;
+        const float bottom   = particles.positionsY[i] + halfSize;
+
+        sf::Color color = particles.colors[i];
+
+        if (fadeOut)
+        {
+            const float remaining = particles.remainingTimes[i] * particles.inverseLifetimes[i];
+            color.a = static_cast<std::uint8_t>(static_cast<float>(color.a) * sf::base::clamp(remaining, 0.f, 1.f));
+        }
+
+        // Same corner order as the indices built by `draw`
+        sf::VertexCompact* quad = vertices + i * 4u;
+        quad[0]                 = {{left, top}, color, {texCoords.left, texCoords.top}};
+        quad[1]                 = {{right, top}, color, {texCoords.right, texCoords.top}};
+        quad[2]                 = {{left, bottom}, color, {texCoords.left, texCoords.bottom}};
+        quad[3]                 = {{right, bottom}, color, {texCoords.right, texCoords.bottom}};
+    }
+}
+
+} // namespace ParticleSystemImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ParticleSystem::Impl
+{
+    explicit Impl(GraphicsContext& theGraphicsContext, unsigned int threadCount) :
+    graphicsContext(&theGraphicsContext),
+    vertexBuffer(theGraphicsContext, PrimitiveType::Triangles, VertexBuffer::Usage::Stream),
+    parallelFor(threadCount)
+    {
+    }
+
+    GraphicsContext* graphicsContext; //!< Graphics context owning the buffers
+
+    ParticleSystemImpl::Particles       particles;    //!< Attributes of the living particles
+    Vector2f                            acceleration; //!< Acceleration applied to all the particles
+    float                               drag{};       //!< Drag slowing down all the particles
+    bool                                fadeOut{};    //!< Fade the particles out over their lifetime?
+    IntRect                             textureRect;  //!< Area of the texture displayed by the particles
+    std::vector<VertexCompact>          vertices;     //!< Four vertices per particle, as of the last update or emission
+    mutable VertexBuffer                vertexBuffer; //!< Vertices uploaded by the last draw
+    mutable base::Optional<IndexBuffer> indexBuffer;  //!< Two triangles per particle, grown as needed
+    priv::ParallelFor                   parallelFor;  //!< Threads integrating the particles and writing their vertices
+};
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::ParticleSystem(GraphicsContext& graphicsContext, unsigned int threadCount) :
+m_impl(graphicsContext, threadCount)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ParticleSystem::~ParticleSystem() = default;
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::emit(const Particle& particle)
+{
+    emit(&particle, 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::emit(const Particle* particles, std::size_t particleCount)
+{
+    SFML_BASE_ASSERT(particles != nullptr || particleCount == 0u);
+
+    ParticleSystemImpl::Particles& storage = m_impl->particles;
+    const std::size_t              first   = storage.positionsX.size();
+
+    for (std::size_t i = 0u; i < particleCount; ++i)
+    {
+        const Particle& particle = particles[i];
+        SFML_BASE_ASSERT(particle.lifetime > 0.f && "ParticleSystem particle lifetime must be positive");
+
+        storage.positionsX.push_back(particle.position.x);
+        storage.positionsY.push_back(particle.position.y);
+        storage.velocitiesX.push_back(particle.velocity.x);
+        storage.velocitiesY.push_back(particle.velocity.y);
+        storage.remainingTimes.push_back(particle.lifetime);
+        storage.inverseLifetimes.push_back(1.f / particle.lifetime);
+        storage.sizes.push_back(particle.size);
+        storage.colors.push_back(particle.color);
+    }
+
+    // New particles are visible right away, without waiting for the next update
+    m_impl->vertices.resize(storage.positionsX.size() * 4u);
+    ParticleSystemImpl::writeVertices(storage,
+                                      first,
+                                      storage.positionsX.size(),
+                                      ParticleSystemImpl::toTexCoordsRect(m_impl->textureRect),
+                                      m_impl->fadeOut,
+                                      m_impl->vertices.data());
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::update(Time deltaTime)
+{
+    Impl& impl = *m_impl;
+
+    const float seconds = deltaTime.asSeconds();
+
+    const ParticleSystemImpl::IntegrationParams params{seconds,
+                                                       base::max(1.f - impl.drag * seconds, 0.f),
+                                                       impl.acceleration.x * seconds,
+                                                       impl.acceleration.y * seconds};
+
+    impl.parallelFor.run(impl.particles.positionsX.size(),
+                         ParticleSystemImpl::blockSize,
+                         [&](std::size_t begin, std::size_t end)
+                         { ParticleSystemImpl::integrate(impl.particles, begin, end, params); });
+
+    // Remove the expired particles by moving the last ones into their slots
+    ParticleSystemImpl::Particles& particles = impl.particles;
+    std::size_t                    count     = particles.positionsX.size();
+
+    for (std::size_t i = 0u; i < count;)
+    {
+        if (particles.remainingTimes[i] > 0.f)
+        {
+            ++i;
+            continue;
+        }
+
+        --count;
+        particles.positionsX[i]       = particles.positionsX[count];
+        particles.positionsY[i]       = particles.positionsY[count];
+        particles.velocitiesX[i]      = particles.velocitiesX[count];
+        particles.velocitiesY[i]      = particles.velocitiesY[count];
+        particles.remainingTimes[i]   = particles.remainingTimes[count];
+        particles.inverseLifetimes[i] = particles.inverseLifetimes[count];
+        particles.sizes[i]            = particles.sizes[count];
+        particles.colors[i]           = particles.colors[count];
+    }
+
+    particles.positionsX.resize(count);
+    particles.positionsY.resize(count);
+    particles.velocitiesX.resize(count);
+    particles.velocitiesY.resize(count);
+    particles.remainingTimes.resize(count);
+    particles.inverseLifetimes.resize(count);
+    particles.sizes.resize(count);
+    particles.colors.resize(count);
+
+    impl.vertices.resize(count * 4u);
+
+    const ParticleSystemImpl::TexCoordsRect texCoords = ParticleSystemImpl::toTexCoordsRect(impl.textureRect);
+
+    impl.parallelFor.run(count,
+                         ParticleSystemImpl::blockSize,
+                         [&](std::size_t begin, std::size_t end)
+                         {
+                             ParticleSystemImpl::writeVertices(particles,
+                                                               begin,
+                                                               end,
+                                                               texCoords,
+                                                               impl.fadeOut,
+                                                               impl.vertices.data());
+                         });
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::clear()
+{
+    ParticleSystemImpl::Particles& particles = m_impl->particles;
+
+    particles.positionsX.clear();
+    particles.positionsY.clear();
+    particles.velocitiesX.clear();
+    particles.velocitiesY.clear();
+    particles.remainingTimes.clear();
+    particles.inverseLifetimes.clear();
+    particles.sizes.clear();
+    particles.colors.clear();
+
+    m_impl->vertices.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::reserve(std::size_t particleCount)
+{
+    ParticleSystemImpl::Particles& particles = m_impl->particles;
+
+    particles.positionsX.reserve(particleCount);
+    particles.positionsY.reserve(particleCount);
+    particles.velocitiesX.reserve(particleCount);
+    particles.velocitiesY.reserve(particleCount);
+    particles.remainingTimes.reserve(particleCount);
+    particles.inverseLifetimes.reserve(particleCount);
+    particles.sizes.reserve(particleCount);
+    particles.colors.reserve(particleCount);
+
+    m_impl->vertices.reserve(particleCount * 4u);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ParticleSystem::getParticleCount() const
+{
+    return m_impl->particles.positionsX.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getParticlePosition(std::size_t index) const
+{
+    SFML_BASE_ASSERT(index < getParticleCount());
+
+    return {m_impl->particles.positionsX[index], m_impl->particles.positionsY[index]};
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setAcceleration(Vector2f acceleration)
+{
+    m_impl->acceleration = acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f ParticleSystem::getAcceleration() const
+{
+    return m_impl->acceleration;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setDrag(float drag)
+{
+    m_impl->drag = drag;
+}
+
+
+////////////////////////////////////////////////////////////
+float ParticleSystem::getDrag() const
+{
+    return m_impl->drag;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setFadeOutEnabled(bool enabled)
+{
+    m_impl->fadeOut = enabled;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ParticleSystem::isFadeOutEnabled() const
+{
+    return m_impl->fadeOut;
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::setTextureRect(const IntRect& rect)
+{
+    m_impl->textureRect = rect;
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& ParticleSystem::getTextureRect() const
+{
+    return m_impl->textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ParticleSystem::getThreadCount() const
+{
+    return m_impl->parallelFor.getThreadCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void ParticleSystem::draw(RenderTarget& target, const Texture* texture, RenderStates states) const
+{
+    const Impl&       impl          = *m_impl;
+    const std::size_t particleCount = impl.vertices.size() / 4u;
+
+    if (particleCount == 0u)
+        return;
+
+    // The indices never change, grow them geometrically so that they are rarely rebuilt
+    if (!impl.indexBuffer.hasValue() || impl.indexBuffer->getIndexCount() < particleCount * 6u)
+    {
+        std::size_t capacity = 1'024u;
+
+        while (capacity < particleCount)
+            capacity *= 2u;
+
+        std::vector<IndexType> indices;
+        indices.reserve(capacity * 6u);
+
+        for (std::size_t i = 0u; i < capacity; ++i)
+        {
+            const auto first = static_cast<IndexType>(i * 4u);
+
+            for (const IndexType corner : {0u, 1u, 2u, 2u, 1u, 3u})
+                indices.push_back(first + corner);
+        }
+
+        impl.indexBuffer = IndexBuffer::create(*impl.graphicsContext, indices.size(), IndexBuffer::Usage::Static);
+
+        if (!impl.indexBuffer.hasValue() || !impl.indexBuffer->update(indices.data(), indices.size()))
+        {
+            priv::err() << "Failed to create particle system index buffer";
+            impl.indexBuffer.reset();
+            return;
+        }
+    }
+
+    if (impl.vertexBuffer.getNativeHandle() == 0u &&
+        !impl.vertexBuffer.create(impl.vertices.size(), VertexFormat::Compact))
+        return;
+
+    if (!impl.vertexBuffer.update(impl.vertices.data(), impl.vertices.size(), 0u))
+        return;
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+    states.texture        = texture;
+
+    target.draw(impl.vertexBuffer, *impl.indexBuffer, 0u, particleCount * 6u, states);
+}
+
+} // namespace sf
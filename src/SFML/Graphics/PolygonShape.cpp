@@ -0,0 +1,360 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/PolygonShape.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/Transform.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PolygonShapeImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::FloatRect getVertexRangeBounds(const sf::Vertex* vertices, std::size_t vertexCount)
+{
+    if (vertexCount == 0u)
+        return {};
+
+    sf::Vector2f minimum = vertices[0].position;
+    sf::Vector2f maximum = vertices[0].position;
+
+    for (std::size_t i = 1u; i < vertexCount; ++i)
+    {
+        const sf::Vector2f position = vertices[i].position;
+
+        minimum = {sf::base::min(minimum.x, position.x), sf::base::min(minimum.y, position.y)};
+        maximum = {sf::base::max(maximum.x, position.x), sf::base::max(maximum.y, position.y)};
+    }
+
+    return {minimum, maximum - minimum};
+}
+
+} // namespace PolygonShapeImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+void PolygonShape::setPoints(const Vector2f* points, std::size_t pointCount)
+{
+    SFML_BASE_ASSERT(pointCount == 0u || points != nullptr);
+
+    m_points.assign(points, points + pointCount);
+    m_holeOffsets.clear();
+
+    m_fillDirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::addHole(const Vector2f* points, std::size_t pointCount)
+{
+    SFML_BASE_ASSERT(pointCount == 0u || points != nullptr);
+
+    m_holeOffsets.push_back(m_points.size());
+    m_points.insert(m_points.end(), points, points + pointCount);
+
+    m_fillDirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::clearHoles()
+{
+    if (m_holeOffsets.empty())
+        return;
+
+    m_points.resize(m_holeOffsets[0]);
+    m_holeOffsets.clear();
+
+    m_fillDirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setPoint(std::size_t index, Vector2f position)
+{
+    SFML_BASE_ASSERT(index < m_points.size() && "Index is out of bounds");
+
+    m_points[index] = position;
+    m_fillDirty     = true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getPointCount() const
+{
+    return m_points.size();
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f PolygonShape::getPoint(std::size_t index) const
+{
+    SFML_BASE_ASSERT(index < m_points.size() && "Index is out of bounds");
+    return m_points[index];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getHoleCount() const
+{
+    return m_holeOffsets.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setTextureRect(const IntRect& rect)
+{
+    m_textureRect = rect;
+
+    if (!m_fillDirty)
+        updateTexCoords();
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& PolygonShape::getTextureRect() const
+{
+    return m_textureRect;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setFillColor(Color color)
+{
+    m_fillColor = color;
+
+    if (m_fillDirty)
+        return;
+
+    // The triangulation does not depend on the colors, only recolor the fill vertices
+    for (std::size_t i = 0u; i < m_points.size(); ++i)
+        m_vertices[i].color = color;
+}
+
+
+////////////////////////////////////////////////////////////
+Color PolygonShape::getFillColor() const
+{
+    return m_fillColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setOutlineColor(Color color)
+{
+    m_outlineColor = color;
+
+    if (m_fillDirty || m_outlineDirty)
+        return;
+
+    for (std::size_t i = m_points.size(); i < m_vertices.size(); ++i)
+        m_vertices[i].color = color;
+}
+
+
+////////////////////////////////////////////////////////////
+Color PolygonShape::getOutlineColor() const
+{
+    return m_outlineColor;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::setOutlineThickness(float thickness)
+{
+    m_outlineThickness = thickness;
+    m_outlineDirty     = true;
+}
+
+
+////////////////////////////////////////////////////////////
+float PolygonShape::getOutlineThickness() const
+{
+    return m_outlineThickness;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getLocalBounds() const
+{
+    updateGeometry();
+    return m_bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect PolygonShape::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonShape::getFillIndexCount() const
+{
+    updateGeometry();
+    return m_fillIndexCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::appendGeometry(std::vector<Vertex>& vertices, std::vector<IndexType>& indices) const
+{
+    updateGeometry();
+
+    if (m_indices.empty())
+        return;
+
+    const Transform& transform   = getTransform();
+    const auto       indexOffset = static_cast<IndexType>(vertices.size());
+
+    vertices.reserve(vertices.size() + m_vertices.size());
+
+    for (const Vertex& vertex : m_vertices)
+        vertices.push_back({transform * vertex.position, vertex.color, vertex.texCoords});
+
+    indices.reserve(indices.size() + m_indices.size());
+
+    for (const IndexType index : m_indices)
+        indices.push_back(index + indexOffset);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::draw(RenderTarget& target, RenderStates states) const
+{
+    draw(target, nullptr, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::draw(RenderTarget& target, const Texture* texture, RenderStates states) const
+{
+    updateGeometry();
+
+    if (m_indices.empty())
+        return;
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+    states.texture        = texture;
+
+    // Without a texture, the fill and the outline are drawn at once
+    const std::size_t firstIndexCount = texture == nullptr ? m_indices.size() : m_fillIndexCount;
+
+    target.drawIndexedVertices(m_vertices.data(),
+                               m_vertices.size(),
+                               m_indices.data(),
+                               firstIndexCount,
+                               PrimitiveType::Triangles,
+                               states);
+
+    if (firstIndexCount == m_indices.size())
+        return;
+
+    states.texture = nullptr;
+    target.drawIndexedVertices(m_vertices.data(),
+                               m_vertices.size(),
+                               m_indices.data() + m_fillIndexCount,
+                               m_indices.size() - m_fillIndexCount,
+                               PrimitiveType::Triangles,
+                               states);
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateGeometry() const
+{
+    if (m_fillDirty)
+    {
+        const std::size_t pointCount = m_points.size();
+
+        m_vertices.resize(pointCount);
+
+        for (std::size_t i = 0u; i < pointCount; ++i)
+            m_vertices[i] = {m_points[i], m_fillColor};
+
+        m_indices.clear();
+        m_fillIndexCount = m_triangulator.triangulate(m_indices,
+                                                      m_points.data(),
+                                                      pointCount,
+                                                      m_holeOffsets.data(),
+                                                      m_holeOffsets.size());
+
+        m_insideBounds = PolygonShapeImpl::getVertexRangeBounds(m_vertices.data(), pointCount);
+        updateTexCoords();
+
+        m_fillDirty    = false;
+        m_outlineDirty = true;
+    }
+
+    if (m_outlineDirty)
+        updateOutline();
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateOutline() const
+{
+    const std::size_t pointCount = m_points.size();
+
+    m_vertices.resize(pointCount);
+    m_indices.resize(m_fillIndexCount);
+    m_bounds       = m_insideBounds;
+    m_outlineDirty = false;
+
+    // Polygons that could not be triangulated are not outlined either
+    if (m_outlineThickness == 0.f || m_fillIndexCount == 0u)
+        return;
+
+    const StrokeStyle style{.thickness = base::fabs(m_outlineThickness), .color = m_outlineColor};
+
+    for (std::size_t i = 0u; i <= m_holeOffsets.size(); ++i)
+    {
+        const std::size_t begin = i == 0u ? 0u : m_holeOffsets[i - 1u];
+        const std::size_t end   = i < m_holeOffsets.size() ? m_holeOffsets[i] : pointCount;
+
+        if (begin < end)
+            (void)m_strokeTessellator.appendPolygon(m_vertices, m_points.data() + begin, end - begin, style);
+    }
+
+    // The outline is a plain triangle list, its indices are sequential
+    for (std::size_t i = pointCount; i < m_vertices.size(); ++i)
+        m_indices.push_back(static_cast<IndexType>(i));
+
+    m_bounds = PolygonShapeImpl::getVertexRangeBounds(m_vertices.data(), m_vertices.size());
+}
+
+
+////////////////////////////////////////////////////////////
+void PolygonShape::updateTexCoords() const
+{
+    const auto convertedTextureRect = m_textureRect.to<FloatRect>();
+
+    // Make sure not to divide by zero when the points are aligned on a vertical or horizontal line
+    const Vector2f safeInsideSize(m_insideBounds.size.x > 0 ? m_insideBounds.size.x : 1.f,
+                                  m_insideBounds.size.y > 0 ? m_insideBounds.size.y : 1.f);
+
+    for (std::size_t i = 0u; i < m_points.size(); ++i)
+    {
+        const Vector2f ratio    = (m_vertices[i].position - m_insideBounds.position).cwiseDiv(safeInsideSize);
+        m_vertices[i].texCoords = convertedTextureRect.position + convertedTextureRect.size.cwiseMul(ratio);
+    }
+}
+
+} // namespace sf
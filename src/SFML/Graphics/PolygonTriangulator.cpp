@@ -0,0 +1,971 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/PolygonTriangulator.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+
+#include <vector>
+
+#include <cfloat>
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace PolygonTriangulatorImpl
+{
+////////////////////////////////////////////////////////////
+// Index of a missing node, ends the z-order lists
+constexpr std::size_t noNode = ~std::size_t{0};
+
+
+////////////////////////////////////////////////////////////
+// Polygons with more points than this are sorted along a z-order curve before being triangulated
+constexpr std::size_t zOrderThreshold = 80u;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Vertex of a contour, linked to its neighbors
+///
+////////////////////////////////////////////////////////////
+struct Node
+{
+    sf::Vector2f position; //!< Position of the vertex
+    std::size_t  index;    //!< Index of the vertex in the input points
+    std::size_t  prev;     //!< Previous node of the contour
+    std::size_t  next;     //!< Next node of the contour
+    std::size_t  prevZ;    //!< Previous node in z-order, `noNode` if none
+    std::size_t  nextZ;    //!< Next node in z-order, `noNode` if none
+    unsigned int z;        //!< Position on the z-order curve, 0 if not computed yet
+    bool         steiner;  //!< Is this the only vertex of a hole?
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Mapping from positions to the z-order curve
+///
+////////////////////////////////////////////////////////////
+struct ZOrderGrid
+{
+    sf::Vector2f minimum; //!< Top-left corner of the bounds of the polygon
+    float        scale{}; //!< Factor mapping the polygon to 15-bit coordinates, 0 to disable z-ordering
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float area(sf::Vector2f p, sf::Vector2f q, sf::Vector2f r)
+{
+    // Twice the signed area of the triangle, negative for convex corners of the linked contours
+    return (q.y - p.y) * (r.x - q.x) - (q.x - p.x) * (r.y - q.y);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] int sign(float value)
+{
+    return (value > 0.f) - (value < 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool pointInTriangle(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f p)
+{
+    return (c.x - p.x) * (a.y - p.y) >= (a.x - p.x) * (c.y - p.y) &&
+           (a.x - p.x) * (b.y - p.y) >= (b.x - p.x) * (a.y - p.y) &&
+           (b.x - p.x) * (c.y - p.y) >= (c.x - p.x) * (b.y - p.y);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool onSegment(sf::Vector2f p, sf::Vector2f q, sf::Vector2f r)
+{
+    // Assumes that `p`, `q` and `r` are collinear
+    return q.x <= sf::base::max(p.x, r.x) && q.x >= sf::base::min(p.x, r.x) && q.y <= sf::base::max(p.y, r.y) &&
+           q.y >= sf::base::min(p.y, r.y);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool segmentsIntersect(sf::Vector2f p1, sf::Vector2f q1, sf::Vector2f p2, sf::Vector2f q2)
+{
+    const int o1 = sign(area(p1, q1, p2));
+    const int o2 = sign(area(p1, q1, q2));
+    const int o3 = sign(area(p2, q2, p1));
+    const int o4 = sign(area(p2, q2, q1));
+
+    if (o1 != o2 && o3 != o4)
+        return true;
+
+    return (o1 == 0 && onSegment(p1, p2, q1)) || (o2 == 0 && onSegment(p1, q2, q1)) ||
+           (o3 == 0 && onSegment(p2, p1, q2)) || (o4 == 0 && onSegment(p2, q1, q2));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int spreadBits(unsigned int value)
+{
+    value = (value | (value << 8u)) & 0x00FF00FFu;
+    value = (value | (value << 4u)) & 0x0F0F0F0Fu;
+    value = (value | (value << 2u)) & 0x33333333u;
+    value = (value | (value << 1u)) & 0x55555555u;
+
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int zOrder(sf::Vector2f position, const ZOrderGrid& grid)
+{
+    const auto x = static_cast<unsigned int>((position.x - grid.minimum.x) * grid.scale);
+    const auto y = static_cast<unsigned int>((position.y - grid.minimum.y) * grid.scale);
+
+    return spreadBits(x) | (spreadBits(y) << 1u);
+}
+
+} // namespace PolygonTriangulatorImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct PolygonTriangulator::Impl
+{
+    using Node       = PolygonTriangulatorImpl::Node;
+    using ZOrderGrid = PolygonTriangulatorImpl::ZOrderGrid;
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t createNode(std::size_t index, Vector2f position)
+    {
+        nodes.push_back({position,
+                         index,
+                         nodes.size(),
+                         nodes.size(),
+                         PolygonTriangulatorImpl::noNode,
+                         PolygonTriangulatorImpl::noNode,
+                         0u,
+                         false});
+
+        return nodes.size() - 1u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t insertNode(std::size_t index, Vector2f position, std::size_t last)
+    {
+        const std::size_t node = createNode(index, position);
+
+        if (last == PolygonTriangulatorImpl::noNode)
+            return node;
+
+        nodes[node].next             = nodes[last].next;
+        nodes[node].prev             = last;
+        nodes[nodes[last].next].prev = node;
+        nodes[last].next             = node;
+
+        return node;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void removeNode(std::size_t node)
+    {
+        const Node& removed = nodes[node];
+
+        nodes[removed.next].prev = removed.prev;
+        nodes[removed.prev].next = removed.next;
+
+        if (removed.prevZ != PolygonTriangulatorImpl::noNode)
+            nodes[removed.prevZ].nextZ = removed.nextZ;
+
+        if (removed.nextZ != PolygonTriangulatorImpl::noNode)
+            nodes[removed.nextZ].prevZ = removed.prevZ;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool equals(std::size_t a, std::size_t b) const
+    {
+        return nodes[a].position == nodes[b].position;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float area(std::size_t p, std::size_t q, std::size_t r) const
+    {
+        return PolygonTriangulatorImpl::area(nodes[p].position, nodes[q].position, nodes[r].position);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float cornerArea(std::size_t node) const
+    {
+        return area(nodes[node].prev, node, nodes[node].next);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Link the points of a contour in a circular list with the requested winding
+    ///
+    /// \return Last node of the list, `noNode` if the contour is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t linkContour(const Vector2f* points, std::size_t begin, std::size_t end, bool clockwise)
+    {
+        float signedArea = 0.f;
+
+        for (std::size_t i = begin, j = end - 1u; i < end; j = i++)
+            signedArea += (points[j].x - points[i].x) * (points[i].y + points[j].y);
+
+        std::size_t last = PolygonTriangulatorImpl::noNode;
+
+        if (clockwise == (signedArea > 0.f))
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                last = insertNode(i, points[i], last);
+        }
+        else
+        {
+            for (std::size_t i = end; i > begin; --i)
+                last = insertNode(i - 1u, points[i - 1u], last);
+        }
+
+        if (last != PolygonTriangulatorImpl::noNode && equals(last, nodes[last].next))
+        {
+            const std::size_t next = nodes[last].next;
+            removeNode(last);
+            last = next;
+        }
+
+        return last;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove duplicate and collinear points between `start` and `end`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t filterPoints(std::size_t start, std::size_t end = PolygonTriangulatorImpl::noNode)
+    {
+        if (start == PolygonTriangulatorImpl::noNode)
+            return start;
+
+        if (end == PolygonTriangulatorImpl::noNode)
+            end = start;
+
+        std::size_t node = start;
+        bool        again{};
+
+        do
+        {
+            again = false;
+
+            if (!nodes[node].steiner && (equals(node, nodes[node].next) || cornerArea(node) == 0.f))
+            {
+                removeNode(node);
+                node = end = nodes[node].prev;
+
+                if (node == nodes[node].next)
+                    break;
+
+                again = true;
+            }
+            else
+            {
+                node = nodes[node].next;
+            }
+        } while (again || node != end);
+
+        return end;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a corner is an ear, testing all the other vertices
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEar(std::size_t ear) const
+    {
+        const std::size_t a = nodes[ear].prev;
+        const std::size_t c = nodes[ear].next;
+
+        // Reflex corners are never ears
+        if (area(a, ear, c) >= 0.f)
+            return false;
+
+        const Vector2f pa = nodes[a].position;
+        const Vector2f pb = nodes[ear].position;
+        const Vector2f pc = nodes[c].position;
+
+        const Vector2f minimum{base::min(pa.x, base::min(pb.x, pc.x)), base::min(pa.y, base::min(pb.y, pc.y))};
+        const Vector2f maximum{base::max(pa.x, base::max(pb.x, pc.x)), base::max(pa.y, base::max(pb.y, pc.y))};
+
+        for (std::size_t node = nodes[c].next; node != a; node = nodes[node].next)
+            if (isInsideEar(node, minimum, maximum, pa, pb, pc))
+                return false;
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a corner is an ear, only testing the vertices close on the z-order curve
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEarHashed(std::size_t ear, const ZOrderGrid& grid) const
+    {
+        const std::size_t a = nodes[ear].prev;
+        const std::size_t c = nodes[ear].next;
+
+        if (area(a, ear, c) >= 0.f)
+            return false;
+
+        const Vector2f pa = nodes[a].position;
+        const Vector2f pb = nodes[ear].position;
+        const Vector2f pc = nodes[c].position;
+
+        const Vector2f minimum{base::min(pa.x, base::min(pb.x, pc.x)), base::min(pa.y, base::min(pb.y, pc.y))};
+        const Vector2f maximum{base::max(pa.x, base::max(pb.x, pc.x)), base::max(pa.y, base::max(pb.y, pc.y))};
+
+        // Only the vertices whose z-order is within the range of the bounds of the triangle can be inside it
+        const unsigned int minZ = PolygonTriangulatorImpl::zOrder(minimum, grid);
+        const unsigned int maxZ = PolygonTriangulatorImpl::zOrder(maximum, grid);
+
+        const auto isBlocking = [&](std::size_t node)
+        { return node != a && node != c && isInsideEar(node, minimum, maximum, pa, pb, pc); };
+
+        constexpr std::size_t noNode = PolygonTriangulatorImpl::noNode;
+
+        std::size_t p = nodes[ear].prevZ;
+        std::size_t n = nodes[ear].nextZ;
+
+        // Look in both directions at once
+        while (p != noNode && nodes[p].z >= minZ && n != noNode && nodes[n].z <= maxZ)
+        {
+            if (isBlocking(p) || isBlocking(n))
+                return false;
+
+            p = nodes[p].prevZ;
+            n = nodes[n].nextZ;
+        }
+
+        for (; p != noNode && nodes[p].z >= minZ; p = nodes[p].prevZ)
+            if (isBlocking(p))
+                return false;
+
+        for (; n != noNode && nodes[n].z <= maxZ; n = nodes[n].nextZ)
+            if (isBlocking(n))
+                return false;
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isInsideEar(std::size_t node,
+                                   Vector2f    minimum,
+                                   Vector2f    maximum,
+                                   Vector2f    a,
+                                   Vector2f    b,
+                                   Vector2f    c) const
+    {
+        const Vector2f position = nodes[node].position;
+
+        return position.x >= minimum.x && position.x <= maximum.x && position.y >= minimum.y &&
+               position.y <= maximum.y && PolygonTriangulatorImpl::pointInTriangle(a, b, c, position) &&
+               cornerArea(node) >= 0.f;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void appendTriangle(std::size_t a, std::size_t b, std::size_t c)
+    {
+        indices->push_back(static_cast<IndexType>(nodes[a].index) + baseIndex);
+        indices->push_back(static_cast<IndexType>(nodes[b].index) + baseIndex);
+        indices->push_back(static_cast<IndexType>(nodes[c].index) + baseIndex);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cut ears off a contour until it is fully triangulated
+    ///
+    /// When no ear can be found, the contour is cleaned up (pass 1),
+    /// then its local self-intersections are cut off (pass 2), and
+    /// finally it is split in two along a valid diagonal.
+    ///
+    ////////////////////////////////////////////////////////////
+    void earcut(std::size_t ear, const ZOrderGrid& grid, int pass)
+    {
+        if (ear == PolygonTriangulatorImpl::noNode)
+            return;
+
+        if (pass == 0 && grid.scale != 0.f)
+            indexCurve(ear, grid);
+
+        std::size_t stop = ear;
+
+        while (nodes[ear].prev != nodes[ear].next)
+        {
+            const std::size_t prev = nodes[ear].prev;
+            const std::size_t next = nodes[ear].next;
+
+            if (grid.scale != 0.f ? isEarHashed(ear, grid) : isEar(ear))
+            {
+                appendTriangle(prev, ear, next);
+                removeNode(ear);
+
+                // Skipping the next vertex leads to less sliver triangles
+                ear = stop = nodes[next].next;
+                continue;
+            }
+
+            ear = next;
+
+            if (ear != stop)
+                continue;
+
+            if (pass == 0)
+            {
+                earcut(filterPoints(ear), grid, 1);
+            }
+            else if (pass == 1)
+            {
+                earcut(cureLocalIntersections(filterPoints(ear)), grid, 2);
+            }
+            else
+            {
+                splitEarcut(ear, grid);
+            }
+
+            break;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cut off the triangles formed by two consecutive self-intersecting edges
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t cureLocalIntersections(std::size_t start)
+    {
+        std::size_t node = start;
+
+        do
+        {
+            const std::size_t a = nodes[node].prev;
+            const std::size_t b = nodes[nodes[node].next].next;
+
+            if (!equals(a, b) &&
+                PolygonTriangulatorImpl::segmentsIntersect(nodes[a].position,
+                                                           nodes[node].position,
+                                                           nodes[nodes[node].next].position,
+                                                           nodes[b].position) &&
+                isLocallyInside(a, b) && isLocallyInside(b, a))
+            {
+                appendTriangle(a, node, b);
+
+                removeNode(nodes[node].next);
+                removeNode(node);
+
+                node = start = b;
+            }
+
+            node = nodes[node].next;
+        } while (node != start);
+
+        return filterPoints(node);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Split a contour in two along a valid diagonal and triangulate both halves
+    ///
+    ////////////////////////////////////////////////////////////
+    void splitEarcut(std::size_t start, const ZOrderGrid& grid)
+    {
+        std::size_t a = start;
+
+        do
+        {
+            for (std::size_t b = nodes[nodes[a].next].next; b != nodes[a].prev; b = nodes[b].next)
+            {
+                if (nodes[a].index == nodes[b].index || !isValidDiagonal(a, b))
+                    continue;
+
+                std::size_t c = splitPolygon(a, b);
+
+                a = filterPoints(a, nodes[a].next);
+                c = filterPoints(c, nodes[c].next);
+
+                earcut(a, grid, 0);
+                earcut(c, grid, 0);
+                return;
+            }
+
+            a = nodes[a].next;
+        } while (a != start);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Link every hole to the outer contour, turning the polygon into a single contour
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t eliminateHoles(const Vector2f*    points,
+                                             std::size_t        pointCount,
+                                             const std::size_t* holeOffsets,
+                                             std::size_t        holeCount,
+                                             std::size_t        outerNode)
+    {
+        holeQueue.clear();
+
+        for (std::size_t i = 0u; i < holeCount; ++i)
+        {
+            const std::size_t begin = holeOffsets[i];
+            const std::size_t end   = i + 1u < holeCount ? holeOffsets[i + 1u] : pointCount;
+
+            if (begin >= end)
+                continue;
+
+            const std::size_t list = linkContour(points, begin, end, false);
+
+            if (list == PolygonTriangulatorImpl::noNode)
+                continue;
+
+            if (list == nodes[list].next)
+                nodes[list].steiner = true;
+
+            holeQueue.push_back(getLeftmost(list));
+        }
+
+        // Holes are bridged from left to right, so that each bridge can reach the holes already merged
+        for (std::size_t i = 1u; i < holeQueue.size(); ++i)
+            for (std::size_t j = i; j > 0u && nodes[holeQueue[j]].position.x < nodes[holeQueue[j - 1u]].position.x; --j)
+                base::swap(holeQueue[j], holeQueue[j - 1u]);
+
+        for (const std::size_t hole : holeQueue)
+        {
+            const std::size_t bridge = findHoleBridge(hole, outerNode);
+
+            if (bridge == PolygonTriangulatorImpl::noNode)
+                continue;
+
+            const std::size_t bridgeReverse = splitPolygon(bridge, hole);
+
+            (void)filterPoints(bridgeReverse, nodes[bridgeReverse].next);
+            outerNode = filterPoints(bridge, nodes[bridge].next);
+        }
+
+        return outerNode;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t getLeftmost(std::size_t start) const
+    {
+        std::size_t leftmost = start;
+        std::size_t node     = start;
+
+        do
+        {
+            const Vector2f position = nodes[node].position;
+            const Vector2f best     = nodes[leftmost].position;
+
+            if (position.x < best.x || (position.x == best.x && position.y < best.y))
+                leftmost = node;
+
+            node = nodes[node].next;
+        } while (node != start);
+
+        return leftmost;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a vertex of the outer contour that can be linked to the leftmost vertex of a hole
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findHoleBridge(std::size_t hole, std::size_t outerNode) const
+    {
+        const Vector2f h = nodes[hole].position;
+
+        // Find the closest edge on the left of the hole, crossing the horizontal line through it
+        float       qx = -FLT_MAX;
+        std::size_t m  = PolygonTriangulatorImpl::noNode;
+        std::size_t p  = outerNode;
+
+        do
+        {
+            const Vector2f a = nodes[p].position;
+            const Vector2f b = nodes[nodes[p].next].position;
+
+            if (h.y <= a.y && h.y >= b.y && b.y != a.y)
+            {
+                const float x = a.x + (h.y - a.y) * (b.x - a.x) / (b.y - a.y);
+
+                if (x <= h.x && x > qx)
+                {
+                    qx = x;
+                    m  = a.x < b.x ? p : nodes[p].next;
+
+                    if (x == h.x)
+                        return m; // The hole touches the outer contour
+                }
+            }
+
+            p = nodes[p].next;
+        } while (p != outerNode);
+
+        if (m == PolygonTriangulatorImpl::noNode)
+            return m;
+
+        // Look for reflex vertices inside the triangle between the hole, the intersection and the edge end point;
+        // if any, link to the one with the smallest angle to the horizontal line instead
+        const std::size_t stop   = m;
+        const Vector2f    mp     = nodes[m].position;
+        const Vector2f    first  = {h.y < mp.y ? h.x : qx, h.y};
+        const Vector2f    third  = {h.y < mp.y ? qx : h.x, h.y};
+        float             tanMin = FLT_MAX;
+
+        p = m;
+
+        do
+        {
+            const Vector2f position = nodes[p].position;
+
+            if (h.x >= position.x && position.x >= mp.x && h.x != position.x &&
+                PolygonTriangulatorImpl::pointInTriangle(first, mp, third, position))
+            {
+                const float tan   = base::fabs(h.y - position.y) / (h.x - position.x);
+                const float bestX = nodes[m].position.x;
+
+                if (isLocallyInside(p, hole) &&
+                    (tan < tanMin ||
+                     (tan == tanMin && (position.x > bestX || (position.x == bestX && sectorContainsSector(m, p))))))
+                {
+                    m      = p;
+                    tanMin = tan;
+                }
+            }
+
+            p = nodes[p].next;
+        } while (p != stop);
+
+        return m;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool sectorContainsSector(std::size_t m, std::size_t p) const
+    {
+        return area(nodes[m].prev, m, nodes[p].prev) < 0.f && area(nodes[p].next, m, nodes[m].next) < 0.f;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Link two vertices with a diagonal, splitting their contour in two
+    ///
+    /// \return Duplicate of `b` in the contour that contains the duplicate of `a`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t splitPolygon(std::size_t a, std::size_t b)
+    {
+        const std::size_t a2 = createNode(nodes[a].index, nodes[a].position);
+        const std::size_t b2 = createNode(nodes[b].index, nodes[b].position);
+        const std::size_t an = nodes[a].next;
+        const std::size_t bp = nodes[b].prev;
+
+        nodes[a].next = b;
+        nodes[b].prev = a;
+
+        nodes[a2].next = an;
+        nodes[an].prev = a2;
+
+        nodes[b2].next = a2;
+        nodes[a2].prev = b2;
+
+        nodes[bp].next = b2;
+        nodes[b2].prev = bp;
+
+        return b2;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the z-order of a contour and sort it along the z-order curve
+    ///
+    ////////////////////////////////////////////////////////////
+    void indexCurve(std::size_t start, const ZOrderGrid& grid)
+    {
+        std::size_t node = start;
+
+        do
+        {
+            Node& current = nodes[node];
+
+            if (current.z == 0u)
+                current.z = PolygonTriangulatorImpl::zOrder(current.position, grid);
+
+            current.prevZ = current.prev;
+            current.nextZ = current.next;
+
+            node = current.next;
+        } while (node != start);
+
+        nodes[nodes[node].prevZ].nextZ = PolygonTriangulatorImpl::noNode;
+        nodes[node].prevZ              = PolygonTriangulatorImpl::noNode;
+
+        sortByZOrder(node);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort a z-order list with a bottom-up merge sort, which does not need extra memory
+    ///
+    ////////////////////////////////////////////////////////////
+    void sortByZOrder(std::size_t list)
+    {
+        constexpr std::size_t noNode = PolygonTriangulatorImpl::noNode;
+
+        std::size_t runSize = 1u;
+        std::size_t mergeCount{};
+
+        do
+        {
+            std::size_t p    = list;
+            std::size_t tail = noNode;
+
+            list       = noNode;
+            mergeCount = 0u;
+
+            while (p != noNode)
+            {
+                ++mergeCount;
+
+                std::size_t q     = p;
+                std::size_t pSize = 0u;
+
+                for (std::size_t i = 0u; i < runSize && q != noNode; ++i)
+                {
+                    ++pSize;
+                    q = nodes[q].nextZ;
+                }
+
+                std::size_t qSize = runSize;
+
+                while (pSize > 0u || (qSize > 0u && q != noNode))
+                {
+                    std::size_t e{};
+
+                    if (pSize != 0u && (qSize == 0u || q == noNode || nodes[p].z <= nodes[q].z))
+                    {
+                        e = p;
+                        p = nodes[p].nextZ;
+                        --pSize;
+                    }
+                    else
+                    {
+                        e = q;
+                        q = nodes[q].nextZ;
+                        --qSize;
+                    }
+
+                    if (tail != noNode)
+                        nodes[tail].nextZ = e;
+                    else
+                        list = e;
+
+                    nodes[e].prevZ = tail;
+                    tail           = e;
+                }
+
+                p = q;
+            }
+
+            nodes[tail].nextZ = noNode;
+            runSize *= 2u;
+        } while (mergeCount > 1u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether a diagonal between two vertices lies inside the polygon without crossing it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isValidDiagonal(std::size_t a, std::size_t b) const
+    {
+        if (nodes[nodes[a].next].index == nodes[b].index || nodes[nodes[a].prev].index == nodes[b].index ||
+            intersectsPolygon(a, b))
+            return false;
+
+        // The diagonal must not create a zero-area polygon, unless it links two coincident convex vertices
+        if (isLocallyInside(a, b) && isLocallyInside(b, a) && isMiddleInside(a, b) &&
+            (area(nodes[a].prev, a, nodes[b].prev) != 0.f || area(a, nodes[b].prev, b) != 0.f))
+            return true;
+
+        return equals(a, b) && cornerArea(a) > 0.f && cornerArea(b) > 0.f;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool intersectsPolygon(std::size_t a, std::size_t b) const
+    {
+        const std::size_t indexA = nodes[a].index;
+        const std::size_t indexB = nodes[b].index;
+        std::size_t       node   = a;
+
+        do
+        {
+            const std::size_t next = nodes[node].next;
+
+            if (nodes[node].index != indexA && nodes[next].index != indexA && nodes[node].index != indexB &&
+                nodes[next].index != indexB &&
+                PolygonTriangulatorImpl::segmentsIntersect(nodes[node].position,
+                                                           nodes[next].position,
+                                                           nodes[a].position,
+                                                           nodes[b].position))
+                return true;
+
+            node = next;
+        } while (node != a);
+
+        return false;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLocallyInside(std::size_t a, std::size_t b) const
+    {
+        const std::size_t prev = nodes[a].prev;
+        const std::size_t next = nodes[a].next;
+
+        return cornerArea(a) < 0.f ? area(a, b, next) >= 0.f && area(a, prev, b) >= 0.f
+                                   : area(a, b, prev) < 0.f || area(a, next, b) < 0.f;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isMiddleInside(std::size_t a, std::size_t b) const
+    {
+        const Vector2f middle = (nodes[a].position + nodes[b].position) / 2.f;
+        bool           inside = false;
+        std::size_t    node   = a;
+
+        do
+        {
+            const Vector2f p = nodes[node].position;
+            const Vector2f q = nodes[nodes[node].next].position;
+
+            if (((p.y > middle.y) != (q.y > middle.y)) && q.y != p.y &&
+                middle.x < (q.x - p.x) * (middle.y - p.y) / (q.y - p.y) + p.x)
+                inside = !inside;
+
+            node = nodes[node].next;
+        } while (node != a);
+
+        return inside;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::vector<Node>        nodes;       //!< Linked vertices of the polygon being triangulated, storage reused
+    std::vector<std::size_t> holeQueue;   //!< Leftmost vertex of each hole, storage reused
+    std::vector<IndexType>*  indices{};   //!< Index array the triangles are appended to
+    IndexType                baseIndex{}; //!< Value added to every appended index
+};
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator::PolygonTriangulator() = default;
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator::~PolygonTriangulator() = default;
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator::PolygonTriangulator(const PolygonTriangulator& rhs) = default;
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator& PolygonTriangulator::operator=(const PolygonTriangulator&) = default;
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator::PolygonTriangulator(PolygonTriangulator&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+PolygonTriangulator& PolygonTriangulator::operator=(PolygonTriangulator&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+std::size_t PolygonTriangulator::triangulate(std::vector<IndexType>& indices,
+                                             const Vector2f*         points,
+                                             std::size_t             pointCount,
+                                             const std::size_t*      holeOffsets,
+                                             std::size_t             holeCount,
+                                             IndexType               baseIndex)
+{
+    SFML_BASE_ASSERT(holeCount == 0u || holeOffsets != nullptr);
+
+    const std::size_t outerCount = holeCount > 0u ? base::min(holeOffsets[0], pointCount) : pointCount;
+
+    if (outerCount < 3u)
+        return 0u;
+
+    const std::size_t initialSize = indices.size();
+
+    Impl& impl = *m_impl;
+
+    impl.nodes.clear();
+    impl.nodes.reserve(pointCount + 2u * holeCount);
+    impl.indices   = &indices;
+    impl.baseIndex = baseIndex;
+
+    std::size_t outerNode = impl.linkContour(points, 0u, outerCount, true);
+
+    if (outerNode == PolygonTriangulatorImpl::noNode || impl.nodes[outerNode].prev == impl.nodes[outerNode].next)
+        return 0u;
+
+    if (holeCount > 0u)
+        outerNode = impl.eliminateHoles(points, pointCount, holeOffsets, holeCount, outerNode);
+
+    Impl::ZOrderGrid grid;
+
+    if (pointCount > PolygonTriangulatorImpl::zOrderThreshold)
+    {
+        Vector2f minimum = points[0];
+        Vector2f maximum = points[0];
+
+        // Holes are included, so that malformed ones cannot map outside of the curve
+        for (std::size_t i = 1u; i < pointCount; ++i)
+        {
+            minimum = {base::min(minimum.x, points[i].x), base::min(minimum.y, points[i].y)};
+            maximum = {base::max(maximum.x, points[i].x), base::max(maximum.y, points[i].y)};
+        }
+
+        const float extent = base::max(maximum.x - minimum.x, maximum.y - minimum.y);
+
+        grid.minimum = minimum;
+        grid.scale   = extent != 0.f ? 32767.f / extent : 0.f;
+    }
+
+    impl.earcut(outerNode, grid, 0);
+
+    impl.indices = nullptr;
+
+    return indices.size() - initialSize;
+}
+
+} // namespace sf
@@ -6,6 +6,7 @@
 #include "SFML/Graphics/BlendMode.hpp"
 #include "SFML/Graphics/CoordinateType.hpp"
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/Shader.hpp"
@@ -13,15 +14,21 @@
 #include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/UniformBuffer.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 #include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormatUtils.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
 #include "SFML/Graphics/View.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 
 #include "SFML/System/Err.hpp"
 #include "SFML/System/Rect.hpp"
+#include "SFML/System/RectUtils.hpp"
 
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
@@ -55,6 +62,9 @@ constexpr std::size_t maxIdCount{256ul};
 // Map to help us detect whether a different RenderTarget has been activated within a single context
 constinit std::atomic<IdType> contextRenderTargetMap[maxIdCount]{};
 
+// Map to help us detect whether the view block of a different RenderTarget is bound within a single context
+constinit std::atomic<IdType> contextViewBlockMap[maxIdCount]{};
+
 // Check if a render target with the given ID is active in the current context
 [[nodiscard]] bool isActive(sf::GraphicsContext& graphicsContext, IdType id)
 {
@@ -187,10 +197,8 @@ struct [[nodiscard]] StatesCache
     bool enable{};      //!< Is the cache enabled?
     bool glStatesSet{}; //!< Are our internal GL states set yet?
 
-    bool viewChanged{}; //!< Has the current view changed since last draw?
-
-    bool scissorEnabled{}; //!< Is scissor testing enabled?
-    bool stencilEnabled{}; //!< Is stencil testing enabled?
+    bool viewChanged{};   //!< Has the current view changed since last draw?
+    bool usesViewBlock{}; //!< Does the last used shader program read the view from the view block?
 
     BlendMode      lastBlendMode;        //!< Cached blending mode
     StencilMode    lastStencilMode;      //!< Cached stencil
@@ -208,6 +216,7 @@ struct [[nodiscard]] StatesCache
 
     base::Optional<Shader::UniformLocation> ulTextureMatrix;             //!< Built-in texture matrix uniform location
     base::Optional<Shader::UniformLocation> ulModelViewProjectionMatrix; //!< Built-in model-view-projection matrix uniform location
+    base::Optional<Shader::UniformLocation> ulModelMatrix; //!< Built-in model matrix uniform location, used with the view block
 };
 
 
@@ -216,7 +225,8 @@ template <auto FnGen, auto FnBind, auto FnGet, auto FnDelete>
 class OpenGLRAII
 {
 public:
-    [[nodiscard, gnu::always_inline]] explicit OpenGLRAII(GraphicsContext&)
+    [[nodiscard, gnu::always_inline]] explicit OpenGLRAII(GraphicsContext& graphicsContext) :
+    m_graphicsContext(&graphicsContext)
     {
         SFML_BASE_ASSERT(m_id == 0u);
         FnGen(m_id);
@@ -233,21 +243,26 @@ public:
     [[gnu::always_inline]] void bind() const
     {
         SFML_BASE_ASSERT(m_id != 0u);
-        FnBind(m_id);
+        FnBind(m_graphicsContext->getActiveGLStateCache(), m_id);
 
         SFML_BASE_ASSERT(isBound());
     }
 
     [[gnu::always_inline]] ~OpenGLRAII()
     {
-        if (m_id != 0u)
-            FnDelete(m_id);
+        if (m_id == 0u)
+            return;
+
+        FnDelete(m_id);
+        sf::priv::GLStateCache::invalidateObjectBindings();
     }
 
     OpenGLRAII(const OpenGLRAII&)            = delete;
     OpenGLRAII& operator=(const OpenGLRAII&) = delete;
 
-    [[gnu::always_inline]] OpenGLRAII(OpenGLRAII&& rhs) noexcept : m_id(base::exchange(rhs.m_id, 0u))
+    [[gnu::always_inline]] OpenGLRAII(OpenGLRAII&& rhs) noexcept :
+    m_graphicsContext(rhs.m_graphicsContext),
+    m_id(base::exchange(rhs.m_id, 0u))
     {
     }
 
@@ -256,43 +271,106 @@ public:
         if (&rhs == this)
             return *this;
 
-        m_id = base::exchange(rhs.m_id, 0u);
+        m_graphicsContext = rhs.m_graphicsContext;
+        m_id              = base::exchange(rhs.m_id, 0u);
         return *this;
     }
 
 private:
-    unsigned int m_id{};
+    GraphicsContext* m_graphicsContext; //!< Context whose state cache is used to bind the object
+    unsigned int     m_id{};            //!< OpenGL name of the object
 };
 
 
 ////////////////////////////////////////////////////////////
 using VAO = OpenGLRAII<[](auto& id) { glCheck(glGenVertexArrays(1, &id)); },
-                       [](auto id) { glCheck(glBindVertexArray(id)); },
+                       [](priv::GLStateCache& cache, auto id) { cache.bindVertexArray(id); },
                        [](auto& id) { glCheck(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &id)); },
                        [](auto& id) { glCheck(glDeleteVertexArrays(1, &id)); }>;
 
 
 ////////////////////////////////////////////////////////////
 using VBO = OpenGLRAII<[](auto& id) { glCheck(glGenBuffers(1, &id)); },
-                       [](auto id) { glCheck(glBindBuffer(GL_ARRAY_BUFFER, id)); },
+                       [](priv::GLStateCache& cache, auto id) { cache.bindBuffer(GL_ARRAY_BUFFER, id); },
                        [](auto& id) { glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &id)); },
                        [](auto& id) { glCheck(glDeleteBuffers(1, &id)); }>;
 
 
 ////////////////////////////////////////////////////////////
-void setupVertexAttribPointers(const GLint sfAttribPositionIdx, const GLint sfAttribColorIdx, const GLint sfAttribTexCoordIdx)
+using EBO = OpenGLRAII<[](auto& id) { glCheck(glGenBuffers(1, &id)); },
+                       [](priv::GLStateCache& cache, auto id) { cache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, id); },
+                       [](auto& id) { glCheck(glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &id)); },
+                       [](auto& id) { glCheck(glDeleteBuffers(1, &id)); }>;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum primitiveTypeToGlEnum(PrimitiveType type)
+{
+    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
+    return modes[static_cast<std::size_t>(type)];
+}
+
+
+////////////////////////////////////////////////////////////
+struct VertexLayout
+{
+    GLenum      positionType;    //!< Component type of the position
+    GLenum      texCoordsType;   //!< Component type of the texture coordinates
+    std::size_t positionOffset;  //!< Offset of the position in the vertex
+    std::size_t colorOffset;     //!< Offset of the color in the vertex
+    std::size_t texCoordsOffset; //!< Offset of the texture coordinates in the vertex
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] VertexLayout getVertexLayout(VertexFormat vertexFormat)
 {
-#define SFML_PRIV_OFFSETOF(...) reinterpret_cast<const void*>(offsetof(__VA_ARGS__))
+    switch (vertexFormat)
+    {
+        case VertexFormat::Compact:
+            return {GL_FLOAT,
+                    GL_UNSIGNED_SHORT,
+                    offsetof(VertexCompact, position),
+                    offsetof(VertexCompact, color),
+                    offsetof(VertexCompact, texCoords)};
+
+        case VertexFormat::Packed:
+            return {GL_SHORT,
+                    GL_UNSIGNED_SHORT,
+                    offsetof(VertexPacked, position),
+                    offsetof(VertexPacked, color),
+                    offsetof(VertexPacked, texCoords)};
+
+        default:
+            return {GL_FLOAT,
+                    GL_FLOAT,
+                    offsetof(Vertex, position),
+                    offsetof(Vertex, color),
+                    offsetof(Vertex, texCoords)};
+    }
+}
+
 
+////////////////////////////////////////////////////////////
+void setupVertexAttribPointers(const VertexFormat   vertexFormat,
+                               const CoordinateType coordinateType,
+                               const GLint          sfAttribPositionIdx,
+                               const GLint          sfAttribColorIdx,
+                               const GLint          sfAttribTexCoordIdx)
+{
     SFML_BASE_ASSERT(sfAttribPositionIdx >= 0);
 
+    const VertexLayout layout = getVertexLayout(vertexFormat);
+    const auto         stride = static_cast<GLsizei>(priv::getVertexSize(vertexFormat));
+
+    // Integer attributes are converted to floats when fetched, so the built-in shaders work with every format
     glCheck(glEnableVertexAttribArray(static_cast<GLuint>(sfAttribPositionIdx)));
     glCheck(glVertexAttribPointer(/*      index */ static_cast<GLuint>(sfAttribPositionIdx),
                                   /*       size */ 2,
-                                  /*       type */ GL_FLOAT,
+                                  /*       type */ layout.positionType,
                                   /* normalized */ GL_FALSE,
-                                  /*     stride */ sizeof(Vertex),
-                                  /*     offset */ SFML_PRIV_OFFSETOF(Vertex, position)));
+                                  /*     stride */ stride,
+                                  /*     offset */ reinterpret_cast<const void*>(layout.positionOffset)));
 
     if (sfAttribColorIdx >= 0)
     {
@@ -301,22 +379,23 @@ void setupVertexAttribPointers(const GLint sfAttribPositionIdx, const GLint sfAt
                                       /*       size */ 4,
                                       /*       type */ GL_UNSIGNED_BYTE,
                                       /* normalized */ GL_TRUE,
-                                      /*     stride */ sizeof(Vertex),
-                                      /*     offset */ SFML_PRIV_OFFSETOF(Vertex, color)));
+                                      /*     stride */ stride,
+                                      /*     offset */ reinterpret_cast<const void*>(layout.colorOffset)));
     }
 
     if (sfAttribTexCoordIdx >= 0)
     {
+        // 16-bit texture coordinates are whole pixels, or fixed-point fractions of the texture size
+        const bool normalized = layout.texCoordsType != GL_FLOAT && coordinateType == CoordinateType::Normalized;
+
         glCheck(glEnableVertexAttribArray(static_cast<GLuint>(sfAttribTexCoordIdx)));
         glCheck(glVertexAttribPointer(/*      index */ static_cast<GLuint>(sfAttribTexCoordIdx),
                                       /*       size */ 2,
-                                      /*       type */ GL_FLOAT,
-                                      /* normalized */ GL_FALSE,
-                                      /*     stride */ sizeof(Vertex),
-                                      /*     offset */ SFML_PRIV_OFFSETOF(Vertex, texCoords)));
+                                      /*       type */ layout.texCoordsType,
+                                      /* normalized */ normalized ? GL_TRUE : GL_FALSE,
+                                      /*     stride */ stride,
+                                      /*     offset */ reinterpret_cast<const void*>(layout.texCoordsOffset)));
     }
-
-#undef SFML_PRIV_OFFSETOF
 }
 
 
@@ -326,7 +405,8 @@ struct RenderTarget::Impl
     explicit Impl(GraphicsContext& theGraphicsContext) :
     graphicsContext(&theGraphicsContext),
     vao(theGraphicsContext),
-    vbo(theGraphicsContext)
+    vbo(theGraphicsContext),
+    ebo(theGraphicsContext)
     {
     }
 
@@ -337,6 +417,13 @@ struct RenderTarget::Impl
     RenderTargetImpl::IdType id{};            //!< Unique number that identifies the render target
     VAO                      vao;             //!< Vertex array object associated with the render target
     VBO                      vbo;             //!< Vertex buffer object associated with the render target
+    EBO                      ebo;             //!< Index buffer object associated with the render target
+
+    base::Optional<UniformBuffer> viewBlock;          //!< View-projection matrix read by `sf_u_ViewBlock`, created on first use
+    bool                          viewBlockDirty{true}; //!< Does the view block need to be re-uploaded?
+
+    bool    damageTracking{}; //!< Are clears and draws restricted to the dirty region?
+    IntRect dirtyRegion{};    //!< Bounding rectangle of the damage of the current frame, in pixels
 };
 
 
@@ -361,6 +448,10 @@ RenderTarget& RenderTarget::operator=(RenderTarget&&) noexcept = default;
 ////////////////////////////////////////////////////////////
 [[nodiscard]] bool RenderTarget::clearImpl()
 {
+    // Nothing was damaged since the last frame?
+    if (isDamageEmpty())
+        return false;
+
     if (!RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) && !setActive(true))
     {
         priv::err() << "Failed to activate render target in `clearImpl`";
@@ -417,6 +508,7 @@ void RenderTarget::setView(const View& view)
 {
     m_impl->view              = view;
     m_impl->cache.viewChanged = true;
+    m_impl->viewBlockDirty    = true;
 }
 
 
@@ -521,7 +613,7 @@ void RenderTarget::draw(const Shape& shape, const Texture* texture, const Render
 void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, PrimitiveType type, const RenderStates& states)
 {
     // Nothing to draw?
-    if (vertices == nullptr || (vertexCount == 0))
+    if (vertices == nullptr || (vertexCount == 0) || isDamageEmpty())
         return;
 
     if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
@@ -548,7 +640,9 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
         const auto* data = reinterpret_cast<const char*>(useVertexCache ? m_impl->cache.vertexCache : vertices);
 
         glCheck(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount), data, GL_STATIC_DRAW));
-        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+        setupVertexAttribPointers(VertexFormat::Standard,
+                                  states.coordinateType,
+                                  m_impl->cache.sfAttribPositionIdx,
                                   m_impl->cache.sfAttribColorIdx,
                                   m_impl->cache.sfAttribTexCoordIdx);
 
@@ -561,6 +655,62 @@ void RenderTarget::draw(const Vertex* vertices, std::size_t vertexCount, Primiti
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexCompact* vertices,
+                        std::size_t          vertexCount,
+                        PrimitiveType        type,
+                        const RenderStates&  states)
+{
+    drawVertexData(vertices, vertexCount, VertexFormat::Compact, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexPacked* vertices,
+                        std::size_t         vertexCount,
+                        PrimitiveType       type,
+                        const RenderStates& states)
+{
+    drawVertexData(vertices, vertexCount, VertexFormat::Packed, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawVertexData(const void*         vertexData,
+                                  std::size_t         vertexCount,
+                                  VertexFormat        vertexFormat,
+                                  PrimitiveType       type,
+                                  const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertexData == nullptr || vertexCount == 0 || isDamageEmpty())
+        return;
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        // Pre-transforming would expand the vertices back to full precision, defeating the compact formats
+        setupDraw(false, states);
+
+        glCheck(glBufferData(GL_ARRAY_BUFFER,
+                             static_cast<GLsizeiptr>(priv::getVertexSize(vertexFormat) * vertexCount),
+                             vertexData,
+                             GL_STREAM_DRAW));
+
+        setupVertexAttribPointers(vertexFormat,
+                                  states.coordinateType,
+                                  m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx);
+
+        drawPrimitives(type, 0, vertexCount);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::draw(const VertexBuffer& vertexBuffer, const RenderStates& states)
 {
@@ -586,7 +736,7 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
     vertexCount = base::min(vertexCount, vertexBuffer.getVertexCount() - firstVertex);
 
     // Nothing to draw?
-    if (!vertexCount || !vertexBuffer.getNativeHandle())
+    if (!vertexCount || !vertexBuffer.getNativeHandle() || isDamageEmpty())
         return;
 
     if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
@@ -597,7 +747,9 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
         VertexBuffer::bind(*m_impl->graphicsContext, &vertexBuffer);
 
         // Always enable texture coordinates
-        setupVertexAttribPointers(m_impl->cache.sfAttribPositionIdx,
+        setupVertexAttribPointers(vertexBuffer.m_vertexFormat,
+                                  states.coordinateType,
+                                  m_impl->cache.sfAttribPositionIdx,
                                   m_impl->cache.sfAttribColorIdx,
                                   m_impl->cache.sfAttribTexCoordIdx);
 
@@ -614,6 +766,142 @@ void RenderTarget::draw(const VertexBuffer& vertexBuffer, std::size_t firstVerte
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::draw(const VertexBuffer& vertexBuffer,
+                        const IndexBuffer&  indexBuffer,
+                        std::size_t         firstIndex,
+                        std::size_t         indexCount,
+                        const RenderStates& states)
+{
+    // VertexBuffer not supported?
+    if (!VertexBuffer::isAvailable(*m_impl->graphicsContext))
+    {
+        priv::err() << "sf::VertexBuffer is not available, drawing skipped";
+        return;
+    }
+
+    // Sanity check
+    if (firstIndex > indexBuffer.getIndexCount())
+        return;
+
+    // Clamp indexCount to something that makes sense
+    indexCount = base::min(indexCount, indexBuffer.getIndexCount() - firstIndex);
+
+    // Nothing to draw?
+    if (!indexCount || !vertexBuffer.getNativeHandle() || !indexBuffer.getNativeHandle() || isDamageEmpty())
+        return;
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        setupDraw(false, states);
+
+        // Bind vertex buffer
+        VertexBuffer::bind(*m_impl->graphicsContext, &vertexBuffer);
+
+        setupVertexAttribPointers(vertexBuffer.m_vertexFormat,
+                                  states.coordinateType,
+                                  m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx);
+
+        // The index buffer binding is stored in the vertex array object
+        m_impl->graphicsContext->getActiveGLStateCache().bindBuffer(GL_ELEMENT_ARRAY_BUFFER,
+                                                                    indexBuffer.getNativeHandle());
+
+        drawIndexedPrimitives(vertexBuffer.getPrimitiveType(), firstIndex, indexCount);
+
+        // Unbind vertex buffer
+        VertexBuffer::bind(*vertexBuffer.m_graphicsContext, nullptr);
+
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedVertices(const Vertex*       vertices,
+                                       std::size_t         vertexCount,
+                                       const IndexType*    indices,
+                                       std::size_t         indexCount,
+                                       PrimitiveType       type,
+                                       const RenderStates& states)
+{
+    drawIndexedVertexData(vertices, vertexCount, VertexFormat::Standard, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedVertices(const VertexCompact* vertices,
+                                       std::size_t          vertexCount,
+                                       const IndexType*     indices,
+                                       std::size_t          indexCount,
+                                       PrimitiveType        type,
+                                       const RenderStates&  states)
+{
+    drawIndexedVertexData(vertices, vertexCount, VertexFormat::Compact, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedVertices(const VertexPacked* vertices,
+                                       std::size_t         vertexCount,
+                                       const IndexType*    indices,
+                                       std::size_t         indexCount,
+                                       PrimitiveType       type,
+                                       const RenderStates& states)
+{
+    drawIndexedVertexData(vertices, vertexCount, VertexFormat::Packed, indices, indexCount, type, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedVertexData(const void*         vertexData,
+                                         std::size_t         vertexCount,
+                                         VertexFormat        vertexFormat,
+                                         const IndexType*    indices,
+                                         std::size_t         indexCount,
+                                         PrimitiveType       type,
+                                         const RenderStates& states)
+{
+    // Nothing to draw?
+    if (vertexData == nullptr || vertexCount == 0 || indices == nullptr || indexCount == 0 || isDamageEmpty())
+        return;
+
+    if (RenderTargetImpl::isActive(*m_impl->graphicsContext, m_impl->id) || setActive(true))
+    {
+        // Indexed geometry is meant for large batches, never pre-transform it
+        setupDraw(false, states);
+
+        glCheck(glBufferData(GL_ARRAY_BUFFER,
+                             static_cast<GLsizeiptr>(priv::getVertexSize(vertexFormat) * vertexCount),
+                             vertexData,
+                             GL_STREAM_DRAW));
+
+        setupVertexAttribPointers(vertexFormat,
+                                  states.coordinateType,
+                                  m_impl->cache.sfAttribPositionIdx,
+                                  m_impl->cache.sfAttribColorIdx,
+                                  m_impl->cache.sfAttribTexCoordIdx);
+
+        // The index buffer binding is stored in the vertex array object
+        m_impl->ebo.bind();
+        glCheck(glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                             static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount),
+                             indices,
+                             GL_STREAM_DRAW));
+
+        drawIndexedPrimitives(type, 0, indexCount);
+        cleanupDraw(states);
+
+        // Update the cache
+        m_impl->cache.useVertexCache = false;
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 bool RenderTarget::isSrgb() const
 {
@@ -692,20 +980,21 @@ void RenderTarget::resetGLStates()
         }
 #endif
 
+        // External code may have changed any state behind the state cache of the context
+        priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+        stateCache.invalidate();
+
         // Make sure that the texture unit which is active is the number 0
         if (GLEXT_multitexture)
-        {
-            // glCheck(GLEXT_glClientActiveTexture(GLEXT_GL_TEXTURE0));
-            glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
-        }
+            stateCache.activeTexture(GL_TEXTURE0);
 
         // Define the default OpenGL states
-        glCheck(glDisable(GL_CULL_FACE));
-        glCheck(glDisable(GL_STENCIL_TEST));
-        glCheck(glDisable(GL_DEPTH_TEST));
-        glCheck(glDisable(GL_SCISSOR_TEST));
-        glCheck(glEnable(GL_BLEND));
-        glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+        stateCache.setEnabled(GL_CULL_FACE, false);
+        stateCache.setEnabled(GL_STENCIL_TEST, false);
+        stateCache.setEnabled(GL_DEPTH_TEST, false);
+        stateCache.setEnabled(GL_SCISSOR_TEST, false);
+        stateCache.setEnabled(GL_BLEND, true);
+        stateCache.colorMask(true, true, true, true);
 
         const auto disableCacheAttrib = [&](const GLint cacheAttrib)
         {
@@ -717,9 +1006,7 @@ void RenderTarget::resetGLStates()
         disableCacheAttrib(m_impl->cache.sfAttribColorIdx);
         disableCacheAttrib(m_impl->cache.sfAttribTexCoordIdx);
 
-        m_impl->cache.scissorEnabled = false;
-        m_impl->cache.stencilEnabled = false;
-        m_impl->cache.glStatesSet    = true;
+        m_impl->cache.glStatesSet = true;
 
         // Apply the default SFML states
         applyBlendMode(BlendAlpha);
@@ -740,6 +1027,87 @@ void RenderTarget::resetGLStates()
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderTarget::setDamageTrackingEnabled(bool enabled)
+{
+    m_impl->damageTracking = enabled;
+    m_impl->dirtyRegion    = {};
+
+    // The previous contents cannot be trusted, so the first frame is redrawn entirely
+    markAllDirty();
+
+    m_impl->cache.viewChanged = true;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isDamageTrackingEnabled() const
+{
+    return m_impl->damageTracking;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::markDirty(const IntRect& rect)
+{
+    if (!m_impl->damageTracking)
+        return;
+
+    const base::Optional<IntRect> clamped = findIntersection(rect, IntRect({0, 0}, getSize().to<Vector2i>()));
+    if (!clamped.hasValue())
+        return;
+
+    IntRect& region = m_impl->dirtyRegion;
+
+    if (region.size.x == 0 || region.size.y == 0)
+    {
+        region = *clamped;
+    }
+    else
+    {
+        const Vector2i topLeft{base::min(region.position.x, clamped->position.x),
+                               base::min(region.position.y, clamped->position.y)};
+
+        const Vector2i bottomRight{base::max(region.position.x + region.size.x, clamped->position.x + clamped->size.x),
+                                   base::max(region.position.y + region.size.y, clamped->position.y + clamped->size.y)};
+
+        region = IntRect(topLeft, bottomRight - topLeft);
+    }
+
+    m_impl->cache.viewChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::markAllDirty()
+{
+    markDirty(IntRect({0, 0}, getSize().to<Vector2i>()));
+}
+
+
+////////////////////////////////////////////////////////////
+IntRect RenderTarget::getDirtyRegion() const
+{
+    return m_impl->dirtyRegion;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::clearDirtyRegion()
+{
+    m_impl->dirtyRegion       = {};
+    m_impl->cache.viewChanged = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTarget::isDamageEmpty() const
+{
+    return m_impl->damageTracking && (m_impl->dirtyRegion.size.x == 0 || m_impl->dirtyRegion.size.y == 0);
+}
+
+
 ////////////////////////////////////////////////////////////
 const RenderStates& RenderTarget::getDefaultRenderStates()
 {
@@ -780,31 +1148,72 @@ void RenderTarget::applyCurrentView()
     // Set the viewport
     const IntRect viewport    = getViewport(m_impl->view);
     const int     viewportTop = static_cast<int>(getSize().y) - (viewport.position.y + viewport.size.y);
-    glCheck(glViewport(viewport.position.x, viewportTop, viewport.size.x, viewport.size.y));
+
+    priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+    stateCache.viewport(viewport.position.x, viewportTop, viewport.size.x, viewport.size.y);
 
     // Set the scissor rectangle and enable/disable scissor testing
-    if (m_impl->view.getScissor() == FloatRect({0, 0}, {1, 1}))
+    const bool fullScissor = m_impl->view.getScissor() == FloatRect({0, 0}, {1, 1});
+
+    if (fullScissor && !m_impl->damageTracking)
     {
-        if (!m_impl->cache.enable || m_impl->cache.scissorEnabled)
-        {
-            glCheck(glDisable(GL_SCISSOR_TEST));
-            m_impl->cache.scissorEnabled = false;
-        }
+        stateCache.setEnabled(GL_SCISSOR_TEST, false);
     }
     else
     {
-        const IntRect pixelScissor = getScissor(m_impl->view);
-        const int     scissorTop   = static_cast<int>(getSize().y) - (pixelScissor.position.y + pixelScissor.size.y);
-        glCheck(glScissor(pixelScissor.position.x, scissorTop, pixelScissor.size.x, pixelScissor.size.y));
+        IntRect pixelScissor = fullScissor ? IntRect({0, 0}, getSize().to<Vector2i>()) : getScissor(m_impl->view);
+
+        // Only the dirty region is redrawn when tracking damage
+        if (m_impl->damageTracking)
+            pixelScissor = findIntersection(pixelScissor, m_impl->dirtyRegion).valueOr(IntRect{});
+
+        const int scissorTop = static_cast<int>(getSize().y) - (pixelScissor.position.y + pixelScissor.size.y);
+
+        stateCache.scissor(pixelScissor.position.x, scissorTop, pixelScissor.size.x, pixelScissor.size.y);
+        stateCache.setEnabled(GL_SCISSOR_TEST, true);
+    }
 
-        if (!m_impl->cache.enable || !m_impl->cache.scissorEnabled)
+    m_impl->cache.viewChanged = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::applyViewBlock()
+{
+    if (!m_impl->viewBlock.hasValue())
+    {
+        m_impl->viewBlock = UniformBuffer::create(*m_impl->graphicsContext, sizeof(float) * 16u);
+
+        if (!m_impl->viewBlock.hasValue())
         {
-            glCheck(glEnable(GL_SCISSOR_TEST));
-            m_impl->cache.scissorEnabled = true;
+            priv::err() << "Failed to create the view block of the render target";
+            return;
         }
+
+        m_impl->viewBlockDirty = true;
     }
 
-    m_impl->cache.viewChanged = false;
+    // A mat4 has the same layout in a std140 block as in a transform
+    if (m_impl->viewBlockDirty)
+    {
+        [[maybe_unused]] const bool rc = m_impl->viewBlock->update(m_impl->view.getTransform().getMatrix(),
+                                                                   sizeof(float) * 16u);
+        SFML_BASE_ASSERT(rc);
+
+        m_impl->viewBlockDirty = false;
+    }
+
+    // The binding point is context state shared by all the render targets active on the context
+    const RenderTargetImpl::IdType contextId = m_impl->graphicsContext->getActiveThreadLocalGlContextId();
+    SFML_BASE_ASSERT(contextId < RenderTargetImpl::maxIdCount);
+
+    std::atomic<RenderTargetImpl::IdType>& boundViewBlockId = RenderTargetImpl::contextViewBlockMap[contextId];
+
+    if (!m_impl->cache.enable || boundViewBlockId.load() != m_impl->id)
+    {
+        m_impl->viewBlock->bind(Shader::ViewBlockBindingPoint);
+        boundViewBlockId.store(m_impl->id);
+    }
 }
 
 
@@ -814,29 +1223,31 @@ void RenderTarget::applyBlendMode(const BlendMode& mode)
     using RenderTargetImpl::equationToGlConstant;
     using RenderTargetImpl::factorToGlConstant;
 
+    priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+
     // Apply the blend mode, falling back to the non-separate versions if necessary
     if (GLEXT_blend_func_separate)
     {
-        glCheck(GLEXT_glBlendFuncSeparate(factorToGlConstant(mode.colorSrcFactor),
-                                          factorToGlConstant(mode.colorDstFactor),
-                                          factorToGlConstant(mode.alphaSrcFactor),
-                                          factorToGlConstant(mode.alphaDstFactor)));
+        stateCache.blendFuncSeparate(factorToGlConstant(mode.colorSrcFactor),
+                                     factorToGlConstant(mode.colorDstFactor),
+                                     factorToGlConstant(mode.alphaSrcFactor),
+                                     factorToGlConstant(mode.alphaDstFactor));
     }
     else
     {
-        glCheck(glBlendFunc(factorToGlConstant(mode.colorSrcFactor), factorToGlConstant(mode.colorDstFactor)));
+        stateCache.blendFunc(factorToGlConstant(mode.colorSrcFactor), factorToGlConstant(mode.colorDstFactor));
     }
 
     if (GLEXT_blend_minmax || GLEXT_blend_subtract)
     {
         if (GLEXT_blend_equation_separate)
         {
-            glCheck(GLEXT_glBlendEquationSeparate(equationToGlConstant(mode.colorEquation),
-                                                  equationToGlConstant(mode.alphaEquation)));
+            stateCache.blendEquationSeparate(equationToGlConstant(mode.colorEquation),
+                                             equationToGlConstant(mode.alphaEquation));
         }
         else
         {
-            glCheck(GLEXT_glBlendEquation(equationToGlConstant(mode.colorEquation)));
+            stateCache.blendEquation(equationToGlConstant(mode.colorEquation));
         }
     }
     else if ((mode.colorEquation != BlendMode::Equation::Add) || (mode.alphaEquation != BlendMode::Equation::Add))
@@ -867,32 +1278,26 @@ void RenderTarget::applyStencilMode(const StencilMode& mode)
     using RenderTargetImpl::stencilFunctionToGlConstant;
     using RenderTargetImpl::stencilOperationToGlConstant;
 
+    priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+
     // Fast path if we have a default (disabled) stencil mode
     if (mode == StencilMode())
     {
-        if (!m_impl->cache.enable || m_impl->cache.stencilEnabled)
-        {
-            glCheck(glDisable(GL_STENCIL_TEST));
-            glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
-
-            m_impl->cache.stencilEnabled = false;
-        }
+        stateCache.setEnabled(GL_STENCIL_TEST, false);
+        stateCache.colorMask(true, true, true, true);
     }
     else
     {
         // Apply the stencil mode
-        if (!m_impl->cache.enable || !m_impl->cache.stencilEnabled)
-            glCheck(glEnable(GL_STENCIL_TEST));
+        stateCache.setEnabled(GL_STENCIL_TEST, true);
 
-        glCheck(glStencilOp(GL_KEEP,
-                            stencilOperationToGlConstant(mode.stencilUpdateOperation),
-                            stencilOperationToGlConstant(mode.stencilUpdateOperation)));
+        stateCache.stencilOp(GL_KEEP,
+                             stencilOperationToGlConstant(mode.stencilUpdateOperation),
+                             stencilOperationToGlConstant(mode.stencilUpdateOperation));
 
-        glCheck(glStencilFunc(stencilFunctionToGlConstant(mode.stencilComparison),
-                              static_cast<int>(mode.stencilReference.value),
-                              mode.stencilMask.value));
-
-        m_impl->cache.stencilEnabled = true;
+        stateCache.stencilFunc(stencilFunctionToGlConstant(mode.stencilComparison),
+                               static_cast<int>(mode.stencilReference.value),
+                               mode.stencilMask.value);
     }
 
     m_impl->cache.lastStencilMode = mode;
@@ -938,12 +1343,7 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
     // Enable or disable sRGB encoding
     // This is needed for drivers that do not check the format of the surface drawn to before applying sRGB conversion
     if (!m_impl->cache.enable)
-    {
-        if (isSrgb())
-            glCheck(glEnable(GL_FRAMEBUFFER_SRGB));
-        else
-            glCheck(glDisable(GL_FRAMEBUFFER_SRGB));
-    }
+        m_impl->graphicsContext->getActiveGLStateCache().setEnabled(GL_FRAMEBUFFER_SRGB, isSrgb());
 #endif
 
     // First set the persistent OpenGL states if it's the very first call
@@ -981,20 +1381,39 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 
         m_impl->cache.ulTextureMatrix             = usedShader.getUniformLocation("sf_u_textureMatrix");
         m_impl->cache.ulModelViewProjectionMatrix = usedShader.getUniformLocation("sf_u_modelViewProjectionMatrix");
+        m_impl->cache.ulModelMatrix               = usedShader.getUniformLocation("sf_u_modelMatrix");
+        m_impl->cache.usesViewBlock               = usedShader.getUniformBlockIndex("sf_u_ViewBlock").hasValue();
     }
 
     // Apply the view
     if (!m_impl->cache.enable || m_impl->cache.viewChanged)
         applyCurrentView();
 
-    // Set the model-view-projection matrix
     const Transform& modelViewMatrix(useVertexCache ? Transform::Identity : states.transform);
-    usedShader.setMat4Uniform(*m_impl->cache.ulModelViewProjectionMatrix,
-                              (m_impl->view.getTransform() * modelViewMatrix).getMatrix());
 
-    // Apply the blend mode
-    if (!m_impl->cache.enable || (states.blendMode != m_impl->cache.lastBlendMode))
-        applyBlendMode(states.blendMode);
+    if (m_impl->cache.usesViewBlock)
+    {
+        // Upload the view-projection matrix only when the view changes, and the model matrix only when it changes
+        applyViewBlock();
+
+        if (m_impl->cache.ulModelMatrix.hasValue())
+            usedShader.setTransformUniform(*m_impl->cache.ulModelMatrix, modelViewMatrix.getMatrix());
+    }
+    else if (m_impl->cache.ulModelViewProjectionMatrix.hasValue())
+    {
+        // Set the model-view-projection matrix, skipped if unchanged since the last draw with this shader
+        usedShader.setTransformUniform(*m_impl->cache.ulModelViewProjectionMatrix,
+                                       (m_impl->view.getTransform() * modelViewMatrix).getMatrix());
+    }
+
+    // Apply the blend mode, substituting the premultiplied equivalent of standard alpha blending if needed
+    const BlendMode& usedBlendMode = (states.texture != nullptr && states.texture->m_premultipliedAlpha &&
+                                      states.blendMode == BlendAlpha)
+                                         ? BlendPremultipliedAlpha
+                                         : states.blendMode;
+
+    if (!m_impl->cache.enable || (usedBlendMode != m_impl->cache.lastBlendMode))
+        applyBlendMode(usedBlendMode);
 
     // Apply the stencil mode
     if (!m_impl->cache.enable || (states.stencilMode != m_impl->cache.lastStencilMode))
@@ -1002,7 +1421,7 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 
     // Mask the color buffer off if necessary
     if (states.stencilMode.stencilOnly)
-        glCheck(glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE));
+        m_impl->graphicsContext->getActiveGLStateCache().colorMask(false, false, false, false);
 
     // Apply the texture
     const Texture& usedTexture = states.texture != nullptr ? *states.texture
@@ -1044,8 +1463,7 @@ void RenderTarget::setupDraw(bool useVertexCache, const RenderStates& states)
 void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, std::size_t vertexCount)
 {
     // Find the OpenGL primitive type
-    static constexpr GLenum modes[] = {GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP, GL_TRIANGLE_FAN};
-    const GLenum mode = modes[static_cast<std::size_t>(type)];
+    const GLenum mode = primitiveTypeToGlEnum(type);
 
     // Draw the primitives
     m_impl->vao.bind();
@@ -1053,11 +1471,25 @@ void RenderTarget::drawPrimitives(PrimitiveType type, std::size_t firstVertex, s
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, std::size_t firstIndex, std::size_t indexCount)
+{
+    // Find the OpenGL primitive type
+    const GLenum mode = primitiveTypeToGlEnum(type);
+
+    // Draw the primitives, the offset is a byte offset into the bound index buffer
+    m_impl->vao.bind();
+    glCheck(glDrawElements(mode,
+                           static_cast<GLsizei>(indexCount),
+                           GL_UNSIGNED_INT,
+                           reinterpret_cast<const void*>(sizeof(IndexType) * firstIndex)));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::cleanupDraw(const RenderStates& states)
 {
-    // Unbind the shader, if any
-    applyShader(/* shader */ nullptr);
+    // The shader is left bound: the next draw binds its own through the state cache, which skips it if unchanged
 
     // If the texture we used to draw belonged to a RenderTexture, then forcibly unbind that texture.
     // This prevents a bug where some drivers do not clear RenderTextures properly.
@@ -1066,7 +1498,7 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 
     // Mask the color buffer back on if necessary
     if (states.stencilMode.stencilOnly)
-        glCheck(glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE));
+        m_impl->graphicsContext->getActiveGLStateCache().colorMask(true, true, true, true);
 
     // Re-enable the cache at the end of the draw if it was disabled
     m_impl->cache.enable = true;
@@ -1106,8 +1538,14 @@ void RenderTarget::cleanupDraw(const RenderStates& states)
 // * Shader
 //   Shaders are very hard to optimize, because they have
 //   parameters that can be hard (if not impossible) to track,
-//   like matrices or textures. The only optimization that we
-//   do is that we avoid setting a null shader if there was
-//   already none for the previous draw.
+//   like matrices or textures. The program itself is left
+//   bound between draws, so that binding it again for the
+//   next draw is skipped by the state cache of the context.
+//
+// * OpenGL state
+//   All the state changes go through the state cache of the
+//   active context (`priv::GLStateCache`), which skips those
+//   setting a state to the value it already has, including
+//   across render targets sharing the same context.
 //
 ////////////////////////////////////////////////////////////
@@ -12,9 +12,14 @@
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Variant.hpp"
 
+#include <vector>
+
+#include <cstddef>
+
 
 namespace sf
 {
@@ -22,7 +27,8 @@ namespace sf
 struct RenderTexture::Impl
 {
     sfvr::tinyvariant<priv::RenderTextureImplDefault, priv::RenderTextureImplFBO> renderTextureImpl; //!< Platform/hardware specific implementation
-    Texture texture; //!< Target texture to draw on
+    Texture              texture;            //!< Target texture to draw on
+    std::vector<Texture> attachmentTextures; //!< Target textures of the color attachments after the first one
 
     template <typename TRenderTextureImplTag>
     explicit Impl(TRenderTextureImplTag theRenderTextureImplTag, GraphicsContext& graphicsContext, Texture&& theTexture) :
@@ -30,6 +36,15 @@ struct RenderTexture::Impl
     texture(SFML_BASE_MOVE(theTexture))
     {
     }
+
+    template <typename F>
+    void forEachTexture(F&& func)
+    {
+        func(texture);
+
+        for (Texture& attachmentTexture : attachmentTextures)
+            func(attachmentTexture);
+    }
 };
 
 
@@ -50,17 +65,81 @@ base::Optional<RenderTexture> RenderTexture::create(GraphicsContext&       graph
                                                     Vector2u               size,
                                                     const ContextSettings& contextSettings)
 {
+    const TextureFormat format = TextureFormat::RGBA8;
+    return create(graphicsContext, size, &format, 1u, contextSettings);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<RenderTexture> RenderTexture::create(GraphicsContext&       graphicsContext,
+                                                    Vector2u               size,
+                                                    const TextureFormat*   colorFormats,
+                                                    std::size_t            colorAttachmentCount,
+                                                    const ContextSettings& contextSettings)
+{
+    SFML_BASE_ASSERT(colorFormats != nullptr && colorAttachmentCount > 0u);
+
     base::Optional<RenderTexture> result; // Use a single local variable for NRVO
 
-    // Create the texture
-    auto texture = sf::Texture::create(graphicsContext, size, contextSettings.sRgbCapable);
+    const bool fboAvailable = priv::RenderTextureImplFBO::isAvailable(graphicsContext);
+
+    if (!fboAvailable && (colorAttachmentCount > 1u || colorFormats[0] != TextureFormat::RGBA8))
+    {
+        priv::err() << "Impossible to create render texture (multiple color attachments and formats other than "
+                       "RGBA8 require frame buffer objects)";
+        return result; // Empty optional
+    }
+
+    if (colorAttachmentCount > getMaximumColorAttachmentCount(graphicsContext))
+    {
+        priv::err() << "Impossible to create render texture (unsupported number of color attachments)"
+                    << " Requested: " << colorAttachmentCount
+                    << " Maximum supported: " << getMaximumColorAttachmentCount(graphicsContext);
+        return result; // Empty optional
+    }
+
+#ifdef SFML_OPENGL_ES
+    // Floating point textures can be sampled but not rendered to by OpenGL ES 3.0 and WebGL 2 without an extension
+    for (std::size_t i = 0; i < colorAttachmentCount; ++i)
+    {
+        const bool floatFormat = colorFormats[i] == TextureFormat::RGBA16F ||
+                                 colorFormats[i] == TextureFormat::R11FG11FB10F;
+
+        if (floatFormat && !graphicsContext.isExtensionAvailable("GL_EXT_color_buffer_float"))
+        {
+            priv::err() << "Impossible to create render texture (floating point color attachments require "
+                           "GL_EXT_color_buffer_float)";
+            return result; // Empty optional
+        }
+    }
+#endif
+
+    // Create the textures
+    auto texture = sf::Texture::create(graphicsContext, size, colorFormats[0], contextSettings.sRgbCapable);
     if (!texture.hasValue())
     {
         priv::err() << "Impossible to create render texture (failed to create the target texture)";
         return result; // Empty optional
     }
 
-    if (priv::RenderTextureImplFBO::isAvailable(graphicsContext))
+    std::vector<Texture> attachmentTextures;
+    attachmentTextures.reserve(colorAttachmentCount - 1u);
+
+    for (std::size_t i = 1u; i < colorAttachmentCount; ++i)
+    {
+        auto attachmentTexture = sf::Texture::create(graphicsContext, size, colorFormats[i], contextSettings.sRgbCapable);
+        if (!attachmentTexture.hasValue())
+        {
+            priv::err() << "Impossible to create render texture (failed to create the target texture of color "
+                           "attachment "
+                        << i << ")";
+            return result; // Empty optional
+        }
+
+        attachmentTextures.push_back(SFML_BASE_MOVE(*attachmentTexture));
+    }
+
+    if (fboAvailable)
     {
         // Use frame-buffer object (FBO)
         result.emplace(base::PassKey<RenderTexture>{},
@@ -68,8 +147,10 @@ base::Optional<RenderTexture> RenderTexture::create(GraphicsContext&       graph
                        sfvr::inplace_type<priv::RenderTextureImplFBO>,
                        SFML_BASE_MOVE(*texture));
 
-        // Mark the texture as being a framebuffer object attachment
-        result->m_impl->texture.m_fboAttachment = true;
+        result->m_impl->attachmentTextures = SFML_BASE_MOVE(attachmentTextures);
+
+        // Mark the textures as being framebuffer object attachments
+        result->m_impl->forEachTexture([](Texture& attachmentTexture) { attachmentTexture.m_fboAttachment = true; });
     }
     else
     {
@@ -85,9 +166,20 @@ base::Optional<RenderTexture> RenderTexture::create(GraphicsContext&       graph
 
     // Initialize the render texture
     // We pass the actual size of our texture since OpenGL ES requires that all attachments have identical sizes
+    unsigned int textureIds[MaxColorAttachments]{};
+    std::size_t  textureCount = 0u;
+
+    result->m_impl->forEachTexture([&](const Texture& attachmentTexture)
+                                   { textureIds[textureCount++] = attachmentTexture.m_texture; });
+
     if (!result->m_impl->renderTextureImpl.linear_visit(
-            [&](auto&& impl) {
-                return impl.create(result->m_impl->texture.m_actualSize, result->m_impl->texture.m_texture, contextSettings);
+            [&](auto&& impl)
+            {
+                return impl.create(result->m_impl->texture.m_actualSize,
+                                   textureIds,
+                                   colorFormats,
+                                   colorAttachmentCount,
+                                   contextSettings);
             }))
     {
         priv::err() << "Impossible to create render texture (failed to create render texture renderTextureImpl)";
@@ -112,10 +204,19 @@ unsigned int RenderTexture::getMaximumAntialiasingLevel(GraphicsContext& graphic
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int RenderTexture::getMaximumColorAttachmentCount(GraphicsContext& graphicsContext)
+{
+    return priv::RenderTextureImplFBO::isAvailable(graphicsContext)
+               ? priv::RenderTextureImplFBO::getMaximumColorAttachmentCount(graphicsContext)
+               : 1u;
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTexture::setSmooth(bool smooth)
 {
-    m_impl->texture.setSmooth(smooth);
+    m_impl->forEachTexture([&](Texture& texture) { texture.setSmooth(smooth); });
 }
 
 
@@ -126,10 +227,24 @@ bool RenderTexture::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTexture::setAlphaPremultiplied(bool premultiplied)
+{
+    m_impl->forEachTexture([&](Texture& texture) { texture.setAlphaPremultiplied(premultiplied); });
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderTexture::isAlphaPremultiplied() const
+{
+    return m_impl->texture.isAlphaPremultiplied();
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTexture::setRepeated(bool repeated)
 {
-    m_impl->texture.setRepeated(repeated);
+    m_impl->forEachTexture([&](Texture& texture) { texture.setRepeated(repeated); });
 }
 
 
@@ -143,7 +258,10 @@ bool RenderTexture::isRepeated() const
 ////////////////////////////////////////////////////////////
 bool RenderTexture::generateMipmap()
 {
-    return m_impl->texture.generateMipmap();
+    bool success = true;
+    m_impl->forEachTexture([&](Texture& texture) { success = texture.generateMipmap() && success; });
+
+    return success;
 }
 
 
@@ -176,8 +294,15 @@ void RenderTexture::display()
 
     // Update the target texture
     m_impl->renderTextureImpl.linear_visit([&](auto&& impl) { impl.updateTexture(m_impl->texture.m_texture); });
-    m_impl->texture.m_pixelsFlipped = true;
-    m_impl->texture.invalidateMipmap();
+    m_impl->forEachTexture(
+        [](Texture& texture)
+        {
+            texture.m_pixelsFlipped = true;
+            texture.invalidateMipmap();
+        });
+
+    // The next frame starts with no damage
+    clearDirtyRegion();
 }
 
 
@@ -202,6 +327,21 @@ const Texture& RenderTexture::getTexture() const
 }
 
 
+////////////////////////////////////////////////////////////
+const Texture& RenderTexture::getTexture(std::size_t index) const
+{
+    SFML_BASE_ASSERT(index < getColorAttachmentCount());
+    return index == 0u ? m_impl->texture : m_impl->attachmentTextures[index - 1u];
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexture::getColorAttachmentCount() const
+{
+    return m_impl->attachmentTextures.size() + 1u;
+}
+
+
 ////////////////////////////////////////////////////////////
 template <typename TRenderTextureImplTag>
 RenderTexture::RenderTexture(base::PassKey<RenderTexture>&&,
@@ -10,6 +10,7 @@
 #include "SFML/Window/ContextSettings.hpp"
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 #include "SFML/Window/GlContext.hpp"
 
 #include "SFML/Base/UniquePtr.hpp"
@@ -47,8 +48,14 @@ unsigned int RenderTextureImplDefault::getMaximumAntialiasingLevel()
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTextureImplDefault::create(Vector2u size, unsigned int, const ContextSettings& contextSettings)
+bool RenderTextureImplDefault::create(Vector2u                              size,
+                                      const unsigned int*,
+                                      [[maybe_unused]] const TextureFormat* formats,
+                                      [[maybe_unused]] std::size_t          attachmentCount,
+                                      const ContextSettings&                contextSettings)
 {
+    SFML_BASE_ASSERT(attachmentCount == 1u && formats[0] == TextureFormat::RGBA8);
+
     // Store the dimensions
     m_size = size;
 
@@ -78,10 +85,10 @@ bool RenderTextureImplDefault::isSrgb() const
 void RenderTextureImplDefault::updateTexture(unsigned int textureId) const
 {
     // Make sure that the current texture binding will be preserved
-    const TextureSaver save;
+    const TextureSaver save{*m_graphicsContext};
 
     // Copy the rendered pixels to the texture
-    glCheck(glBindTexture(GL_TEXTURE_2D, textureId));
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, textureId);
     glCheck(
         glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, static_cast<GLsizei>(m_size.x), static_cast<GLsizei>(m_size.y)));
 }
@@ -4,10 +4,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Graphics/TextureFormat.hpp"
+
 #include "SFML/System/Vector2.hpp"
 
 #include "SFML/Base/UniquePtr.hpp"
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -72,14 +76,24 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create the render texture implementation
     ///
-    /// \param size       Width and height of the texture to render to
-    /// \param textureId  OpenGL identifier of the target texture
-    /// \param settings   Context settings to create render-texture with
+    /// Only a single `TextureFormat::RGBA8` color attachment is
+    /// supported, as the pixels are copied from the context's
+    /// default frame buffer.
+    ///
+    /// \param size            Width and height of the texture to render to
+    /// \param textureIds      OpenGL identifier of the target texture
+    /// \param formats         Format of the target texture
+    /// \param attachmentCount Number of color attachments, must be 1
+    /// \param settings        Context settings to create render-texture with
     ///
     /// \return True if creation has been successful
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool create(Vector2u size, unsigned int textureId, const ContextSettings& contextSettings);
+    [[nodiscard]] bool create(Vector2u               size,
+                              const unsigned int*    textureIds,
+                              const TextureFormat*   formats,
+                              std::size_t            attachmentCount,
+                              const ContextSettings& contextSettings);
 
     ////////////////////////////////////////////////////////////
     /// \brief Activate or deactivate the render texture for rendering
@@ -4,21 +4,26 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
 #include "SFML/Graphics/RenderTextureImplFBO.hpp"
+#include "SFML/Graphics/TextureFormat.hpp"
 
 #include "SFML/Window/ContextSettings.hpp"
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 #include "SFML/Window/GlContext.hpp"
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 #include <unordered_map>
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -30,6 +35,42 @@ void deleteFrameBuffer(unsigned int id)
     glCheck(GLEXT_glDeleteFramebuffers(1, &id));
 }
 
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum getRenderbufferFormat(sf::TextureFormat format, bool sRgb)
+{
+    switch (format)
+    {
+        case sf::TextureFormat::RGBA8:
+            return sRgb ? GL_SRGB8_ALPHA8_EXT : GL_RGBA;
+
+        case sf::TextureFormat::RGBA16F:
+            return GL_RGBA16F;
+
+        case sf::TextureFormat::R11FG11FB10F:
+            return GL_R11F_G11F_B10F;
+
+        case sf::TextureFormat::R8:
+            return GL_R8;
+    }
+
+    SFML_BASE_ASSERT(false && "Unknown texture format");
+    return GL_RGBA;
+}
+
+
+////////////////////////////////////////////////////////////
+void setDrawBuffers(std::size_t attachmentCount)
+{
+    // Fragment shader output `i` is written to color attachment `i`
+    GLenum drawBuffers[sf::RenderTexture::MaxColorAttachments];
+
+    for (std::size_t i = 0; i < attachmentCount; ++i)
+        drawBuffers[i] = static_cast<GLenum>(GLEXT_GL_COLOR_ATTACHMENT0 + i);
+
+    glCheck(glDrawBuffers(static_cast<GLsizei>(attachmentCount), drawBuffers));
+}
+
 } // namespace
 
 
@@ -49,14 +90,15 @@ struct RenderTextureImplFBO::Impl
     FrameBufferIdMap frameBuffers; //!< OpenGL frame buffer objects per context
     FrameBufferIdMap multisampleFrameBuffers; //!< base::Optional per-context OpenGL frame buffer objects with multisample attachments
 
-    unsigned int depthStencilBuffer{}; //!< base::Optional depth/stencil buffer attached to the frame buffer
-    unsigned int colorBuffer{};        //!< base::Optional multisample color buffer attached to the frame buffer
-    Vector2u     size;                 //!< Width and height of the attachments
-    unsigned int textureId{};          //!< The ID of the texture to attach to the FBO
-    bool         multisample{};        //!< Whether we have to create a multisample frame buffer as well
-    bool         depth{};              //!< Whether we have depth attachment
-    bool         stencil{};            //!< Whether we have stencil attachment
-    bool         sRgb{};               //!< Whether we need to encode drawn pixels into sRGB color space
+    unsigned int depthStencilBuffer{};                               //!< base::Optional depth/stencil buffer attached to the frame buffer
+    unsigned int colorBuffers[RenderTexture::MaxColorAttachments]{}; //!< base::Optional multisample color buffers attached to the frame buffer
+    unsigned int textureIds[RenderTexture::MaxColorAttachments]{};   //!< The IDs of the textures to attach to the FBO
+    std::size_t  attachmentCount{};                                  //!< Number of color attachments
+    Vector2u     size;                                               //!< Width and height of the attachments
+    bool         multisample{};                                      //!< Whether we have to create a multisample frame buffer as well
+    bool         depth{};                                            //!< Whether we have depth attachment
+    bool         stencil{};                                          //!< Whether we have stencil attachment
+    bool         sRgb{};                                             //!< Whether we need to encode drawn pixels into sRGB color space
 };
 
 
@@ -71,11 +113,14 @@ RenderTextureImplFBO::~RenderTextureImplFBO()
 {
     SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
-    // Destroy the color buffer
-    if (m_impl->colorBuffer)
+    // Destroy the color buffers
+    for (const unsigned int colorBuffer : m_impl->colorBuffers)
     {
-        const GLuint colorBuffer = m_impl->colorBuffer;
-        glCheck(GLEXT_glDeleteRenderbuffers(1, &colorBuffer));
+        if (colorBuffer)
+        {
+            const GLuint glColorBuffer = colorBuffer;
+            glCheck(GLEXT_glDeleteRenderbuffers(1, &glColorBuffer));
+        }
     }
 
     // Destroy the depth/stencil buffer
@@ -126,6 +171,20 @@ unsigned int RenderTextureImplFBO::getMaximumAntialiasingLevel([[maybe_unused]]
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int RenderTextureImplFBO::getMaximumColorAttachmentCount([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    // Every attachment must also be an output of the fragment shader
+    const auto maxColorAttachments = static_cast<unsigned int>(getGLInteger(GL_MAX_COLOR_ATTACHMENTS));
+    const auto maxDrawBuffers      = static_cast<unsigned int>(getGLInteger(GL_MAX_DRAW_BUFFERS));
+
+    return base::min(base::min(maxColorAttachments, maxDrawBuffers),
+                     static_cast<unsigned int>(RenderTexture::MaxColorAttachments));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTextureImplFBO::unbind()
 {
@@ -134,8 +193,14 @@ void RenderTextureImplFBO::unbind()
 
 
 ////////////////////////////////////////////////////////////
-bool RenderTextureImplFBO::create(Vector2u size, unsigned int textureId, const ContextSettings& contextSettings)
+bool RenderTextureImplFBO::create(Vector2u               size,
+                                  const unsigned int*    textureIds,
+                                  const TextureFormat*   formats,
+                                  std::size_t            attachmentCount,
+                                  const ContextSettings& contextSettings)
 {
+    SFML_BASE_ASSERT(attachmentCount > 0u && attachmentCount <= RenderTexture::MaxColorAttachments);
+
     // Store the dimensions
     m_impl->size = size;
 
@@ -236,22 +301,25 @@ bool RenderTextureImplFBO::create(Vector2u size, unsigned int textureId, const C
         }
         else
         {
-            // Create the multisample color buffer
-            GLuint color = 0;
-            glCheck(GLEXT_glGenRenderbuffers(1, &color));
-            m_impl->colorBuffer = color;
-            if (!m_impl->colorBuffer)
+            // Create the multisample color buffers, one per color attachment
+            for (std::size_t i = 0; i < attachmentCount; ++i)
             {
-                err() << "Impossible to create render texture (failed to create the attached multisample color "
-                         "buffer)";
-                return false;
+                GLuint color = 0;
+                glCheck(GLEXT_glGenRenderbuffers(1, &color));
+                m_impl->colorBuffers[i] = color;
+                if (!m_impl->colorBuffers[i])
+                {
+                    err() << "Impossible to create render texture (failed to create the attached multisample color "
+                             "buffer)";
+                    return false;
+                }
+                glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_impl->colorBuffers[i]));
+                glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER,
+                                                               static_cast<GLsizei>(contextSettings.antialiasingLevel),
+                                                               getRenderbufferFormat(formats[i], m_impl->sRgb),
+                                                               static_cast<GLsizei>(size.x),
+                                                               static_cast<GLsizei>(size.y)));
             }
-            glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_impl->colorBuffer));
-            glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER,
-                                                           static_cast<GLsizei>(contextSettings.antialiasingLevel),
-                                                           m_impl->sRgb ? GL_SRGB8_ALPHA8_EXT : GL_RGBA,
-                                                           static_cast<GLsizei>(size.x),
-                                                           static_cast<GLsizei>(size.y)));
 
             // Create the multisample depth/stencil buffer if requested
             if (contextSettings.stencilBits && contextSettings.depthBits)
@@ -323,8 +391,11 @@ bool RenderTextureImplFBO::create(Vector2u size, unsigned int textureId, const C
         }
     }
 
-    // Save our texture ID in order to be able to attach it to an FBO at any time
-    m_impl->textureId = textureId;
+    // Save our texture IDs in order to be able to attach them to an FBO at any time
+    for (std::size_t i = 0; i < attachmentCount; ++i)
+        m_impl->textureIds[i] = textureIds[i];
+
+    m_impl->attachmentCount = attachmentCount;
 
     // We can't create an FBO now if there is no active context
     if (!m_impl->graphicsContext->hasActiveThreadLocalGlContext())
@@ -399,9 +470,17 @@ bool RenderTextureImplFBO::createFrameBuffer()
         }
     }
 
-    // Link the texture to the frame buffer
-    glCheck(
-        GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_impl->textureId, 0));
+    // Link the textures to the frame buffer
+    for (std::size_t i = 0; i < m_impl->attachmentCount; ++i)
+        glCheck(GLEXT_glFramebufferTexture2D(GLEXT_GL_FRAMEBUFFER,
+                                             static_cast<GLenum>(GLEXT_GL_COLOR_ATTACHMENT0 + i),
+                                             GL_TEXTURE_2D,
+                                             m_impl->textureIds[i],
+                                             0));
+
+    // Only the first attachment is drawn to by default
+    if (m_impl->attachmentCount > 1u)
+        setDrawBuffers(m_impl->attachmentCount);
 
     // A final check, just to be sure...
     GLenum status = 0;
@@ -437,12 +516,18 @@ bool RenderTextureImplFBO::createFrameBuffer()
         }
         glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, multisampleFrameBufferId));
 
-        // Link the multisample color buffer to the frame buffer
-        glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_impl->colorBuffer));
-        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER,
-                                                GLEXT_GL_COLOR_ATTACHMENT0,
-                                                GLEXT_GL_RENDERBUFFER,
-                                                m_impl->colorBuffer));
+        // Link the multisample color buffers to the frame buffer
+        for (std::size_t i = 0; i < m_impl->attachmentCount; ++i)
+        {
+            glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, m_impl->colorBuffers[i]));
+            glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER,
+                                                    static_cast<GLenum>(GLEXT_GL_COLOR_ATTACHMENT0 + i),
+                                                    GLEXT_GL_RENDERBUFFER,
+                                                    m_impl->colorBuffers[i]));
+        }
+
+        if (m_impl->attachmentCount > 1u)
+            setDrawBuffers(m_impl->attachmentCount);
 
         // Link the depth/stencil renderbuffer to the frame buffer
         if (m_impl->depthStencilBuffer)
@@ -558,29 +643,52 @@ void RenderTextureImplFBO::updateTexture(unsigned int)
         {
             // Scissor testing affects framebuffer blits as well
             // Since we don't want scissor testing to interfere with our copying, we temporarily disable it for the blit if it is enabled
-            GLboolean scissorEnabled = GL_FALSE;
-            glCheck(glGetBooleanv(GL_SCISSOR_TEST, &scissorEnabled));
-
-            if (scissorEnabled == GL_TRUE)
-                glCheck(glDisable(GL_SCISSOR_TEST));
+            GLStateCache& stateCache     = m_impl->graphicsContext->getActiveGLStateCache();
+            const bool    scissorEnabled = stateCache.isEnabled(GL_SCISSOR_TEST);
+            stateCache.setEnabled(GL_SCISSOR_TEST, false);
 
             // Set up the blit target (draw framebuffer) and blit (from the read framebuffer, our multisample FBO)
             glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, frameBufferIt->second));
-            glCheck(GLEXT_glBlitFramebuffer(0,
-                                            0,
-                                            static_cast<GLint>(m_impl->size.x),
-                                            static_cast<GLint>(m_impl->size.y),
-                                            0,
-                                            0,
-                                            static_cast<GLint>(m_impl->size.x),
-                                            static_cast<GLint>(m_impl->size.y),
-                                            GL_COLOR_BUFFER_BIT,
-                                            GL_NEAREST));
+
+            // A blit copies a single read buffer, so each attachment is resolved on its own
+            for (std::size_t i = 0; i < m_impl->attachmentCount; ++i)
+            {
+                if (m_impl->attachmentCount > 1u)
+                {
+                    GLenum drawBuffers[RenderTexture::MaxColorAttachments];
+
+                    for (std::size_t j = 0; j < i; ++j)
+                        drawBuffers[j] = GL_NONE;
+
+                    drawBuffers[i] = static_cast<GLenum>(GLEXT_GL_COLOR_ATTACHMENT0 + i);
+
+                    glCheck(glReadBuffer(drawBuffers[i]));
+                    glCheck(glDrawBuffers(static_cast<GLsizei>(i + 1), drawBuffers));
+                }
+
+                glCheck(GLEXT_glBlitFramebuffer(0,
+                                                0,
+                                                static_cast<GLint>(m_impl->size.x),
+                                                static_cast<GLint>(m_impl->size.y),
+                                                0,
+                                                0,
+                                                static_cast<GLint>(m_impl->size.x),
+                                                static_cast<GLint>(m_impl->size.y),
+                                                GL_COLOR_BUFFER_BIT,
+                                                GL_NEAREST));
+            }
+
+            // Restore the read and draw buffers of both frame buffers
+            if (m_impl->attachmentCount > 1u)
+            {
+                setDrawBuffers(m_impl->attachmentCount);
+                glCheck(glReadBuffer(GLEXT_GL_COLOR_ATTACHMENT0));
+            }
+
             glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, multisampleIt->second));
 
             // Re-enable scissor testing if it was previously enabled
-            if (scissorEnabled == GL_TRUE)
-                glCheck(glEnable(GL_SCISSOR_TEST));
+            stateCache.setEnabled(GL_SCISSOR_TEST, scissorEnabled);
         }
     }
 
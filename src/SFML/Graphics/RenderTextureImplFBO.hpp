@@ -4,10 +4,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Graphics/TextureFormat.hpp"
+
 #include "SFML/System/Vector2.hpp"
 
 #include "SFML/Base/InPlacePImpl.hpp"
 
+#include <cstddef>
+
 
 namespace sf
 {
@@ -76,6 +80,14 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static unsigned int getMaximumAntialiasingLevel(GraphicsContext& graphicsContext);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of color attachments supported by the system
+    ///
+    /// \return The maximum number of color attachments, capped to `RenderTexture::MaxColorAttachments`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaximumColorAttachmentCount(GraphicsContext& graphicsContext);
+
     ////////////////////////////////////////////////////////////
     /// \brief Unbind the currently bound FBO
     ///
@@ -85,14 +97,20 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create the render texture implementation
     ///
-    /// \param size       Width and height of the texture to render to
-    /// \param textureId  OpenGL identifier of the target texture
-    /// \param settings   Context settings to create render-texture with
+    /// \param size            Width and height of the textures to render to
+    /// \param textureIds      OpenGL identifiers of the target textures, one per color attachment
+    /// \param formats         Formats of the target textures
+    /// \param attachmentCount Number of color attachments
+    /// \param settings        Context settings to create render-texture with
     ///
     /// \return True if creation has been successful
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool create(Vector2u size, unsigned int textureId, const ContextSettings& contextSettings);
+    [[nodiscard]] bool create(Vector2u               size,
+                              const unsigned int*    textureIds,
+                              const TextureFormat*   formats,
+                              std::size_t            attachmentCount,
+                              const ContextSettings& contextSettings);
 
     ////////////////////////////////////////////////////////////
     /// \brief Create an FBO in the current context
@@ -136,7 +154,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 192> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 256> m_impl; //!< Implementation details
 };
 
 } // namespace priv
@@ -0,0 +1,276 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/RenderTexturePool.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace RenderTexturePoolImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isCompatible(const sf::ContextSettings& lhs, const sf::ContextSettings& rhs)
+{
+    // The context version and attributes are irrelevant to render textures
+    return lhs.depthBits == rhs.depthBits && lhs.stencilBits == rhs.stencilBits &&
+           lhs.antialiasingLevel == rhs.antialiasingLevel && lhs.sRgbCapable == rhs.sRgbCapable;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool hasSameFormats(const std::vector<sf::TextureFormat>& lhs,
+                                  const sf::TextureFormat*              rhs,
+                                  std::size_t                           rhsCount)
+{
+    if (lhs.size() != rhsCount)
+        return false;
+
+    for (std::size_t i = 0u; i < rhsCount; ++i)
+        if (lhs[i] != rhs[i])
+            return false;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getBytesPerPixel(sf::TextureFormat format)
+{
+    switch (format)
+    {
+        case sf::TextureFormat::RGBA8:
+            return 4u;
+        case sf::TextureFormat::RGBA16F:
+            return 8u;
+        case sf::TextureFormat::R11FG11FB10F:
+            return 4u;
+        case sf::TextureFormat::R8:
+            return 1u;
+    }
+
+    SFML_BASE_ASSERT(false && "Unknown texture format");
+    return 4u;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t estimateMemoryUsage(sf::Vector2u                          size,
+                                              const std::vector<sf::TextureFormat>& colorFormats,
+                                              const sf::ContextSettings&            contextSettings)
+{
+    const std::size_t pixelCount  = std::size_t{size.x} * std::size_t{size.y};
+    const std::size_t sampleCount = contextSettings.antialiasingLevel;
+
+    std::size_t memoryUsage = 0u;
+
+    // Resolved color textures, plus their multisample color renderbuffers
+    for (const sf::TextureFormat format : colorFormats)
+        memoryUsage += pixelCount * getBytesPerPixel(format) * (1u + sampleCount);
+
+    // Depth and stencil are packed together, or padded to 32 bits when alone
+    if (contextSettings.depthBits > 0u || contextSettings.stencilBits > 0u)
+        memoryUsage += pixelCount * 4u * (sampleCount > 0u ? sampleCount : 1u);
+
+    return memoryUsage;
+}
+
+} // namespace RenderTexturePoolImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+RenderTexturePool::RenderTexturePool(GraphicsContext& graphicsContext) : m_graphicsContext(&graphicsContext)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexturePool::~RenderTexturePool() = default;
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(Vector2u size, const ContextSettings& contextSettings)
+{
+    const TextureFormat format = TextureFormat::RGBA8;
+    return acquire(size, &format, 1u, contextSettings);
+}
+
+
+////////////////////////////////////////////////////////////
+RenderTexture* RenderTexturePool::acquire(Vector2u               size,
+                                          const TextureFormat*   colorFormats,
+                                          std::size_t            colorAttachmentCount,
+                                          const ContextSettings& contextSettings)
+{
+    SFML_BASE_ASSERT(colorFormats != nullptr && colorAttachmentCount > 0u);
+
+    for (Entry& entry : m_entries)
+    {
+        if (entry.acquired || entry.size != size ||
+            !RenderTexturePoolImpl::isCompatible(entry.contextSettings, contextSettings) ||
+            !RenderTexturePoolImpl::hasSameFormats(entry.colorFormats, colorFormats, colorAttachmentCount))
+            continue;
+
+        entry.acquired = true;
+        ++m_reuseCount;
+
+        // Undo the changes of the previous user, so that reused render textures behave like new ones
+        RenderTexture& renderTexture = *entry.renderTexture;
+        renderTexture.setView(renderTexture.getDefaultView());
+        renderTexture.setSmooth(false);
+        renderTexture.setRepeated(false);
+
+        return &renderTexture;
+    }
+
+    base::Optional<RenderTexture> renderTexture = RenderTexture::create(*m_graphicsContext,
+                                                                        size,
+                                                                        colorFormats,
+                                                                        colorAttachmentCount,
+                                                                        contextSettings);
+
+    if (!renderTexture.hasValue())
+        return nullptr;
+
+    std::vector<TextureFormat> formats(colorFormats, colorFormats + colorAttachmentCount);
+
+    const std::size_t memoryUsage = RenderTexturePoolImpl::estimateMemoryUsage(size, formats, contextSettings);
+    m_memoryUsage += memoryUsage;
+
+    m_entries.push_back({base::makeUnique<RenderTexture>(SFML_BASE_MOVE(*renderTexture)),
+                         size,
+                         contextSettings,
+                         SFML_BASE_MOVE(formats),
+                         memoryUsage,
+                         m_frame,
+                         true});
+
+    return m_entries.back().renderTexture.get();
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::release(RenderTexture& renderTexture)
+{
+    for (Entry& entry : m_entries)
+    {
+        if (entry.renderTexture.get() != &renderTexture)
+            continue;
+
+        SFML_BASE_ASSERT(entry.acquired && "RenderTexturePool render texture released twice");
+
+        entry.acquired      = false;
+        entry.lastUsedFrame = m_frame;
+        return;
+    }
+
+    SFML_BASE_ASSERT(false && "RenderTexturePool render texture not acquired from this pool");
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::endFrame()
+{
+    ++m_frame;
+
+    destroyReleased([&](const Entry& entry) { return m_frame - entry.lastUsedFrame > m_maxIdleFrames; });
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::setMaxIdleFrames(unsigned int maxIdleFrames)
+{
+    m_maxIdleFrames = maxIdleFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderTexturePool::getMaxIdleFrames() const
+{
+    return m_maxIdleFrames;
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTexturePool::clear()
+{
+    destroyReleased([](const Entry&) { return true; });
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getRenderTextureCount() const
+{
+    return m_entries.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getAcquiredCount() const
+{
+    std::size_t count = 0u;
+
+    for (const Entry& entry : m_entries)
+        count += entry.acquired ? 1u : 0u;
+
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getReuseCount() const
+{
+    return m_reuseCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t RenderTexturePool::getMemoryUsage() const
+{
+    return m_memoryUsage;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Predicate>
+void RenderTexturePool::destroyReleased(Predicate&& predicate)
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Compact in place, acquired render textures keep their address since they are heap allocated
+    std::size_t kept = 0u;
+
+    for (Entry& entry : m_entries)
+    {
+        if (!entry.acquired && predicate(entry))
+        {
+            m_memoryUsage -= entry.memoryUsage;
+            entry.renderTexture.reset();
+            continue;
+        }
+
+        if (&m_entries[kept] != &entry)
+            m_entries[kept] = SFML_BASE_MOVE(entry);
+
+        ++kept;
+    }
+
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(kept), m_entries.end());
+}
+
+} // namespace sf
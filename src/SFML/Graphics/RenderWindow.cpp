@@ -11,8 +11,13 @@
 #include "SFML/Window/Event.hpp"
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 #include "SFML/Window/WindowBase.hpp"
 
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
 
 namespace
 {
@@ -32,6 +37,23 @@ void retrieveWindowFrameBufferId(sf::GraphicsContext& graphicsContext, unsigned
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+struct RenderWindow::BackBuffer
+{
+    ~BackBuffer()
+    {
+        glCheck(GLEXT_glDeleteFramebuffers(1, &frameBuffer));
+        glCheck(GLEXT_glDeleteRenderbuffers(1, &colorBuffer));
+        glCheck(GLEXT_glDeleteRenderbuffers(1, &depthStencilBuffer));
+    }
+
+    GLuint   frameBuffer{};        //!< Framebuffer object drawn into instead of the window
+    GLuint   colorBuffer{};        //!< Color renderbuffer, matching the format of the window
+    GLuint   depthStencilBuffer{}; //!< Depth/stencil renderbuffer, if the window has any
+    Vector2u size;                 //!< Size of the renderbuffers
+};
+
+
 ////////////////////////////////////////////////////////////
 RenderWindow::RenderWindow(GraphicsContext& graphicsContext, const WindowSettings& windowSettings) :
 Window(graphicsContext, windowSettings),
@@ -39,6 +61,7 @@ RenderTarget(graphicsContext)
 {
     retrieveWindowFrameBufferId(getGraphicsContext(), m_defaultFrameBuffer);
     RenderTarget::initialize(); // Just initialize the render target part
+    setDisplayHook(&finishFrame);
 }
 
 
@@ -49,6 +72,7 @@ RenderTarget(graphicsContext)
 {
     retrieveWindowFrameBufferId(getGraphicsContext(), m_defaultFrameBuffer);
     RenderTarget::initialize(); // Just initialize the render target part
+    setDisplayHook(&finishFrame);
 }
 
 
@@ -100,10 +124,11 @@ bool RenderWindow::setActive(bool active)
         result = RenderTarget::setActive(active);
 
     // If FBOs are available, make sure none are bound when we
-    // try to draw to the default framebuffer of the RenderWindow
+    // try to draw to the default framebuffer of the RenderWindow,
+    // or to its back buffer when damage tracking is enabled
     if (active && result && priv::RenderTextureImplFBO::isAvailable(getGraphicsContext()))
     {
-        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_defaultFrameBuffer));
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, getTargetFrameBuffer()));
         return true;
     }
 
@@ -111,6 +136,183 @@ bool RenderWindow::setActive(bool active)
 }
 
 
+////////////////////////////////////////////////////////////
+bool RenderWindow::setDamageTrackingEnabled(bool enabled)
+{
+    if (enabled != (m_backBuffer != nullptr))
+    {
+        if (enabled && !priv::RenderTextureImplFBO::isAvailable(getGraphicsContext()))
+        {
+            priv::err() << "Failed to enable damage tracking (framebuffer objects are not available)";
+            return false;
+        }
+
+        if (!setActive(true))
+        {
+            priv::err() << "Failed to activate the window in `setDamageTrackingEnabled`";
+            return false;
+        }
+
+        if (!enabled)
+            m_backBuffer.reset();
+        else if (!createBackBuffer())
+            return false;
+
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, getTargetFrameBuffer()));
+    }
+
+    return RenderTarget::setDamageTrackingEnabled(enabled);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderWindow::finishFrame(Window& window)
+{
+    // The hook is only ever set by render windows on themselves
+    auto& renderWindow = static_cast<RenderWindow&>(window);
+
+    if (renderWindow.m_backBuffer != nullptr && renderWindow.setActive(true))
+    {
+        // Scissor testing affects framebuffer blits as well
+        // The view is applied again after the dirty region is cleared, which restores it
+        renderWindow.getGraphicsContext().getActiveGLStateCache().setEnabled(GL_SCISSOR_TEST, false);
+
+        // The window contents are undefined after a swap, so the whole back buffer is presented
+        const BackBuffer& backBuffer = *renderWindow.m_backBuffer;
+        const auto [width, height]   = backBuffer.size.to<Vector2i>();
+
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_READ_FRAMEBUFFER, backBuffer.frameBuffer));
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_DRAW_FRAMEBUFFER, renderWindow.m_defaultFrameBuffer));
+        glCheck(GLEXT_glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, backBuffer.frameBuffer));
+    }
+
+    // The next frame starts with no damage
+    renderWindow.clearDirtyRegion();
+}
+
+
+////////////////////////////////////////////////////////////
+bool RenderWindow::createBackBuffer()
+{
+    const ContextSettings& settings = getSettings();
+    const auto             samples  = static_cast<GLsizei>(settings.antialiasingLevel);
+
+    if (!GLEXT_framebuffer_blit)
+    {
+        priv::err() << "Impossible to create the back buffer of the window (framebuffer blits unsupported)";
+        return false;
+    }
+
+    // The back buffer must have as many samples as the window to be blit to it
+    if (samples > 0)
+    {
+#ifdef SFML_OPENGL_ES
+        // OpenGL ES forbids blits to a multisampled framebuffer
+        priv::err() << "Impossible to create the back buffer of the window (multisampled windows unsupported on "
+                       "OpenGL ES)";
+        return false;
+#else
+        if (!GLEXT_framebuffer_multisample)
+        {
+            priv::err() << "Impossible to create the back buffer of the window (anti-aliasing unsupported)";
+            return false;
+        }
+
+        if (const GLint maxSamples = priv::getGLInteger(GLEXT_GL_MAX_SAMPLES); samples > maxSamples)
+        {
+            priv::err() << "Impossible to create the back buffer of the window (unsupported anti-aliasing level)"
+                        << " Requested: " << samples << " Maximum supported: " << maxSamples;
+            return false;
+        }
+#endif
+    }
+
+    auto backBuffer  = base::makeUnique<BackBuffer>();
+    backBuffer->size = getSize();
+
+    // The renderbuffers must match the window framebuffer, so that they can be blit to it
+    const auto allocateStorage = [&](GLenum format)
+    {
+        const auto [width, height] = backBuffer->size.to<Vector2i>();
+
+        if (samples > 0)
+            glCheck(GLEXT_glRenderbufferStorageMultisample(GLEXT_GL_RENDERBUFFER, samples, format, width, height));
+        else
+            glCheck(GLEXT_glRenderbufferStorage(GLEXT_GL_RENDERBUFFER, format, width, height));
+    };
+
+    glCheck(GLEXT_glGenRenderbuffers(1, &backBuffer->colorBuffer));
+    if (!backBuffer->colorBuffer)
+    {
+        priv::err() << "Impossible to create the back buffer of the window (failed to create the color buffer)";
+        return false;
+    }
+
+    glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, backBuffer->colorBuffer));
+    allocateStorage(isSrgb() ? GL_SRGB8_ALPHA8_EXT : GL_RGBA8);
+
+    if (settings.depthBits || settings.stencilBits)
+    {
+        glCheck(GLEXT_glGenRenderbuffers(1, &backBuffer->depthStencilBuffer));
+        if (!backBuffer->depthStencilBuffer)
+        {
+            priv::err() << "Impossible to create the back buffer of the window (failed to create the depth/stencil "
+                           "buffer)";
+            return false;
+        }
+
+        glCheck(GLEXT_glBindRenderbuffer(GLEXT_GL_RENDERBUFFER, backBuffer->depthStencilBuffer));
+        allocateStorage(GL_DEPTH24_STENCIL8);
+    }
+
+    glCheck(GLEXT_glGenFramebuffers(1, &backBuffer->frameBuffer));
+    if (!backBuffer->frameBuffer)
+    {
+        priv::err() << "Impossible to create the back buffer of the window (failed to create the frame buffer object)";
+        return false;
+    }
+
+    glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, backBuffer->frameBuffer));
+    glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER,
+                                            GLEXT_GL_COLOR_ATTACHMENT0,
+                                            GLEXT_GL_RENDERBUFFER,
+                                            backBuffer->colorBuffer));
+
+    if (backBuffer->depthStencilBuffer)
+    {
+        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER,
+                                                GLEXT_GL_DEPTH_ATTACHMENT,
+                                                GLEXT_GL_RENDERBUFFER,
+                                                backBuffer->depthStencilBuffer));
+
+        glCheck(GLEXT_glFramebufferRenderbuffer(GLEXT_GL_FRAMEBUFFER,
+                                                GLEXT_GL_STENCIL_ATTACHMENT,
+                                                GLEXT_GL_RENDERBUFFER,
+                                                backBuffer->depthStencilBuffer));
+    }
+
+    GLenum status = 0;
+    glCheck(status = GLEXT_glCheckFramebufferStatus(GLEXT_GL_FRAMEBUFFER));
+    if (status != GLEXT_GL_FRAMEBUFFER_COMPLETE)
+    {
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, m_defaultFrameBuffer));
+        priv::err() << "Impossible to create the back buffer of the window (incomplete frame buffer object)";
+        return false;
+    }
+
+    m_backBuffer = SFML_BASE_MOVE(backBuffer);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int RenderWindow::getTargetFrameBuffer() const
+{
+    return m_backBuffer != nullptr ? m_backBuffer->frameBuffer : m_defaultFrameBuffer;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<Event> RenderWindow::filterEvent(base::Optional<Event> event)
 {
@@ -146,6 +348,21 @@ void RenderWindow::setSize(const Vector2u& size)
 ////////////////////////////////////////////////////////////
 void RenderWindow::onResize()
 {
+    // Recreate the back buffer at the new size, its previous contents are lost
+    if (m_backBuffer != nullptr && setActive(true))
+    {
+        m_backBuffer.reset();
+
+        if (!createBackBuffer())
+        {
+            priv::err() << "Failed to resize the back buffer of the window, disabling damage tracking";
+            [[maybe_unused]] const bool rc = RenderTarget::setDamageTrackingEnabled(false);
+        }
+
+        glCheck(GLEXT_glBindFramebuffer(GLEXT_GL_FRAMEBUFFER, getTargetFrameBuffer()));
+        markAllDirty();
+    }
+
     // Update the current view (recompute the viewport, which is stored in relative coordinates)
     setView(getView());
 }
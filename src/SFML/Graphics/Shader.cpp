@@ -6,10 +6,12 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Shader.hpp"
+#include "SFML/Graphics/ShaderCache.hpp"
 #include "SFML/Graphics/Texture.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 
 #include "SFML/System/Err.hpp"
 #include "SFML/System/InputStream.hpp"
@@ -26,9 +28,11 @@
 #include <fstream>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
+#include <cstdint>
+#include <cstring>
+
 
 #if defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_IOS)
 
@@ -183,26 +187,45 @@ struct [[nodiscard]] BufferSlice
     return contiguous;
 }
 
-struct StringHash
-{
-    using is_transparent = void;
-
-    [[nodiscard]] size_t operator()(const char* txt) const
-    {
-        return std::hash<std::string_view>{}(txt);
-    }
+} // namespace
 
-    [[nodiscard]] size_t operator()(std::string_view txt) const
-    {
-        return std::hash<std::string_view>{}(txt);
-    }
 
-    [[nodiscard]] size_t operator()(const std::string& txt) const
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderImpl
+{
+// Check if an active uniform type is an opaque sampler type, which requires a texture unit
+[[nodiscard]] bool isSamplerType(GLenum type)
+{
+    switch (type)
     {
-        return std::hash<std::string>{}(txt);
+        case GL_SAMPLER_1D:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_1D_SHADOW:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_2D_ARRAY:
+        case GL_SAMPLER_2D_ARRAY_SHADOW:
+        case GL_SAMPLER_CUBE_SHADOW:
+        case GL_SAMPLER_2D_RECT:
+        case GL_INT_SAMPLER_2D:
+        case GL_INT_SAMPLER_3D:
+        case GL_INT_SAMPLER_CUBE:
+        case GL_INT_SAMPLER_2D_ARRAY:
+        case GL_UNSIGNED_INT_SAMPLER_2D:
+        case GL_UNSIGNED_INT_SAMPLER_3D:
+        case GL_UNSIGNED_INT_SAMPLER_CUBE:
+        case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
+            return true;
+
+        default:
+            return false;
     }
-};
+}
 
+} // namespace ShaderImpl
 } // namespace
 
 
@@ -210,16 +233,37 @@ namespace sf
 {
 struct Shader::Impl
 {
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int, StringHash, std::equal_to<>>;
+    ////////////////////////////////////////////////////////////
+    /// \brief Location of a uniform, looked up by name
+    ///
+    ////////////////////////////////////////////////////////////
+    struct UniformEntry
+    {
+        std::string name;     //!< Name of the uniform, as passed to `getUniformLocation`
+        int         location; //!< Location of the uniform, -1 if inactive
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sampler uniform and its texture unit, fixed at link time
+    ///
+    ////////////////////////////////////////////////////////////
+    struct SamplerSlot
+    {
+        int            location;  //!< Location of the sampler uniform
+        int            unit;      //!< Texture unit reserved for the sampler, 0 if none was left
+        int            value{};   //!< Texture unit currently stored in the uniform
+        const Texture* texture{}; //!< Texture bound to the unit, `nullptr` if none
+    };
 
     GraphicsContext* graphicsContext;
-    unsigned int     shaderProgram{};    //!< OpenGL identifier for the program
-    int              currentTexture{-1}; //!< Location of the current texture in the shader
+    unsigned int     shaderProgram{}; //!< OpenGL identifier for the program
 
     // TODO P1: protect with mutex? Change API?
-    mutable TextureTable textures; //!< Texture variables in the shader, mapped to their location
-    mutable UniformTable uniforms; //!< Parameters location cache
+    mutable std::vector<UniformEntry> uniforms; //!< Uniform locations sorted by name, reflected at link time
+    mutable std::vector<SamplerSlot>  samplers; //!< Sampler uniforms in reflection order
+
+    mutable int   lastTransformLocation{-1}; //!< Location of the last matrix set by `setTransformUniform`
+    mutable float lastTransformMatrix[16]{}; //!< Value of the last matrix set by `setTransformUniform`
 
     explicit Impl(GraphicsContext& theGraphicsContext, unsigned int theShaderProgram) :
     graphicsContext(&theGraphicsContext),
@@ -230,10 +274,136 @@ struct Shader::Impl
     Impl(Impl&& rhs) noexcept :
     graphicsContext(rhs.graphicsContext),
     shaderProgram(base::exchange(rhs.shaderProgram, 0u)),
-    currentTexture(base::exchange(rhs.currentTexture, -1)),
-    textures(SFML_BASE_MOVE(rhs.textures)),
-    uniforms(SFML_BASE_MOVE(rhs.uniforms))
+    uniforms(SFML_BASE_MOVE(rhs.uniforms)),
+    samplers(SFML_BASE_MOVE(rhs.samplers)),
+    lastTransformLocation(base::exchange(rhs.lastTransformLocation, -1))
     {
+        std::memcpy(lastTransformMatrix, rhs.lastTransformMatrix, sizeof(lastTransformMatrix));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the index of the first uniform not ordered before a name
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::size_t findUniform(std::string_view name) const
+    {
+        std::size_t first = 0u;
+        std::size_t count = uniforms.size();
+
+        while (count > 0u)
+        {
+            const std::size_t step = count / 2u;
+
+            if (std::string_view{uniforms[first + step].name} < name)
+            {
+                first += step + 1u;
+                count -= step + 1u;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a uniform location to the table, unless already present
+    ///
+    ////////////////////////////////////////////////////////////
+    void addUniform(std::string_view name, int location) const
+    {
+        const std::size_t index = findUniform(name);
+
+        if (index == uniforms.size() || uniforms[index].name != name)
+            uniforms.insert(uniforms.begin() + static_cast<std::ptrdiff_t>(index), UniformEntry{std::string{name}, location});
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sampler slot of a uniform location
+    ///
+    /// \return Pointer to the slot, `nullptr` if the location is not a sampler
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SamplerSlot* findSampler(int location) const
+    {
+        // Programs have few samplers, a linear search beats anything fancier
+        for (SamplerSlot& slot : samplers)
+            if (slot.location == location)
+                return &slot;
+
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Query the active uniforms of the program and assign texture units
+    ///
+    ////////////////////////////////////////////////////////////
+    void reflect()
+    {
+        GLint uniformCount  = 0;
+        GLint maxNameLength = 0;
+        glCheck(glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORMS, &uniformCount));
+        glCheck(glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength));
+
+        if (uniformCount <= 0 || maxNameLength <= 0)
+            return;
+
+        const std::size_t maxUnits = getMaxTextureUnits();
+
+        // Unit 0 is reserved for the texture of the object being drawn
+        int nextUnit = 1;
+
+        std::string nameBuffer(static_cast<std::size_t>(maxNameLength), '\0');
+        std::string elementName;
+
+        for (GLint i = 0; i < uniformCount; ++i)
+        {
+            GLsizei nameLength = 0;
+            GLint   arraySize  = 0;
+            GLenum  type       = 0;
+            glCheck(glGetActiveUniform(shaderProgram,
+                                       static_cast<GLuint>(i),
+                                       maxNameLength,
+                                       &nameLength,
+                                       &arraySize,
+                                       &type,
+                                       nameBuffer.data()));
+
+            const std::string_view name{nameBuffer.data(), static_cast<std::size_t>(nameLength)};
+
+            // Members of uniform blocks are active but have no location
+            const int location = glCheckExpr(glGetUniformLocation(shaderProgram, nameBuffer.data()));
+            addUniform(name, location);
+
+            // Arrays are reported by their first element, make them reachable by their bare name as well
+            const std::string_view baseName = name.ends_with("[0]") ? name.substr(0u, name.size() - 3u) : name;
+            if (baseName.size() != name.size())
+                addUniform(baseName, location);
+
+            if (location == -1 || !ShaderImpl::isSamplerType(type))
+                continue;
+
+            for (GLint element = 0; element < arraySize; ++element)
+            {
+                int elementLocation = location;
+
+                if (element > 0)
+                {
+                    elementName.assign(baseName);
+                    elementName += '[';
+                    elementName += std::to_string(element);
+                    elementName += ']';
+
+                    elementLocation = glCheckExpr(glGetUniformLocation(shaderProgram, elementName.c_str()));
+                    addUniform(elementName, elementLocation);
+                }
+
+                const bool unitLeft = static_cast<std::size_t>(nextUnit) < maxUnits;
+                samplers.push_back(SamplerSlot{elementLocation, unitLeft ? nextUnit++ : 0});
+            }
+        }
     }
 };
 
@@ -253,20 +423,16 @@ public:
     /// \brief Constructor: set up state before uniform is set
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline]] explicit UniformBinder(unsigned int shaderProgram) :
-    m_currentProgram(static_cast<GLEXT_GLhandle>(castToGlHandle(shaderProgram)))
+    [[nodiscard, gnu::always_inline]] explicit UniformBinder(GraphicsContext& graphicsContext,
+                                                             unsigned int     shaderProgram) :
+    m_stateCache(graphicsContext.getActiveGLStateCache()),
+    m_currentProgram(shaderProgram),
+    m_savedProgram(m_stateCache.getProgram())
     {
         SFML_BASE_ASSERT(m_currentProgram != 0);
 
-// Enable program object
-#ifndef SFML_OPENGL_ES
-        glCheck(m_savedProgram = GLEXT_glGetHandle(GLEXT_GL_PROGRAM_OBJECT));
-#else
-        glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, reinterpret_cast<GLint*>(&m_savedProgram)));
-#endif
-
-        if (m_currentProgram != m_savedProgram)
-            glCheck(GLEXT_glUseProgramObject(m_currentProgram));
+        // Enable program object
+        m_stateCache.useProgram(m_currentProgram);
     }
 
     ////////////////////////////////////////////////////////////
@@ -275,9 +441,8 @@ public:
     ////////////////////////////////////////////////////////////
     [[gnu::always_inline]] ~UniformBinder()
     {
-        // Disable program object
-        if (m_currentProgram && (m_currentProgram != m_savedProgram))
-            glCheck(GLEXT_glUseProgramObject(m_savedProgram));
+        // Restore the previous program object, skipped by the state cache if it was already this one
+        m_stateCache.useProgram(m_savedProgram);
     }
 
     ////////////////////////////////////////////////////////////
@@ -293,8 +458,9 @@ public:
     UniformBinder& operator=(const UniformBinder&) = delete;
 
 private:
-    GLEXT_GLhandle m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
-    GLEXT_GLhandle m_savedProgram{}; //!< Handle to the previously active program object
+    priv::GLStateCache& m_stateCache;     //!< State cache of the active context
+    unsigned int        m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
+    unsigned int        m_savedProgram;   //!< Handle to the previously active program object
 };
 
 
@@ -307,6 +473,7 @@ Shader::~Shader()
     if (m_impl->shaderProgram)
     {
         SFML_BASE_ASSERT(glCheckExpr(glIsProgram(castToGlHandle(m_impl->shaderProgram))));
+        m_impl->graphicsContext->getActiveGLStateCache().releaseProgram(m_impl->shaderProgram);
         glCheck(GLEXT_glDeleteProgram(castToGlHandle(m_impl->shaderProgram)));
     }
 }
@@ -330,14 +497,17 @@ Shader& Shader::operator=(Shader&& right) noexcept
         // Destroy effect program
         SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
         SFML_BASE_ASSERT(m_impl->shaderProgram);
+        m_impl->graphicsContext->getActiveGLStateCache().releaseProgram(m_impl->shaderProgram);
         glCheck(GLEXT_glDeleteProgram(castToGlHandle(m_impl->shaderProgram)));
     }
 
     // Move the contents of right.
-    m_impl->shaderProgram  = base::exchange(right.m_impl->shaderProgram, 0u);
-    m_impl->currentTexture = base::exchange(right.m_impl->currentTexture, -1);
-    m_impl->textures       = SFML_BASE_MOVE(right.m_impl->textures);
-    m_impl->uniforms       = SFML_BASE_MOVE(right.m_impl->uniforms);
+    m_impl->shaderProgram = base::exchange(right.m_impl->shaderProgram, 0u);
+    m_impl->uniforms      = SFML_BASE_MOVE(right.m_impl->uniforms);
+    m_impl->samplers      = SFML_BASE_MOVE(right.m_impl->samplers);
+
+    m_impl->lastTransformLocation = base::exchange(right.m_impl->lastTransformLocation, -1);
+    std::memcpy(m_impl->lastTransformMatrix, right.m_impl->lastTransformMatrix, sizeof(m_impl->lastTransformMatrix));
 
     return *this;
 }
@@ -583,11 +753,13 @@ base::Optional<Shader> Shader::loadFromStream(GraphicsContext& graphicsContext,
 ////////////////////////////////////////////////////////////
 base::Optional<Shader::UniformLocation> Shader::getUniformLocation(std::string_view uniformName) const
 {
-    // Check the cache
-    if (const auto it = m_impl->uniforms.find(uniformName); it != m_impl->uniforms.end())
+    // Check the table, filled with all the active uniforms at link time
+    const std::size_t index = m_impl->findUniform(uniformName);
+
+    if (index < m_impl->uniforms.size() && m_impl->uniforms[index].name == uniformName)
     {
-        // Already in cache, return it
-        return it->second == -1 ? base::nullOpt : base::makeOptional(UniformLocation{it->second});
+        const int location = m_impl->uniforms[index].location;
+        return location == -1 ? base::nullOpt : base::makeOptional(UniformLocation{location});
     }
 
     // Use thread-local string buffer to get a null-terminated uniform name
@@ -595,18 +767,46 @@ base::Optional<Shader::UniformLocation> Shader::getUniformLocation(std::string_v
     uniformNameBuffer.clear();
     uniformNameBuffer.assign(uniformName);
 
-    // Not in cache, request the location from OpenGL
+    // Not reflected (e.g. array elements or unknown names), request the location from OpenGL and remember it
     const int location = GLEXT_glGetUniformLocation(castToGlHandle(m_impl->shaderProgram), uniformNameBuffer.c_str());
-    m_impl->uniforms.emplace(uniformName, location);
+    m_impl->uniforms.insert(m_impl->uniforms.begin() + static_cast<std::ptrdiff_t>(index),
+                            Impl::UniformEntry{std::string{uniformName}, location});
 
     return location == -1 ? base::nullOpt : base::makeOptional(UniformLocation{location});
 }
 
 
+////////////////////////////////////////////////////////////
+base::Optional<unsigned int> Shader::getUniformBlockIndex(std::string_view blockName) const
+{
+    SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Use thread-local string buffer to get a null-terminated block name
+    thread_local std::string blockNameBuffer;
+    blockNameBuffer.clear();
+    blockNameBuffer.assign(blockName);
+
+    const GLuint index = glCheckExpr(glGetUniformBlockIndex(m_impl->shaderProgram, blockNameBuffer.c_str()));
+    return index == GL_INVALID_INDEX ? base::nullOpt : base::makeOptional(static_cast<unsigned int>(index));
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlockBinding(std::string_view blockName, unsigned int bindingPoint) const
+{
+    const base::Optional<unsigned int> index = getUniformBlockIndex(blockName);
+    if (!index.hasValue())
+        return false;
+
+    glCheck(glUniformBlockBinding(m_impl->shaderProgram, *index, bindingPoint));
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, float x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1f(location.m_value, x));
 }
 
@@ -614,7 +814,7 @@ void Shader::setUniform(UniformLocation location, float x) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2f(location.m_value, v.x, v.y));
 }
 
@@ -622,7 +822,7 @@ void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3f(location.m_value, v.x, v.y, v.z));
 }
 
@@ -630,7 +830,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4f(location.m_value, v.x, v.y, v.z, v.w));
 }
 
@@ -638,7 +838,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, int x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1i(location.m_value, x));
 }
 
@@ -646,7 +846,7 @@ void Shader::setUniform(UniformLocation location, int x) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2i(location.m_value, v.x, v.y));
 }
 
@@ -654,7 +854,7 @@ void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3i(location.m_value, v.x, v.y, v.z));
 }
 
@@ -662,7 +862,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4i(location.m_value, v.x, v.y, v.z, v.w));
 }
 
@@ -698,7 +898,7 @@ void Shader::setUniform(UniformLocation location, const Glsl::Bvec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix3fv(location.m_value, 1, GL_FALSE, matrix.array));
 }
 
@@ -706,7 +906,24 @@ void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) cons
 ////////////////////////////////////////////////////////////
 void Shader::setMat4Uniform(UniformLocation location, const float* matrixPtr) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    if (location.m_value == m_impl->lastTransformLocation)
+        m_impl->lastTransformLocation = -1;
+
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
+    glCheck(GLEXT_glUniformMatrix4fv(location.m_value, 1, GL_FALSE, matrixPtr));
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::setTransformUniform(UniformLocation location, const float* matrixPtr) const
+{
+    if (location.m_value == m_impl->lastTransformLocation &&
+        std::memcmp(matrixPtr, m_impl->lastTransformMatrix, sizeof(m_impl->lastTransformMatrix)) == 0)
+        return;
+
+    m_impl->lastTransformLocation = location.m_value;
+    std::memcpy(m_impl->lastTransformMatrix, matrixPtr, sizeof(m_impl->lastTransformMatrix));
+
     glCheck(GLEXT_glUniformMatrix4fv(location.m_value, 1, GL_FALSE, matrixPtr));
 }
 
@@ -724,16 +941,18 @@ bool Shader::setUniform(UniformLocation location, const Texture& texture) const
     SFML_BASE_ASSERT(m_impl->shaderProgram);
     SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
-    // Store the location -> texture mapping
-    if (const auto it = m_impl->textures.find(location.m_value); it != m_impl->textures.end())
+    Impl::SamplerSlot* const slot = m_impl->findSampler(location.m_value);
+
+    if (slot == nullptr)
     {
-        // Location already used, just replace the texture
-        it->second = &texture;
-        return true;
+        priv::err() << "Impossible to use texture \"" << location.m_value << '"'
+                    << " for shader: the uniform is not a sampler";
+
+        return false;
     }
 
-    // New entry, make sure there are enough texture units
-    if (m_impl->textures.size() + 1 >= getMaxTextureUnits())
+    // The unit was reserved at link time, make sure there was one left
+    if (slot->unit == 0)
     {
         priv::err() << "Impossible to use texture \"" << location.m_value << '"'
                     << " \"for shader: all available texture units are used";
@@ -741,7 +960,16 @@ bool Shader::setUniform(UniformLocation location, const Texture& texture) const
         return false;
     }
 
-    m_impl->textures[location.m_value] = &texture;
+    slot->texture = &texture;
+
+    // Point the sampler to its unit once, binding only changes the texture of the unit afterwards
+    if (slot->value != slot->unit)
+    {
+        const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
+        glCheck(GLEXT_glUniform1i(slot->location, slot->unit));
+        slot->value = slot->unit;
+    }
+
     return true;
 }
 
@@ -752,15 +980,32 @@ void Shader::setUniform(UniformLocation location, CurrentTextureType)
     SFML_BASE_ASSERT(m_impl->shaderProgram);
     SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
-    // Find the location of the variable in the shader
-    m_impl->currentTexture = location.m_value;
+    Impl::SamplerSlot* const slot = m_impl->findSampler(location.m_value);
+
+    if (slot == nullptr)
+    {
+        priv::err() << "Impossible to use current texture \"" << location.m_value << '"'
+                    << " for shader: the uniform is not a sampler";
+
+        return;
+    }
+
+    // The texture of the object being drawn is always bound to unit 0
+    slot->texture = nullptr;
+
+    if (slot->value != 0)
+    {
+        const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
+        glCheck(GLEXT_glUniform1i(slot->location, 0));
+        slot->value = 0;
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(UniformLocation location, const float* scalarArray, std::size_t length)
 {
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform1fv(location.m_value, static_cast<GLsizei>(length), scalarArray));
 }
 
@@ -769,7 +1014,7 @@ void Shader::setUniformArray(UniformLocation location, const float* scalarArray,
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform2fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -778,7 +1023,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform3fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -787,7 +1032,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec4* vectorArray, std::size_t length)
 {
     std::vector<float>  contiguous = flatten(vectorArray, length);
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniform4fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
 }
 
@@ -801,7 +1046,7 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat3* matrixA
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix3fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
 }
 
@@ -815,7 +1060,10 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat4* matrixA
     for (std::size_t i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
+    // The array may overlap the matrix cached by `setTransformUniform`
+    m_impl->lastTransformLocation = -1;
+
+    const UniformBinder binder{*m_impl->graphicsContext, m_impl->shaderProgram};
     glCheck(GLEXT_glUniformMatrix4fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
 }
 
@@ -832,32 +1080,30 @@ void Shader::bind() const
 {
     SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
+    priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+
     if (m_impl->shaderProgram == 0)
     {
         // Bind no shader
-        glCheck(GLEXT_glUseProgramObject({}));
+        stateCache.useProgram(0u);
         return;
     }
 
     // Enable the program
     SFML_BASE_ASSERT(glCheckExpr(glIsProgram(castToGlHandle(m_impl->shaderProgram))));
-    glCheck(GLEXT_glUseProgramObject(castToGlHandle(m_impl->shaderProgram)));
+    stateCache.useProgram(m_impl->shaderProgram);
 
     // Bind the textures
     bindTextures();
-
-    // Bind the current texture
-    if (m_impl->currentTexture != -1)
-        glCheck(GLEXT_glUniform1i(m_impl->currentTexture, 0));
 }
 
 
-void Shader::unbind([[maybe_unused]] GraphicsContext& graphicsContext)
+void Shader::unbind(GraphicsContext& graphicsContext)
 {
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
 
     // Bind no shader
-    glCheck(GLEXT_glUseProgramObject({}));
+    graphicsContext.getActiveGLStateCache().useProgram(0u);
 }
 
 
@@ -878,6 +1124,22 @@ bool Shader::isGeometryAvailable([[maybe_unused]] GraphicsContext& graphicsConte
 Shader::Shader(base::PassKey<Shader>&&, GraphicsContext& graphicsContext, unsigned int shaderProgram) :
 m_impl(graphicsContext, shaderProgram)
 {
+    m_impl->reflect();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shader::substituteMissingStages([[maybe_unused]] GraphicsContext&  graphicsContext,
+                                     [[maybe_unused]] std::string_view& vertexShaderCode,
+                                     [[maybe_unused]] std::string_view& fragmentShaderCode)
+{
+#ifdef SFML_OPENGL_ES
+    if (vertexShaderCode.data() == nullptr)
+        vertexShaderCode = graphicsContext.getBuiltInShaderVertexSrc();
+
+    if (fragmentShaderCode.data() == nullptr)
+        fragmentShaderCode = graphicsContext.getBuiltInShaderFragmentSrc();
+#endif
 }
 
 
@@ -898,16 +1160,23 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return base::nullOpt;
     }
 
+    substituteMissingStages(graphicsContext, vertexShaderCode, fragmentShaderCode);
+
+    // Restore the program from its binary if it was cached by a previous run
+    ShaderCache* const  shaderCache = graphicsContext.getShaderCache();
+    const std::uint64_t cacheKey    = shaderCache != nullptr
+                                          ? shaderCache->computeKey(vertexShaderCode, geometryShaderCode, fragmentShaderCode)
+                                          : 0u;
+
+    if (shaderCache != nullptr)
+        if (const unsigned int cachedProgram = shaderCache->loadProgram(cacheKey); cachedProgram != 0u)
+            return finalizeLinkedProgram(graphicsContext, cachedProgram);
+
     // Create the program
     GLEXT_GLhandle shaderProgram{};
     glCheck(shaderProgram = glCreateProgram());
     SFML_BASE_ASSERT(glCheckExpr(glIsProgram(shaderProgram)));
 
-#ifdef SFML_OPENGL_ES
-    if (vertexShaderCode.data() == nullptr)
-        vertexShaderCode = graphicsContext.getBuiltInShaderVertexSrc();
-#endif
-
     // Create the vertex shader if needed
     if (vertexShaderCode.data())
     {
@@ -967,11 +1236,6 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         glCheck(GLEXT_glDeleteShader(geometryShader));
     }
 
-#ifdef SFML_OPENGL_ES
-    if (fragmentShaderCode.data() == nullptr)
-        fragmentShaderCode = graphicsContext.getBuiltInShaderFragmentSrc();
-#endif
-
     // Create the fragment shader if needed
     if (fragmentShaderCode.data())
     {
@@ -1002,6 +1266,10 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         glCheck(GLEXT_glDeleteShader(fragmentShader));
     }
 
+    // Ask the driver to keep the binary around for the cache
+    if (shaderCache != nullptr)
+        glCheck(glProgramParameteri(castFromGlHandle(shaderProgram), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     // Link the program
     glCheck(GLEXT_glLinkProgram(shaderProgram));
 
@@ -1017,29 +1285,42 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return base::nullOpt;
     }
 
+    if (shaderCache != nullptr)
+        shaderCache->storeProgram(cacheKey, castFromGlHandle(shaderProgram));
+
+    return finalizeLinkedProgram(graphicsContext, castFromGlHandle(shaderProgram));
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Shader> Shader::finalizeLinkedProgram(GraphicsContext& graphicsContext, unsigned int shaderProgram)
+{
+    // Associate the built-in view block to the binding point used by render targets
+    if (const GLuint viewBlockIndex = glCheckExpr(glGetUniformBlockIndex(shaderProgram, "sf_u_ViewBlock"));
+        viewBlockIndex != GL_INVALID_INDEX)
+        glCheck(glUniformBlockBinding(shaderProgram, viewBlockIndex, ViewBlockBindingPoint));
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
 
-    return base::makeOptional<Shader>(base::PassKey<Shader>{}, graphicsContext, castFromGlHandle(shaderProgram));
+    return base::makeOptional<Shader>(base::PassKey<Shader>{}, graphicsContext, shaderProgram);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::bindTextures() const
 {
-    auto it = m_impl->textures.begin();
-    for (std::size_t i = 0; i < m_impl->textures.size(); ++i)
-    {
-        const auto index = static_cast<GLsizei>(i + 1);
-        glCheck(GLEXT_glUniform1i(it->first, index));
-        glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0 + static_cast<GLenum>(index)));
-        it->second->bind(*m_impl->graphicsContext);
-        ++it;
-    }
+    priv::GLStateCache& stateCache = m_impl->graphicsContext->getActiveGLStateCache();
+
+    // Texture units are context state shared by all the shaders, the state cache skips the ones already holding
+    // the texture and only switches the active unit for the ones that must be rebound
+    for (const Impl::SamplerSlot& slot : m_impl->samplers)
+        if (slot.texture != nullptr)
+            stateCache.bindTextureToUnit(static_cast<unsigned int>(slot.unit), slot.texture->getNativeHandle());
 
     // Make sure that the texture unit which is left active is the number 0
-    glCheck(GLEXT_glActiveTexture(GLEXT_GL_TEXTURE0));
+    stateCache.activeTexture(GL_TEXTURE0);
 }
 
 } // namespace sf
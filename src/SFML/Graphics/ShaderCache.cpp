@@ -0,0 +1,336 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/ShaderCache.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Path.hpp"
+#include "SFML/System/PathUtils.hpp"
+
+#include "SFML/Base/Assert.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderCacheImpl
+{
+////////////////////////////////////////////////////////////
+constexpr std::uint32_t fileMagic{0x42504653u}; // "SFPB"
+constexpr std::uint32_t fileVersion{1u};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Header of a cached program binary file
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] FileHeader
+{
+    std::uint32_t magic;        //!< Always `fileMagic`
+    std::uint32_t version;      //!< Always `fileVersion`
+    std::uint64_t key;          //!< Key of the program, guards against file name collisions
+    std::uint32_t binaryFormat; //!< Driver-specific format of the binary
+    std::uint32_t byteCount;    //!< Size of the binary following the header
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief 64-bit FNV-1a hash, accumulated over several pieces of data
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] Fnv1a
+{
+    ////////////////////////////////////////////////////////////
+    void add(std::string_view data)
+    {
+        // Hash the length first, so that moving bytes between pieces changes the hash
+        const std::size_t size = data.size();
+        addBytes(&size, sizeof(size));
+        addBytes(data.data(), data.size());
+    }
+
+    ////////////////////////////////////////////////////////////
+    void addBytes(const void* data, std::size_t byteCount)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+
+        for (std::size_t i = 0u; i < byteCount; ++i)
+            value = (value ^ bytes[i]) * 0x100000001B3ull;
+    }
+
+    std::uint64_t value{0xCBF29CE484222325ull};
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string_view getGlString(GLenum name)
+{
+    const auto* string = reinterpret_cast<const char*>(glCheckExpr(glGetString(name)));
+    return string != nullptr ? std::string_view{string} : std::string_view{};
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Suffix of a temporary file name, unique across threads and processes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string makeTemporarySuffix()
+{
+    // Random per process, as there is no portable way to get the process ID
+    static const std::uint32_t        processTag = std::random_device{}();
+    static std::atomic<std::uint32_t> counter{0u};
+
+    return "." + std::to_string(processTag) + "." +
+           std::to_string(counter.fetch_add(1u, std::memory_order_relaxed)) + ".tmp";
+}
+
+} // namespace ShaderCacheImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::Optional<ShaderCache> ShaderCache::create(GraphicsContext& graphicsContext, const Path& directory)
+{
+    if (!isAvailable(graphicsContext))
+    {
+        priv::err() << "Failed to create shader cache: program binaries are not supported";
+        return base::nullOpt;
+    }
+
+    if (!directory.exists())
+    {
+        priv::err() << "Failed to create shader cache: directory does not exist\n" << priv::PathDebugFormatter{directory};
+        return base::nullOpt;
+    }
+
+    // Binaries are only valid for the driver that produced them
+    ShaderCacheImpl::Fnv1a driverHash;
+    driverHash.add(ShaderCacheImpl::getGlString(GL_VENDOR));
+    driverHash.add(ShaderCacheImpl::getGlString(GL_RENDERER));
+    driverHash.add(ShaderCacheImpl::getGlString(GL_VERSION));
+
+    return base::makeOptional<ShaderCache>(base::PassKey<ShaderCache>{}, directory, driverHash.value);
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderCache::isAvailable([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    static const bool available = [&]
+    {
+        SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+        if (!GLAD_GL_VERSION_4_1 && !GLAD_GL_ARB_get_program_binary && !GLAD_GL_ES_VERSION_3_0)
+            return false;
+
+        // Some drivers expose the entry points without supporting any binary format
+        return priv::getGLInteger(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCache::ShaderCache(base::PassKey<ShaderCache>&&, const Path& directory, std::uint64_t driverHash) :
+m_directory(directory),
+m_driverHash(driverHash)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+const Path& ShaderCache::getDirectory() const
+{
+    return m_directory;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderCache::getHitCount() const
+{
+    return m_hitCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderCache::getMissCount() const
+{
+    return m_missCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderCache::getRejectedCount() const
+{
+    return m_rejectedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCache::resetCounters()
+{
+    m_hitCount      = 0u;
+    m_missCount     = 0u;
+    m_rejectedCount = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint64_t ShaderCache::computeKey(std::string_view vertexShaderCode,
+                                      std::string_view geometryShaderCode,
+                                      std::string_view fragmentShaderCode) const
+{
+    ShaderCacheImpl::Fnv1a hash;
+    hash.addBytes(&m_driverHash, sizeof(m_driverHash));
+
+    // Distinguish missing stages from empty ones
+    for (const std::string_view code : {vertexShaderCode, geometryShaderCode, fragmentShaderCode})
+    {
+        const bool present = code.data() != nullptr;
+        hash.addBytes(&present, sizeof(present));
+        hash.add(code);
+    }
+
+    return hash.value;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int ShaderCache::loadProgram(std::uint64_t key)
+{
+    std::ifstream file(getProgramPath(key).to<std::string>(), std::ios_base::binary);
+
+    ShaderCacheImpl::FileHeader header{};
+
+    if (!file || !file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != ShaderCacheImpl::fileMagic || header.version != ShaderCacheImpl::fileVersion ||
+        header.key != key || header.byteCount == 0u)
+    {
+        ++m_missCount;
+        return 0u;
+    }
+
+    std::vector<char> binary(header.byteCount);
+
+    if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size())))
+    {
+        ++m_missCount;
+        return 0u;
+    }
+
+    const GLuint program = glCheckExpr(glCreateProgram());
+
+    // Errors raised by earlier calls would otherwise be mistaken for a rejection of the binary
+    for (GLenum error = glGetError(); error != GL_NO_ERROR; error = glGetError())
+        priv::err() << "OpenGL error " << error << " pending before loading a cached program binary";
+
+    // A binary in a format the driver no longer accepts, e.g. after a driver update, raises an error
+    // instead of only failing to link: the error is checked in all builds and treated as a rejection
+    glProgramBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+    const bool rejected = glGetError() != GL_NO_ERROR;
+
+    // Loading a binary counts as linking, a rejected binary leaves the program unlinked
+    GLint success = GL_FALSE;
+    if (!rejected)
+        glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+
+    if (success == GL_FALSE)
+    {
+        glCheck(glDeleteProgram(program));
+
+        ++m_rejectedCount;
+        ++m_missCount;
+        return 0u;
+    }
+
+    ++m_hitCount;
+    return program;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCache::storeProgram(std::uint64_t key, unsigned int program) const
+{
+    GLint byteCount = 0;
+    glCheck(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &byteCount));
+
+    if (byteCount <= 0)
+        return;
+
+    std::vector<char> binary(static_cast<std::size_t>(byteCount));
+
+    GLsizei writtenByteCount = 0;
+    GLenum  binaryFormat     = 0;
+    glCheck(glGetProgramBinary(program, byteCount, &writtenByteCount, &binaryFormat, binary.data()));
+
+    if (writtenByteCount <= 0)
+        return;
+
+    const ShaderCacheImpl::FileHeader header{ShaderCacheImpl::fileMagic,
+                                             ShaderCacheImpl::fileVersion,
+                                             key,
+                                             binaryFormat,
+                                             static_cast<std::uint32_t>(writtenByteCount)};
+
+    // Write to a temporary file first, so that other processes never read a partial binary,
+    // named uniquely so that processes and threads storing the same program don't share it
+    const std::string path          = getProgramPath(key).to<std::string>();
+    const std::string temporaryPath = path + ShaderCacheImpl::makeTemporarySuffix();
+
+    bool written = false;
+
+    {
+        std::ofstream file(temporaryPath, std::ios_base::binary | std::ios_base::trunc);
+
+        written = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+                  file.write(binary.data(), writtenByteCount);
+    }
+
+    if (!written)
+    {
+        priv::err() << "Failed to write shader cache file\n" << priv::PathDebugFormatter{Path{temporaryPath}};
+        std::remove(temporaryPath.c_str());
+        return;
+    }
+
+    // `std::rename` does not replace existing files on every platform
+    std::remove(path.c_str());
+
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        priv::err() << "Failed to write shader cache file\n" << priv::PathDebugFormatter{Path{path}};
+        std::remove(temporaryPath.c_str());
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Path ShaderCache::getProgramPath(std::uint64_t key) const
+{
+    char fileName[32];
+    std::snprintf(fileName, sizeof(fileName), "%016llx.sfpb", static_cast<unsigned long long>(key));
+
+    return m_directory / Path{fileName};
+}
+
+} // namespace sf
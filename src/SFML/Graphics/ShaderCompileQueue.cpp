@@ -0,0 +1,358 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shader.hpp"
+#include "SFML/Graphics/ShaderCache.hpp"
+#include "SFML/Graphics/ShaderCompileQueue.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <string>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderCompileQueueImpl
+{
+////////////////////////////////////////////////////////////
+// From `KHR_parallel_shader_compile`, not part of the bundled OpenGL headers
+constexpr GLenum glCompletionStatus{0x91B1u};
+
+
+////////////////////////////////////////////////////////////
+constexpr GLenum stageTypes[]{GL_VERTEX_SHADER, GL_GEOMETRY_SHADER, GL_FRAGMENT_SHADER};
+
+
+////////////////////////////////////////////////////////////
+void logProgramErrors(GLuint program)
+{
+    // The stages are only queried once linking is known to have failed, so that compilation is never waited on
+    GLuint  shaders[3]{};
+    GLsizei shaderCount = 0;
+    glCheck(glGetAttachedShaders(program, 3, &shaderCount, shaders));
+
+    char log[1024];
+
+    for (GLsizei i = 0; i < shaderCount; ++i)
+    {
+        GLint success = GL_TRUE;
+        glCheck(glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &success));
+
+        if (success == GL_TRUE)
+            continue;
+
+        glCheck(glGetShaderInfoLog(shaders[i], sizeof(log), nullptr, log));
+        sf::priv::err() << "Failed to compile shader:" << '\n' << static_cast<const char*>(log);
+    }
+
+    glCheck(glGetProgramInfoLog(program, sizeof(log), nullptr, log));
+    sf::priv::err() << "Failed to link shader:" << '\n' << static_cast<const char*>(log);
+}
+
+} // namespace ShaderCompileQueueImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct ShaderCompileQueue::Entry
+{
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::string_view getSource(std::size_t stage) const
+    {
+        // A missing stage is a null view, unlike an empty source
+        return hasStage[stage] ? std::string_view{sources[stage]} : std::string_view{};
+    }
+
+    std::string            sources[3];              //!< Vertex, geometry and fragment sources, released when done
+    bool                   hasStage[3]{};           //!< Is there a vertex, geometry and fragment stage?
+    unsigned int           program{};               //!< Program submitted to the driver, 0 if not submitted
+    Status                 status{Status::Pending}; //!< State of the program
+    base::Optional<Shader> shader;                  //!< Linked shader, once ready
+};
+
+
+////////////////////////////////////////////////////////////
+ShaderCompileQueue::ShaderCompileQueue(GraphicsContext& graphicsContext, std::size_t maxCompilesPerUpdate) :
+m_graphicsContext(&graphicsContext),
+m_maxCompilesPerUpdate(maxCompilesPerUpdate),
+m_parallelCompile(isParallelCompileAvailable(graphicsContext))
+{
+    SFML_BASE_ASSERT(m_maxCompilesPerUpdate > 0u && "ShaderCompileQueue would never compile anything");
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCompileQueue::~ShaderCompileQueue()
+{
+    for (const Entry& entry : m_entries)
+    {
+        if (entry.program == 0u)
+            continue;
+
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteProgram(entry.program));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCompileQueue::Id ShaderCompileQueue::push(std::string_view vertexShaderCode, std::string_view fragmentShaderCode)
+{
+    return push(vertexShaderCode, {}, fragmentShaderCode);
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCompileQueue::Id ShaderCompileQueue::push(std::string_view vertexShaderCode,
+                                                std::string_view geometryShaderCode,
+                                                std::string_view fragmentShaderCode)
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const Id id    = m_entries.size();
+    Entry&   entry = m_entries.emplace_back();
+
+    if (geometryShaderCode.data() != nullptr && !Shader::isGeometryAvailable(*m_graphicsContext))
+    {
+        priv::err() << "Failed to create a shader: your system doesn't support geometry shaders "
+                    << "(you should test Shader::isGeometryAvailable() before trying to use geometry shaders)";
+
+        entry.status = Status::Failed;
+        return id;
+    }
+
+    // Same sources and key as `Shader::loadFromMemory`, so that both share the cached binaries
+    Shader::substituteMissingStages(*m_graphicsContext, vertexShaderCode, fragmentShaderCode);
+
+    if (ShaderCache* const shaderCache = m_graphicsContext->getShaderCache())
+    {
+        const std::uint64_t cacheKey = shaderCache->computeKey(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+
+        if (const unsigned int cachedProgram = shaderCache->loadProgram(cacheKey); cachedProgram != 0u)
+        {
+            entry.shader = Shader::finalizeLinkedProgram(*m_graphicsContext, cachedProgram);
+            entry.status = Status::Ready;
+            return id;
+        }
+    }
+
+    const std::string_view stageSources[3]{vertexShaderCode, geometryShaderCode, fragmentShaderCode};
+
+    for (std::size_t i = 0u; i < 3u; ++i)
+    {
+        entry.hasStage[i] = stageSources[i].data() != nullptr;
+        entry.sources[i].assign(stageSources[i]);
+    }
+
+    ++m_pendingCount;
+
+    // Let the driver work on all the programs at once
+    if (m_parallelCompile)
+        submit(entry);
+
+    return id;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCompileQueue::update()
+{
+    if (m_pendingCount == 0u)
+        return;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    if (m_parallelCompile)
+    {
+        // Only collect the programs the driver is done with, querying the link status of others would block
+        for (Entry& entry : m_entries)
+        {
+            if (entry.status != Status::Pending)
+                continue;
+
+            GLint completed = GL_FALSE;
+            glCheck(glGetProgramiv(entry.program, ShaderCompileQueueImpl::glCompletionStatus, &completed));
+
+            if (completed == GL_TRUE)
+                finish(entry);
+        }
+
+        return;
+    }
+
+    // Without background compilation, spread the blocking compilations over several updates
+    std::size_t compileCount = 0u;
+
+    for (Entry& entry : m_entries)
+    {
+        if (compileCount == m_maxCompilesPerUpdate || m_pendingCount == 0u)
+            break;
+
+        if (entry.status != Status::Pending)
+            continue;
+
+        submit(entry);
+        finish(entry);
+        ++compileCount;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCompileQueue::waitForCompletion()
+{
+    if (m_pendingCount == 0u)
+        return;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    for (Entry& entry : m_entries)
+    {
+        if (entry.status != Status::Pending)
+            continue;
+
+        if (entry.program == 0u)
+            submit(entry);
+
+        finish(entry);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+ShaderCompileQueue::Status ShaderCompileQueue::getStatus(Id id) const
+{
+    SFML_BASE_ASSERT(id < m_entries.size() && "ShaderCompileQueue invalid program id");
+    return m_entries[id].status;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader* ShaderCompileQueue::getShader(Id id) const
+{
+    SFML_BASE_ASSERT(id < m_entries.size() && "ShaderCompileQueue invalid program id");
+
+    const Entry& entry = m_entries[id];
+    return entry.shader.hasValue() ? &*entry.shader : nullptr;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader& ShaderCompileQueue::getShaderOr(Id id, const Shader& fallback) const
+{
+    const Shader* shader = getShader(id);
+    return shader != nullptr ? *shader : fallback;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShaderCompileQueue::getPendingCount() const
+{
+    return m_pendingCount;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShaderCompileQueue::isParallelCompileAvailable(GraphicsContext& graphicsContext)
+{
+    static const bool available = [&]
+    {
+        SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+        return graphicsContext.isExtensionAvailable("GL_KHR_parallel_shader_compile") ||
+               graphicsContext.isExtensionAvailable("GL_ARB_parallel_shader_compile");
+    }();
+
+    return available;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCompileQueue::submit(Entry& entry) const
+{
+    SFML_BASE_ASSERT(entry.program == 0u);
+
+    const GLuint program = glCheckExpr(glCreateProgram());
+
+    // Neither compilation nor linking is checked here, so that the driver can process them asynchronously
+    for (std::size_t i = 0u; i < 3u; ++i)
+    {
+        if (!entry.hasStage[i])
+            continue;
+
+        const GLuint shader           = glCheckExpr(glCreateShader(ShaderCompileQueueImpl::stageTypes[i]));
+        const char*  sourceCode       = entry.sources[i].data();
+        const auto   sourceCodeLength = static_cast<GLint>(entry.sources[i].size());
+
+        glCheck(glShaderSource(shader, 1, &sourceCode, &sourceCodeLength));
+        glCheck(glCompileShader(shader));
+
+        // The shader is only flagged for deletion while attached, its compile log remains available
+        glCheck(glAttachShader(program, shader));
+        glCheck(glDeleteShader(shader));
+    }
+
+    if (m_graphicsContext->getShaderCache() != nullptr)
+        glCheck(glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
+    glCheck(glLinkProgram(program));
+
+    entry.program = program;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShaderCompileQueue::finish(Entry& entry)
+{
+    SFML_BASE_ASSERT(entry.status == Status::Pending && entry.program != 0u);
+
+    const GLuint program = entry.program;
+    entry.program        = 0u;
+
+    GLint success = GL_FALSE;
+    glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+
+    if (success == GL_FALSE)
+    {
+        ShaderCompileQueueImpl::logProgramErrors(program);
+        glCheck(glDeleteProgram(program));
+
+        entry.status = Status::Failed;
+    }
+    else
+    {
+        if (ShaderCache* const shaderCache = m_graphicsContext->getShaderCache())
+        {
+            const std::uint64_t cacheKey = shaderCache->computeKey(entry.getSource(0u),
+                                                                   entry.getSource(1u),
+                                                                   entry.getSource(2u));
+            shaderCache->storeProgram(cacheKey, program);
+        }
+
+        entry.shader = Shader::finalizeLinkedProgram(*m_graphicsContext, program);
+        entry.status = Status::Ready;
+    }
+
+    for (std::string& source : entry.sources)
+        std::string().swap(source);
+
+    --m_pendingCount;
+}
+
+} // namespace sf
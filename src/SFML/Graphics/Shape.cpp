@@ -12,6 +12,8 @@
 
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/Assert.hpp"
+
 #include <vector>
 
 #include <cstddef>
@@ -157,15 +159,9 @@ void Shape::setOutlineThickness(float thickness)
 {
     m_impl->outlineThickness = thickness;
 
-    const std::size_t pointCount = m_impl->vertices.size() - 2;
-
-    std::vector<Vector2f> points;
-    points.reserve(pointCount);
-
-    for (std::size_t i = 0; i < pointCount; ++i)
-        points.push_back(m_impl->vertices[i + 1].position);
-
-    update(points.data(), pointCount); // recompute everything because the whole shape must be offset
+    // Recompute everything because the whole shape must be offset, the points are already in place
+    if (!m_impl->vertices.empty())
+        finishUpdate();
 }
 
 
@@ -192,20 +188,43 @@ FloatRect Shape::getGlobalBounds() const
 
 ////////////////////////////////////////////////////////////
 void Shape::update(const sf::Vector2f* points, const std::size_t pointCount)
+{
+    Vertex* const pointVertices = beginUpdate(pointCount);
+
+    if (pointVertices == nullptr)
+        return;
+
+    // Position
+    for (std::size_t i = 0; i < pointCount; ++i)
+        pointVertices[i].position = points[i];
+
+    finishUpdate();
+}
+
+
+////////////////////////////////////////////////////////////
+Vertex* Shape::beginUpdate(std::size_t pointCount)
 {
     // Get the total number of points of the shape
     if (pointCount < 3)
     {
-        m_impl->vertices.resize(0);
-        m_impl->outlineVertices.resize(0);
-        return;
+        m_impl->vertices.clear();
+        m_impl->outlineVertices.clear();
+        return nullptr;
     }
 
+    // Resizing to a smaller or equal point count never reallocates
     m_impl->vertices.resize(pointCount + 2); // + 2 for center and repeated first point
+    return m_impl->vertices.data() + 1;
+}
 
-    // Position
-    for (std::size_t i = 0; i < pointCount; ++i)
-        m_impl->vertices[i + 1].position = points[i];
+
+////////////////////////////////////////////////////////////
+void Shape::finishUpdate()
+{
+    SFML_BASE_ASSERT(m_impl->vertices.size() >= 5u && "Shape::finishUpdate called without a successful beginUpdate");
+
+    const std::size_t pointCount = m_impl->vertices.size() - 2;
 
     m_impl->vertices[pointCount + 1].position = m_impl->vertices[1].position;
 
@@ -246,6 +265,45 @@ void Shape::drawOnto(RenderTarget& renderTarget, const Texture* texture, RenderS
 }
 
 
+////////////////////////////////////////////////////////////
+std::size_t Shape::getGeometryPointCount() const
+{
+    // The fill fan holds the center, the points and the first point repeated
+    return m_impl->vertices.empty() ? 0u : m_impl->vertices.size() - 2;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Shape::hasOutlineGeometry() const
+{
+    return !m_impl->outlineVertices.empty();
+}
+
+
+////////////////////////////////////////////////////////////
+void Shape::writeIndexedVertices(Vertex* fillVertices, Vertex* outlineVertices) const
+{
+    const Transform&  transform  = getTransform();
+    const std::size_t pointCount = getGeometryPointCount();
+
+    // Indexed triangles reuse the first point instead of repeating it
+    for (std::size_t i = 0; i < pointCount + 1; ++i)
+    {
+        const Vertex& vertex = m_impl->vertices[i];
+        fillVertices[i]      = {transform * vertex.position, vertex.color, vertex.texCoords};
+    }
+
+    if (outlineVertices == nullptr || !hasOutlineGeometry())
+        return;
+
+    for (std::size_t i = 0; i < pointCount * 2; ++i)
+    {
+        const Vertex& vertex = m_impl->outlineVertices[i];
+        outlineVertices[i]   = {transform * vertex.position, vertex.color, vertex.texCoords};
+    }
+}
+
+
 ////////////////////////////////////////////////////////////
 void Shape::updateFillColors()
 {
@@ -0,0 +1,337 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/Shape.hpp"
+#include "SFML/Graphics/ShapeBatch.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShapeBatchImpl
+{
+////////////////////////////////////////////////////////////
+// Center and points of the fill, then inner and outer vertex of each point of the outline
+[[nodiscard]] std::size_t getVertexCount(std::size_t pointCount, bool hasOutline)
+{
+    if (pointCount == 0u)
+        return 0u;
+
+    return pointCount + 1u + (hasOutline ? pointCount * 2u : 0u);
+}
+
+
+////////////////////////////////////////////////////////////
+// Grow GPU buffers geometrically, so that adding shapes one by one does not reallocate every frame
+[[nodiscard]] std::size_t getGrownCapacity(std::size_t requiredCount)
+{
+    return requiredCount + requiredCount / 2u;
+}
+
+} // namespace ShapeBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+ShapeBatch::ShapeBatch(GraphicsContext& graphicsContext) :
+m_graphicsContext(&graphicsContext),
+m_vertexBuffer(graphicsContext, PrimitiveType::Triangles, VertexBuffer::Usage::Dynamic)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+ShapeBatch::Handle ShapeBatch::add(const Shape& shape)
+{
+    const Handle handle = m_slots.size();
+
+    m_slots.push_back({m_vertices.size(), 0u, false});
+    set(handle, shape);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::set(Handle handle, const Shape& shape)
+{
+    SFML_BASE_ASSERT(handle < m_slots.size() && "ShapeBatch invalid shape handle");
+
+    Slot&             slot       = m_slots[handle];
+    const std::size_t pointCount = shape.getGeometryPointCount();
+    const bool        hasOutline = pointCount > 0u && shape.hasOutlineGeometry();
+
+    const std::size_t oldVertexCount = ShapeBatchImpl::getVertexCount(slot.pointCount, slot.hasOutline);
+    const std::size_t newVertexCount = ShapeBatchImpl::getVertexCount(pointCount, hasOutline);
+
+    if (pointCount != slot.pointCount || hasOutline != slot.hasOutline)
+    {
+        // The topology changed: resize the range in place and shift the shapes after it
+        const auto offset = static_cast<std::ptrdiff_t>(slot.vertexOffset);
+
+        m_vertices.erase(m_vertices.begin() + offset, m_vertices.begin() + offset + static_cast<std::ptrdiff_t>(oldVertexCount));
+        m_vertices.insert(m_vertices.begin() + offset, newVertexCount, Vertex{});
+
+        for (Handle i = handle + 1u; i < m_slots.size(); ++i)
+            m_slots[i].vertexOffset = m_slots[i].vertexOffset - oldVertexCount + newVertexCount;
+
+        slot.pointCount = pointCount;
+        slot.hasOutline = hasOutline;
+
+        // All the vertices after the shape moved
+        markDirty(slot.vertexOffset, m_vertices.size());
+        m_indicesDirty = true;
+    }
+    else
+    {
+        markDirty(slot.vertexOffset, slot.vertexOffset + newVertexCount);
+    }
+
+    if (pointCount == 0u)
+        return;
+
+    Vertex* const fillVertices = m_vertices.data() + slot.vertexOffset;
+    shape.writeIndexedVertices(fillVertices, hasOutline ? fillVertices + pointCount + 1u : nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::clear()
+{
+    m_slots.clear();
+    m_vertices.clear();
+    m_indices.clear();
+
+    m_fillIndexCount = 0u;
+    m_indicesDirty   = false;
+    m_dirtyBegin     = 0u;
+    m_dirtyEnd       = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::getShapeCount() const
+{
+    return m_slots.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::getVertexCount() const
+{
+    return m_vertices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t ShapeBatch::getIndexCount() const
+{
+    if (m_indicesDirty)
+        rebuildIndices();
+
+    return m_indices.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::draw(RenderTarget& target, RenderStates states) const
+{
+    draw(target, nullptr, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::draw(RenderTarget& target, const Texture* texture, RenderStates states) const
+{
+    if (m_indicesDirty)
+        rebuildIndices();
+
+    if (m_indices.empty())
+        return;
+
+    const bool uploaded = upload();
+
+    // The fill texture coordinates are in pixels, like those of `sf::Shape`
+    states.coordinateType = CoordinateType::Pixels;
+    states.texture        = texture;
+
+    // Without a texture, fills and outlines are all drawn at once
+    if (texture == nullptr)
+    {
+        drawRange(target, uploaded, 0u, m_indices.size(), states);
+        return;
+    }
+
+    drawRange(target, uploaded, 0u, m_fillIndexCount, states);
+
+    states.texture = nullptr;
+    drawRange(target, uploaded, m_fillIndexCount, m_indices.size() - m_fillIndexCount, states);
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::markDirty(std::size_t begin, std::size_t end)
+{
+    if (begin >= end)
+        return;
+
+    if (m_dirtyBegin == m_dirtyEnd)
+    {
+        m_dirtyBegin = begin;
+        m_dirtyEnd   = end;
+        return;
+    }
+
+    // Merge with the pending range, uploading a few clean vertices is cheaper than several uploads
+    m_dirtyBegin = base::min(m_dirtyBegin, begin);
+    m_dirtyEnd   = base::max(m_dirtyEnd, end);
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::rebuildIndices() const
+{
+    std::size_t fillIndexCount    = 0u;
+    std::size_t outlineIndexCount = 0u;
+
+    for (const Slot& slot : m_slots)
+    {
+        fillIndexCount += slot.pointCount * 3u;
+
+        if (slot.hasOutline)
+            outlineIndexCount += slot.pointCount * 6u;
+    }
+
+    m_indices.resize(fillIndexCount + outlineIndexCount);
+    m_fillIndexCount = fillIndexCount;
+
+    IndexType* fillIndices    = m_indices.data();
+    IndexType* outlineIndices = m_indices.data() + fillIndexCount;
+
+    for (const Slot& slot : m_slots)
+    {
+        const std::size_t pointCount = slot.pointCount;
+
+        // Fill: a triangle between the center and each side
+        const auto center = static_cast<IndexType>(slot.vertexOffset);
+
+        for (std::size_t i = 0u; i < pointCount; ++i)
+        {
+            *fillIndices++ = center;
+            *fillIndices++ = center + 1u + static_cast<IndexType>(i);
+            *fillIndices++ = center + 1u + static_cast<IndexType>((i + 1u) % pointCount);
+        }
+
+        if (!slot.hasOutline)
+            continue;
+
+        // Outline: a quad between the inner and outer vertices of consecutive points
+        const auto outline = static_cast<IndexType>(slot.vertexOffset + pointCount + 1u);
+
+        for (std::size_t i = 0u; i < pointCount; ++i)
+        {
+            const IndexType inner     = outline + static_cast<IndexType>(i * 2u);
+            const IndexType nextInner = outline + static_cast<IndexType>(((i + 1u) % pointCount) * 2u);
+
+            *outlineIndices++ = inner;
+            *outlineIndices++ = inner + 1u;
+            *outlineIndices++ = nextInner;
+            *outlineIndices++ = inner + 1u;
+            *outlineIndices++ = nextInner + 1u;
+            *outlineIndices++ = nextInner;
+        }
+    }
+
+    m_indicesDirty      = false;
+    m_indexUploadNeeded = true;
+}
+
+
+////////////////////////////////////////////////////////////
+bool ShapeBatch::upload() const
+{
+    if (!VertexBuffer::isAvailable(*m_graphicsContext))
+        return false;
+
+    // Vertices: reallocate when growing, otherwise only upload the dirty range
+    if (m_vertexBuffer.getVertexCount() < m_vertices.size())
+    {
+        if (!m_vertexBuffer.create(ShapeBatchImpl::getGrownCapacity(m_vertices.size())))
+            return false;
+
+        m_dirtyBegin = 0u;
+        m_dirtyEnd   = m_vertices.size();
+    }
+
+    if (m_dirtyBegin < m_dirtyEnd)
+    {
+        if (!m_vertexBuffer.update(m_vertices.data() + m_dirtyBegin,
+                                   m_dirtyEnd - m_dirtyBegin,
+                                   static_cast<unsigned int>(m_dirtyBegin)))
+            return false;
+
+        m_dirtyBegin = m_dirtyEnd = 0u;
+    }
+
+    // Indices: only uploaded when the layout of the batch changes
+    if (!m_indexBuffer.hasValue() || m_indexBuffer->getIndexCount() < m_indices.size())
+    {
+        m_indexBuffer = IndexBuffer::create(*m_graphicsContext, ShapeBatchImpl::getGrownCapacity(m_indices.size()));
+
+        if (!m_indexBuffer.hasValue())
+            return false;
+
+        m_indexUploadNeeded = true;
+    }
+
+    if (m_indexUploadNeeded)
+    {
+        if (!m_indexBuffer->update(m_indices.data(), m_indices.size()))
+            return false;
+
+        m_indexUploadNeeded = false;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void ShapeBatch::drawRange(RenderTarget&       target,
+                           bool                uploaded,
+                           std::size_t         firstIndex,
+                           std::size_t         indexCount,
+                           const RenderStates& states) const
+{
+    if (indexCount == 0u)
+        return;
+
+    if (uploaded)
+    {
+        target.draw(m_vertexBuffer, *m_indexBuffer, firstIndex, indexCount, states);
+        return;
+    }
+
+    // Fall back to streaming the geometry when vertex buffers are not available
+    target.drawIndexedVertices(m_vertices.data(),
+                               m_vertices.size(),
+                               m_indices.data() + firstIndex,
+                               indexCount,
+                               PrimitiveType::Triangles,
+                               states);
+}
+
+} // namespace sf
@@ -0,0 +1,962 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ParallelFor.hpp"
+#include "SFML/Graphics/SoftwareRenderTarget.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include "SFML/System/Rect.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Floor.hpp"
+#include "SFML/Base/Math/Lround.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SoftwareRenderTargetImpl
+{
+////////////////////////////////////////////////////////////
+constexpr int tileSize = 64; // Tiles are square, small enough to balance the load across threads
+
+constexpr std::int64_t subpixelScale = 256;                   // Vertex positions are snapped to 1/256 of a pixel
+constexpr std::int64_t maxCoordinate = std::int64_t{1} << 30; // Keeps the edge functions within 64 bits
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] int getTileCount(unsigned int pixels)
+{
+    return static_cast<int>((pixels + tileSize - 1u) / tileSize);
+}
+
+
+////////////////////////////////////////////////////////////
+struct ScreenVertex
+{
+    sf::Vector2f position;  //!< Position in pixels, Y pointing down
+    float        color[4];  //!< Normalized vertex color
+    sf::Vector2f texCoords; //!< Normalized texture coordinates
+};
+
+
+////////////////////////////////////////////////////////////
+struct Triangle
+{
+    std::int64_t  x[3];        //!< Snapped X coordinates of the vertices, in subpixels
+    std::int64_t  y[3];        //!< Snapped Y coordinates of the vertices, in subpixels
+    ScreenVertex  vertices[3]; //!< Attributes of the vertices
+    std::int64_t  area;        //!< Twice the area of the triangle in squared subpixels, always positive
+    std::uint32_t stateIndex;  //!< Index of the draw state of the triangle
+    int           minX, minY;  //!< Top-left pixel of the clipped bounding box
+    int           maxX, maxY;  //!< Bottom-right pixel of the clipped bounding box, exclusive
+};
+
+
+////////////////////////////////////////////////////////////
+struct DrawState
+{
+    sf::BlendMode    blendMode;        //!< Blending of the fragments with the image
+    sf::StencilMode  stencilMode;      //!< Stencil test and update of the fragments
+    bool             stencilEnabled{}; //!< Whether the stencil mode differs from the default one
+    const sf::Image* image{};          //!< Image to sample, `nullptr` for white
+    int              imageWidth{};     //!< Width of the image
+    int              imageHeight{};    //!< Height of the image
+    bool             smooth{};         //!< Bilinear filtering
+    bool             repeated{};       //!< Wrap instead of clamping to the edge
+    int              clipMinX{};       //!< Left pixel column of the clip rectangle
+    int              clipMinY{};       //!< Top pixel row of the clip rectangle
+    int              clipMaxX{};       //!< Right pixel column of the clip rectangle, exclusive
+    int              clipMaxY{};       //!< Bottom pixel row of the clip rectangle, exclusive
+};
+
+
+////////////////////////////////////////////////////////////
+struct PixelRect
+{
+    int minX, minY; //!< Top-left pixel
+    int maxX, maxY; //!< Bottom-right pixel, exclusive
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] PixelRect toPixelRect(sf::Vector2u targetSize, const sf::FloatRect& ratio)
+{
+    // Same rounding as `RenderTarget::getViewport` and `RenderTarget::getScissor`
+    const auto width  = static_cast<float>(targetSize.x);
+    const auto height = static_cast<float>(targetSize.y);
+
+    const auto left   = static_cast<int>(sf::base::lround(width * ratio.position.x));
+    const auto top    = static_cast<int>(sf::base::lround(height * ratio.position.y));
+    const auto right  = left + static_cast<int>(sf::base::lround(width * ratio.size.x));
+    const auto bottom = top + static_cast<int>(sf::base::lround(height * ratio.size.y));
+
+    return {left, top, right, bottom};
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] PixelRect intersect(const PixelRect& lhs, const PixelRect& rhs)
+{
+    return {sf::base::max(lhs.minX, rhs.minX),
+            sf::base::max(lhs.minY, rhs.minY),
+            sf::base::min(lhs.maxX, rhs.maxX),
+            sf::base::min(lhs.maxY, rhs.maxY)};
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::int64_t snap(float coordinate)
+{
+    const auto snapped = static_cast<std::int64_t>(sf::base::lround(coordinate * static_cast<float>(subpixelScale)));
+    return sf::base::clamp(snapped, -maxCoordinate, maxCoordinate);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::int64_t edge(
+    std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by, std::int64_t px, std::int64_t py)
+{
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isTopLeft(std::int64_t ax, std::int64_t ay, std::int64_t bx, std::int64_t by)
+{
+    // With Y pointing down and a positive area, left edges go up and top edges go right
+    return by < ay || (by == ay && bx > ax);
+}
+
+
+////////////////////////////////////////////////////////////
+void appendTriangle(std::vector<Triangle>& triangles,
+                    const DrawState&       drawState,
+                    std::uint32_t          stateIndex,
+                    const ScreenVertex&    a,
+                    const ScreenVertex&    b,
+                    const ScreenVertex&    c)
+{
+    Triangle triangle{{snap(a.position.x), snap(b.position.x), snap(c.position.x)},
+                      {snap(a.position.y), snap(b.position.y), snap(c.position.y)},
+                      {a, b, c},
+                      0,
+                      stateIndex,
+                      0,
+                      0,
+                      0,
+                      0};
+
+    triangle.area = edge(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2]);
+
+    // No culling, like `sf::RenderTarget`: flip back-facing triangles
+    if (triangle.area < 0)
+    {
+        sf::base::swap(triangle.x[1], triangle.x[2]);
+        sf::base::swap(triangle.y[1], triangle.y[2]);
+        sf::base::swap(triangle.vertices[1], triangle.vertices[2]);
+        triangle.area = -triangle.area;
+    }
+
+    if (triangle.area == 0)
+        return;
+
+    // Pixels are sampled at their centers, so the pixel `x` is covered if `x + 0.5` lies within the bounds
+    const std::int64_t minX = sf::base::min(triangle.x[0], sf::base::min(triangle.x[1], triangle.x[2]));
+    const std::int64_t minY = sf::base::min(triangle.y[0], sf::base::min(triangle.y[1], triangle.y[2]));
+    const std::int64_t maxX = sf::base::max(triangle.x[0], sf::base::max(triangle.x[1], triangle.x[2]));
+    const std::int64_t maxY = sf::base::max(triangle.y[0], sf::base::max(triangle.y[1], triangle.y[2]));
+
+    const auto toPixel = [](std::int64_t subpixel, std::int64_t bias)
+    {
+        // Rounds towards negative infinity, unlike the division operator
+        const std::int64_t shifted = subpixel - subpixelScale / 2 + bias;
+        return static_cast<int>((shifted >= 0 ? shifted : shifted - subpixelScale + 1) / subpixelScale);
+    };
+
+    triangle.minX = sf::base::max(drawState.clipMinX, toPixel(minX, subpixelScale - 1));
+    triangle.minY = sf::base::max(drawState.clipMinY, toPixel(minY, subpixelScale - 1));
+    triangle.maxX = sf::base::min(drawState.clipMaxX, toPixel(maxX, 0) + 1);
+    triangle.maxY = sf::base::min(drawState.clipMaxY, toPixel(maxY, 0) + 1);
+
+    if (triangle.minX >= triangle.maxX || triangle.minY >= triangle.maxY)
+        return;
+
+    triangles.push_back(triangle);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename VertexAt, typename Append>
+void assemblePrimitives(sf::PrimitiveType type, std::size_t count, VertexAt&& vertexAt, Append&& append)
+{
+    const sf::Vertex* primitive[3]{};
+
+    switch (type)
+    {
+        case sf::PrimitiveType::Points:
+            for (std::size_t i = 0u; i < count; ++i)
+            {
+                primitive[0] = &vertexAt(i);
+                append(primitive, 1u);
+            }
+            break;
+
+        case sf::PrimitiveType::Lines:
+        case sf::PrimitiveType::LineStrip:
+        {
+            const std::size_t step = type == sf::PrimitiveType::Lines ? 2u : 1u;
+
+            for (std::size_t i = 0u; i + 1u < count; i += step)
+            {
+                primitive[0] = &vertexAt(i);
+                primitive[1] = &vertexAt(i + 1u);
+                append(primitive, 2u);
+            }
+            break;
+        }
+
+        case sf::PrimitiveType::Triangles:
+        case sf::PrimitiveType::TriangleStrip:
+        case sf::PrimitiveType::TriangleFan:
+        {
+            const std::size_t step = type == sf::PrimitiveType::Triangles ? 3u : 1u;
+
+            for (std::size_t i = 0u; i + 2u < count; i += step)
+            {
+                primitive[0] = &vertexAt(type == sf::PrimitiveType::TriangleFan ? 0u : i);
+                primitive[1] = &vertexAt(i + 1u);
+                primitive[2] = &vertexAt(i + 2u);
+                append(primitive, 3u);
+            }
+            break;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void fetchTexel(const DrawState& drawState, int x, int y, float (&texel)[4])
+{
+    const int width  = drawState.imageWidth;
+    const int height = drawState.imageHeight;
+
+    if (drawState.repeated)
+    {
+        x = ((x % width) + width) % width;
+        y = ((y % height) + height) % height;
+    }
+    else
+    {
+        x = sf::base::clamp(x, 0, width - 1);
+        y = sf::base::clamp(y, 0, height - 1);
+    }
+
+    const std::uint8_t* pixel = drawState.image->getPixelsPtr() +
+                                (static_cast<std::size_t>(y) * static_cast<std::size_t>(width) +
+                                 static_cast<std::size_t>(x)) *
+                                    4u;
+
+    for (int i = 0; i < 4; ++i)
+        texel[i] = static_cast<float>(pixel[i]) / 255.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void sampleTexture(const DrawState& drawState, sf::Vector2f texCoords, float (&color)[4])
+{
+    if (drawState.image == nullptr)
+    {
+        color[0] = color[1] = color[2] = color[3] = 1.f;
+        return;
+    }
+
+    const float u = texCoords.x * static_cast<float>(drawState.imageWidth);
+    const float v = texCoords.y * static_cast<float>(drawState.imageHeight);
+
+    if (!drawState.smooth)
+    {
+        fetchTexel(drawState, static_cast<int>(sf::base::floor(u)), static_cast<int>(sf::base::floor(v)), color);
+        return;
+    }
+
+    // Bilinear filtering weights the 4 texels whose centers surround the sample
+    const float left = sf::base::floor(u - 0.5f);
+    const float top  = sf::base::floor(v - 0.5f);
+    const float fx   = u - 0.5f - left;
+    const float fy   = v - 0.5f - top;
+    const int   x    = static_cast<int>(left);
+    const int   y    = static_cast<int>(top);
+
+    float topLeft[4], topRight[4], bottomLeft[4], bottomRight[4];
+    fetchTexel(drawState, x, y, topLeft);
+    fetchTexel(drawState, x + 1, y, topRight);
+    fetchTexel(drawState, x, y + 1, bottomLeft);
+    fetchTexel(drawState, x + 1, y + 1, bottomRight);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        const float upper = topLeft[i] + (topRight[i] - topLeft[i]) * fx;
+        const float lower = bottomLeft[i] + (bottomRight[i] - bottomLeft[i]) * fx;
+        color[i]          = upper + (lower - upper) * fy;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float blendFactor(sf::BlendMode::Factor factor, const float (&src)[4], const float (&dst)[4], int channel)
+{
+    switch (factor)
+    {
+        case sf::BlendMode::Factor::Zero:
+            return 0.f;
+        case sf::BlendMode::Factor::One:
+            return 1.f;
+        case sf::BlendMode::Factor::SrcColor:
+            return src[channel];
+        case sf::BlendMode::Factor::OneMinusSrcColor:
+            return 1.f - src[channel];
+        case sf::BlendMode::Factor::DstColor:
+            return dst[channel];
+        case sf::BlendMode::Factor::OneMinusDstColor:
+            return 1.f - dst[channel];
+        case sf::BlendMode::Factor::SrcAlpha:
+            return src[3];
+        case sf::BlendMode::Factor::OneMinusSrcAlpha:
+            return 1.f - src[3];
+        case sf::BlendMode::Factor::DstAlpha:
+            return dst[3];
+        case sf::BlendMode::Factor::OneMinusDstAlpha:
+            return 1.f - dst[3];
+    }
+
+    return 0.f;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float blendChannel(sf::BlendMode::Factor   srcFactor,
+                                 sf::BlendMode::Factor   dstFactor,
+                                 sf::BlendMode::Equation equation,
+                                 const float (&src)[4],
+                                 const float (&dst)[4],
+                                 int channel)
+{
+    const float s = src[channel];
+    const float d = dst[channel];
+
+    switch (equation)
+    {
+        case sf::BlendMode::Equation::Add:
+            return s * blendFactor(srcFactor, src, dst, channel) + d * blendFactor(dstFactor, src, dst, channel);
+        case sf::BlendMode::Equation::Subtract:
+            return s * blendFactor(srcFactor, src, dst, channel) - d * blendFactor(dstFactor, src, dst, channel);
+        case sf::BlendMode::Equation::ReverseSubtract:
+            return d * blendFactor(dstFactor, src, dst, channel) - s * blendFactor(srcFactor, src, dst, channel);
+        case sf::BlendMode::Equation::Min:
+            return sf::base::min(s, d);
+        case sf::BlendMode::Equation::Max:
+            return sf::base::max(s, d);
+    }
+
+    return s;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool passesStencilTest(const sf::StencilMode& stencilMode, std::uint8_t value)
+{
+    const unsigned int mask      = stencilMode.stencilMask.value & 0xFFu;
+    const unsigned int reference = stencilMode.stencilReference.value & mask;
+    const unsigned int stored    = value & mask;
+
+    switch (stencilMode.stencilComparison)
+    {
+        case sf::StencilComparison::Never:
+            return false;
+        case sf::StencilComparison::Less:
+            return reference < stored;
+        case sf::StencilComparison::LessEqual:
+            return reference <= stored;
+        case sf::StencilComparison::Greater:
+            return reference > stored;
+        case sf::StencilComparison::GreaterEqual:
+            return reference >= stored;
+        case sf::StencilComparison::Equal:
+            return reference == stored;
+        case sf::StencilComparison::NotEqual:
+            return reference != stored;
+        case sf::StencilComparison::Always:
+            return true;
+    }
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint8_t updateStencil(const sf::StencilMode& stencilMode, std::uint8_t value)
+{
+    switch (stencilMode.stencilUpdateOperation)
+    {
+        case sf::StencilUpdateOperation::Keep:
+            return value;
+        case sf::StencilUpdateOperation::Zero:
+            return 0u;
+        case sf::StencilUpdateOperation::Replace:
+            return static_cast<std::uint8_t>(stencilMode.stencilReference.value & 0xFFu);
+        case sf::StencilUpdateOperation::Increment:
+            return value == 0xFFu ? value : static_cast<std::uint8_t>(value + 1u);
+        case sf::StencilUpdateOperation::Decrement:
+            return value == 0u ? value : static_cast<std::uint8_t>(value - 1u);
+        case sf::StencilUpdateOperation::Invert:
+            return static_cast<std::uint8_t>(~value);
+    }
+
+    return value;
+}
+
+
+////////////////////////////////////////////////////////////
+void rasterizeTriangle(const Triangle&  triangle,
+                       const DrawState& drawState,
+                       const PixelRect& bounds,
+                       std::uint8_t*    pixels,
+                       std::uint8_t*    stencil,
+                       int              width)
+{
+    // Edge `i` is opposite to vertex `i`, its function is the unnormalized barycentric weight of the vertex
+    std::int64_t rowValue[3], stepX[3], stepY[3], bias[3];
+
+    const std::int64_t startX = std::int64_t{bounds.minX} * subpixelScale + subpixelScale / 2;
+    const std::int64_t startY = std::int64_t{bounds.minY} * subpixelScale + subpixelScale / 2;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const int a = (i + 1) % 3;
+        const int b = (i + 2) % 3;
+
+        rowValue[i] = edge(triangle.x[a], triangle.y[a], triangle.x[b], triangle.y[b], startX, startY);
+        stepX[i]    = -(triangle.y[b] - triangle.y[a]) * subpixelScale;
+        stepY[i]    = (triangle.x[b] - triangle.x[a]) * subpixelScale;
+
+        // Pixels exactly on a shared edge belong to the triangle for which it is a top or left edge
+        bias[i] = isTopLeft(triangle.x[a], triangle.y[a], triangle.x[b], triangle.y[b]) ? 0 : -1;
+    }
+
+    const double        inverseArea = 1.0 / static_cast<double>(triangle.area);
+    const ScreenVertex* v           = triangle.vertices;
+
+    for (int y = bounds.minY; y < bounds.maxY; ++y)
+    {
+        std::int64_t value[3] = {rowValue[0], rowValue[1], rowValue[2]};
+
+        for (int x = bounds.minX; x < bounds.maxX;
+             ++x, value[0] += stepX[0], value[1] += stepX[1], value[2] += stepX[2])
+        {
+            if (((value[0] + bias[0]) | (value[1] + bias[1]) | (value[2] + bias[2])) < 0)
+                continue;
+
+            const std::size_t index = static_cast<std::size_t>(y) * static_cast<std::size_t>(width) +
+                                      static_cast<std::size_t>(x);
+
+            if (drawState.stencilEnabled)
+            {
+                if (!passesStencilTest(drawState.stencilMode, stencil[index]))
+                    continue;
+
+                stencil[index] = updateStencil(drawState.stencilMode, stencil[index]);
+
+                if (drawState.stencilMode.stencilOnly)
+                    continue;
+            }
+
+            const auto w0 = static_cast<float>(static_cast<double>(value[0]) * inverseArea);
+            const auto w1 = static_cast<float>(static_cast<double>(value[1]) * inverseArea);
+            const auto w2 = 1.f - w0 - w1;
+
+            float src[4];
+            sampleTexture(drawState, v[0].texCoords * w0 + v[1].texCoords * w1 + v[2].texCoords * w2, src);
+
+            for (int i = 0; i < 4; ++i)
+                src[i] *= v[0].color[i] * w0 + v[1].color[i] * w1 + v[2].color[i] * w2;
+
+            std::uint8_t* pixel = pixels + index * 4u;
+
+            float dst[4];
+            for (int i = 0; i < 4; ++i)
+                dst[i] = static_cast<float>(pixel[i]) / 255.f;
+
+            const sf::BlendMode& blendMode = drawState.blendMode;
+
+            for (int i = 0; i < 4; ++i)
+            {
+                const float blended = i < 3 ? blendChannel(blendMode.colorSrcFactor,
+                                                           blendMode.colorDstFactor,
+                                                           blendMode.colorEquation,
+                                                           src,
+                                                           dst,
+                                                           i)
+                                            : blendChannel(blendMode.alphaSrcFactor,
+                                                           blendMode.alphaDstFactor,
+                                                           blendMode.alphaEquation,
+                                                           src,
+                                                           dst,
+                                                           i);
+
+                pixel[i] = static_cast<std::uint8_t>(sf::base::clamp(blended, 0.f, 1.f) * 255.f + 0.5f);
+            }
+        }
+
+        for (int i = 0; i < 3; ++i)
+            rowValue[i] += stepY[i];
+    }
+}
+
+} // namespace SoftwareRenderTargetImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SoftwareRenderTarget::Impl
+{
+    explicit Impl(Vector2u size, unsigned int threadCount) :
+    image(Image::create(size).value()),
+    stencil(static_cast<std::size_t>(size.x) * static_cast<std::size_t>(size.y), std::uint8_t{0}),
+    defaultView(FloatRect({0.f, 0.f}, size.to<Vector2f>())),
+    view(defaultView),
+    tileCountX(SoftwareRenderTargetImpl::getTileCount(size.x)),
+    tileCountY(SoftwareRenderTargetImpl::getTileCount(size.y)),
+    tiles(static_cast<std::size_t>(tileCountX) * static_cast<std::size_t>(tileCountY)),
+    parallelFor(threadCount)
+    {
+    }
+
+    Image                     image;       //!< Color buffer
+    std::vector<std::uint8_t> stencil;     //!< Stencil buffer, one byte per pixel
+    View                      defaultView; //!< Default view, covering the whole target
+    View                      view;        //!< Current view
+
+    Transform transform;              //!< Transform of the current draw, from world to clip space
+    FloatRect viewport;               //!< Viewport of the current draw, in pixels
+    Vector2f  texCoordsScale;         //!< Scale normalizing the texture coordinates of the current draw
+    bool      pendingStencilWrites{}; //!< Whether a pending draw modifies the stencil buffer
+
+    std::vector<SoftwareRenderTargetImpl::DrawState> drawStates; //!< States of the pending draws
+    std::vector<SoftwareRenderTargetImpl::Triangle>  triangles;  //!< Triangles of the pending draws, in order
+
+    int                                     tileCountX;  //!< Number of tile columns
+    int                                     tileCountY;  //!< Number of tile rows
+    std::vector<std::vector<std::uint32_t>> tiles;       //!< Indices of the triangles overlapping each tile
+    std::vector<std::uint32_t>              activeTiles; //!< Indices of the tiles overlapped by a triangle
+
+    priv::ParallelFor parallelFor; //!< Threads rasterizing the tiles
+};
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::SoftwareRenderTarget(Vector2u size, unsigned int threadCount) : m_impl(size, threadCount)
+{
+    SFML_BASE_ASSERT(size.x > 0u && size.y > 0u && "SoftwareRenderTarget size must not be zero");
+}
+
+
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::~SoftwareRenderTarget() = default;
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clear(Color color)
+{
+    clearImpl(&color, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clearStencil(StencilValue stencilValue)
+{
+    clearImpl(nullptr, &stencilValue);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clear(Color color, StencilValue stencilValue)
+{
+    clearImpl(&color, &stencilValue);
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::setView(const View& view)
+{
+    m_impl->view = view;
+}
+
+
+////////////////////////////////////////////////////////////
+const View& SoftwareRenderTarget::getView() const
+{
+    return m_impl->view;
+}
+
+
+////////////////////////////////////////////////////////////
+const View& SoftwareRenderTarget::getDefaultView() const
+{
+    return m_impl->defaultView;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::draw(const Vertex*        vertices,
+                                std::size_t          vertexCount,
+                                PrimitiveType        type,
+                                const RenderStates&  states,
+                                const TextureSource& texture)
+{
+    if (vertexCount == 0u)
+        return;
+
+    beginDraw(states, texture);
+
+    SoftwareRenderTargetImpl::assemblePrimitives(type,
+                                                 vertexCount,
+                                                 [&](std::size_t i) -> const Vertex& { return vertices[i]; },
+                                                 [&](const Vertex* const* primitive, std::size_t count)
+                                                 { appendPrimitive(primitive, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::drawIndexed(const Vertex*        vertices,
+                                       [[maybe_unused]] std::size_t vertexCount,
+                                       const IndexType*     indices,
+                                       std::size_t          indexCount,
+                                       PrimitiveType        type,
+                                       const RenderStates&  states,
+                                       const TextureSource& texture)
+{
+    if (indexCount == 0u)
+        return;
+
+    beginDraw(states, texture);
+
+    SoftwareRenderTargetImpl::assemblePrimitives(type,
+                                                 indexCount,
+                                                 [&](std::size_t i) -> const Vertex&
+                                                 {
+                                                     SFML_BASE_ASSERT(indices[i] < vertexCount);
+                                                     return vertices[indices[i]];
+                                                 },
+                                                 [&](const Vertex* const* primitive, std::size_t count)
+                                                 { appendPrimitive(primitive, count); });
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::display()
+{
+    Impl& impl = *m_impl;
+
+    if (impl.triangles.empty())
+    {
+        impl.drawStates.clear();
+        return;
+    }
+
+    SFML_BASE_ASSERT(impl.triangles.size() <= 0xFFFFFFFFu && "SoftwareRenderTarget has too many pending triangles");
+
+    // Bin the triangles into the tiles they overlap, keeping the draw order within each tile
+    for (std::size_t i = 0u; i < impl.triangles.size(); ++i)
+    {
+        const SoftwareRenderTargetImpl::Triangle& triangle = impl.triangles[i];
+
+        for (int tileY = triangle.minY / SoftwareRenderTargetImpl::tileSize;
+             tileY <= (triangle.maxY - 1) / SoftwareRenderTargetImpl::tileSize;
+             ++tileY)
+        {
+            for (int tileX = triangle.minX / SoftwareRenderTargetImpl::tileSize;
+                 tileX <= (triangle.maxX - 1) / SoftwareRenderTargetImpl::tileSize;
+                 ++tileX)
+            {
+                const auto tileIndex = static_cast<std::uint32_t>(tileY * impl.tileCountX + tileX);
+                std::vector<std::uint32_t>& tile = impl.tiles[tileIndex];
+
+                if (tile.empty())
+                    impl.activeTiles.push_back(tileIndex);
+
+                tile.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    // Tiles are handed out one at a time, as their cost varies a lot with the triangles they overlap
+    impl.parallelFor.run(impl.activeTiles.size(),
+                         1u,
+                         [&](std::size_t begin, std::size_t end) { rasterizeTiles(begin, end); });
+
+    // Keep the allocations of the bins for the next frame
+    for (const std::uint32_t tileIndex : impl.activeTiles)
+        impl.tiles[tileIndex].clear();
+
+    impl.activeTiles.clear();
+    impl.triangles.clear();
+    impl.drawStates.clear();
+    impl.pendingStencilWrites = false;
+}
+
+
+////////////////////////////////////////////////////////////
+const Image& SoftwareRenderTarget::getImage() const
+{
+    return m_impl->image;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SoftwareRenderTarget::getSize() const
+{
+    return m_impl->image.getSize();
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SoftwareRenderTarget::getThreadCount() const
+{
+    return m_impl->parallelFor.getThreadCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::clearImpl(const Color* color, const StencilValue* stencilValue)
+{
+    Impl& impl = *m_impl;
+
+    const Vector2u                        size = impl.image.getSize();
+    const SoftwareRenderTargetImpl::PixelRect target{0, 0, static_cast<int>(size.x), static_cast<int>(size.y)};
+    const SoftwareRenderTargetImpl::PixelRect rect = SoftwareRenderTargetImpl::
+        intersect(SoftwareRenderTargetImpl::toPixelRect(size, impl.view.getScissor()), target);
+
+    const bool coversTarget = rect.minX == 0 && rect.minY == 0 && rect.maxX == target.maxX && rect.maxY == target.maxY;
+
+    // Pending draws entirely overwritten by the clear don't need to be rasterized
+    if (coversTarget && color != nullptr && (stencilValue != nullptr || !impl.pendingStencilWrites))
+    {
+        impl.triangles.clear();
+        impl.drawStates.clear();
+        impl.pendingStencilWrites = false;
+    }
+    else
+    {
+        display();
+    }
+
+    if (rect.minX >= rect.maxX || rect.minY >= rect.maxY)
+        return;
+
+    std::uint8_t* pixels = impl.image.asMutableImageView().pixels;
+
+    for (int y = rect.minY; y < rect.maxY; ++y)
+    {
+        const std::size_t rowStart = static_cast<std::size_t>(y) * size.x;
+
+        for (int x = rect.minX; x < rect.maxX; ++x)
+        {
+            const std::size_t index = rowStart + static_cast<std::size_t>(x);
+
+            if (color != nullptr)
+            {
+                pixels[index * 4u + 0u] = color->r;
+                pixels[index * 4u + 1u] = color->g;
+                pixels[index * 4u + 2u] = color->b;
+                pixels[index * 4u + 3u] = color->a;
+            }
+
+            if (stencilValue != nullptr)
+                impl.stencil[index] = static_cast<std::uint8_t>(stencilValue->value & 0xFFu);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::beginDraw(const RenderStates& states, const TextureSource& texture)
+{
+    SFML_BASE_ASSERT(states.texture == nullptr && "SoftwareRenderTarget samples images, pass them as `texture`");
+    SFML_BASE_ASSERT(states.shader == nullptr && "SoftwareRenderTarget does not support shaders");
+
+    Impl& impl = *m_impl;
+
+    const Vector2u                            size = impl.image.getSize();
+    const SoftwareRenderTargetImpl::PixelRect target{0, 0, static_cast<int>(size.x), static_cast<int>(size.y)};
+    const SoftwareRenderTargetImpl::PixelRect viewport = SoftwareRenderTargetImpl::toPixelRect(size,
+                                                                                               impl.view.getViewport());
+    const SoftwareRenderTargetImpl::PixelRect scissor = SoftwareRenderTargetImpl::toPixelRect(size,
+                                                                                              impl.view.getScissor());
+    const SoftwareRenderTargetImpl::PixelRect clip = SoftwareRenderTargetImpl::
+        intersect(SoftwareRenderTargetImpl::intersect(viewport, scissor), target);
+
+    impl.transform = impl.view.getTransform() * states.transform;
+    impl.viewport  = FloatRect({static_cast<float>(viewport.minX), static_cast<float>(viewport.minY)},
+                              {static_cast<float>(viewport.maxX - viewport.minX),
+                               static_cast<float>(viewport.maxY - viewport.minY)});
+
+    SoftwareRenderTargetImpl::DrawState& drawState = impl.drawStates.emplace_back();
+
+    drawState.blendMode      = states.blendMode;
+    drawState.stencilMode    = states.stencilMode;
+    drawState.stencilEnabled = states.stencilMode != StencilMode();
+    drawState.image          = texture.image;
+    drawState.smooth         = texture.smooth;
+    drawState.repeated       = texture.repeated;
+    drawState.clipMinX       = clip.minX;
+    drawState.clipMinY       = clip.minY;
+    drawState.clipMaxX       = clip.maxX;
+    drawState.clipMaxY       = clip.maxY;
+
+    impl.texCoordsScale = {1.f, 1.f};
+
+    if (texture.image != nullptr)
+    {
+        const Vector2u imageSize = texture.image->getSize();
+        SFML_BASE_ASSERT(imageSize.x > 0u && imageSize.y > 0u);
+
+        drawState.imageWidth  = static_cast<int>(imageSize.x);
+        drawState.imageHeight = static_cast<int>(imageSize.y);
+
+        if (states.coordinateType == CoordinateType::Pixels)
+            impl.texCoordsScale = {1.f / static_cast<float>(imageSize.x), 1.f / static_cast<float>(imageSize.y)};
+    }
+
+    if (drawState.stencilEnabled && states.stencilMode.stencilUpdateOperation != StencilUpdateOperation::Keep)
+        impl.pendingStencilWrites = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::appendPrimitive(const Vertex* const* vertices, std::size_t vertexCount)
+{
+    Impl& impl = *m_impl;
+
+    const auto stateIndex = static_cast<std::uint32_t>(impl.drawStates.size() - 1u);
+    const SoftwareRenderTargetImpl::DrawState& drawState = impl.drawStates.back();
+
+    if (drawState.clipMinX >= drawState.clipMaxX || drawState.clipMinY >= drawState.clipMaxY)
+        return;
+
+    SoftwareRenderTargetImpl::ScreenVertex screen[3];
+
+    for (std::size_t i = 0u; i < vertexCount; ++i)
+    {
+        const Vertex& vertex = *vertices[i];
+
+        // Clip space to pixels, with Y pointing down like the rows of the image
+        const Vector2f clip = impl.transform.transformPoint(vertex.position);
+
+        screen[i].position = {impl.viewport.position.x + (clip.x + 1.f) * 0.5f * impl.viewport.size.x,
+                              impl.viewport.position.y + (1.f - clip.y) * 0.5f * impl.viewport.size.y};
+
+        screen[i].color[0] = static_cast<float>(vertex.color.r) / 255.f;
+        screen[i].color[1] = static_cast<float>(vertex.color.g) / 255.f;
+        screen[i].color[2] = static_cast<float>(vertex.color.b) / 255.f;
+        screen[i].color[3] = static_cast<float>(vertex.color.a) / 255.f;
+
+        screen[i].texCoords = vertex.texCoords.cwiseMul(impl.texCoordsScale);
+    }
+
+    const auto appendQuad = [&](SoftwareRenderTargetImpl::ScreenVertex a,
+                                SoftwareRenderTargetImpl::ScreenVertex b,
+                                SoftwareRenderTargetImpl::ScreenVertex c,
+                                SoftwareRenderTargetImpl::ScreenVertex d,
+                                Vector2f                               halfExtentA,
+                                Vector2f                               halfExtentB)
+    {
+        a.position += halfExtentA;
+        b.position += halfExtentB;
+        c.position -= halfExtentA;
+        d.position -= halfExtentB;
+
+        SoftwareRenderTargetImpl::appendTriangle(impl.triangles, drawState, stateIndex, a, b, c);
+        SoftwareRenderTargetImpl::appendTriangle(impl.triangles, drawState, stateIndex, a, c, d);
+    };
+
+    if (vertexCount == 3u)
+    {
+        SoftwareRenderTargetImpl::appendTriangle(impl.triangles,
+                                                 drawState,
+                                                 stateIndex,
+                                                 screen[0],
+                                                 screen[1],
+                                                 screen[2]);
+    }
+    else if (vertexCount == 2u)
+    {
+        // Lines are one pixel wide quads around the segment
+        const Vector2f direction = screen[1].position - screen[0].position;
+        const float    length    = direction.length();
+
+        if (length == 0.f)
+            return;
+
+        const Vector2f normal = Vector2f{-direction.y, direction.x} * (0.5f / length);
+        appendQuad(screen[0], screen[1], screen[1], screen[0], normal, normal);
+    }
+    else
+    {
+        // Points are one pixel squares centered on the vertex
+        appendQuad(screen[0], screen[0], screen[0], screen[0], {-0.5f, -0.5f}, {0.5f, -0.5f});
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void SoftwareRenderTarget::rasterizeTiles(std::size_t begin, std::size_t end)
+{
+    Impl& impl = *m_impl;
+
+    const Vector2u size   = impl.image.getSize();
+    std::uint8_t*  pixels = impl.image.asMutableImageView().pixels;
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const std::uint32_t tileIndex = impl.activeTiles[i];
+        const int           tileX     = static_cast<int>(tileIndex) % impl.tileCountX;
+        const int           tileY     = static_cast<int>(tileIndex) / impl.tileCountX;
+
+        const SoftwareRenderTargetImpl::PixelRect tile{tileX * SoftwareRenderTargetImpl::tileSize,
+                                                       tileY * SoftwareRenderTargetImpl::tileSize,
+                                                       base::min((tileX + 1) * SoftwareRenderTargetImpl::tileSize,
+                                                                 static_cast<int>(size.x)),
+                                                       base::min((tileY + 1) * SoftwareRenderTargetImpl::tileSize,
+                                                                 static_cast<int>(size.y))};
+
+        // Tiles don't overlap, so each pixel is only ever written by one thread
+        for (const std::uint32_t triangleIndex : impl.tiles[tileIndex])
+        {
+            const SoftwareRenderTargetImpl::Triangle& triangle = impl.triangles[triangleIndex];
+            const SoftwareRenderTargetImpl::PixelRect bounds   = SoftwareRenderTargetImpl::
+                intersect(tile, {triangle.minX, triangle.minY, triangle.maxX, triangle.maxY});
+
+            SoftwareRenderTargetImpl::rasterizeTriangle(triangle,
+                                                        impl.drawStates[triangle.stateIndex],
+                                                        bounds,
+                                                        pixels,
+                                                        impl.stencil.data(),
+                                                        static_cast<int>(size.x));
+        }
+    }
+}
+
+} // namespace sf
@@ -0,0 +1,324 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/SpatialGrid.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Ceil.hpp"
+#include "SFML/Base/Math/Floor.hpp"
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpatialGridImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
+{
+    return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+           a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::FloatRect getBoundingBox(const sf::Vector2f (&corners)[4])
+{
+    sf::Vector2f min = corners[0];
+    sf::Vector2f max = corners[0];
+
+    for (const sf::Vector2f corner : corners)
+    {
+        min = {sf::base::min(min.x, corner.x), sf::base::min(min.y, corner.y)};
+        max = {sf::base::max(max.x, corner.x), sf::base::max(max.y, corner.y)};
+    }
+
+    return {min, max - min};
+}
+
+
+////////////////////////////////////////////////////////////
+/// Separating axis test between a rectangle and the rotated rectangle
+/// `corners`, along the two edge normals of the latter. The world axes
+/// are already covered by testing against the bounding box of `corners`.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool overlapsRotated(const sf::FloatRect& rect, const sf::Vector2f (&corners)[4])
+{
+    const sf::Vector2f rectCorners[]{rect.position,
+                                     {rect.position.x + rect.size.x, rect.position.y},
+                                     rect.position + rect.size,
+                                     {rect.position.x, rect.position.y + rect.size.y}};
+
+    for (std::size_t edge = 0u; edge < 2u; ++edge)
+    {
+        const sf::Vector2f axis = (corners[edge + 1u] - corners[edge]).perpendicular();
+
+        // The rotated rectangle projects onto its own edge normal as the interval between two of its edges
+        const float rotatedMin = sf::base::min(axis.dot(corners[edge]), axis.dot(corners[edge + 2u]));
+        const float rotatedMax = sf::base::max(axis.dot(corners[edge]), axis.dot(corners[edge + 2u]));
+
+        float rectMin = axis.dot(rectCorners[0]);
+        float rectMax = rectMin;
+
+        for (const sf::Vector2f corner : rectCorners)
+        {
+            rectMin = sf::base::min(rectMin, axis.dot(corner));
+            rectMax = sf::base::max(rectMax, axis.dot(corner));
+        }
+
+        if (rectMax <= rotatedMin || rotatedMax <= rectMin)
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace SpatialGridImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+SpatialGrid::SpatialGrid(const FloatRect& area, Vector2f cellSize) :
+m_area(area),
+m_cellSize(cellSize),
+m_gridSize(base::max(static_cast<unsigned int>(base::ceil(area.size.x / cellSize.x)), 1u),
+           base::max(static_cast<unsigned int>(base::ceil(area.size.y / cellSize.y)), 1u)),
+m_cells(static_cast<std::size_t>(m_gridSize.x) * m_gridSize.y)
+{
+    SFML_BASE_ASSERT(cellSize.x > 0.f && cellSize.y > 0.f);
+}
+
+
+////////////////////////////////////////////////////////////
+SpatialGrid::ObjectId SpatialGrid::insert(const FloatRect& bounds)
+{
+    ObjectId objectId{};
+
+    if (m_freeIds.empty())
+    {
+        objectId = static_cast<ObjectId>(m_objects.size());
+        m_objects.emplace_back();
+    }
+    else
+    {
+        objectId = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Object& object = m_objects[objectId];
+    object.bounds  = bounds;
+    object.alive   = true;
+
+    link(objectId);
+    ++m_objectCount;
+
+    return objectId;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::update(ObjectId objectId, const FloatRect& bounds)
+{
+    SFML_BASE_ASSERT(objectId < m_objects.size() && m_objects[objectId].alive);
+
+    Object& object = m_objects[objectId];
+    object.bounds  = bounds;
+
+    // Most moves stay within the same cells, and only need the new bounds for the exact tests
+    if (getCell(bounds.position) == object.cellBegin && getCell(bounds.position + bounds.size) == object.cellEnd)
+        return;
+
+    unlink(objectId);
+    link(objectId);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::remove(ObjectId objectId)
+{
+    SFML_BASE_ASSERT(objectId < m_objects.size() && m_objects[objectId].alive);
+
+    unlink(objectId);
+
+    m_objects[objectId].alive = false;
+    m_freeIds.push_back(objectId);
+    --m_objectCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::clear()
+{
+    for (std::vector<ObjectId>& cell : m_cells)
+        cell.clear();
+
+    m_objects.clear();
+    m_freeIds.clear();
+    m_objectCount = 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+const FloatRect& SpatialGrid::getBounds(ObjectId objectId) const
+{
+    SFML_BASE_ASSERT(objectId < m_objects.size() && m_objects[objectId].alive);
+
+    return m_objects[objectId].bounds;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::getObjectCount() const
+{
+    return m_objectCount;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Func>
+void SpatialGrid::forEachCandidate(const FloatRect& area, Func&& func) const
+{
+    // Objects overlapping several cells are only reported for the first cell visited
+    if (++m_queryStamp == 0u)
+    {
+        for (Object& object : m_objects)
+            object.queryStamp = 0u;
+
+        m_queryStamp = 1u;
+    }
+
+    const Vector2u begin = getCell(area.position);
+    const Vector2u end   = getCell(area.position + area.size);
+
+    for (unsigned int y = begin.y; y <= end.y; ++y)
+        for (unsigned int x = begin.x; x <= end.x; ++x)
+            for (const ObjectId objectId : m_cells[static_cast<std::size_t>(y) * m_gridSize.x + x])
+            {
+                Object& object = m_objects[objectId];
+
+                if (object.queryStamp == m_queryStamp)
+                    continue;
+
+                object.queryStamp = m_queryStamp;
+                func(objectId, object);
+            }
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::query(const FloatRect& area, std::vector<ObjectId>& result) const
+{
+    const std::size_t initialSize = result.size();
+
+    forEachCandidate(area,
+                     [&](ObjectId objectId, const Object& object)
+    {
+        if (SpatialGridImpl::overlaps(object.bounds, area))
+            result.push_back(objectId);
+    });
+
+    return result.size() - initialSize;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::queryVisible(const View& view, std::vector<ObjectId>& result) const
+{
+    // Corners of the area seen by the view, in world units and in order around the rectangle
+    const Transform& inverse = view.getInverseTransform();
+    const Vector2f   corners[]{inverse.transformPoint({-1.f, -1.f}),
+                               inverse.transformPoint({1.f, -1.f}),
+                               inverse.transformPoint({1.f, 1.f}),
+                               inverse.transformPoint({-1.f, 1.f})};
+
+    const FloatRect boundingBox = SpatialGridImpl::getBoundingBox(corners);
+    const bool      rotated     = view.getRotation() != Angle::Zero;
+
+    const std::size_t initialSize = result.size();
+
+    forEachCandidate(boundingBox,
+                     [&](ObjectId objectId, const Object& object)
+    {
+        if (SpatialGridImpl::overlaps(object.bounds, boundingBox) &&
+            (!rotated || SpatialGridImpl::overlapsRotated(object.bounds, corners)))
+            result.push_back(objectId);
+    });
+
+    m_visibleCount = result.size() - initialSize;
+    m_culledCount  = m_objectCount - m_visibleCount;
+
+    return m_visibleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::getVisibleCount() const
+{
+    return m_visibleCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpatialGrid::getCulledCount() const
+{
+    return m_culledCount;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u SpatialGrid::getCell(Vector2f point) const
+{
+    const Vector2f cell = (point - m_area.position).cwiseDiv(m_cellSize);
+
+    // Clamp before converting, out of range conversions being undefined
+    return {static_cast<unsigned int>(base::clamp(base::floor(cell.x), 0.f, static_cast<float>(m_gridSize.x - 1u))),
+            static_cast<unsigned int>(base::clamp(base::floor(cell.y), 0.f, static_cast<float>(m_gridSize.y - 1u)))};
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::link(ObjectId objectId)
+{
+    Object& object   = m_objects[objectId];
+    object.cellBegin = getCell(object.bounds.position);
+    object.cellEnd   = getCell(object.bounds.position + object.bounds.size);
+
+    for (unsigned int y = object.cellBegin.y; y <= object.cellEnd.y; ++y)
+        for (unsigned int x = object.cellBegin.x; x <= object.cellEnd.x; ++x)
+            m_cells[static_cast<std::size_t>(y) * m_gridSize.x + x].push_back(objectId);
+}
+
+
+////////////////////////////////////////////////////////////
+void SpatialGrid::unlink(ObjectId objectId)
+{
+    const Object& object = m_objects[objectId];
+
+    for (unsigned int y = object.cellBegin.y; y <= object.cellEnd.y; ++y)
+        for (unsigned int x = object.cellBegin.x; x <= object.cellEnd.x; ++x)
+        {
+            std::vector<ObjectId>& cell = m_cells[static_cast<std::size_t>(y) * m_gridSize.x + x];
+
+            // The order of the objects in a cell is irrelevant, swap with the last one
+            for (ObjectId& id : cell)
+                if (id == objectId)
+                {
+                    id = cell.back();
+                    cell.pop_back();
+                    break;
+                }
+        }
+}
+
+
+} // namespace sf
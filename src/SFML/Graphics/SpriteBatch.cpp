@@ -0,0 +1,537 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/IndexBuffer.hpp"
+#include "SFML/Graphics/IndexType.hpp"
+#include "SFML/Graphics/ParallelFor.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/SpriteBatch.hpp"
+#include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Cos.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/Math/Sin.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_PRIV_SPRITE_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace SpriteBatchImpl
+{
+////////////////////////////////////////////////////////////
+// Number of sprites processed by a thread at once, large enough to amortize the scheduling
+constexpr std::size_t blockSize = 8192u;
+
+
+////////////////////////////////////////////////////////////
+// Attributes of the sprites, one array each, indexed by handle
+struct Sprites
+{
+    std::vector<float>       positionsX;   //!< Horizontal positions
+    std::vector<float>       positionsY;   //!< Vertical positions
+    std::vector<sf::Angle>   rotations;    //!< Rotations, as set by the user
+    std::vector<float>       cosines;      //!< Cosines of the rotations
+    std::vector<float>       sines;        //!< Sines of the opposite of the rotations, as in `sf::Transformable`
+    std::vector<float>       scalesX;      //!< Horizontal scale factors
+    std::vector<float>       scalesY;      //!< Vertical scale factors
+    std::vector<float>       originsX;     //!< Horizontal local origins
+    std::vector<float>       originsY;     //!< Vertical local origins
+    std::vector<float>       widths;       //!< Absolute widths of the texture rectangles
+    std::vector<float>       heights;      //!< Absolute heights of the texture rectangles
+    std::vector<sf::IntRect> textureRects; //!< Texture rectangles
+    std::vector<sf::Color>   colors;       //!< Colors
+};
+
+
+////////////////////////////////////////////////////////////
+// Calls `func` with each array of `sprites`, to resize or clear them all at once
+template <typename Func>
+void forEachArray(Sprites& sprites, Func&& func)
+{
+    func(sprites.positionsX);
+    func(sprites.positionsY);
+    func(sprites.rotations);
+    func(sprites.cosines);
+    func(sprites.sines);
+    func(sprites.scalesX);
+    func(sprites.scalesY);
+    func(sprites.originsX);
+    func(sprites.originsY);
+    func(sprites.widths);
+    func(sprites.heights);
+    func(sprites.textureRects);
+    func(sprites.colors);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::uint16_t toTexCoord(int coordinate)
+{
+    return static_cast<std::uint16_t>(sf::base::clamp(coordinate, 0, 65'535));
+}
+
+
+////////////////////////////////////////////////////////////
+// Corner positions, in the order of the vertices of `sf::Sprite`: top-left, bottom-left, top-right, bottom-right
+void writePositionsScalar(const Sprites& sprites, std::size_t begin, std::size_t end, sf::VertexCompact* vertices)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        // Same transform as `sf::Transformable`, applied to the corners relative to the origin
+        const float sxc = sprites.scalesX[i] * sprites.cosines[i];
+        const float syc = sprites.scalesY[i] * sprites.cosines[i];
+        const float sxs = sprites.scalesX[i] * sprites.sines[i];
+        const float sys = sprites.scalesY[i] * sprites.sines[i];
+
+        const float left   = -sprites.originsX[i];
+        const float right  = sprites.widths[i] - sprites.originsX[i];
+        const float top    = -sprites.originsY[i];
+        const float bottom = sprites.heights[i] - sprites.originsY[i];
+
+        const float leftX   = sxc * left + sprites.positionsX[i];
+        const float leftY   = -sxs * left + sprites.positionsY[i];
+        const float rightX  = sxc * right + sprites.positionsX[i];
+        const float rightY  = -sxs * right + sprites.positionsY[i];
+        const float topX    = sys * top;
+        const float topY    = syc * top;
+        const float bottomX = sys * bottom;
+        const float bottomY = syc * bottom;
+
+        sf::VertexCompact* quad = vertices + i * 4u;
+        quad[0].position        = {leftX + topX, leftY + topY};
+        quad[1].position        = {leftX + bottomX, leftY + bottomY};
+        quad[2].position        = {rightX + topX, rightY + topY};
+        quad[3].position        = {rightX + bottomX, rightY + bottomY};
+    }
+}
+
+
+#ifdef SFML_PRIV_SPRITE_BATCH_SSE2
+
+////////////////////////////////////////////////////////////
+// Stores the position of one corner of four consecutive sprites, given their coordinates
+void storeCorner(sf::VertexCompact* vertices, std::size_t corner, __m128 x, __m128 y)
+{
+    const __m128 low  = _mm_unpacklo_ps(x, y); // x0 y0 x1 y1
+    const __m128 high = _mm_unpackhi_ps(x, y); // x2 y2 x3 y3
+
+    _mm_storel_pi(reinterpret_cast<__m64*>(&vertices[corner].position), low);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(&vertices[4u + corner].position), low);
+    _mm_storel_pi(reinterpret_cast<__m64*>(&vertices[8u + corner].position), high);
+    _mm_storeh_pi(reinterpret_cast<__m64*>(&vertices[12u + corner].position), high);
+}
+
+
+////////////////////////////////////////////////////////////
+// SSE2 kernel, four sprites per iteration, same operations as the scalar one
+void writePositionsSSE2(const Sprites& sprites, std::size_t begin, std::size_t end, sf::VertexCompact* vertices)
+{
+    const __m128 zero = _mm_setzero_ps();
+
+    std::size_t i = begin;
+
+    for (; i + 4u <= end; i += 4u)
+    {
+        const __m128 cosines = _mm_loadu_ps(sprites.cosines.data() + i);
+        const __m128 sines   = _mm_loadu_ps(sprites.sines.data() + i);
+        const __m128 scalesX = _mm_loadu_ps(sprites.scalesX.data() + i);
+        const __m128 scalesY = _mm_loadu_ps(sprites.scalesY.data() + i);
+
+        const __m128 sxc = _mm_mul_ps(scalesX, cosines);
+        const __m128 syc = _mm_mul_ps(scalesY, cosines);
+        const __m128 sxs = _mm_mul_ps(scalesX, sines);
+        const __m128 sys = _mm_mul_ps(scalesY, sines);
+
+        const __m128 originsX = _mm_loadu_ps(sprites.originsX.data() + i);
+        const __m128 originsY = _mm_loadu_ps(sprites.originsY.data() + i);
+
+        const __m128 left   = _mm_sub_ps(zero, originsX);
+        const __m128 right  = _mm_sub_ps(_mm_loadu_ps(sprites.widths.data() + i), originsX);
+        const __m128 top    = _mm_sub_ps(zero, originsY);
+        const __m128 bottom = _mm_sub_ps(_mm_loadu_ps(sprites.heights.data() + i), originsY);
+
+        const __m128 positionsX = _mm_loadu_ps(sprites.positionsX.data() + i);
+        const __m128 positionsY = _mm_loadu_ps(sprites.positionsY.data() + i);
+        const __m128 minusSxs   = _mm_sub_ps(zero, sxs);
+
+        const __m128 leftX   = _mm_add_ps(_mm_mul_ps(sxc, left), positionsX);
+        const __m128 leftY   = _mm_add_ps(_mm_mul_ps(minusSxs, left), positionsY);
+        const __m128 rightX  = _mm_add_ps(_mm_mul_ps(sxc, right), positionsX);
+        const __m128 rightY  = _mm_add_ps(_mm_mul_ps(minusSxs, right), positionsY);
+        const __m128 topX    = _mm_mul_ps(sys, top);
+        const __m128 topY    = _mm_mul_ps(syc, top);
+        const __m128 bottomX = _mm_mul_ps(sys, bottom);
+        const __m128 bottomY = _mm_mul_ps(syc, bottom);
+
+        sf::VertexCompact* quads = vertices + i * 4u;
+        storeCorner(quads, 0u, _mm_add_ps(leftX, topX), _mm_add_ps(leftY, topY));
+        storeCorner(quads, 1u, _mm_add_ps(leftX, bottomX), _mm_add_ps(leftY, bottomY));
+        storeCorner(quads, 2u, _mm_add_ps(rightX, topX), _mm_add_ps(rightY, topY));
+        storeCorner(quads, 3u, _mm_add_ps(rightX, bottomX), _mm_add_ps(rightY, bottomY));
+    }
+
+    writePositionsScalar(sprites, i, end, vertices);
+}
+
+#endif // SFML_PRIV_SPRITE_BATCH_SSE2
+
+
+////////////////////////////////////////////////////////////
+void writeVertices(const Sprites& sprites, std::size_t begin, std::size_t end, sf::VertexCompact* vertices)
+{
+#ifdef SFML_PRIV_SPRITE_BATCH_SSE2
+    writePositionsSSE2(sprites, begin, end, vertices);
+#else
+    writePositionsScalar(sprites, begin, end, vertices);
+#endif
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        const sf::IntRect&  rect   = sprites.textureRects[i];
+        const std::uint16_t left   = toTexCoord(rect.position.x);
+        const std::uint16_t top    = toTexCoord(rect.position.y);
+        const std::uint16_t right  = toTexCoord(rect.position.x + rect.size.x);
+        const std::uint16_t bottom = toTexCoord(rect.position.y + rect.size.y);
+
+        sf::VertexCompact* quad = vertices + i * 4u;
+        quad[0].texCoords       = {left, top};
+        quad[1].texCoords       = {left, bottom};
+        quad[2].texCoords       = {right, top};
+        quad[3].texCoords       = {right, bottom};
+
+        quad[0].color = quad[1].color = quad[2].color = quad[3].color = sprites.colors[i];
+    }
+}
+
+} // namespace SpriteBatchImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SpriteBatch::Impl
+{
+    explicit Impl(GraphicsContext& theGraphicsContext, unsigned int threadCount) :
+    graphicsContext(&theGraphicsContext),
+    vertexBuffer(theGraphicsContext, PrimitiveType::Triangles, VertexBuffer::Usage::Stream),
+    parallelFor(threadCount)
+    {
+    }
+
+    GraphicsContext* graphicsContext; //!< Graphics context owning the buffers
+
+    SpriteBatchImpl::Sprites            sprites;         //!< Attributes of the sprites
+    mutable std::vector<VertexCompact>  vertices;        //!< Four vertices per sprite
+    mutable bool                        verticesDirty{}; //!< Did a sprite change since the vertices were generated?
+    mutable std::vector<IndexType>      indices;         //!< Two triangles per sprite, grown as needed
+    mutable VertexBuffer                vertexBuffer;    //!< Vertices uploaded by the last draw
+    mutable base::Optional<IndexBuffer> indexBuffer;     //!< Copy of `indices` in graphics memory
+    mutable priv::ParallelFor           parallelFor;     //!< Threads generating the vertices
+};
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::SpriteBatch(GraphicsContext& graphicsContext, unsigned int threadCount) :
+m_impl(graphicsContext, threadCount)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::~SpriteBatch() = default;
+
+
+////////////////////////////////////////////////////////////
+SpriteBatch::Handle SpriteBatch::add(const Sprite& sprite)
+{
+    const Handle handle = getSpriteCount();
+
+    SpriteBatchImpl::forEachArray(m_impl->sprites, [&](auto& array) { array.emplace_back(); });
+    set(handle, sprite);
+
+    return handle;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::set(Handle handle, const Sprite& sprite)
+{
+    setPosition(handle, sprite.getPosition());
+    setRotation(handle, sprite.getRotation());
+    setScale(handle, sprite.getScale());
+    setOrigin(handle, sprite.getOrigin());
+    setTextureRect(handle, sprite.getTextureRect());
+    setColor(handle, sprite.getColor());
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::clear()
+{
+    SpriteBatchImpl::forEachArray(m_impl->sprites, [](auto& array) { array.clear(); });
+
+    m_impl->vertices.clear();
+    m_impl->verticesDirty = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::reserve(std::size_t spriteCount)
+{
+    SpriteBatchImpl::forEachArray(m_impl->sprites, [&](auto& array) { array.reserve(spriteCount); });
+
+    m_impl->vertices.reserve(spriteCount * 4u);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t SpriteBatch::getSpriteCount() const
+{
+    return m_impl->sprites.positionsX.size();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setPosition(Handle handle, Vector2f position)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    m_impl->sprites.positionsX[handle] = position.x;
+    m_impl->sprites.positionsY[handle] = position.y;
+    m_impl->verticesDirty              = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::move(Handle handle, Vector2f offset)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    m_impl->sprites.positionsX[handle] += offset.x;
+    m_impl->sprites.positionsY[handle] += offset.y;
+    m_impl->verticesDirty = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setRotation(Handle handle, Angle angle)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    const Angle wrapped = angle.wrapUnsigned();
+
+    m_impl->sprites.rotations[handle] = wrapped;
+    m_impl->sprites.cosines[handle]   = base::cos(-wrapped.asRadians());
+    m_impl->sprites.sines[handle]     = base::sin(-wrapped.asRadians());
+    m_impl->verticesDirty             = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setScale(Handle handle, Vector2f factors)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    m_impl->sprites.scalesX[handle] = factors.x;
+    m_impl->sprites.scalesY[handle] = factors.y;
+    m_impl->verticesDirty           = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setOrigin(Handle handle, Vector2f origin)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    m_impl->sprites.originsX[handle] = origin.x;
+    m_impl->sprites.originsY[handle] = origin.y;
+    m_impl->verticesDirty            = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setTextureRect(Handle handle, const IntRect& rectangle)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    // Absolute values are used to support negative texture rect sizes, as in `sf::Sprite`
+    m_impl->sprites.textureRects[handle] = rectangle;
+    m_impl->sprites.widths[handle]       = base::fabs(static_cast<float>(rectangle.size.x));
+    m_impl->sprites.heights[handle]      = base::fabs(static_cast<float>(rectangle.size.y));
+    m_impl->verticesDirty                = true;
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::setColor(Handle handle, Color color)
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    m_impl->sprites.colors[handle] = color;
+    m_impl->verticesDirty          = true;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getPosition(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return {m_impl->sprites.positionsX[handle], m_impl->sprites.positionsY[handle]};
+}
+
+
+////////////////////////////////////////////////////////////
+Angle SpriteBatch::getRotation(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return m_impl->sprites.rotations[handle];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getScale(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return {m_impl->sprites.scalesX[handle], m_impl->sprites.scalesY[handle]};
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2f SpriteBatch::getOrigin(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return {m_impl->sprites.originsX[handle], m_impl->sprites.originsY[handle]};
+}
+
+
+////////////////////////////////////////////////////////////
+const IntRect& SpriteBatch::getTextureRect(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return m_impl->sprites.textureRects[handle];
+}
+
+
+////////////////////////////////////////////////////////////
+Color SpriteBatch::getColor(Handle handle) const
+{
+    SFML_BASE_ASSERT(handle < getSpriteCount() && "SpriteBatch invalid sprite handle");
+
+    return m_impl->sprites.colors[handle];
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int SpriteBatch::getThreadCount() const
+{
+    return m_impl->parallelFor.getThreadCount();
+}
+
+
+////////////////////////////////////////////////////////////
+void SpriteBatch::draw(RenderTarget& target, const Texture& texture, RenderStates states) const
+{
+    const Impl&       impl        = *m_impl;
+    const std::size_t spriteCount = getSpriteCount();
+
+    if (spriteCount == 0u)
+        return;
+
+    if (impl.verticesDirty)
+    {
+        impl.vertices.resize(spriteCount * 4u);
+
+        impl.parallelFor.run(spriteCount,
+                             SpriteBatchImpl::blockSize,
+                             [&](std::size_t begin, std::size_t end)
+                             { SpriteBatchImpl::writeVertices(impl.sprites, begin, end, impl.vertices.data()); });
+
+        impl.verticesDirty = false;
+    }
+
+    // The indices only depend on the number of sprites, grow them geometrically so that they are rarely rebuilt
+    if (impl.indices.size() < spriteCount * 6u)
+    {
+        std::size_t capacity = 1024u;
+
+        while (capacity < spriteCount)
+            capacity *= 2u;
+
+        impl.indices.clear();
+        impl.indices.reserve(capacity * 6u);
+
+        for (std::size_t i = 0u; i < capacity; ++i)
+        {
+            const auto first = static_cast<IndexType>(i * 4u);
+
+            for (const IndexType corner : {0u, 1u, 2u, 2u, 1u, 3u})
+                impl.indices.push_back(first + corner);
+        }
+
+        impl.indexBuffer.reset();
+    }
+
+    states.texture        = &texture;
+    states.coordinateType = CoordinateType::Pixels;
+
+    const std::size_t indexCount = spriteCount * 6u;
+
+    if (VertexBuffer::isAvailable(*impl.graphicsContext))
+    {
+        if (!impl.indexBuffer.hasValue())
+        {
+            impl.indexBuffer = IndexBuffer::create(*impl.graphicsContext,
+                                                   impl.indices.size(),
+                                                   IndexBuffer::Usage::Static);
+
+            if (impl.indexBuffer.hasValue() && !impl.indexBuffer->update(impl.indices.data(), impl.indices.size()))
+                impl.indexBuffer.reset();
+        }
+
+        const bool vertexBufferReady = impl.vertexBuffer.getVertexCount() >= impl.vertices.size() ||
+                                       impl.vertexBuffer.create(impl.vertices.size(), VertexFormat::Compact);
+
+        if (vertexBufferReady && impl.indexBuffer.hasValue() &&
+            impl.vertexBuffer.update(impl.vertices.data(), impl.vertices.size(), 0u))
+        {
+            target.draw(impl.vertexBuffer, *impl.indexBuffer, 0u, indexCount, states);
+            return;
+        }
+    }
+
+    // Fall back to streaming the geometry when vertex buffers are not available
+    target.drawIndexedVertices(impl.vertices.data(),
+                               impl.vertices.size(),
+                               impl.indices.data(),
+                               indexCount,
+                               PrimitiveType::Triangles,
+                               states);
+}
+
+} // namespace sf
@@ -0,0 +1,449 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/StrokeTessellator.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Math/Acos.hpp"
+#include "SFML/Base/Math/Ceil.hpp"
+#include "SFML/Base/Math/Cos.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/Math/Sin.hpp"
+
+#include <vector>
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace StrokeTessellatorImpl
+{
+////////////////////////////////////////////////////////////
+constexpr float epsilon = 1e-6f;
+constexpr float halfPi  = 1.57079632679f;
+
+
+////////////////////////////////////////////////////////////
+/// \brief Cross-section of a stroke at a given point
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] Section
+{
+    sf::Vector2f positions[4]; //!< Fringe and edge of side A, then edge and fringe of side B
+    bool         transparent;  //!< Is the whole section transparent? (ends of antialiased butt and square caps)
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Connects consecutive cross-sections of a stroke with triangles
+///
+/// Each section is given as a center and one direction per side,
+/// the directions are scaled by the half thickness, so that unit
+/// directions give edges parallel to the stroke, and longer ones
+/// reach miter points.
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SectionWriter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    explicit SectionWriter(std::vector<sf::Vertex>& output, const sf::StrokeStyle& style) :
+    m_output(output),
+    m_color(style.color),
+    m_transparentColor(style.color.r, style.color.g, style.color.b, 0u)
+    {
+        // The fringe is centered on the edge, so that antialiasing does not change the apparent thickness
+        const float halfThickness = style.thickness * 0.5f;
+        m_halfFringe              = sf::base::max(style.antialiasingWidth, 0.f) * 0.5f;
+        m_innerWidth              = sf::base::max(halfThickness - m_halfFringe, 0.f);
+        m_outerWidth              = halfThickness + m_halfFringe;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void push(sf::Vector2f center, sf::Vector2f directionA, sf::Vector2f directionB, bool transparent = false)
+    {
+        const Section section{{center + directionA * m_outerWidth,
+                               center + directionA * m_innerWidth,
+                               center + directionB * m_innerWidth,
+                               center + directionB * m_outerWidth},
+                              transparent};
+
+        if (m_hasPrevious)
+            connect(m_previous, section);
+
+        m_previous    = section;
+        m_hasPrevious = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getOuterWidth() const
+    {
+        return m_outerWidth;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getHalfFringe() const
+    {
+        return m_halfFringe;
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    void connect(const Section& from, const Section& to)
+    {
+        const sf::Color fromColor = from.transparent ? m_transparentColor : m_color;
+        const sf::Color toColor   = to.transparent ? m_transparentColor : m_color;
+
+        if (m_halfFringe > 0.f)
+            appendQuad(from.positions[0],
+                       from.positions[1],
+                       to.positions[1],
+                       to.positions[0],
+                       {m_transparentColor, fromColor, toColor, m_transparentColor});
+
+        // Thin antialiased strokes have no solid core, only their fringes
+        if (m_innerWidth > 0.f)
+            appendQuad(from.positions[1],
+                       from.positions[2],
+                       to.positions[2],
+                       to.positions[1],
+                       {fromColor, fromColor, toColor, toColor});
+
+        if (m_halfFringe > 0.f)
+            appendQuad(from.positions[2],
+                       from.positions[3],
+                       to.positions[3],
+                       to.positions[2],
+                       {fromColor, m_transparentColor, m_transparentColor, toColor});
+    }
+
+    ////////////////////////////////////////////////////////////
+    struct QuadColors
+    {
+        sf::Color a, b, c, d;
+    };
+
+    ////////////////////////////////////////////////////////////
+    void appendQuad(sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Vector2f d, const QuadColors& colors)
+    {
+        m_output.push_back({a, colors.a});
+        m_output.push_back({b, colors.b});
+        m_output.push_back({c, colors.c});
+
+        m_output.push_back({a, colors.a});
+        m_output.push_back({c, colors.c});
+        m_output.push_back({d, colors.d});
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::vector<sf::Vertex>& m_output;           //!< Vertex array the triangles are appended to
+    sf::Color                m_color;            //!< Color of the stroke
+    sf::Color                m_transparentColor; //!< Color of the stroke with zero alpha, for the fringe
+    float                    m_halfFringe{};     //!< Half the width of the antialiasing fringe
+    float                    m_innerWidth{};     //!< Distance from the center line to the solid edge
+    float                    m_outerWidth{};     //!< Distance from the center line to the outer edge of the fringe
+    Section                  m_previous{};       //!< Last section pushed
+    bool                     m_hasPrevious{};    //!< Was any section pushed yet?
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Largest angle covered by a single triangle of an arc
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] float computeArcStep(float radius, float tolerance)
+{
+    tolerance = sf::base::max(tolerance, 0.01f);
+
+    if (radius <= tolerance)
+        return halfPi;
+
+    // Angle for which the chord stays within `tolerance` of the arc
+    return sf::base::min(2.f * sf::base::acos(radius / (radius + tolerance)), halfPi);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t computeArcSegmentCount(float angle, float arcStep)
+{
+    return sf::base::max(std::size_t{1u}, static_cast<std::size_t>(sf::base::ceil(angle / arcStep)));
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Push the sections of the corner between two segments
+///
+/// When `firstSectionOnly` is set, only the section continuing
+/// the incoming segment is pushed, which closes polygons whose
+/// first corner was already fully pushed.
+///
+////////////////////////////////////////////////////////////
+void appendJoin(SectionWriter&         writer,
+                sf::Vector2f           point,
+                sf::Vector2f           direction0,
+                float                  length0,
+                sf::Vector2f           direction1,
+                float                  length1,
+                const sf::StrokeStyle& style,
+                float                  arcStep,
+                bool                   firstSectionOnly)
+{
+    const sf::Vector2f normal0 = direction0.perpendicular();
+    const sf::Vector2f normal1 = direction1.perpendicular();
+    const float        cross   = direction0.cross(direction1);
+
+    // Collinear segments going the same way need no corner
+    if (sf::base::fabs(cross) < epsilon && direction0.dot(direction1) > 0.f)
+    {
+        writer.push(point, normal0, -normal0);
+        return;
+    }
+
+    // Squared cosine of half the angle between the normals, the miter is as much longer than the half thickness
+    sf::Vector2f miter        = (normal0 + normal1) * 0.5f;
+    const float  miterCosSq   = miter.lengthSq();
+    const float  outerWidth   = writer.getOuterWidth();
+    const float  shortestSide = sf::base::min(length0, length1);
+
+    // The inner corner can meet at the miter point unless it lies beyond the other end of a segment
+    const bool innerMiter = miterCosSq > epsilon && outerWidth * outerWidth <= shortestSide * shortestSide * miterCosSq;
+    const bool outerMiter = style.join == sf::LineJoin::Miter &&
+                            miterCosSq * style.miterLimit * style.miterLimit >= 1.f;
+
+    if (miterCosSq > epsilon)
+        miter /= miterCosSq;
+
+    if (innerMiter && outerMiter)
+    {
+        writer.push(point, miter, -miter);
+        return;
+    }
+
+    // Turning towards side A puts side A inside the corner
+    const float        innerSide = cross > 0.f ? 1.f : -1.f;
+    const sf::Vector2f inner0    = (innerMiter ? miter : normal0) * innerSide;
+    const sf::Vector2f inner1    = (innerMiter ? miter : normal1) * innerSide;
+    const sf::Vector2f outer0    = normal0 * -innerSide;
+    const sf::Vector2f outer1    = normal1 * -innerSide;
+
+    const auto pushSection = [&](sf::Vector2f innerDirection, sf::Vector2f outerDirection)
+    {
+        if (innerSide > 0.f)
+            writer.push(point, innerDirection, outerDirection);
+        else
+            writer.push(point, outerDirection, innerDirection);
+    };
+
+    if (style.join == sf::LineJoin::Round)
+    {
+        pushSection(inner0, outer0);
+
+        if (firstSectionOnly)
+            return;
+
+        const float       angle        = sf::base::acos(sf::base::max(-1.f, sf::base::min(normal0.dot(normal1), 1.f)));
+        const std::size_t segmentCount = computeArcSegmentCount(angle, arcStep);
+
+        // Rotate from the outer normal of the incoming segment to the one of the outgoing segment
+        const float step = angle / static_cast<float>(segmentCount) * (outer0.cross(outer1) >= 0.f ? 1.f : -1.f);
+        const float cos  = sf::base::cos(step);
+        const float sin  = sf::base::sin(step);
+
+        sf::Vector2f outer = outer0;
+
+        for (std::size_t i = 1u; i < segmentCount; ++i)
+        {
+            outer = {outer.x * cos - outer.y * sin, outer.x * sin + outer.y * cos};
+            pushSection(inner1, outer);
+        }
+
+        pushSection(inner1, outer1);
+        return;
+    }
+
+    if (outerMiter)
+    {
+        // Sharp corner whose inner side must fall back to the segment normals
+        pushSection(inner0, miter * -innerSide);
+
+        if (!firstSectionOnly)
+            pushSection(inner1, miter * -innerSide);
+
+        return;
+    }
+
+    // Bevel, also used for miters beyond the limit
+    pushSection(inner0, outer0);
+
+    if (!firstSectionOnly)
+        pushSection(inner1, outer1);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Push the sections of an end of an open stroke
+///
+/// `direction` points away from the stroke, backwards for the
+/// start cap and forwards for the end cap.
+///
+////////////////////////////////////////////////////////////
+void appendCap(SectionWriter&         writer,
+               sf::Vector2f           point,
+               sf::Vector2f           direction,
+               const sf::StrokeStyle& style,
+               float                  arcStep,
+               bool                   isStart)
+{
+    // Side A is on the same side as for the corners, whichever way `direction` points
+    const sf::Vector2f normal = isStart ? -direction.perpendicular() : direction.perpendicular();
+
+    if (style.cap == sf::LineCap::Round)
+    {
+        // Both sides sweep a quarter turn at once, from the tip to the edges or the other way around
+        const std::size_t segmentCount = computeArcSegmentCount(halfPi, arcStep);
+
+        for (std::size_t i = 0u; i <= segmentCount; ++i)
+        {
+            const float ratio = static_cast<float>(i) / static_cast<float>(segmentCount);
+            const float angle = halfPi * (isStart ? 1.f - ratio : ratio);
+
+            const sf::Vector2f along  = direction * sf::base::sin(angle);
+            const sf::Vector2f across = normal * sf::base::cos(angle);
+
+            writer.push(point, across + along, -across + along);
+        }
+
+        return;
+    }
+
+    const float extension  = style.cap == sf::LineCap::Square ? style.thickness * 0.5f : 0.f;
+    const float halfFringe = writer.getHalfFringe();
+
+    // Antialiased ends fade out over the fringe, centered on the end of the stroke
+    if (isStart && halfFringe > 0.f)
+        writer.push(point + direction * (extension + halfFringe), normal, -normal, true);
+
+    writer.push(point + direction * (extension - halfFringe), normal, -normal);
+
+    if (!isStart && halfFringe > 0.f)
+        writer.push(point + direction * (extension + halfFringe), normal, -normal, true);
+}
+
+} // namespace StrokeTessellatorImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+std::size_t StrokeTessellator::appendPolyline(std::vector<Vertex>& output,
+                                              const Vector2f*      points,
+                                              std::size_t          pointCount,
+                                              const StrokeStyle&   style)
+{
+    return append(output, points, pointCount, style, /* closed */ false);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t StrokeTessellator::appendPolygon(std::vector<Vertex>& output,
+                                             const Vector2f*      points,
+                                             std::size_t          pointCount,
+                                             const StrokeStyle&   style)
+{
+    return append(output, points, pointCount, style, /* closed */ true);
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t StrokeTessellator::append(std::vector<Vertex>& output,
+                                      const Vector2f*      points,
+                                      std::size_t          pointCount,
+                                      const StrokeStyle&   style,
+                                      bool                 closed)
+{
+    using namespace StrokeTessellatorImpl;
+
+    // Drop consecutive duplicates, their segments have no direction
+    m_pathPoints.clear();
+
+    for (std::size_t i = 0u; i < pointCount; ++i)
+        if (m_pathPoints.empty() || (points[i] - m_pathPoints.back().position).lengthSq() > epsilon)
+            m_pathPoints.push_back({points[i], {}, 0.f});
+
+    if (closed && m_pathPoints.size() > 1u &&
+        (m_pathPoints.front().position - m_pathPoints.back().position).lengthSq() <= epsilon)
+        m_pathPoints.pop_back();
+
+    if (closed && m_pathPoints.size() < 3u)
+        closed = false;
+
+    const std::size_t count = m_pathPoints.size();
+
+    if (count < 2u)
+        return 0u;
+
+    const std::size_t segmentCount = closed ? count : count - 1u;
+
+    for (std::size_t i = 0u; i < segmentCount; ++i)
+    {
+        PathPoint&     pathPoint = m_pathPoints[i];
+        const Vector2f delta     = m_pathPoints[i + 1u == count ? 0u : i + 1u].position - pathPoint.position;
+
+        pathPoint.length    = delta.length();
+        pathPoint.direction = delta / pathPoint.length;
+    }
+
+    const std::size_t initialSize = output.size();
+
+    SectionWriter writer(output, style);
+    const float   arcStep = computeArcStep(writer.getOuterWidth(), style.roundTolerance);
+
+    const auto appendCorner = [&](std::size_t index, bool firstSectionOnly)
+    {
+        const PathPoint& incoming = m_pathPoints[index == 0u ? count - 1u : index - 1u];
+        const PathPoint& outgoing = m_pathPoints[index];
+
+        appendJoin(writer,
+                   outgoing.position,
+                   incoming.direction,
+                   incoming.length,
+                   outgoing.direction,
+                   outgoing.length,
+                   style,
+                   arcStep,
+                   firstSectionOnly);
+    };
+
+    if (closed)
+    {
+        for (std::size_t i = 0u; i < count; ++i)
+            appendCorner(i, /* firstSectionOnly */ false);
+
+        // Connect the last segment to the first corner
+        appendCorner(0u, /* firstSectionOnly */ true);
+    }
+    else
+    {
+        const PathPoint& first = m_pathPoints.front();
+        appendCap(writer, first.position, -first.direction, style, arcStep, /* isStart */ true);
+
+        for (std::size_t i = 1u; i < count - 1u; ++i)
+            appendCorner(i, /* firstSectionOnly */ false);
+
+        const PathPoint& last = m_pathPoints.back();
+        appendCap(writer, last.position, m_pathPoints[count - 2u].direction, style, arcStep, /* isStart */ false);
+    }
+
+    return output.size() - initialSize;
+}
+
+} // namespace sf
@@ -6,6 +6,7 @@
 #include "SFML/Graphics/Color.hpp"
 #include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/Glyph.hpp"
+#include "SFML/Graphics/ImagePixelOps.hpp"
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
@@ -30,6 +31,18 @@
 
 namespace
 {
+// Get the color to store in the vertices, premultiplied if the font glyph pages are
+[[nodiscard]] sf::Color toVertexColor(sf::Color color, const sf::Font& font)
+{
+    if (!font.isAlphaPremultiplied())
+        return color;
+
+    return {sf::priv::mulDiv255(color.r, color.a),
+            sf::priv::mulDiv255(color.g, color.a),
+            sf::priv::mulDiv255(color.b, color.a),
+            color.a};
+}
+
 // Add an underline or strikethrough line to the vertex array
 void addLine(std::vector<sf::Vertex>& vertices,
              std::size_t&             index,
@@ -232,8 +245,10 @@ void Text::setFillColor(Color color)
     // (if geometry is updated anyway, we can skip this step)
     if (!m_impl->geometryNeedUpdate)
     {
+        const Color vertexColor = toVertexColor(m_impl->fillColor, *m_impl->font);
+
         for (std::size_t i = m_impl->fillVerticesStartIndex; i < m_impl->vertices.size(); ++i)
-            m_impl->vertices[i].color = m_impl->fillColor;
+            m_impl->vertices[i].color = vertexColor;
     }
 }
 
@@ -250,8 +265,10 @@ void Text::setOutlineColor(Color color)
     // (if geometry is updated anyway, we can skip this step)
     if (!m_impl->geometryNeedUpdate)
     {
+        const Color vertexColor = toVertexColor(m_impl->outlineColor, *m_impl->font);
+
         for (std::size_t i = 0; i < m_impl->fillVerticesStartIndex; ++i)
-            m_impl->vertices[i].color = m_impl->outlineColor;
+            m_impl->vertices[i].color = vertexColor;
     }
 }
 
@@ -548,12 +565,15 @@ void Text::ensureGeometryUpdate() const
 
     std::uint32_t prevChar = 0;
 
-    const auto addLines = [this, &currFillIndex, &currOutlineIndex, &x, &y, &underlineThickness](float offset)
+    const Color fillVertexColor    = toVertexColor(m_impl->fillColor, *m_impl->font);
+    const Color outlineVertexColor = toVertexColor(m_impl->outlineColor, *m_impl->font);
+
+    const auto addLines = [&](float offset)
     {
-        addLine(m_impl->vertices, currFillIndex, x, y, m_impl->fillColor, offset, underlineThickness);
+        addLine(m_impl->vertices, currFillIndex, x, y, fillVertexColor, offset, underlineThickness);
 
         if (m_impl->outlineThickness != 0)
-            addLine(m_impl->vertices, currOutlineIndex, x, y, m_impl->outlineColor, offset, underlineThickness, m_impl->outlineThickness);
+            addLine(m_impl->vertices, currOutlineIndex, x, y, outlineVertexColor, offset, underlineThickness, m_impl->outlineThickness);
     };
 
     for (const std::uint32_t curChar : m_impl->string)
@@ -613,14 +633,14 @@ void Text::ensureGeometryUpdate() const
             const Glyph& glyph = m_impl->font->getGlyph(curChar, m_impl->characterSize, isBold, m_impl->outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_impl->vertices, currOutlineIndex, Vector2f{x, y}, m_impl->outlineColor, glyph, italicShear);
+            addGlyphQuad(m_impl->vertices, currOutlineIndex, Vector2f{x, y}, outlineVertexColor, glyph, italicShear);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = m_impl->font->getGlyph(curChar, m_impl->characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_impl->vertices, currFillIndex, Vector2f{x, y}, m_impl->fillColor, glyph, italicShear);
+        addGlyphQuad(m_impl->vertices, currFillIndex, Vector2f{x, y}, fillVertexColor, glyph, italicShear);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
@@ -5,11 +5,14 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImagePixelOps.hpp"
+#include "SFML/Graphics/ImageView.hpp"
 #include "SFML/Graphics/Texture.hpp"
 #include "SFML/Graphics/TextureSaver.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 #include "SFML/Window/Window.hpp"
 
 #include "SFML/System/Err.hpp"
@@ -39,6 +42,39 @@ std::uint64_t getUniqueId() noexcept
 
     return id.fetch_add(1);
 }
+
+
+////////////////////////////////////////////////////////////
+struct GlFormat
+{
+    GLint  internalFormat; //!< Format of the texels in video memory
+    GLenum format;         //!< Layout of the pixels passed to `glTexImage2D`
+    GLenum type;           //!< Type of the components passed to `glTexImage2D`
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] GlFormat getGlFormat(sf::TextureFormat format, bool sRgb)
+{
+    switch (format)
+    {
+        case sf::TextureFormat::RGBA8:
+            return {sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE};
+
+        case sf::TextureFormat::RGBA16F:
+            return {GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT};
+
+        case sf::TextureFormat::R11FG11FB10F:
+            return {GL_R11F_G11F_B10F, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV};
+
+        case sf::TextureFormat::R8:
+            return {GL_R8, GL_RED, GL_UNSIGNED_BYTE};
+    }
+
+    SFML_BASE_ASSERT(false && "Unknown texture format");
+    return {GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE};
+}
+
 } // namespace TextureImpl
 } // namespace
 
@@ -51,12 +87,14 @@ Texture::Texture(base::PassKey<Texture>&&,
                  Vector2u         size,
                  Vector2u         actualSize,
                  unsigned int     texture,
+                 TextureFormat    format,
                  bool             sRgb) :
 m_graphicsContext(&graphicsContext),
 m_size(size),
 m_actualSize(actualSize),
 m_texture(texture),
 m_sRgb(sRgb),
+m_format(format),
 m_cacheId(TextureImpl::getUniqueId())
 {
 }
@@ -67,13 +105,15 @@ Texture::Texture(const Texture& rhs) :
 m_graphicsContext(rhs.m_graphicsContext),
 m_isSmooth(rhs.m_isSmooth),
 m_sRgb(rhs.m_sRgb),
+m_format(rhs.m_format),
 m_isRepeated(rhs.m_isRepeated),
 m_cacheId(TextureImpl::getUniqueId())
 {
-    if (base::Optional texture = create(*m_graphicsContext, rhs.getSize(), rhs.isSrgb()))
+    if (base::Optional texture = create(*m_graphicsContext, rhs.getSize(), rhs.getFormat(), rhs.isSrgb()))
     {
         *this = SFML_BASE_MOVE(*texture);
         update(rhs);
+        m_premultipliedAlpha = rhs.m_premultipliedAlpha;
     }
     else
     {
@@ -92,6 +132,7 @@ Texture::~Texture()
 
         const GLuint texture = m_texture;
         glCheck(glDeleteTextures(1, &texture));
+        priv::GLStateCache::invalidateObjectBindings();
     }
 }
 
@@ -103,10 +144,12 @@ m_actualSize(base::exchange(right.m_actualSize, {})),
 m_texture(base::exchange(right.m_texture, 0u)),
 m_isSmooth(base::exchange(right.m_isSmooth, false)),
 m_sRgb(base::exchange(right.m_sRgb, false)),
+m_format(base::exchange(right.m_format, TextureFormat::RGBA8)),
 m_isRepeated(base::exchange(right.m_isRepeated, false)),
 m_pixelsFlipped(base::exchange(right.m_pixelsFlipped, false)),
 m_fboAttachment(base::exchange(right.m_fboAttachment, false)),
 m_hasMipmap(base::exchange(right.m_hasMipmap, false)),
+m_premultipliedAlpha(base::exchange(right.m_premultipliedAlpha, false)),
 m_cacheId(base::exchange(right.m_cacheId, 0u))
 {
 }
@@ -127,20 +170,23 @@ Texture& Texture::operator=(Texture&& right) noexcept
 
         const GLuint texture = m_texture;
         glCheck(glDeleteTextures(1, &texture));
+        priv::GLStateCache::invalidateObjectBindings();
     }
 
     // Move old to new.
-    m_graphicsContext = right.m_graphicsContext;
-    m_size            = base::exchange(right.m_size, {});
-    m_actualSize      = base::exchange(right.m_actualSize, {});
-    m_texture         = base::exchange(right.m_texture, 0u);
-    m_isSmooth        = base::exchange(right.m_isSmooth, false);
-    m_sRgb            = base::exchange(right.m_sRgb, false);
-    m_isRepeated      = base::exchange(right.m_isRepeated, false);
-    m_pixelsFlipped   = base::exchange(right.m_pixelsFlipped, false);
-    m_fboAttachment   = base::exchange(right.m_fboAttachment, false);
-    m_hasMipmap       = base::exchange(right.m_hasMipmap, false);
-    m_cacheId         = base::exchange(right.m_cacheId, 0u);
+    m_graphicsContext    = right.m_graphicsContext;
+    m_size               = base::exchange(right.m_size, {});
+    m_actualSize         = base::exchange(right.m_actualSize, {});
+    m_texture            = base::exchange(right.m_texture, 0u);
+    m_isSmooth           = base::exchange(right.m_isSmooth, false);
+    m_sRgb               = base::exchange(right.m_sRgb, false);
+    m_format             = base::exchange(right.m_format, TextureFormat::RGBA8);
+    m_isRepeated         = base::exchange(right.m_isRepeated, false);
+    m_pixelsFlipped      = base::exchange(right.m_pixelsFlipped, false);
+    m_fboAttachment      = base::exchange(right.m_fboAttachment, false);
+    m_hasMipmap          = base::exchange(right.m_hasMipmap, false);
+    m_premultipliedAlpha = base::exchange(right.m_premultipliedAlpha, false);
+    m_cacheId            = base::exchange(right.m_cacheId, 0u);
 
     return *this;
 }
@@ -148,6 +194,25 @@ Texture& Texture::operator=(Texture&& right) noexcept
 
 ////////////////////////////////////////////////////////////
 base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector2u size, bool sRgb)
+{
+    return createImpl(graphicsContext, size, TextureFormat::RGBA8, sRgb, /* allocateStorage */ true);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector2u size, TextureFormat format, bool sRgb)
+{
+    return createImpl(graphicsContext, size, format, sRgb, /* allocateStorage */ true);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Texture> Texture::createImpl(
+    GraphicsContext& graphicsContext,
+    Vector2u         size,
+    TextureFormat    format,
+    bool             sRgb,
+    bool             allocateStorage)
 {
     base::Optional<Texture> result; // Use a single local variable for NRVO
 
@@ -174,6 +239,15 @@ base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector
         return result; // Empty optional
     }
 
+    // Levels are allocated individually, their sizes must follow the public size
+    if (!allocateStorage && actualSize != size)
+    {
+        priv::err() << "Failed to create texture, mipmap levels cannot be allocated without support for "
+                    << "non power of two textures";
+
+        return result; // Empty optional
+    }
+
 
     // Create the OpenGL texture
     GLuint glTexture = 0;
@@ -181,25 +255,39 @@ base::Optional<Texture> Texture::create(GraphicsContext& graphicsContext, Vector
     SFML_BASE_ASSERT(glTexture);
 
     // All the validity checks passed, we can store the new texture settings
-    result.emplace(base::PassKey<Texture>{}, graphicsContext, size, actualSize, glTexture, sRgb);
+    // sRGB conversion is only defined for 8-bit color channels
+    result.emplace(base::PassKey<Texture>{},
+                   graphicsContext,
+                   size,
+                   actualSize,
+                   glTexture,
+                   format,
+                   sRgb && format == TextureFormat::RGBA8);
     Texture& texture = *result;
 
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{graphicsContext};
 
     const GLint textureWrapParam = GLEXT_GL_CLAMP_TO_EDGE;
 
     // Initialize the texture
-    glCheck(glBindTexture(GL_TEXTURE_2D, texture.m_texture));
-    glCheck(glTexImage2D(GL_TEXTURE_2D,
-                         0,
-                         (texture.m_sRgb ? GLEXT_GL_SRGB8_ALPHA8 : GL_RGBA),
-                         static_cast<GLsizei>(texture.m_actualSize.x),
-                         static_cast<GLsizei>(texture.m_actualSize.y),
-                         0,
-                         GL_RGBA,
-                         GL_UNSIGNED_BYTE,
-                         nullptr));
+    graphicsContext.getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, texture.m_texture);
+
+    if (allocateStorage)
+    {
+        const TextureImpl::GlFormat glFormat = TextureImpl::getGlFormat(texture.m_format, texture.m_sRgb);
+
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             0,
+                             glFormat.internalFormat,
+                             static_cast<GLsizei>(texture.m_actualSize.x),
+                             static_cast<GLsizei>(texture.m_actualSize.y),
+                             0,
+                             glFormat.format,
+                             glFormat.type,
+                             nullptr));
+    }
+
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
@@ -266,6 +354,7 @@ base::Optional<Texture> Texture::loadFromImage(GraphicsContext& graphicsContext,
         if ((result = sf::Texture::create(graphicsContext, image.getSize(), sRgb)))
         {
             result->update(image);
+            result->m_premultipliedAlpha = image.isAlphaPremultiplied();
             return result;
         }
 
@@ -282,29 +371,11 @@ base::Optional<Texture> Texture::loadFromImage(GraphicsContext& graphicsContext,
     rectangle.size.x     = base::min(rectangle.size.x, size.x - rectangle.position.x);
     rectangle.size.y     = base::min(rectangle.size.y, size.y - rectangle.position.y);
 
-    // Create the texture and upload the pixels
+    // Create the texture and upload the pixels, directly from the rows of the source image
     if ((result = sf::Texture::create(graphicsContext, rectangle.size.to<Vector2u>(), sRgb)))
     {
-        SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
-
-        // Make sure that the current texture binding will be preserved
-        const priv::TextureSaver save;
-
-        // Copy the pixels to the texture, row by row
-        const std::uint8_t* pixels = image.getPixelsPtr() + 4 * (rectangle.position.x + (size.x * rectangle.position.y));
-        glCheck(glBindTexture(GL_TEXTURE_2D, result->m_texture));
-        for (int i = 0; i < rectangle.size.y; ++i)
-        {
-            glCheck(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, i, rectangle.size.x, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            pixels += 4 * size.x;
-        }
-
-        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
-        result->m_hasMipmap = false;
-
-        // Force an OpenGL flush, so that the texture will appear updated
-        // in all contexts immediately (solves problems in multi-threaded apps)
-        glCheck(glFlush());
+        result->update(image.asImageView().getSubView(rectangle.position.to<Vector2u>(), rectangle.size.to<Vector2u>()));
+        result->m_premultipliedAlpha = image.isAlphaPremultiplied();
     }
 
     // Error message generated in called function.
@@ -328,7 +399,7 @@ Image Texture::copyToImage() const
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{*m_graphicsContext};
 
     // Create an array of pixels
     std::vector<std::uint8_t> pixels(m_size.x * m_size.y * 4);
@@ -378,7 +449,7 @@ Image Texture::copyToImage() const
     if ((m_size == m_actualSize) && !m_pixelsFlipped)
     {
         // Texture is not padded nor flipped, we can use a direct copy
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
         glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
     }
     else
@@ -387,7 +458,7 @@ Image Texture::copyToImage() const
 
         // All the pixels will first be copied to a temporary array
         std::vector<std::uint8_t> allPixels(m_actualSize.x * m_actualSize.y * 4);
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
         glCheck(glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, allPixels.data()));
 
         // Then we copy the useful pixels from the temporary array to the final one
@@ -415,6 +486,7 @@ Image Texture::copyToImage() const
 
     auto result = sf::Image::create(m_size, pixels.data());
     SFML_BASE_ASSERT(result.hasValue());
+    result->setAlphaPremultiplied(m_premultipliedAlpha);
     return SFML_BASE_MOVE(*result);
 }
 
@@ -430,30 +502,58 @@ void Texture::update(const std::uint8_t* pixels)
 ////////////////////////////////////////////////////////////
 void Texture::update(const std::uint8_t* pixels, Vector2u size, Vector2u dest)
 {
-    SFML_BASE_ASSERT(dest.x + size.x <= m_size.x && "Destination x coordinate is outside of texture");
-    SFML_BASE_ASSERT(dest.y + size.y <= m_size.y && "Destination y coordinate is outside of texture");
+    update(ImageView{pixels, size}, dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::update(ImageView view, Vector2u dest)
+{
+    SFML_BASE_ASSERT(dest.x + view.size.x <= m_size.x && "Destination x coordinate is outside of texture");
+    SFML_BASE_ASSERT(dest.y + view.size.y <= m_size.y && "Destination y coordinate is outside of texture");
 
-    SFML_BASE_ASSERT(pixels != nullptr);
+    SFML_BASE_ASSERT(view.pixels != nullptr);
+    SFML_BASE_ASSERT(view.getRowStride() % 4u == 0u && "Row stride must be a multiple of the pixel size");
 
     SFML_BASE_ASSERT(m_texture);
     SFML_BASE_ASSERT(glCheckExpr(glIsTexture(m_texture)));
 
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
+#ifdef SFML_OPENGL_ES
+    // BGRA uploads are an optional extension in OpenGL ES, convert on the CPU instead
+    std::vector<std::uint8_t> convertedPixels;
+    if (view.format == PixelFormat::BGRA)
+        view = ImageView{priv::getPackedRgbaPixels(view, convertedPixels), view.size};
+
+    const GLenum format = GL_RGBA;
+#else
+    const GLenum format = view.format == PixelFormat::BGRA ? GL_BGRA : GL_RGBA;
+#endif
+
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{*m_graphicsContext};
+
+    // Let the driver skip the padding between rows, rather than uploading them one by one
+    const bool hasRowPadding = !view.isContiguous();
+    if (hasRowPadding)
+        glCheck(glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(view.getRowStride() / 4u)));
 
     // Copy pixels from the given array to the texture
-    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
     glCheck(glTexSubImage2D(GL_TEXTURE_2D,
                             0,
                             static_cast<GLint>(dest.x),
                             static_cast<GLint>(dest.y),
-                            static_cast<GLsizei>(size.x),
-                            static_cast<GLsizei>(size.y),
-                            GL_RGBA,
+                            static_cast<GLsizei>(view.size.x),
+                            static_cast<GLsizei>(view.size.y),
+                            format,
                             GL_UNSIGNED_BYTE,
-                            pixels));
+                            view.pixels));
+
+    if (hasRowPadding)
+        glCheck(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_hasMipmap     = false;
     m_pixelsFlipped = false;
@@ -532,11 +632,9 @@ bool Texture::update(const Texture& texture, Vector2u dest)
     {
         // Scissor testing affects framebuffer blits as well
         // Since we don't want scissor testing to interfere with our copying, we temporarily disable it for the blit if it is enabled
-        GLboolean scissorEnabled = GL_FALSE;
-        glCheck(glGetBooleanv(GL_SCISSOR_TEST, &scissorEnabled));
-
-        if (scissorEnabled == GL_TRUE)
-            glCheck(glDisable(GL_SCISSOR_TEST));
+        priv::GLStateCache& stateCache     = m_graphicsContext->getActiveGLStateCache();
+        const bool          scissorEnabled = stateCache.isEnabled(GL_SCISSOR_TEST);
+        stateCache.setEnabled(GL_SCISSOR_TEST, false);
 
         // Blit the texture contents from the source to the destination texture
         glCheck(GLEXT_glBlitFramebuffer(0,
@@ -551,8 +649,7 @@ bool Texture::update(const Texture& texture, Vector2u dest)
                                         GL_NEAREST));
 
         // Re-enable scissor testing if it was previously enabled
-        if (scissorEnabled == GL_TRUE)
-            glCheck(glEnable(GL_SCISSOR_TEST));
+        stateCache.setEnabled(GL_SCISSOR_TEST, scissorEnabled);
     }
     else
     {
@@ -569,10 +666,10 @@ bool Texture::update(const Texture& texture, Vector2u dest)
     glCheck(GLEXT_glDeleteFramebuffers(1, &destFrameBuffer));
 
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{*m_graphicsContext};
 
     // Set the parameters of this texture
-    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
     m_hasMipmap     = false;
     m_pixelsFlipped = false;
@@ -588,14 +685,20 @@ bool Texture::update(const Texture& texture, Vector2u dest)
 ////////////////////////////////////////////////////////////
 void Texture::update(const Image& image)
 {
-    // Update the whole texture
-    update(image.getPixelsPtr(), image.getSize(), {0u, 0u});
+    // An image covering the whole texture replaces its alpha encoding, a smaller one must match it
+    if (image.getSize() == m_size)
+        m_premultipliedAlpha = image.isAlphaPremultiplied();
+
+    update(image, {0u, 0u});
 }
 
 
 ////////////////////////////////////////////////////////////
 void Texture::update(const Image& image, Vector2u dest)
 {
+    SFML_BASE_ASSERT(image.isAlphaPremultiplied() == m_premultipliedAlpha &&
+                     "Texture::update() image and texture must use the same alpha encoding");
+
     update(image.getPixelsPtr(), image.getSize(), dest);
 }
 
@@ -661,11 +764,9 @@ bool Texture::update(const Window& window, Vector2u dest)
         {
             // Scissor testing affects framebuffer blits as well
             // Since we don't want scissor testing to interfere with our copying, we temporarily disable it for the blit if it is enabled
-            GLboolean scissorEnabled = GL_FALSE;
-            glCheck(glGetBooleanv(GL_SCISSOR_TEST, &scissorEnabled));
-
-            if (scissorEnabled == GL_TRUE)
-                glCheck(glDisable(GL_SCISSOR_TEST));
+            priv::GLStateCache& stateCache     = m_graphicsContext->getActiveGLStateCache();
+            const bool          scissorEnabled = stateCache.isEnabled(GL_SCISSOR_TEST);
+            stateCache.setEnabled(GL_SCISSOR_TEST, false);
 
             // Blit the texture contents from the source to the destination texture
             glCheck(GLEXT_glBlitFramebuffer(0,
@@ -680,8 +781,7 @@ bool Texture::update(const Window& window, Vector2u dest)
                                             GL_NEAREST));
 
             // Re-enable scissor testing if it was previously enabled
-            if (scissorEnabled == GL_TRUE)
-                glCheck(glEnable(GL_SCISSOR_TEST));
+            stateCache.setEnabled(GL_SCISSOR_TEST, scissorEnabled);
         }
         else
         {
@@ -696,10 +796,10 @@ bool Texture::update(const Window& window, Vector2u dest)
         glCheck(GLEXT_glDeleteFramebuffers(1, &destFrameBuffer));
 
         // Make sure that the current texture binding will be preserved
-        const priv::TextureSaver save;
+        const priv::TextureSaver save{*m_graphicsContext};
 
         // Set the parameters of this texture
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
         glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
         m_hasMipmap     = false;
         m_pixelsFlipped = true;
@@ -708,10 +808,10 @@ bool Texture::update(const Window& window, Vector2u dest)
     else
     {
         // Make sure that the current texture binding will be preserved
-        const priv::TextureSaver save;
+        const priv::TextureSaver save{*m_graphicsContext};
 
         // Copy pixels from the back-buffer to the texture
-        glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+        m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
         glCheck(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0u));
         glCheck(glCopyTexSubImage2D(GL_TEXTURE_2D,
                                     0,
@@ -747,9 +847,9 @@ void Texture::setSmooth(bool smooth)
             SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
             // Make sure that the current texture binding will be preserved
-            const priv::TextureSaver save;
+            const priv::TextureSaver save{*m_graphicsContext};
 
-            glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+            m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
             glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
 
             if (m_hasMipmap)
@@ -774,6 +874,20 @@ bool Texture::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Texture::setAlphaPremultiplied(bool premultiplied)
+{
+    m_premultipliedAlpha = premultiplied;
+}
+
+
+////////////////////////////////////////////////////////////
+bool Texture::isAlphaPremultiplied() const
+{
+    return m_premultipliedAlpha;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Texture::isSrgb() const
 {
@@ -781,6 +895,13 @@ bool Texture::isSrgb() const
 }
 
 
+////////////////////////////////////////////////////////////
+TextureFormat Texture::getFormat() const
+{
+    return m_format;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::setRepeated(bool repeated)
 {
@@ -793,7 +914,7 @@ void Texture::setRepeated(bool repeated)
             SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
             // Make sure that the current texture binding will be preserved
-            const priv::TextureSaver save;
+            const priv::TextureSaver save{*m_graphicsContext};
 
             static const bool textureEdgeClamp = GLEXT_texture_edge_clamp;
 
@@ -818,7 +939,7 @@ void Texture::setRepeated(bool repeated)
             const GLint textureWrapParam = m_isRepeated ? GL_REPEAT : GLEXT_GL_CLAMP_TO_EDGE;
 #endif
 
-            glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+            m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
             glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, textureWrapParam));
             glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, textureWrapParam));
         }
@@ -848,9 +969,9 @@ bool Texture::generateMipmap()
     }
 
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{*m_graphicsContext};
 
-    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
     glCheck(GLEXT_glGenerateMipmap(GL_TEXTURE_2D));
     glCheck(glTexParameteri(GL_TEXTURE_2D,
                             GL_TEXTURE_MIN_FILTER,
@@ -871,9 +992,9 @@ void Texture::invalidateMipmap()
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
     // Make sure that the current texture binding will be preserved
-    const priv::TextureSaver save;
+    const priv::TextureSaver save{*m_graphicsContext};
 
-    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
 
     m_hasMipmap = false;
@@ -881,20 +1002,103 @@ void Texture::invalidateMipmap()
 
 
 ////////////////////////////////////////////////////////////
-void Texture::bind([[maybe_unused]] GraphicsContext& graphicsContext) const
+void Texture::uploadMipLevel(unsigned int level, ImageView view)
+{
+    SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(m_format == TextureFormat::RGBA8);
+    SFML_BASE_ASSERT(view.pixels != nullptr && view.format == PixelFormat::RGBA && view.isContiguous());
+    SFML_BASE_ASSERT(view.size.x == base::max(m_size.x >> level, 1u) && view.size.y == base::max(m_size.y >> level, 1u));
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save{*m_graphicsContext};
+
+    const TextureImpl::GlFormat glFormat = TextureImpl::getGlFormat(m_format, m_sRgb);
+
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
+    glCheck(glTexImage2D(GL_TEXTURE_2D,
+                         static_cast<GLint>(level),
+                         glFormat.internalFormat,
+                         static_cast<GLsizei>(view.size.x),
+                         static_cast<GLsizei>(view.size.y),
+                         0,
+                         glFormat.format,
+                         glFormat.type,
+                         view.pixels));
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::releaseMipLevel(unsigned int level)
+{
+    SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save{*m_graphicsContext};
+
+    const TextureImpl::GlFormat glFormat = TextureImpl::getGlFormat(m_format, m_sRgb);
+
+    // Respecifying the level as empty lets the driver free its memory
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
+    glCheck(glTexImage2D(GL_TEXTURE_2D,
+                         static_cast<GLint>(level),
+                         glFormat.internalFormat,
+                         0,
+                         0,
+                         0,
+                         glFormat.format,
+                         glFormat.type,
+                         nullptr));
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::setMipLevelRange(unsigned int baseLevel, unsigned int maxLevel)
+{
+    SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(baseLevel <= maxLevel);
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save{*m_graphicsContext};
+
+    m_graphicsContext->getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, static_cast<GLint>(baseLevel)));
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(maxLevel)));
+
+    // Only filter between levels if there is more than one
+    m_hasMipmap = baseLevel < maxLevel;
+
+    if (m_hasMipmap)
+    {
+        glCheck(glTexParameteri(GL_TEXTURE_2D,
+                                GL_TEXTURE_MIN_FILTER,
+                                m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+    }
+    else
+    {
+        glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void Texture::bind(GraphicsContext& graphicsContext) const
 {
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
     SFML_BASE_ASSERT(m_texture);
 
-    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+    graphicsContext.getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, m_texture);
 }
 
 
 ////////////////////////////////////////////////////////////
-void Texture::unbind([[maybe_unused]] GraphicsContext& graphicsContext)
+void Texture::unbind(GraphicsContext& graphicsContext)
 {
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
-    glCheck(glBindTexture(GL_TEXTURE_2D, 0));
+    graphicsContext.getActiveGLStateCache().bindTexture(GL_TEXTURE_2D, 0u);
 }
 
 ////////////////////////////////////////////////////////////
@@ -944,10 +1148,12 @@ void Texture::swap(Texture& right) noexcept
     std::swap(m_texture, right.m_texture);
     std::swap(m_isSmooth, right.m_isSmooth);
     std::swap(m_sRgb, right.m_sRgb);
+    std::swap(m_format, right.m_format);
     std::swap(m_isRepeated, right.m_isRepeated);
     std::swap(m_pixelsFlipped, right.m_pixelsFlipped);
     std::swap(m_fboAttachment, right.m_fboAttachment);
     std::swap(m_hasMipmap, right.m_hasMipmap);
+    std::swap(m_premultipliedAlpha, right.m_premultipliedAlpha);
     std::swap(m_cacheId, right.m_cacheId);
 }
 
@@ -3,15 +3,18 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/TextureSaver.hpp"
 
-#include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
-TextureSaver::TextureSaver() : m_textureBinding(static_cast<int>(priv::getGLInteger(GL_TEXTURE_BINDING_2D)))
+TextureSaver::TextureSaver(GraphicsContext& graphicsContext) :
+m_stateCache(graphicsContext.getActiveGLStateCache()),
+m_textureBinding(m_stateCache.getTexture2D())
 {
 }
 
@@ -19,7 +22,7 @@ TextureSaver::TextureSaver() : m_textureBinding(static_cast<int>(priv::getGLInte
 ////////////////////////////////////////////////////////////
 TextureSaver::~TextureSaver()
 {
-    glCheck(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(m_textureBinding)));
+    m_stateCache.bindTexture(GL_TEXTURE_2D, m_textureBinding);
 }
 
 } // namespace sf::priv
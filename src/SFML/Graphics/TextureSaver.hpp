@@ -2,6 +2,20 @@
 #include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
 
 
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+} // namespace sf
+
+namespace sf::priv
+{
+class GLStateCache;
+} // namespace sf::priv
+
+
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
@@ -12,12 +26,12 @@ class TextureSaver
 {
 public:
     ////////////////////////////////////////////////////////////
-    /// \brief Default constructor
+    /// \brief Constructor
     ///
-    /// The current texture binding is saved.
+    /// The current texture binding of the active context is saved.
     ///
     ////////////////////////////////////////////////////////////
-    TextureSaver();
+    explicit TextureSaver(GraphicsContext& graphicsContext);
 
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
@@ -27,11 +41,24 @@ public:
     ////////////////////////////////////////////////////////////
     ~TextureSaver();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureSaver(const TextureSaver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureSaver& operator=(const TextureSaver&) = delete;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    int m_textureBinding{}; //!< Texture binding to restore
+    GLStateCache& m_stateCache;     //!< State cache of the active context
+    unsigned int  m_textureBinding; //!< Texture binding to restore
 };
 
 } // namespace sf::priv
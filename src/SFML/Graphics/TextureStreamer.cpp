@@ -0,0 +1,332 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/MipChain.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureStreamer.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct TextureStreamer::Entry
+{
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLastLevel() const
+    {
+        return mipChain->getLevelCount() - 1u;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isLive() const
+    {
+        return texture.hasValue();
+    }
+
+    base::Optional<MipChain> mipChain;            //!< Source of the levels, empty for removed entries
+    base::Optional<Texture>  texture;             //!< Streamed texture, empty for removed entries
+    unsigned int             residentLevel{};     //!< Largest level in video memory
+    unsigned int             desiredLevel{};      //!< Largest level needed by the last requests
+    std::size_t              residentByteCount{}; //!< Video memory used by the resident levels
+    std::uint64_t            lastRequestFrame{};  //!< Frame of the last request, 0 if never requested
+    std::uint64_t            lastRefineFrame{};   //!< Frame of the last refinement attempt
+};
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::TextureStreamer(GraphicsContext& graphicsContext, std::size_t memoryBudget, std::size_t uploadBudget) :
+m_graphicsContext(&graphicsContext),
+m_memoryBudget(memoryBudget),
+m_uploadBudget(uploadBudget)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::~TextureStreamer() = default;
+
+
+////////////////////////////////////////////////////////////
+base::Optional<TextureStreamer::Id> TextureStreamer::add(MipChain&& mipChain, bool sRgb)
+{
+    base::Optional<Texture> texture = Texture::createImpl(*m_graphicsContext,
+                                                          mipChain.getSize(),
+                                                          TextureFormat::RGBA8,
+                                                          sRgb,
+                                                          /* allocateStorage */ false);
+
+    if (!texture.hasValue())
+    {
+        priv::err() << "Failed to add streamed texture";
+        return base::nullOpt;
+    }
+
+    // Make the texture drawable right away with its smallest level, which is nearly free
+    const unsigned int lastLevel = mipChain.getLevelCount() - 1u;
+
+    texture->uploadMipLevel(lastLevel, mipChain.getLevel(lastLevel).asImageView());
+    texture->setMipLevelRange(lastLevel, lastLevel);
+    texture->setAlphaPremultiplied(mipChain.getLevel(0u).isAlphaPremultiplied());
+
+    Id id = m_entries.size();
+
+    if (m_freeIds.empty())
+    {
+        m_entries.emplace_back();
+    }
+    else
+    {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+
+    Entry& entry = m_entries[id];
+
+    entry.residentByteCount = mipChain.getLevelByteCount(lastLevel);
+    entry.residentLevel     = lastLevel;
+    entry.desiredLevel      = lastLevel;
+    entry.lastRequestFrame  = 0u;
+    entry.lastRefineFrame   = 0u;
+    entry.mipChain.emplace(SFML_BASE_MOVE(mipChain));
+    entry.texture.emplace(SFML_BASE_MOVE(*texture));
+
+    m_residentByteCount += entry.residentByteCount;
+    ++m_textureCount;
+
+    return base::makeOptional(id);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::remove(Id id)
+{
+    Entry& entry = getEntry(id);
+
+    m_residentByteCount -= entry.residentByteCount;
+    --m_textureCount;
+
+    entry.texture.reset();
+    entry.mipChain.reset();
+    entry.residentByteCount = 0u;
+
+    m_freeIds.push_back(id);
+}
+
+
+////////////////////////////////////////////////////////////
+const Texture& TextureStreamer::getTexture(Id id) const
+{
+    return *getEntry(id).texture;
+}
+
+
+////////////////////////////////////////////////////////////
+const MipChain& TextureStreamer::getMipChain(Id id) const
+{
+    return *getEntry(id).mipChain;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::request(Id id, Vector2f displaySize)
+{
+    Entry&             entry = getEntry(id);
+    const unsigned int level = entry.mipChain->selectLevel(displaySize);
+
+    // The first request of the frame replaces the previous frame's level, the next ones can only refine it
+    if (entry.lastRequestFrame != m_frame || level < entry.desiredLevel)
+        entry.desiredLevel = level;
+
+    entry.lastRequestFrame = m_frame;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::update()
+{
+    // Hidden textures only need their smallest level
+    for (Entry& entry : m_entries)
+        if (entry.isLive() && entry.lastRequestFrame != m_frame)
+            entry.desiredLevel = entry.getLastLevel();
+
+    // Enforce the memory budget, sacrificing needed levels only as a last resort
+    while (m_residentByteCount > m_memoryBudget && evictOneLevel(/* evictNeededLevels */ false))
+    {
+    }
+
+    while (m_residentByteCount > m_memoryBudget && evictOneLevel(/* evictNeededLevels */ true))
+    {
+    }
+
+    // Refine the textures one level at a time, those lacking the most levels first
+    std::size_t uploadedByteCount = 0u;
+
+    while (true)
+    {
+        Entry*       best        = nullptr;
+        unsigned int bestDeficit = 0u;
+
+        for (Entry& entry : m_entries)
+        {
+            if (!entry.isLive() || entry.lastRefineFrame == m_frame || entry.residentLevel <= entry.desiredLevel)
+                continue;
+
+            const unsigned int deficit = entry.residentLevel - entry.desiredLevel;
+
+            if (deficit > bestDeficit)
+            {
+                best        = &entry;
+                bestDeficit = deficit;
+            }
+        }
+
+        if (best == nullptr)
+            break;
+
+        best->lastRefineFrame = m_frame;
+
+        const unsigned int level     = best->residentLevel - 1u;
+        const std::size_t  byteCount = best->mipChain->getLevelByteCount(level);
+
+        // Always upload something, so that levels larger than the upload budget still get streamed
+        if (uploadedByteCount > 0u && uploadedByteCount + byteCount > m_uploadBudget)
+            continue;
+
+        // Make room by evicting levels that are not needed anymore, never levels needed by other textures
+        while (m_residentByteCount + byteCount > m_memoryBudget && evictOneLevel(/* evictNeededLevels */ false))
+        {
+        }
+
+        if (m_residentByteCount + byteCount > m_memoryBudget)
+            continue;
+
+        // Upload the level before sampling from it
+        best->texture->uploadMipLevel(level, best->mipChain->getLevel(level).asImageView());
+        best->texture->setMipLevelRange(level, best->getLastLevel());
+
+        best->residentLevel = level;
+        best->residentByteCount += byteCount;
+        m_residentByteCount += byteCount;
+        uploadedByteCount += byteCount;
+    }
+
+    ++m_frame;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setMemoryBudget(std::size_t memoryBudget)
+{
+    m_memoryBudget = memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureStreamer::setUploadBudget(std::size_t uploadBudget)
+{
+    m_uploadBudget = uploadBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getUploadBudget() const
+{
+    return m_uploadBudget;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::Residency TextureStreamer::getResidency(Id id) const
+{
+    const Entry& entry = getEntry(id);
+    return {entry.residentLevel, entry.desiredLevel, entry.mipChain->getLevelCount(), entry.residentByteCount};
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getResidentByteCount() const
+{
+    return m_residentByteCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TextureStreamer::getTextureCount() const
+{
+    return m_textureCount;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureStreamer::Entry& TextureStreamer::getEntry(Id id)
+{
+    SFML_BASE_ASSERT(id < m_entries.size() && m_entries[id].isLive() && "TextureStreamer invalid texture id");
+    return m_entries[id];
+}
+
+
+////////////////////////////////////////////////////////////
+const TextureStreamer::Entry& TextureStreamer::getEntry(Id id) const
+{
+    SFML_BASE_ASSERT(id < m_entries.size() && m_entries[id].isLive() && "TextureStreamer invalid texture id");
+    return m_entries[id];
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureStreamer::evictOneLevel(bool evictNeededLevels)
+{
+    Entry* victim = nullptr;
+
+    for (Entry& entry : m_entries)
+    {
+        // The smallest level is never evicted, so that every texture stays drawable
+        if (!entry.isLive() || entry.residentLevel == entry.getLastLevel())
+            continue;
+
+        if (!evictNeededLevels && entry.residentLevel >= entry.desiredLevel)
+            continue;
+
+        // Prefer the textures requested the longest time ago, then the largest levels
+        if (victim == nullptr || entry.lastRequestFrame < victim->lastRequestFrame ||
+            (entry.lastRequestFrame == victim->lastRequestFrame && entry.residentLevel < victim->residentLevel))
+            victim = &entry;
+    }
+
+    if (victim == nullptr)
+        return false;
+
+    const unsigned int level     = victim->residentLevel;
+    const std::size_t  byteCount = victim->mipChain->getLevelByteCount(level);
+
+    // Stop sampling from the level before freeing it
+    victim->texture->setMipLevelRange(level + 1u, victim->getLastLevel());
+    victim->texture->releaseMipLevel(level);
+
+    victim->residentLevel = level + 1u;
+    victim->residentByteCount -= byteCount;
+    m_residentByteCount -= byteCount;
+
+    return true;
+}
+
+} // namespace sf
@@ -0,0 +1,349 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CoordinateType.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/TileMap.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Math/Ceil.hpp"
+#include "SFML/Base/Math/Floor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TileMapImpl
+{
+////////////////////////////////////////////////////////////
+// Corners of a tile, in the order of its four vertices
+constexpr sf::Vector2u tileCorners[]{{0u, 0u}, {1u, 0u}, {0u, 1u}, {1u, 1u}};
+
+
+////////////////////////////////////////////////////////////
+// Two triangles per tile, indexing the vertices of `tileCorners`
+constexpr sf::IndexType tileIndices[]{0u, 1u, 2u, 2u, 1u, 3u};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int chunkRangeBound(float position, float chunkExtent, unsigned int chunkCount, bool roundUp)
+{
+    const float chunk = position / chunkExtent;
+    const float bound = roundUp ? sf::base::ceil(chunk) : sf::base::floor(chunk);
+
+    return static_cast<unsigned int>(sf::base::clamp(bound, 0.f, static_cast<float>(chunkCount)));
+}
+
+} // namespace TileMapImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+TileMap::TileMap(GraphicsContext& graphicsContext, const Settings& settings) :
+m_graphicsContext(&graphicsContext),
+m_settings(settings),
+m_chunkCount((settings.mapSize.x + settings.chunkSize - 1u) / settings.chunkSize,
+             (settings.mapSize.y + settings.chunkSize - 1u) / settings.chunkSize),
+m_tiles(static_cast<std::size_t>(settings.mapSize.x) * settings.mapSize.y, emptyTile)
+{
+    SFML_BASE_ASSERT(settings.chunkSize > 0u && settings.tilesetColumns > 0u);
+    SFML_BASE_ASSERT(settings.chunkSize * settings.tileSize.x <= 32'767u &&
+                     settings.chunkSize * settings.tileSize.y <= 32'767u &&
+                     "TileMap chunks must fit in the 16-bit positions of sf::VertexPacked");
+
+    // Chunks are never reallocated, since moving a vertex buffer is not cheap
+    m_chunks.reserve(static_cast<std::size_t>(m_chunkCount.x) * m_chunkCount.y);
+
+    for (unsigned int y = 0u; y < m_chunkCount.y; ++y)
+        for (unsigned int x = 0u; x < m_chunkCount.x; ++x)
+        {
+            const Vector2u origin{x * settings.chunkSize, y * settings.chunkSize};
+
+            m_chunks.push_back({VertexBuffer(graphicsContext, PrimitiveType::Triangles, VertexBuffer::Usage::Static),
+                                origin,
+                                {base::min(settings.chunkSize, settings.mapSize.x - origin.x),
+                                 base::min(settings.chunkSize, settings.mapSize.y - origin.y)}});
+        }
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::~TileMap() = default;
+
+
+////////////////////////////////////////////////////////////
+TileMap::TileMap(TileMap&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+TileMap& TileMap::operator=(TileMap&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTile(Vector2u position, std::uint32_t tile)
+{
+    SFML_BASE_ASSERT(position.x < m_settings.mapSize.x && position.y < m_settings.mapSize.y);
+
+    std::uint32_t& current = m_tiles[static_cast<std::size_t>(position.y) * m_settings.mapSize.x + position.x];
+
+    if (current == tile)
+        return;
+
+    Chunk& chunk = getChunk(position);
+
+    if (current == emptyTile)
+        ++chunk.tileCount;
+    else if (tile == emptyTile)
+        --chunk.tileCount;
+
+    current = tile;
+
+    // Grow the range to upload, tiles are laid out row by row in the vertex buffer
+    const Vector2u    local = position - chunk.origin;
+    const std::size_t index = static_cast<std::size_t>(local.y) * chunk.size.x + local.x;
+
+    if (chunk.dirtyBegin == chunk.dirtyEnd)
+    {
+        chunk.dirtyBegin = index;
+        chunk.dirtyEnd   = index + 1u;
+    }
+    else
+    {
+        chunk.dirtyBegin = base::min(chunk.dirtyBegin, index);
+        chunk.dirtyEnd   = base::max(chunk.dirtyEnd, index + 1u);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+std::uint32_t TileMap::getTile(Vector2u position) const
+{
+    SFML_BASE_ASSERT(position.x < m_settings.mapSize.x && position.y < m_settings.mapSize.y);
+
+    return m_tiles[static_cast<std::size_t>(position.y) * m_settings.mapSize.x + position.x];
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::setTiles(const std::uint32_t* tiles)
+{
+    SFML_BASE_ASSERT(tiles != nullptr);
+
+    for (std::size_t i = 0u; i < m_tiles.size(); ++i)
+        m_tiles[i] = tiles[i];
+
+    for (Chunk& chunk : m_chunks)
+    {
+        chunk.tileCount = 0u;
+
+        for (unsigned int y = 0u; y < chunk.size.y; ++y)
+            for (unsigned int x = 0u; x < chunk.size.x; ++x)
+                if (getTile(chunk.origin + Vector2u{x, y}) != emptyTile)
+                    ++chunk.tileCount;
+
+        chunk.dirtyBegin = 0u;
+        chunk.dirtyEnd   = static_cast<std::size_t>(chunk.size.x) * chunk.size.y;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getMapSize() const
+{
+    return m_settings.mapSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getTileSize() const
+{
+    return m_settings.tileSize;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TileMap::getChunkCount() const
+{
+    return m_chunkCount;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t TileMap::getDrawnChunkCount() const
+{
+    return m_drawnChunkCount;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getLocalBounds() const
+{
+    return {{0.f, 0.f},
+            {static_cast<float>(m_settings.mapSize.x * m_settings.tileSize.x),
+             static_cast<float>(m_settings.mapSize.y * m_settings.tileSize.y)}};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TileMap::getGlobalBounds() const
+{
+    return getTransform().transformRect(getLocalBounds());
+}
+
+
+////////////////////////////////////////////////////////////
+void TileMap::draw(RenderTarget& target, const Texture& tileset, RenderStates states) const
+{
+    m_drawnChunkCount = 0u;
+
+    if (m_chunks.empty())
+        return;
+
+    // All the chunks share the same indices, partial chunks only use the first ones
+    if (!m_indexBuffer.hasValue())
+    {
+        const std::size_t tileCount = static_cast<std::size_t>(m_settings.chunkSize) * m_settings.chunkSize;
+
+        std::vector<IndexType> indices;
+        indices.reserve(tileCount * 6u);
+
+        for (std::size_t i = 0u; i < tileCount; ++i)
+            for (const IndexType index : TileMapImpl::tileIndices)
+                indices.push_back(static_cast<IndexType>(i * 4u) + index);
+
+        m_indexBuffer = IndexBuffer::create(*m_graphicsContext, indices.size(), IndexBuffer::Usage::Static);
+
+        if (!m_indexBuffer.hasValue() || !m_indexBuffer->update(indices.data(), indices.size()))
+        {
+            priv::err() << "Failed to create tile map index buffer";
+            m_indexBuffer.reset();
+            return;
+        }
+    }
+
+    states.transform *= getTransform();
+    states.coordinateType = CoordinateType::Pixels;
+    states.texture        = &tileset;
+
+    // Bring the area covered by the view, rotation included, back into the space of the map
+    const FloatRect viewBounds  = target.getView().getInverseTransform().transformRect({{-1.f, -1.f}, {2.f, 2.f}});
+    const FloatRect localBounds = states.transform.getInverse().transformRect(viewBounds);
+
+    const Vector2f chunkExtent = (m_settings.tileSize * m_settings.chunkSize).to<Vector2f>();
+
+    const Vector2u begin{TileMapImpl::chunkRangeBound(localBounds.position.x, chunkExtent.x, m_chunkCount.x, false),
+                         TileMapImpl::chunkRangeBound(localBounds.position.y, chunkExtent.y, m_chunkCount.y, false)};
+
+    const Vector2u end{TileMapImpl::chunkRangeBound(localBounds.position.x + localBounds.size.x,
+                                                    chunkExtent.x,
+                                                    m_chunkCount.x,
+                                                    true),
+                       TileMapImpl::chunkRangeBound(localBounds.position.y + localBounds.size.y,
+                                                    chunkExtent.y,
+                                                    m_chunkCount.y,
+                                                    true)};
+
+    for (unsigned int y = begin.y; y < end.y; ++y)
+        for (unsigned int x = begin.x; x < end.x; ++x)
+        {
+            Chunk& chunk = m_chunks[static_cast<std::size_t>(y) * m_chunkCount.x + x];
+
+            if (chunk.tileCount == 0u || !uploadChunk(chunk))
+                continue;
+
+            // Vertex positions are relative to their chunk, to fit in 16 bits
+            RenderStates chunkStates = states;
+            chunkStates.transform.translate(chunk.origin.cwiseMul(m_settings.tileSize).to<Vector2f>());
+
+            target.draw(chunk.vertexBuffer,
+                        *m_indexBuffer,
+                        0u,
+                        static_cast<std::size_t>(chunk.size.x) * chunk.size.y * 6u,
+                        chunkStates);
+
+            ++m_drawnChunkCount;
+        }
+}
+
+
+////////////////////////////////////////////////////////////
+TileMap::Chunk& TileMap::getChunk(Vector2u position)
+{
+    return m_chunks[static_cast<std::size_t>(position.y / m_settings.chunkSize) * m_chunkCount.x +
+                    position.x / m_settings.chunkSize];
+}
+
+
+////////////////////////////////////////////////////////////
+bool TileMap::uploadChunk(Chunk& chunk) const
+{
+    const std::size_t tileCount = static_cast<std::size_t>(chunk.size.x) * chunk.size.y;
+
+    if (!chunk.uploaded)
+    {
+        if (!chunk.vertexBuffer.create(tileCount * 4u, VertexFormat::Packed))
+            return false;
+
+        chunk.uploaded   = true;
+        chunk.dirtyBegin = 0u;
+        chunk.dirtyEnd   = tileCount;
+    }
+
+    if (chunk.dirtyBegin == chunk.dirtyEnd)
+        return true;
+
+    m_vertices.clear();
+
+    for (std::size_t i = chunk.dirtyBegin; i < chunk.dirtyEnd; ++i)
+    {
+        const Vector2u local{static_cast<unsigned int>(i % chunk.size.x), static_cast<unsigned int>(i / chunk.size.x)};
+        const std::uint32_t tile = getTile(chunk.origin + local);
+
+        // Empty tiles are kept as degenerate triangles, so that the layout of the buffer never changes
+        if (tile == emptyTile)
+        {
+            m_vertices.resize(m_vertices.size() + 4u);
+            continue;
+        }
+
+        const Vector2u texOrigin{tile % m_settings.tilesetColumns * m_settings.tileSize.x,
+                                 tile / m_settings.tilesetColumns * m_settings.tileSize.y};
+
+        SFML_BASE_ASSERT(texOrigin.x + m_settings.tileSize.x <= 65'535u &&
+                         texOrigin.y + m_settings.tileSize.y <= 65'535u &&
+                         "TileMap tileset must fit in the 16-bit texture coordinates of sf::VertexPacked");
+
+        for (const Vector2u corner : TileMapImpl::tileCorners)
+        {
+            const Vector2u offset = corner.cwiseMul(m_settings.tileSize);
+
+            m_vertices.push_back({(local.cwiseMul(m_settings.tileSize) + offset).to<Vector2<std::int16_t>>(),
+                                  Color::White,
+                                  (texOrigin + offset).to<Vector2<std::uint16_t>>()});
+        }
+    }
+
+    const auto offset = static_cast<unsigned int>(chunk.dirtyBegin * 4u);
+
+    if (!chunk.vertexBuffer.update(m_vertices.data(), m_vertices.size(), offset))
+        return false;
+
+    chunk.dirtyBegin = 0u;
+    chunk.dirtyEnd   = 0u;
+    return true;
+}
+
+} // namespace sf
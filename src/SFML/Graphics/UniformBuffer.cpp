@@ -0,0 +1,244 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/UniformBuffer.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <cstddef>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBufferImpl
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum usageToGlEnum(sf::UniformBuffer::Usage usage)
+{
+    switch (usage)
+    {
+        case sf::UniformBuffer::Usage::Static:
+            return GL_STATIC_DRAW;
+        case sf::UniformBuffer::Usage::Dynamic:
+            return GL_DYNAMIC_DRAW;
+        default:
+            return GL_STREAM_DRAW;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isRangeValid(std::size_t offset, std::size_t byteCount, std::size_t bufferByteCount)
+{
+    return offset <= bufferByteCount && byteCount <= bufferByteCount - offset;
+}
+
+} // namespace UniformBufferImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::Optional<UniformBuffer> UniformBuffer::create(GraphicsContext& graphicsContext, std::size_t byteCount, Usage usage)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    if (byteCount == 0u)
+    {
+        priv::err() << "Failed to create uniform buffer, size is zero";
+        return base::nullOpt;
+    }
+
+    GLuint buffer{};
+    glCheck(glGenBuffers(1, &buffer));
+
+    if (!buffer)
+    {
+        priv::err() << "Failed to create uniform buffer, generation failed";
+        return base::nullOpt;
+    }
+
+    graphicsContext.getActiveGLStateCache().bindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glCheck(glBufferData(GL_UNIFORM_BUFFER,
+                         static_cast<GLsizeiptr>(byteCount),
+                         nullptr,
+                         UniformBufferImpl::usageToGlEnum(usage)));
+    graphicsContext.getActiveGLStateCache().bindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    return base::makeOptional<UniformBuffer>(base::PassKey<UniformBuffer>{}, graphicsContext, buffer, byteCount, usage);
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(base::PassKey<UniformBuffer>&&,
+                             GraphicsContext& graphicsContext,
+                             unsigned int     buffer,
+                             std::size_t      byteCount,
+                             Usage            usage) :
+m_graphicsContext(&graphicsContext),
+m_buffer(buffer),
+m_byteCount(byteCount),
+m_usage(usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::~UniformBuffer()
+{
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+        priv::GLStateCache::invalidateObjectBindings();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::UniformBuffer(UniformBuffer&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_buffer(base::exchange(right.m_buffer, 0u)),
+m_byteCount(base::exchange(right.m_byteCount, 0u)),
+m_usage(right.m_usage)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer& UniformBuffer::operator=(UniformBuffer&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+        priv::GLStateCache::invalidateObjectBindings();
+    }
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_buffer          = base::exchange(right.m_buffer, 0u);
+    m_byteCount       = base::exchange(right.m_byteCount, 0u);
+    m_usage           = right.m_usage;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::update(const void* data, std::size_t byteCount, std::size_t offset)
+{
+    SFML_BASE_ASSERT(data != nullptr || byteCount == 0u);
+
+    if (!UniformBufferImpl::isRangeValid(offset, byteCount, m_byteCount))
+    {
+        priv::err() << "Failed to update uniform buffer, range [" << offset << ", " << offset + byteCount
+                    << ") exceeds the buffer size " << m_byteCount;
+        return false;
+    }
+
+    if (byteCount == 0u)
+        return true;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_UNIFORM_BUFFER, m_buffer);
+    glCheck(glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(byteCount), data));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBuffer::bind(unsigned int bindingPoint) const
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    m_graphicsContext->getActiveGLStateCache().bindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, m_buffer);
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBuffer::bindRange(unsigned int bindingPoint, std::size_t offset, std::size_t byteCount) const
+{
+    if (!UniformBufferImpl::isRangeValid(offset, byteCount, m_byteCount) || byteCount == 0u)
+    {
+        priv::err() << "Failed to bind uniform buffer range, range [" << offset << ", " << offset + byteCount
+                    << ") is empty or exceeds the buffer size " << m_byteCount;
+        return false;
+    }
+
+    if (offset % getOffsetAlignment(*m_graphicsContext) != 0u)
+    {
+        priv::err() << "Failed to bind uniform buffer range, offset " << offset << " is not a multiple of "
+                    << getOffsetAlignment(*m_graphicsContext);
+        return false;
+    }
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    m_graphicsContext->getActiveGLStateCache().bindBufferRange(GL_UNIFORM_BUFFER,
+                                                               bindingPoint,
+                                                               m_buffer,
+                                                               static_cast<std::ptrdiff_t>(offset),
+                                                               static_cast<std::ptrdiff_t>(byteCount));
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getByteCount() const
+{
+    return m_byteCount;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBuffer::Usage UniformBuffer::getUsage() const
+{
+    return m_usage;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+std::size_t UniformBuffer::getOffsetAlignment([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    static const auto alignment = static_cast<std::size_t>(priv::getGLInteger(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT));
+    return alignment;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBuffer::getMaximumBindingPoints([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    static const auto maxBindings = static_cast<unsigned int>(priv::getGLInteger(GL_MAX_UNIFORM_BUFFER_BINDINGS));
+    return maxBindings;
+}
+
+} // namespace sf
@@ -8,9 +8,13 @@
 #include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 #include "SFML/Graphics/VertexBuffer.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormatUtils.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 
 #include "SFML/System/Err.hpp"
 
@@ -78,11 +82,12 @@ m_usage(usage)
 VertexBuffer::VertexBuffer(const VertexBuffer& rhs) :
 m_graphicsContext(rhs.m_graphicsContext),
 m_primitiveType(rhs.m_primitiveType),
-m_usage(rhs.m_usage)
+m_usage(rhs.m_usage),
+m_vertexFormat(rhs.m_vertexFormat)
 {
     if (rhs.m_buffer && rhs.m_size)
     {
-        if (!create(rhs.m_size))
+        if (!create(rhs.m_size, rhs.m_vertexFormat))
         {
             priv::err() << "Could not create vertex buffer for copying";
             return;
@@ -102,12 +107,13 @@ VertexBuffer::~VertexBuffer()
         SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
         glCheck(GLEXT_glDeleteBuffers(1, &m_buffer));
+        priv::GLStateCache::invalidateObjectBindings();
     }
 }
 
 
 ////////////////////////////////////////////////////////////
-bool VertexBuffer::create(std::size_t vertexCount)
+bool VertexBuffer::create(std::size_t vertexCount, VertexFormat vertexFormat)
 {
     if (!isAvailable(*m_graphicsContext))
         return false;
@@ -123,14 +129,15 @@ bool VertexBuffer::create(std::size_t vertexCount)
         return false;
     }
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, m_buffer);
     glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                               static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
+                               static_cast<GLsizeiptrARB>(priv::getVertexSize(vertexFormat) * vertexCount),
                                nullptr,
                                VertexBufferImpl::usageToGlEnum(m_usage)));
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, 0);
 
-    m_size = vertexCount;
+    m_size         = vertexCount;
+    m_vertexFormat = vertexFormat;
 
     return true;
 }
@@ -143,6 +150,13 @@ std::size_t VertexBuffer::getVertexCount() const
 }
 
 
+////////////////////////////////////////////////////////////
+VertexFormat VertexBuffer::getVertexFormat() const
+{
+    return m_vertexFormat;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update(const Vertex* vertices)
 {
@@ -153,39 +167,21 @@ bool VertexBuffer::update(const Vertex* vertices)
 ////////////////////////////////////////////////////////////
 bool VertexBuffer::update(const Vertex* vertices, std::size_t vertexCount, unsigned int offset)
 {
-    // Sanity checks
-    if (!m_buffer)
-        return false;
-
-    if (!vertices)
-        return false;
-
-    if (offset && (offset + vertexCount > m_size))
-        return false;
-
-    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
-
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, m_buffer));
-
-    // Check if we need to resize or orphan the buffer
-    if (vertexCount >= m_size)
-    {
-        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
-                                   static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                   nullptr,
-                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+    return updateData(vertices, vertexCount, offset, VertexFormat::Standard);
+}
 
-        m_size = vertexCount;
-    }
 
-    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
-                                  static_cast<GLintptrARB>(sizeof(Vertex) * offset),
-                                  static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexCount),
-                                  vertices));
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const VertexCompact* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    return updateData(vertices, vertexCount, offset, VertexFormat::Compact);
+}
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, 0));
 
-    return true;
+////////////////////////////////////////////////////////////
+bool VertexBuffer::update(const VertexPacked* vertices, std::size_t vertexCount, unsigned int offset)
+{
+    return updateData(vertices, vertexCount, offset, VertexFormat::Packed);
 }
 
 
@@ -195,55 +191,113 @@ bool VertexBuffer::update([[maybe_unused]] const VertexBuffer& vertexBuffer)
     if (!m_buffer || !vertexBuffer.m_buffer)
         return false;
 
+    if (vertexBuffer.m_vertexFormat != m_vertexFormat)
+    {
+        priv::err() << "Could not copy vertex buffer, the vertex formats differ";
+        return false;
+    }
+
     SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
 
+    const std::size_t byteSize = priv::getVertexSize(m_vertexFormat) * vertexBuffer.m_size;
+
     if (GLEXT_copy_buffer)
     {
-        glCheck(glBindBuffer(GL_COPY_READ_BUFFER, vertexBuffer.m_buffer));
-        glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, m_buffer));
+        m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_READ_BUFFER, vertexBuffer.m_buffer);
+        m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, m_buffer);
 
         glCheck(glCopyBufferSubData(GL_COPY_READ_BUFFER,
                                     GL_COPY_WRITE_BUFFER,
                                     0,
                                     0,
-                                    static_cast<GLsizeiptr>(sizeof(Vertex) * vertexBuffer.m_size)));
+                                    static_cast<GLsizeiptr>(byteSize)));
 
-        glCheck(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
-        glCheck(glBindBuffer(GL_COPY_READ_BUFFER, 0));
+        m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_COPY_READ_BUFFER, 0);
 
         return true;
     }
 
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, m_buffer);
     glCheck(glBufferData(GL_ARRAY_BUFFER,
-                         static_cast<GLsizeiptrARB>(sizeof(Vertex) * vertexBuffer.m_size),
+                         static_cast<GLsizeiptrARB>(byteSize),
                          nullptr,
                          VertexBufferImpl::usageToGlEnum(m_usage)));
 
     void* destination = nullptr;
     glCheck(destination = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
 
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.m_buffer));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, vertexBuffer.m_buffer);
 
     void* source = nullptr;
     glCheck(source = glMapBuffer(GL_ARRAY_BUFFER, GL_READ_ONLY));
 
-    std::memcpy(destination, source, sizeof(Vertex) * vertexBuffer.m_size);
+    std::memcpy(destination, source, byteSize);
 
     GLboolean sourceResult = GL_FALSE;
     glCheck(sourceResult = glUnmapBuffer(GL_ARRAY_BUFFER));
 
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, m_buffer));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, m_buffer);
 
     GLboolean destinationResult = GL_FALSE;
     glCheck(destinationResult = glUnmapBuffer(GL_ARRAY_BUFFER));
 
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, 0));
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, 0);
 
     return (sourceResult == GL_TRUE) && (destinationResult == GL_TRUE);
 }
 
 
+////////////////////////////////////////////////////////////
+bool VertexBuffer::updateData(const void*  vertexData,
+                              std::size_t  vertexCount,
+                              unsigned int offset,
+                              VertexFormat vertexFormat)
+{
+    // Sanity checks
+    if (!m_buffer)
+        return false;
+
+    if (!vertexData)
+        return false;
+
+    if (vertexFormat != m_vertexFormat)
+    {
+        priv::err() << "Could not update vertex buffer, the vertices do not match its format";
+        return false;
+    }
+
+    if (offset && (offset + vertexCount > m_size))
+        return false;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const std::size_t vertexSize = priv::getVertexSize(m_vertexFormat);
+
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, m_buffer);
+
+    // Check if we need to resize or orphan the buffer
+    if (vertexCount >= m_size)
+    {
+        glCheck(GLEXT_glBufferData(GLEXT_GL_ARRAY_BUFFER,
+                                   static_cast<GLsizeiptrARB>(vertexSize * vertexCount),
+                                   nullptr,
+                                   VertexBufferImpl::usageToGlEnum(m_usage)));
+
+        m_size = vertexCount;
+    }
+
+    glCheck(GLEXT_glBufferSubData(GLEXT_GL_ARRAY_BUFFER,
+                                  static_cast<GLintptrARB>(vertexSize * offset),
+                                  static_cast<GLsizeiptrARB>(vertexSize * vertexCount),
+                                  vertexData));
+
+    m_graphicsContext->getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 VertexBuffer& VertexBuffer::operator=(const VertexBuffer& rhs)
 {
@@ -262,6 +316,7 @@ void VertexBuffer::swap(VertexBuffer& right) noexcept
     std::swap(m_buffer, right.m_buffer);
     std::swap(m_primitiveType, right.m_primitiveType);
     std::swap(m_usage, right.m_usage);
+    std::swap(m_vertexFormat, right.m_vertexFormat);
 }
 
 
@@ -280,7 +335,7 @@ void VertexBuffer::bind(GraphicsContext& graphicsContext, const VertexBuffer* ve
 
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
 
-    glCheck(GLEXT_glBindBuffer(GLEXT_GL_ARRAY_BUFFER, vertexBuffer ? vertexBuffer->m_buffer : 0));
+    graphicsContext.getActiveGLStateCache().bindBuffer(GL_ARRAY_BUFFER, vertexBuffer ? vertexBuffer->m_buffer : 0);
 }
 
 
@@ -0,0 +1,42 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexFormat.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
+
+#include <cstddef>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+// The attribute pointers rely on these layouts, without padding
+////////////////////////////////////////////////////////////
+static_assert(sizeof(Vertex) == 20u);
+static_assert(sizeof(VertexCompact) == 16u);
+static_assert(sizeof(VertexPacked) == 12u);
+
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size of a single vertex of the given format, in bytes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] constexpr std::size_t getVertexSize(VertexFormat vertexFormat)
+{
+    switch (vertexFormat)
+    {
+        case VertexFormat::Compact:
+            return sizeof(VertexCompact);
+        case VertexFormat::Packed:
+            return sizeof(VertexPacked);
+        default:
+            return sizeof(Vertex);
+    }
+}
+
+} // namespace sf::priv
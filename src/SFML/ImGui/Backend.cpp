@@ -7,6 +7,8 @@
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
+#include "SFML/Window/WindowContext.hpp"
 
 #include <imgui.h>
 
@@ -115,6 +117,13 @@ struct ImGui_ImplOpenGL3_Data
     bool         HasClipOrigin;
     bool         UseBufferSubData;
 
+    WindowContext* WindowCtx; // Gives access to the state cache of the active context
+
+    [[nodiscard]] sf::priv::GLStateCache& GetStateCache() const
+    {
+        return WindowCtx->getActiveGLStateCache();
+    }
+
     ImGui_ImplOpenGL3_Data()
     {
         memset((void*)this, 0, sizeof(*this));
@@ -156,7 +165,7 @@ struct ImGui_ImplOpenGL3_VtxAttribState
 #endif
 
 // Functions
-bool ImGui_ImplOpenGL3_Init(const char* glsl_version)
+bool ImGui_ImplOpenGL3_Init(WindowContext& window_context, const char* glsl_version)
 {
     ImGuiIO& io = ::ImGui::GetIO();
     ::IMGUI_CHECKVERSION();
@@ -176,6 +185,7 @@ bool ImGui_ImplOpenGL3_Init(const char* glsl_version)
     ImGui_ImplOpenGL3_Data* bd = IM_NEW2(ImGui_ImplOpenGL3_Data)();
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName     = "imgui_impl_opengl3";
+    bd->WindowCtx              = &window_context;
 
     // Query for GL version (e.g. 320 for GL 3.2)
 #if defined(IMGUI_IMPL_OPENGL_ES2)
@@ -307,16 +317,17 @@ void ImGui_ImplOpenGL3_NewFrame()
 
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
-    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_Data* bd         = ImGui_ImplOpenGL3_GetBackendData();
+    sf::priv::GLStateCache& stateCache = bd->GetStateCache();
 
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
-    glCheck(glEnable(GL_BLEND));
-    glCheck(glBlendEquation(GL_FUNC_ADD));
-    glCheck(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
-    glCheck(glDisable(GL_CULL_FACE));
-    glCheck(glDisable(GL_DEPTH_TEST));
-    glCheck(glDisable(GL_STENCIL_TEST));
-    glCheck(glEnable(GL_SCISSOR_TEST));
+    stateCache.setEnabled(GL_BLEND, true);
+    stateCache.blendEquation(GL_FUNC_ADD);
+    stateCache.blendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    stateCache.setEnabled(GL_CULL_FACE, false);
+    stateCache.setEnabled(GL_DEPTH_TEST, false);
+    stateCache.setEnabled(GL_STENCIL_TEST, false);
+    stateCache.setEnabled(GL_SCISSOR_TEST, true);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (bd->GlVersion >= 310)
         glCheck(glDisable(GL_PRIMITIVE_RESTART));
@@ -340,7 +351,7 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 
     // Setup viewport, orthographic projection matrix
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
-    glCheck(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+    stateCache.viewport(0, 0, fb_width, fb_height);
     float L = draw_data->DisplayPos.x;
     float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
     float T = draw_data->DisplayPos.y;
@@ -359,7 +370,7 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         {0.0f, 0.0f, -1.0f, 0.0f},
         {(R + L) / (L - R), (T + B) / (B - T), 0.0f, 1.0f},
     };
-    glCheck(glUseProgram(bd->ShaderHandle));
+    stateCache.useProgram(bd->ShaderHandle);
     glCheck(glUniform1i(bd->AttribLocationTex, 0));
     glCheck(glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]));
 
@@ -370,12 +381,12 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 
     (void)vertex_array_object;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glBindVertexArray(vertex_array_object));
+    stateCache.bindVertexArray(vertex_array_object);
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
-    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, bd->VboHandle);
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle);
     glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     glCheck(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
@@ -409,14 +420,12 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     SFML_BASE_ASSERT(bd != nullptr);
 
-    // Backup GL state
-    GLenum last_active_texture;
-    glCheck(glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture));
-    glCheck(glActiveTexture(GL_TEXTURE0));
-    GLuint last_program;
-    glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, (GLint*)&last_program));
-    GLuint last_texture;
-    glCheck(glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture));
+    // Backup GL state, the state cache of the context only queries OpenGL for the values it does not know
+    sf::priv::GLStateCache& stateCache          = bd->GetStateCache();
+    GLenum                  last_active_texture = stateCache.getActiveTexture();
+    stateCache.activeTexture(GL_TEXTURE0);
+    GLuint last_program = stateCache.getProgram();
+    GLuint last_texture = stateCache.getTexture2D();
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     GLuint last_sampler;
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
@@ -428,12 +437,10 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         last_sampler = 0;
     }
 #endif
-    GLuint last_array_buffer;
-    glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer));
+    GLuint last_array_buffer = stateCache.getBuffer(GL_ARRAY_BUFFER);
 #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     // This is part of VAO on OpenGL 3.0+ and OpenGL ES 3.0+.
-    GLint last_element_array_buffer;
-    glCheck(glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &last_element_array_buffer));
+    GLuint last_element_array_buffer = stateCache.getBuffer(GL_ELEMENT_ARRAY_BUFFER);
     ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_pos;
     last_vtx_attrib_state_pos.GetState(bd->AttribLocationVtxPos);
     ImGui_ImplOpenGL3_VtxAttribState last_vtx_attrib_state_uv;
@@ -442,8 +449,7 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     last_vtx_attrib_state_color.GetState(bd->AttribLocationVtxColor);
 #endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLuint last_vertex_array_object;
-    glCheck(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object));
+    GLuint last_vertex_array_object = stateCache.getVertexArray();
 #endif
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
     GLint last_polygon_mode[2];
@@ -453,26 +459,18 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     }
 #endif
     GLint last_viewport[4];
-    glCheck(glGetIntegerv(GL_VIEWPORT, last_viewport));
+    stateCache.getViewport(last_viewport);
     GLint last_scissor_box[4];
-    glCheck(glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box));
-    GLenum last_blend_src_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_SRC_RGB, (GLint*)&last_blend_src_rgb));
-    GLenum last_blend_dst_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_DST_RGB, (GLint*)&last_blend_dst_rgb));
-    GLenum last_blend_src_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_SRC_ALPHA, (GLint*)&last_blend_src_alpha));
-    GLenum last_blend_dst_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_DST_ALPHA, (GLint*)&last_blend_dst_alpha));
-    GLenum last_blend_equation_rgb;
-    glCheck(glGetIntegerv(GL_BLEND_EQUATION_RGB, (GLint*)&last_blend_equation_rgb));
-    GLenum last_blend_equation_alpha;
-    glCheck(glGetIntegerv(GL_BLEND_EQUATION_ALPHA, (GLint*)&last_blend_equation_alpha));
-    GLboolean last_enable_blend        = glIsEnabled(GL_BLEND);
-    GLboolean last_enable_cull_face    = glIsEnabled(GL_CULL_FACE);
-    GLboolean last_enable_depth_test   = glIsEnabled(GL_DEPTH_TEST);
-    GLboolean last_enable_stencil_test = glIsEnabled(GL_STENCIL_TEST);
-    GLboolean last_enable_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+    stateCache.getScissor(last_scissor_box);
+    GLenum last_blend_func[4]; // Source RGB, destination RGB, source alpha, destination alpha
+    stateCache.getBlendFuncSeparate(last_blend_func);
+    GLenum last_blend_equation[2]; // RGB, alpha
+    stateCache.getBlendEquationSeparate(last_blend_equation);
+    bool last_enable_blend        = stateCache.isEnabled(GL_BLEND);
+    bool last_enable_cull_face    = stateCache.isEnabled(GL_CULL_FACE);
+    bool last_enable_depth_test   = stateCache.isEnabled(GL_DEPTH_TEST);
+    bool last_enable_stencil_test = stateCache.isEnabled(GL_STENCIL_TEST);
+    bool last_enable_scissor_test = stateCache.isEnabled(GL_SCISSOR_TEST);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     GLboolean last_enable_primitive_restart = (bd->GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
@@ -559,13 +557,13 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     continue;
 
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                glCheck(glScissor((int)clip_min.x,
-                                  (int)((float)fb_height - clip_max.y),
-                                  (int)(clip_max.x - clip_min.x),
-                                  (int)(clip_max.y - clip_min.y)));
+                stateCache.scissor((int)clip_min.x,
+                                   (int)((float)fb_height - clip_max.y),
+                                   (int)(clip_max.x - clip_min.x),
+                                   (int)(clip_max.y - clip_min.y));
 
                 // Bind texture, Draw
-                glCheck(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+                stateCache.bindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
                     glCheck(glDrawElementsBaseVertex(GL_TRIANGLES,
@@ -584,6 +582,8 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     }
 
     // Destroy the temporary VAO
+    // Vertex array names are not shared between contexts and the previous binding is restored below, so there is no
+    // need to invalidate the object bindings cached for all the contexts
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     glCheck(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
@@ -591,45 +591,30 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
     if (last_program == 0 || glIsProgram(last_program))
-        glCheck(glUseProgram(last_program));
-    glCheck(glBindTexture(GL_TEXTURE_2D, last_texture));
+        stateCache.useProgram(last_program);
+    stateCache.bindTexture(GL_TEXTURE_2D, last_texture);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
         glCheck(glBindSampler(0, last_sampler));
 #endif
-    glCheck(glActiveTexture(last_active_texture));
+    stateCache.activeTexture(last_active_texture);
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glBindVertexArray(last_vertex_array_object));
+    stateCache.bindVertexArray(last_vertex_array_object);
 #endif
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer));
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
 #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, last_element_array_buffer));
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, last_element_array_buffer);
     last_vtx_attrib_state_pos.SetState(bd->AttribLocationVtxPos);
     last_vtx_attrib_state_uv.SetState(bd->AttribLocationVtxUV);
     last_vtx_attrib_state_color.SetState(bd->AttribLocationVtxColor);
 #endif
-    glCheck(glBlendEquationSeparate(last_blend_equation_rgb, last_blend_equation_alpha));
-    glCheck(glBlendFuncSeparate(last_blend_src_rgb, last_blend_dst_rgb, last_blend_src_alpha, last_blend_dst_alpha));
-    if (last_enable_blend)
-        glCheck(glEnable(GL_BLEND));
-    else
-        glCheck(glDisable(GL_BLEND));
-    if (last_enable_cull_face)
-        glCheck(glEnable(GL_CULL_FACE));
-    else
-        glCheck(glDisable(GL_CULL_FACE));
-    if (last_enable_depth_test)
-        glCheck(glEnable(GL_DEPTH_TEST));
-    else
-        glCheck(glDisable(GL_DEPTH_TEST));
-    if (last_enable_stencil_test)
-        glCheck(glEnable(GL_STENCIL_TEST));
-    else
-        glCheck(glDisable(GL_STENCIL_TEST));
-    if (last_enable_scissor_test)
-        glCheck(glEnable(GL_SCISSOR_TEST));
-    else
-        glCheck(glDisable(GL_SCISSOR_TEST));
+    stateCache.blendEquationSeparate(last_blend_equation[0], last_blend_equation[1]);
+    stateCache.blendFuncSeparate(last_blend_func[0], last_blend_func[1], last_blend_func[2], last_blend_func[3]);
+    stateCache.setEnabled(GL_BLEND, last_enable_blend);
+    stateCache.setEnabled(GL_CULL_FACE, last_enable_cull_face);
+    stateCache.setEnabled(GL_DEPTH_TEST, last_enable_depth_test);
+    stateCache.setEnabled(GL_STENCIL_TEST, last_enable_stencil_test);
+    stateCache.setEnabled(GL_SCISSOR_TEST, last_enable_scissor_test);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (bd->GlVersion >= 310)
     {
@@ -656,8 +641,8 @@ void ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     }
 #endif // IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
 
-    glCheck(glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]));
-    glCheck(glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]));
+    stateCache.viewport(last_viewport[0], last_viewport[1], last_viewport[2], last_viewport[3]);
+    stateCache.scissor(last_scissor_box[0], last_scissor_box[1], last_scissor_box[2], last_scissor_box[3]);
     (void)bd; // Not all compilation paths use this
 }
 
@@ -673,10 +658,10 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 
     // Upload texture to graphics system
     // (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
-    GLint last_texture;
-    glCheck(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
+    sf::priv::GLStateCache& stateCache   = bd->GetStateCache();
+    GLuint                  last_texture = stateCache.getTexture2D();
     glCheck(glGenTextures(1, &bd->FontTexture));
-    glCheck(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+    stateCache.bindTexture(GL_TEXTURE_2D, bd->FontTexture);
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
     glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
 #ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
@@ -688,7 +673,7 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
     // Restore state
-    glCheck(glBindTexture(GL_TEXTURE_2D, last_texture));
+    stateCache.bindTexture(GL_TEXTURE_2D, last_texture);
 
     return true;
 }
@@ -700,6 +685,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     if (bd->FontTexture)
     {
         glCheck(glDeleteTextures(1, &bd->FontTexture));
+        sf::priv::GLStateCache::invalidateObjectBindings();
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
@@ -754,9 +740,9 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Backup GL state
-    GLint last_texture, last_array_buffer;
-    glCheck(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
-    glCheck(glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &last_array_buffer));
+    sf::priv::GLStateCache& stateCache        = bd->GetStateCache();
+    GLuint                  last_texture      = stateCache.getTexture2D();
+    GLuint                  last_array_buffer = stateCache.getBuffer(GL_ARRAY_BUFFER);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_BUFFER_PIXEL_UNPACK
     GLint last_pixel_unpack_buffer = 0;
     if (bd->GlVersion >= 210)
@@ -766,8 +752,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     }
 #endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    GLint last_vertex_array;
-    glCheck(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &last_vertex_array));
+    GLuint last_vertex_array = stateCache.getVertexArray();
 #endif
 
     // Parse GLSL version string
@@ -939,8 +924,8 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     ImGui_ImplOpenGL3_CreateFontsTexture();
 
     // Restore modified GL state
-    glCheck(glBindTexture(GL_TEXTURE_2D, last_texture));
-    glCheck(glBindBuffer(GL_ARRAY_BUFFER, last_array_buffer));
+    stateCache.bindTexture(GL_TEXTURE_2D, last_texture);
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, last_array_buffer);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_BUFFER_PIXEL_UNPACK
     if (bd->GlVersion >= 210)
     {
@@ -948,7 +933,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     }
 #endif
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
-    glCheck(glBindVertexArray(last_vertex_array));
+    stateCache.bindVertexArray(last_vertex_array);
 #endif
 
     return true;
@@ -960,15 +945,18 @@ void ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)
     {
         glCheck(glDeleteBuffers(1, &bd->VboHandle));
+        sf::priv::GLStateCache::invalidateObjectBindings();
         bd->VboHandle = 0;
     }
     if (bd->ElementsHandle)
     {
         glCheck(glDeleteBuffers(1, &bd->ElementsHandle));
+        sf::priv::GLStateCache::invalidateObjectBindings();
         bd->ElementsHandle = 0;
     }
     if (bd->ShaderHandle)
     {
+        bd->GetStateCache().releaseProgram(bd->ShaderHandle);
         glCheck(glDeleteProgram(bd->ShaderHandle));
         bd->ShaderHandle = 0;
     }
@@ -6,12 +6,17 @@
 ////////////////////////////////////////////////////////////
 struct ImDrawData;
 
+namespace sf
+{
+class WindowContext;
+} // namespace sf
+
 
 namespace sf::ImGui::priv
 {
 ////////////////////////////////////////////////////////////
 // NOLINTNEXTLINE(readability-identifier-naming)
-bool ImGui_ImplOpenGL3_Init(const char* glsl_version);
+bool ImGui_ImplOpenGL3_Init(WindowContext& window_context, const char* glsl_version);
 
 ////////////////////////////////////////////////////////////
 // NOLINTNEXTLINE(readability-identifier-naming)
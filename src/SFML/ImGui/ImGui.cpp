@@ -464,7 +464,7 @@ struct [[nodiscard]] ImGuiPerWindowContext
         }
 
         ::ImGui::SetCurrentContext(imContext);
-        priv::ImGui_ImplOpenGL3_Init(nullptr);
+        priv::ImGui_ImplOpenGL3_Init(graphicsContext, nullptr);
 
         return true;
     }
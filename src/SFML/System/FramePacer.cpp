@@ -0,0 +1,202 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/FramePacer.hpp"
+#include "SFML/System/Sleep.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <cstdint>
+
+#ifdef SFML_SYSTEM_LINUX_OR_BSD
+#include <cerrno>
+#include <ctime>
+#else
+#include <chrono>
+#endif
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace FramePacerImpl
+{
+#ifdef SFML_SYSTEM_LINUX_OR_BSD
+
+////////////////////////////////////////////////////////////
+// Uses the same clock as `clock_nanosleep`, so that deadlines can be passed to it as they are
+[[nodiscard]] sf::Time now()
+{
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return sf::microseconds(static_cast<std::int64_t>(ts.tv_sec) * 1'000'000 + ts.tv_nsec / 1000);
+}
+
+
+////////////////////////////////////////////////////////////
+void sleepUntil(sf::Time deadline)
+{
+    const std::int64_t usecs = deadline.asMicroseconds();
+
+    timespec ts{};
+    ts.tv_sec  = static_cast<time_t>(usecs / 1'000'000);
+    ts.tv_nsec = static_cast<long>((usecs % 1'000'000) * 1000);
+
+    // Unlike relative sleeps, an absolute sleep interrupted by a signal can simply be restarted with the same deadline
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+    {
+    }
+}
+
+#else
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Time now()
+{
+    const auto sinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+    return sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(sinceEpoch).count());
+}
+
+
+////////////////////////////////////////////////////////////
+// Absolute sleeps are not available everywhere, fall back to a relative sleep
+void sleepUntil(sf::Time deadline)
+{
+    sf::sleep(deadline - now());
+}
+
+#endif
+
+} // namespace FramePacerImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+FramePacer::FramePacer() = default;
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setTargetFrameTime(Time frameTime)
+{
+    SFML_BASE_ASSERT(frameTime >= Time::Zero);
+
+    m_targetFrameTime = frameTime;
+    m_scheduled       = false;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getTargetFrameTime() const
+{
+    return m_targetFrameTime;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::setSpinDuration(Time duration)
+{
+    SFML_BASE_ASSERT(duration >= Time::Zero);
+
+    m_spinDuration = duration;
+}
+
+
+////////////////////////////////////////////////////////////
+Time FramePacer::getSpinDuration() const
+{
+    return m_spinDuration;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::waitForNextFrame()
+{
+    if (m_targetFrameTime != Time::Zero)
+    {
+        const Time current = FramePacerImpl::now();
+
+        // The first frame of a schedule, or a frame late by more than a frame time, starts a new schedule
+        if (!m_scheduled || current > m_nextDeadline + m_targetFrameTime)
+        {
+            m_nextDeadline = current + m_targetFrameTime;
+            m_scheduled    = true;
+        }
+
+        // Sleep coarsely, then yield until the deadline to absorb the wakeup latency
+        if (m_nextDeadline - m_spinDuration > current)
+            FramePacerImpl::sleepUntil(m_nextDeadline - m_spinDuration);
+
+        while (FramePacerImpl::now() < m_nextDeadline)
+            std::this_thread::yield();
+
+        m_nextDeadline += m_targetFrameTime;
+    }
+
+    // Record the time since the end of the previous frame
+    const Time frameEnd = FramePacerImpl::now();
+
+    if (m_started)
+    {
+        const Time frameTime = frameEnd - m_lastFrameEnd;
+
+        m_samples[m_nextSample] = frameTime;
+        m_sampleCount           = base::min(m_sampleCount + 1u, sampleCapacity);
+        m_nextSample            = (m_nextSample + 1u) % sampleCapacity;
+    }
+
+    m_lastFrameEnd = frameEnd;
+    m_started      = true;
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::Statistics FramePacer::getStatistics() const
+{
+    if (m_sampleCount == 0u)
+        return {};
+
+    Statistics   statistics{m_samples[0], Time::Zero, Time::Zero, m_samples[0], m_sampleCount};
+    std::int64_t totalMicroseconds = 0;
+
+    for (std::size_t i = 0u; i < m_sampleCount; ++i)
+    {
+        statistics.minimum = base::min(statistics.minimum, m_samples[i]);
+        statistics.maximum = base::max(statistics.maximum, m_samples[i]);
+        totalMicroseconds += m_samples[i].asMicroseconds();
+    }
+
+    statistics.average = microseconds(totalMicroseconds / static_cast<std::int64_t>(m_sampleCount));
+
+    // Nearest rank: the smallest sample that at least 99% of the samples do not exceed
+    Time sorted[sampleCapacity];
+    std::copy(m_samples, m_samples + m_sampleCount, sorted);
+
+    const std::size_t rank    = (m_sampleCount * 99u + 99u) / 100u;
+    Time* const       nthIter = sorted + (rank - 1u);
+
+    std::nth_element(sorted, nthIter, sorted + m_sampleCount);
+    statistics.percentile99 = *nthIter;
+
+    return statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void FramePacer::resetStatistics()
+{
+    m_sampleCount = 0u;
+    m_nextSample  = 0u;
+    m_started     = false;
+}
+
+} // namespace sf
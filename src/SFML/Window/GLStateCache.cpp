@@ -0,0 +1,532 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace GLStateCacheImpl
+{
+////////////////////////////////////////////////////////////
+// Incremented whenever objects are deleted, in any context
+constinit std::atomic<std::uint64_t> objectGeneration{0u};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] int getBufferSlotIndex(GLenum target)
+{
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER:
+            return 0;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return 1;
+        case GL_COPY_READ_BUFFER:
+            return 2;
+        case GL_COPY_WRITE_BUFFER:
+            return 3;
+        case GL_UNIFORM_BUFFER:
+            return 4;
+        default:
+            return -1;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] GLenum getBufferBindingQuery(GLenum target)
+{
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER:
+            return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER:
+            return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_COPY_READ_BUFFER:
+            return GL_COPY_READ_BUFFER_BINDING;
+        case GL_COPY_WRITE_BUFFER:
+            return GL_COPY_WRITE_BUFFER_BINDING;
+        default:
+            return GL_UNIFORM_BUFFER_BINDING;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] int getCapabilitySlotIndex(GLenum capability)
+{
+    switch (capability)
+    {
+        case GL_BLEND:
+            return 0;
+        case GL_CULL_FACE:
+            return 1;
+        case GL_DEPTH_TEST:
+            return 2;
+        case GL_STENCIL_TEST:
+            return 3;
+        case GL_SCISSOR_TEST:
+            return 4;
+#ifndef SFML_OPENGL_ES
+        case GL_FRAMEBUFFER_SRGB:
+            return 5;
+#endif
+        default:
+            return -1;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int queryUnsigned(GLenum parameterName)
+{
+    GLint result{};
+    glCheck(glGetIntegerv(parameterName, &result));
+    return static_cast<unsigned int>(result);
+}
+
+} // namespace GLStateCacheImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void GLStateCache::invalidate()
+{
+    const WindowContext::GLStateCacheStatistics statistics = m_statistics;
+    *this                                                  = GLStateCache{};
+
+    m_statistics       = statistics;
+    m_objectGeneration = GLStateCacheImpl::objectGeneration.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::invalidateObjectBindings()
+{
+    GLStateCacheImpl::objectGeneration.fetch_add(1u, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::useProgram(unsigned int program)
+{
+    if (update(m_program, {program}))
+        glCheck(glUseProgram(program));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateCache::getProgram()
+{
+    if (!m_program.known)
+        m_program = {{GLStateCacheImpl::queryUnsigned(GL_CURRENT_PROGRAM)}, true};
+
+    return static_cast<unsigned int>(m_program.values[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::releaseProgram(unsigned int program)
+{
+    if (getProgram() == program)
+        useProgram(0u);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindVertexArray(unsigned int vertexArray)
+{
+    syncObjectBindings();
+
+    if (!update(m_vertexArray, {vertexArray}))
+        return;
+
+    glCheck(glBindVertexArray(vertexArray));
+
+    // The element array buffer binding is part of the vertex array state
+    m_buffers[GLStateCacheImpl::getBufferSlotIndex(GL_ELEMENT_ARRAY_BUFFER)].known = false;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateCache::getVertexArray()
+{
+    syncObjectBindings();
+
+    if (!m_vertexArray.known)
+        m_vertexArray = {{GLStateCacheImpl::queryUnsigned(GL_VERTEX_ARRAY_BINDING)}, true};
+
+    return static_cast<unsigned int>(m_vertexArray.values[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindBuffer(unsigned int target, unsigned int buffer)
+{
+    syncObjectBindings();
+
+    const int index = GLStateCacheImpl::getBufferSlotIndex(target);
+
+    if (index < 0 || update(m_buffers[index], {buffer}))
+        glCheck(glBindBuffer(target, buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindBufferBase(unsigned int target, unsigned int index, unsigned int buffer)
+{
+    syncObjectBindings();
+
+    glCheck(glBindBufferBase(target, index, buffer));
+
+    if (const int slotIndex = GLStateCacheImpl::getBufferSlotIndex(target); slotIndex >= 0)
+        m_buffers[slotIndex] = {{buffer}, true};
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindBufferRange(unsigned int   target,
+                                   unsigned int   index,
+                                   unsigned int   buffer,
+                                   std::ptrdiff_t offset,
+                                   std::ptrdiff_t size)
+{
+    syncObjectBindings();
+
+    glCheck(glBindBufferRange(target, index, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size)));
+
+    if (const int slotIndex = GLStateCacheImpl::getBufferSlotIndex(target); slotIndex >= 0)
+        m_buffers[slotIndex] = {{buffer}, true};
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateCache::getBuffer(unsigned int target)
+{
+    syncObjectBindings();
+
+    const int index = GLStateCacheImpl::getBufferSlotIndex(target);
+
+    if (index < 0)
+        return GLStateCacheImpl::queryUnsigned(GLStateCacheImpl::getBufferBindingQuery(target));
+
+    if (!m_buffers[index].known)
+        m_buffers[index] = {{GLStateCacheImpl::queryUnsigned(GLStateCacheImpl::getBufferBindingQuery(target))}, true};
+
+    return static_cast<unsigned int>(m_buffers[index].values[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::activeTexture(unsigned int unit)
+{
+    if (update(m_activeTexture, {unit - GL_TEXTURE0}))
+        glCheck(glActiveTexture(unit));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateCache::getActiveTexture()
+{
+    if (!m_activeTexture.known)
+        m_activeTexture = {{GLStateCacheImpl::queryUnsigned(GL_ACTIVE_TEXTURE) - GL_TEXTURE0}, true};
+
+    return GL_TEXTURE0 + static_cast<unsigned int>(m_activeTexture.values[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindTexture(unsigned int target, unsigned int texture)
+{
+    syncObjectBindings();
+
+    // Bindings of other targets, or on units whose binding is not tracked, are forwarded as they are
+    const auto unitIndex = static_cast<std::size_t>(m_activeTexture.values[0]);
+
+    if (target != GL_TEXTURE_2D || !m_activeTexture.known || unitIndex >= maxCachedTextureUnits ||
+        update(m_textures2D[unitIndex], {texture}))
+        glCheck(glBindTexture(target, texture));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::bindTextureToUnit(unsigned int unitIndex, unsigned int texture)
+{
+    syncObjectBindings();
+
+    // The check is done before switching units, so that already bound textures cost no call at all
+    if (unitIndex < maxCachedTextureUnits && m_textures2D[unitIndex].known &&
+        m_textures2D[unitIndex].values[0] == texture)
+    {
+        ++m_statistics.skippedCalls;
+        return;
+    }
+
+    activeTexture(GL_TEXTURE0 + unitIndex);
+    bindTexture(GL_TEXTURE_2D, texture);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int GLStateCache::getTexture2D()
+{
+    syncObjectBindings();
+
+    const auto unitIndex = static_cast<std::size_t>(getActiveTexture() - GL_TEXTURE0);
+
+    if (unitIndex >= maxCachedTextureUnits)
+        return GLStateCacheImpl::queryUnsigned(GL_TEXTURE_BINDING_2D);
+
+    if (!m_textures2D[unitIndex].known)
+        m_textures2D[unitIndex] = {{GLStateCacheImpl::queryUnsigned(GL_TEXTURE_BINDING_2D)}, true};
+
+    return static_cast<unsigned int>(m_textures2D[unitIndex].values[0]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::setEnabled(unsigned int capability, bool enabled)
+{
+    const int index = GLStateCacheImpl::getCapabilitySlotIndex(capability);
+
+    if (index >= 0 && !update(m_capabilities[index], {enabled}))
+        return;
+
+    if (enabled)
+        glCheck(glEnable(capability));
+    else
+        glCheck(glDisable(capability));
+}
+
+
+////////////////////////////////////////////////////////////
+bool GLStateCache::isEnabled(unsigned int capability)
+{
+    const int index = GLStateCacheImpl::getCapabilitySlotIndex(capability);
+
+    if (index < 0)
+        return glCheckExpr(glIsEnabled(capability)) == GL_TRUE;
+
+    if (!m_capabilities[index].known)
+        m_capabilities[index] = {{glCheckExpr(glIsEnabled(capability)) == GL_TRUE}, true};
+
+    return m_capabilities[index].values[0] != 0;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::blendFunc(unsigned int sourceFactor, unsigned int destinationFactor)
+{
+    // `glBlendFunc` sets the color and alpha factors alike
+    if (update(m_blendFunc, {sourceFactor, destinationFactor, sourceFactor, destinationFactor}))
+        glCheck(glBlendFunc(sourceFactor, destinationFactor));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::blendFuncSeparate(unsigned int colorSourceFactor,
+                                     unsigned int colorDestinationFactor,
+                                     unsigned int alphaSourceFactor,
+                                     unsigned int alphaDestinationFactor)
+{
+    if (update(m_blendFunc, {colorSourceFactor, colorDestinationFactor, alphaSourceFactor, alphaDestinationFactor}))
+        glCheck(
+            glBlendFuncSeparate(colorSourceFactor, colorDestinationFactor, alphaSourceFactor, alphaDestinationFactor));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::getBlendFuncSeparate(unsigned int (&factors)[4])
+{
+    if (!m_blendFunc.known)
+        m_blendFunc = {{GLStateCacheImpl::queryUnsigned(GL_BLEND_SRC_RGB),
+                        GLStateCacheImpl::queryUnsigned(GL_BLEND_DST_RGB),
+                        GLStateCacheImpl::queryUnsigned(GL_BLEND_SRC_ALPHA),
+                        GLStateCacheImpl::queryUnsigned(GL_BLEND_DST_ALPHA)},
+                       true};
+
+    for (std::size_t i = 0u; i < 4u; ++i)
+        factors[i] = static_cast<unsigned int>(m_blendFunc.values[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::blendEquation(unsigned int equation)
+{
+    if (update(m_blendEquation, {equation, equation}))
+        glCheck(glBlendEquation(equation));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::blendEquationSeparate(unsigned int colorEquation, unsigned int alphaEquation)
+{
+    if (update(m_blendEquation, {colorEquation, alphaEquation}))
+        glCheck(glBlendEquationSeparate(colorEquation, alphaEquation));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::getBlendEquationSeparate(unsigned int (&equations)[2])
+{
+    if (!m_blendEquation.known)
+        m_blendEquation = {{GLStateCacheImpl::queryUnsigned(GL_BLEND_EQUATION_RGB),
+                            GLStateCacheImpl::queryUnsigned(GL_BLEND_EQUATION_ALPHA)},
+                           true};
+
+    equations[0] = static_cast<unsigned int>(m_blendEquation.values[0]);
+    equations[1] = static_cast<unsigned int>(m_blendEquation.values[1]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::stencilFunc(unsigned int function, int reference, unsigned int mask)
+{
+    if (update(m_stencilFunc, {function, reference, mask}))
+        glCheck(glStencilFunc(function, reference, mask));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::stencilOp(unsigned int stencilFail, unsigned int depthFail, unsigned int depthPass)
+{
+    if (update(m_stencilOp, {stencilFail, depthFail, depthPass}))
+        glCheck(glStencilOp(stencilFail, depthFail, depthPass));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::colorMask(bool red, bool green, bool blue, bool alpha)
+{
+    if (update(m_colorMask, {red, green, blue, alpha}))
+        glCheck(glColorMask(red ? GL_TRUE : GL_FALSE,
+                            green ? GL_TRUE : GL_FALSE,
+                            blue ? GL_TRUE : GL_FALSE,
+                            alpha ? GL_TRUE : GL_FALSE));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::scissor(int x, int y, int width, int height)
+{
+    if (update(m_scissor, {x, y, width, height}))
+        glCheck(glScissor(x, y, width, height));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::getScissor(int (&box)[4])
+{
+    if (!m_scissor.known)
+    {
+        GLint result[4]{};
+        glCheck(glGetIntegerv(GL_SCISSOR_BOX, result));
+        m_scissor = {{result[0], result[1], result[2], result[3]}, true};
+    }
+
+    for (std::size_t i = 0u; i < 4u; ++i)
+        box[i] = static_cast<int>(m_scissor.values[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::viewport(int x, int y, int width, int height)
+{
+    if (update(m_viewport, {x, y, width, height}))
+        glCheck(glViewport(x, y, width, height));
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::getViewport(int (&box)[4])
+{
+    if (!m_viewport.known)
+    {
+        GLint result[4]{};
+        glCheck(glGetIntegerv(GL_VIEWPORT, result));
+        m_viewport = {{result[0], result[1], result[2], result[3]}, true};
+    }
+
+    for (std::size_t i = 0u; i < 4u; ++i)
+        box[i] = static_cast<int>(m_viewport.values[i]);
+}
+
+
+////////////////////////////////////////////////////////////
+WindowContext::GLStateCacheStatistics GLStateCache::getStatistics() const
+{
+    return m_statistics;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::resetStatistics()
+{
+    m_statistics = {};
+}
+
+
+////////////////////////////////////////////////////////////
+template <std::size_t N>
+bool GLStateCache::update(Slot<N>& slot, const std::int64_t (&values)[N])
+{
+    if (slot.known)
+    {
+        bool equal = true;
+
+        for (std::size_t i = 0u; i < N; ++i)
+            equal &= slot.values[i] == values[i];
+
+        if (equal)
+        {
+            ++m_statistics.skippedCalls;
+            return false;
+        }
+    }
+
+    base::copy(values, values + N, slot.values);
+    slot.known = true;
+
+    ++m_statistics.issuedCalls;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::syncObjectBindings()
+{
+    const std::uint64_t generation = GLStateCacheImpl::objectGeneration.load(std::memory_order_relaxed);
+
+    if (generation == m_objectGeneration)
+        return;
+
+    forgetObjectBindings();
+    m_objectGeneration = generation;
+}
+
+
+////////////////////////////////////////////////////////////
+void GLStateCache::forgetObjectBindings()
+{
+    m_vertexArray.known = false;
+
+    for (Slot<1>& buffer : m_buffers)
+        buffer.known = false;
+
+    for (Slot<1>& texture : m_textures2D)
+        texture.known = false;
+}
+
+} // namespace sf::priv
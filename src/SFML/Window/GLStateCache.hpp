@@ -0,0 +1,319 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Window/WindowContext.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Shadow copy of the GL state of a context, filtering redundant state changes
+///
+////////////////////////////////////////////////////////////
+class GLStateCache
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the whole state of the context
+    ///
+    /// Must be called when code bypassing the cache, e.g. user
+    /// OpenGL code, may have changed the state.
+    ///
+    ////////////////////////////////////////////////////////////
+    void invalidate();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the object bindings of all the contexts
+    ///
+    /// Must be called after deleting textures, buffers or
+    /// vertex arrays: deleting a bound object resets its
+    /// binding, and its name may then be reused by a new object.
+    ///
+    ////////////////////////////////////////////////////////////
+    static void invalidateObjectBindings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glUseProgram`
+    ///
+    ////////////////////////////////////////////////////////////
+    void useProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current program, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getProgram();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Stop using a program which is about to be deleted
+    ///
+    /// A deleted program stays in use until another program is
+    /// made current, after which its name becomes invalid: it
+    /// must not be saved and restored by code switching programs.
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseProgram(unsigned int program);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBindVertexArray`
+    ///
+    /// Also forgets the element array buffer binding, which is
+    /// part of the vertex array state.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindVertexArray(unsigned int vertexArray);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current vertex array, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getVertexArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBindBuffer`
+    ///
+    /// Array, element array, copy read, copy write and uniform
+    /// buffer bindings are cached, other targets are forwarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindBuffer(unsigned int target, unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief `glBindBufferBase`, which also binds the generic binding point of `target`
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindBufferBase(unsigned int target, unsigned int index, unsigned int buffer);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief `glBindBufferRange`, which also binds the generic binding point of `target`
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindBufferRange(unsigned int   target,
+                         unsigned int   index,
+                         unsigned int   buffer,
+                         std::ptrdiff_t offset,
+                         std::ptrdiff_t size);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the buffer bound to `target`, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBuffer(unsigned int target);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glActiveTexture`
+    ///
+    /// \param unit Texture unit, `GL_TEXTURE0 + index`
+    ///
+    ////////////////////////////////////////////////////////////
+    void activeTexture(unsigned int unit);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the active texture unit, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getActiveTexture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBindTexture` on the active texture unit
+    ///
+    /// Only `GL_TEXTURE_2D` bindings of the first
+    /// `maxCachedTextureUnits` units are cached.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindTexture(unsigned int target, unsigned int texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind a 2D texture to a unit, switching the active unit only if needed
+    ///
+    /// The active texture unit is left to `unitIndex` if the
+    /// texture had to be bound.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bindTextureToUnit(unsigned int unitIndex, unsigned int texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the 2D texture bound to the active unit, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getTexture2D();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glEnable`/`glDisable`
+    ///
+    /// Blending, face culling, depth, stencil and scissor tests
+    /// and sRGB framebuffers are cached, other capabilities are
+    /// forwarded.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEnabled(unsigned int capability, bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glIsEnabled`, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEnabled(unsigned int capability);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBlendFunc`
+    ///
+    ////////////////////////////////////////////////////////////
+    void blendFunc(unsigned int sourceFactor, unsigned int destinationFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBlendFuncSeparate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void blendFuncSeparate(unsigned int colorSourceFactor,
+                           unsigned int colorDestinationFactor,
+                           unsigned int alphaSourceFactor,
+                           unsigned int alphaDestinationFactor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the blend factors, querying OpenGL only if unknown
+    ///
+    /// \param factors Color source, color destination, alpha source and alpha destination factors
+    ///
+    ////////////////////////////////////////////////////////////
+    void getBlendFuncSeparate(unsigned int (&factors)[4]);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBlendEquation`
+    ///
+    ////////////////////////////////////////////////////////////
+    void blendEquation(unsigned int equation);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glBlendEquationSeparate`
+    ///
+    ////////////////////////////////////////////////////////////
+    void blendEquationSeparate(unsigned int colorEquation, unsigned int alphaEquation);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the blend equations, querying OpenGL only if unknown
+    ///
+    /// \param equations Color and alpha equations
+    ///
+    ////////////////////////////////////////////////////////////
+    void getBlendEquationSeparate(unsigned int (&equations)[2]);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glStencilFunc`
+    ///
+    ////////////////////////////////////////////////////////////
+    void stencilFunc(unsigned int function, int reference, unsigned int mask);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glStencilOp`
+    ///
+    ////////////////////////////////////////////////////////////
+    void stencilOp(unsigned int stencilFail, unsigned int depthFail, unsigned int depthPass);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glColorMask`
+    ///
+    ////////////////////////////////////////////////////////////
+    void colorMask(bool red, bool green, bool blue, bool alpha);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glScissor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void scissor(int x, int y, int width, int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scissor box, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    void getScissor(int (&box)[4]);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached `glViewport`
+    ///
+    ////////////////////////////////////////////////////////////
+    void viewport(int x, int y, int width, int height);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the viewport, querying OpenGL only if unknown
+    ///
+    ////////////////////////////////////////////////////////////
+    void getViewport(int (&box)[4]);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of state changes forwarded and skipped since the last reset
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] WindowContext::GLStateCacheStatistics getStatistics() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Reset the counters of forwarded and skipped state changes
+    ///
+    ////////////////////////////////////////////////////////////
+    void resetStatistics();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Number of texture units whose 2D binding is cached
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr std::size_t maxCachedTextureUnits = 16u;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Cached piece of state made of `N` values
+    ///
+    ////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    struct Slot
+    {
+        std::int64_t values[N]{}; //!< Last values set
+        bool         known{};     //!< Do the values reflect the state of the context?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Record new values in a slot
+    ///
+    /// \return True if the state changed and must be set, false if the change is redundant
+    ///
+    ////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    [[nodiscard]] bool update(Slot<N>& slot, const std::int64_t (&values)[N]);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the object bindings if objects were deleted since the last check
+    ///
+    ////////////////////////////////////////////////////////////
+    void syncObjectBindings();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forget the bindings of textures, buffers and vertex arrays
+    ///
+    ////////////////////////////////////////////////////////////
+    void forgetObjectBindings();
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Slot<1>                               m_program;                           //!< Current program
+    Slot<1>                               m_vertexArray;                       //!< Bound vertex array
+    Slot<1>                               m_buffers[5];                        //!< Bound buffers of the cached targets
+    Slot<1>                               m_activeTexture;                     //!< Active texture unit, as an index
+    Slot<1>                               m_textures2D[maxCachedTextureUnits]; //!< 2D texture bound to each unit
+    Slot<1>                               m_capabilities[6];                   //!< State of the cached capabilities
+    Slot<4>                               m_blendFunc;                         //!< Color and alpha blend factors
+    Slot<2>                               m_blendEquation;                     //!< Color and alpha blend equations
+    Slot<3>                               m_stencilFunc;                       //!< Stencil function, reference and mask
+    Slot<3>                               m_stencilOp;                         //!< Stencil operations
+    Slot<4>                               m_colorMask;                         //!< Color write mask
+    Slot<4>                               m_scissor;                           //!< Scissor box
+    Slot<4>                               m_viewport;                          //!< Viewport
+    std::uint64_t                         m_objectGeneration{};                //!< Object generation last synced
+    WindowContext::GLStateCacheStatistics m_statistics;                        //!< Forwarded and skipped state changes
+};
+
+} // namespace sf::priv
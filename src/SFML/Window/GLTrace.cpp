@@ -0,0 +1,402 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Window/GLTrace.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include <glad/gl.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace GLTraceImpl
+{
+////////////////////////////////////////////////////////////
+// GL entry points wrapped by the trace, without their `gl` prefix
+#define SFML_PRIV_GL_TRACED_FUNCTIONS(X)                                                                       \
+    X(ActiveTexture) X(AttachShader) X(BindBuffer) X(BindBufferBase) X(BindBufferRange) X(BindFramebuffer)     \
+    X(BindRenderbuffer) X(BindSampler) X(BindTexture) X(BindVertexArray) X(BlendColor) X(BlendEquation)        \
+    X(BlendEquationSeparate) X(BlendFunc) X(BlendFuncSeparate) X(BlitFramebuffer) X(BufferData)                \
+    X(BufferSubData) X(Clear) X(ClearColor) X(ClearStencil) X(ColorMask) X(CompileShader) X(CopyBufferSubData) \
+    X(CopyTexSubImage2D) X(CreateProgram) X(CreateShader) X(DeleteBuffers) X(DeleteFramebuffers)               \
+    X(DeleteProgram) X(DeleteShader) X(DeleteTextures) X(DeleteVertexArrays) X(Disable)                        \
+    X(DisableVertexAttribArray) X(DrawArrays) X(DrawArraysInstanced) X(DrawBuffers) X(DrawElements)            \
+    X(DrawElementsBaseVertex) X(DrawElementsInstanced) X(Enable) X(EnableVertexAttribArray) X(Finish)          \
+    X(Flush) X(FramebufferTexture2D) X(GenBuffers) X(GenFramebuffers) X(GenTextures) X(GenVertexArrays)        \
+    X(GenerateMipmap) X(GetIntegerv) X(GetUniformLocation) X(LinkProgram) X(MapBuffer) X(MapBufferRange)       \
+    X(PixelStorei) X(ReadPixels) X(Scissor) X(ShaderSource) X(StencilFunc) X(StencilMask) X(StencilOp)         \
+    X(TexImage2D) X(TexParameteri) X(TexSubImage2D) X(Uniform1f) X(Uniform1fv) X(Uniform1i) X(Uniform1iv)      \
+    X(Uniform2f) X(Uniform2fv) X(Uniform2i) X(Uniform3f) X(Uniform3fv) X(Uniform3i) X(Uniform4f)               \
+    X(Uniform4fv) X(Uniform4i) X(UniformMatrix3fv) X(UniformMatrix4fv) X(UnmapBuffer) X(UseProgram)            \
+    X(VertexAttribPointer) X(Viewport)
+
+
+////////////////////////////////////////////////////////////
+enum class CallId : std::uint16_t
+{
+#define SFML_PRIV_GL_TRACE_ENUMERATOR(name) name,
+    SFML_PRIV_GL_TRACED_FUNCTIONS(SFML_PRIV_GL_TRACE_ENUMERATOR)
+#undef SFML_PRIV_GL_TRACE_ENUMERATOR
+};
+
+
+////////////////////////////////////////////////////////////
+constexpr const char* callNames[]{
+#define SFML_PRIV_GL_TRACE_NAME(name) "gl" #name,
+    SFML_PRIV_GL_TRACED_FUNCTIONS(SFML_PRIV_GL_TRACE_NAME)
+#undef SFML_PRIV_GL_TRACE_NAME
+};
+
+
+////////////////////////////////////////////////////////////
+constexpr char          traceMagic[8]{'S', 'F', 'G', 'L', 'T', 'R', 'C', '1'};
+constexpr std::uint16_t frameMarkerId    = 0xFFFF;
+constexpr std::uint8_t  hasByteCountFlag = 1u;
+constexpr std::size_t   flushThreshold   = 1024u * 1024u;
+
+
+////////////////////////////////////////////////////////////
+// Buffers the records of all the threads, and writes them to the trace file
+class TraceWriter
+{
+public:
+    [[nodiscard]] bool open(const char* path)
+    {
+        m_file = std::fopen(path, "wb");
+
+        if (m_file == nullptr)
+            return false;
+
+        append(traceMagic, sizeof(traceMagic));
+        appendValue(static_cast<std::uint16_t>(sizeof(callNames) / sizeof(callNames[0])));
+
+        for (const char* name : callNames)
+        {
+            const auto length = static_cast<std::uint16_t>(std::strlen(name));
+            appendValue(length);
+            append(name, length);
+        }
+
+        m_startTime = std::chrono::steady_clock::now();
+        m_active.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void close()
+    {
+        const std::lock_guard lock(m_mutex);
+
+        m_active.store(false, std::memory_order_release);
+
+        if (m_file == nullptr)
+            return;
+
+        flush();
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+
+    [[nodiscard]] bool isActive() const
+    {
+        return m_active.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::uint64_t now() const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    void record(std::uint16_t        callId,
+                std::uint64_t        startTime,
+                std::uint64_t        endTime,
+                const std::uint64_t* arguments,
+                std::uint8_t         argumentCount,
+                const std::uint64_t* byteCount)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        if (m_file == nullptr)
+            return;
+
+        const std::uint64_t duration = endTime - startTime;
+
+        appendValue(callId);
+        appendValue(argumentCount);
+        appendValue(static_cast<std::uint8_t>(byteCount != nullptr ? hasByteCountFlag : 0u));
+        appendValue(static_cast<std::uint32_t>(duration > 0xFFFF'FFFFu ? 0xFFFF'FFFFu : duration));
+        appendValue(startTime);
+
+        if (byteCount != nullptr)
+            appendValue(*byteCount);
+
+        append(arguments, argumentCount * sizeof(std::uint64_t));
+
+        if (m_buffer.size() >= flushThreshold)
+            flush();
+    }
+
+private:
+    void append(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void appendValue(T value)
+    {
+        append(&value, sizeof(value));
+    }
+
+    void flush()
+    {
+        if (!m_buffer.empty() && std::fwrite(m_buffer.data(), 1u, m_buffer.size(), m_file) != m_buffer.size())
+            sf::priv::err() << "Failed to write GL trace, further calls are not recorded";
+
+        m_buffer.clear();
+    }
+
+    std::FILE*                            m_file{};      //!< Trace file
+    std::vector<unsigned char>            m_buffer;      //!< Records not written yet
+    std::mutex                            m_mutex;       //!< Protects the buffer and the file
+    std::atomic<bool>                     m_active{};    //!< Are calls being recorded?
+    std::chrono::steady_clock::time_point m_startTime{}; //!< Time of the start of the trace
+};
+
+
+////////////////////////////////////////////////////////////
+// Never destroyed, so that GL calls made during static destruction remain safe; the file is closed at exit
+TraceWriter* traceWriter = nullptr;
+
+
+////////////////////////////////////////////////////////////
+template <typename T>
+[[nodiscard]] std::uint64_t toTraceArgument(T value)
+{
+    if constexpr (std::is_pointer_v<T>)
+    {
+        return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(value));
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        if constexpr (sizeof(T) == sizeof(std::uint32_t))
+        {
+            std::uint32_t bits{};
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+        else
+        {
+            std::uint64_t bits{};
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+    }
+    else if constexpr (std::is_signed_v<T>)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Approximate size of a pixel, ignoring the pixel store alignment
+[[nodiscard]] std::uint64_t getBytesPerPixel(std::uint64_t format, std::uint64_t type)
+{
+    std::uint64_t componentCount = 4u;
+
+    switch (format)
+    {
+        case GL_RED:
+        case GL_RED_INTEGER:
+        case GL_DEPTH_COMPONENT:
+        case GL_STENCIL_INDEX:
+            componentCount = 1u;
+            break;
+        case GL_RG:
+        case GL_RG_INTEGER:
+            componentCount = 2u;
+            break;
+        case GL_RGB:
+        case GL_RGB_INTEGER:
+            componentCount = 3u;
+            break;
+        default:
+            break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT:
+            return componentCount * 2u;
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+        case GL_FLOAT:
+            return componentCount * 4u;
+        case GL_UNSIGNED_INT_24_8:
+            return 4u;
+        default:
+            return componentCount;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+// Number of bytes uploaded or read back by the calls transferring data
+[[nodiscard]] bool getByteCount(CallId callId, const std::uint64_t* arguments, std::uint64_t& byteCount)
+{
+    switch (callId)
+    {
+        case CallId::BufferData:
+            byteCount = arguments[1];
+            return true;
+        case CallId::BufferSubData:
+            byteCount = arguments[2];
+            return true;
+        case CallId::TexImage2D:
+            byteCount = arguments[3] * arguments[4] * getBytesPerPixel(arguments[6], arguments[7]);
+            return true;
+        case CallId::TexSubImage2D:
+            byteCount = arguments[4] * arguments[5] * getBytesPerPixel(arguments[6], arguments[7]);
+            return true;
+        case CallId::ReadPixels:
+            byteCount = arguments[2] * arguments[3] * getBytesPerPixel(arguments[4], arguments[5]);
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename... Args>
+void recordCall(CallId callId, std::uint64_t startTime, Args... args)
+{
+    // One extra element so that calls without arguments don't declare an empty array
+    const std::uint64_t arguments[sizeof...(Args) + 1u]{toTraceArgument(args)...};
+    const std::uint64_t endTime = traceWriter->now();
+
+    std::uint64_t byteCount{};
+    const bool    hasByteCount = getByteCount(callId, arguments, byteCount);
+
+    traceWriter->record(static_cast<std::uint16_t>(callId),
+                        startTime,
+                        endTime,
+                        arguments,
+                        static_cast<std::uint8_t>(sizeof...(Args)),
+                        hasByteCount ? &byteCount : nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+// Wrapper of a GL entry point, recording its calls before forwarding them to the original entry point
+template <CallId Id, typename FunctionPointer>
+struct Hook;
+
+template <CallId Id, typename Result, typename... Args>
+struct Hook<Id, Result(GLAD_API_PTR*)(Args...)>
+{
+    using FunctionPointer = Result(GLAD_API_PTR*)(Args...);
+
+    static inline FunctionPointer original = nullptr;
+
+    static Result GLAD_API_PTR call(Args... args)
+    {
+        if (!traceWriter->isActive())
+            return original(args...);
+
+        const std::uint64_t startTime = traceWriter->now();
+
+        if constexpr (std::is_void_v<Result>)
+        {
+            original(args...);
+            recordCall(Id, startTime, args...);
+        }
+        else
+        {
+            Result result = original(args...);
+            recordCall(Id, startTime, args...);
+            return result;
+        }
+    }
+
+    static void install(FunctionPointer& pointer)
+    {
+        // Entry points missing from the current context are left as they are
+        if (pointer == nullptr || pointer == &call)
+            return;
+
+        original = pointer;
+        pointer  = &call;
+    }
+};
+
+} // namespace GLTraceImpl
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+void installGLTraceHooks()
+{
+    const char* path = std::getenv("SFML_GL_TRACE_FILE");
+
+    if (path == nullptr || *path == '\0')
+        return;
+
+    if (GLTraceImpl::traceWriter == nullptr)
+    {
+        auto* writer = new GLTraceImpl::TraceWriter;
+
+        if (!writer->open(path))
+        {
+            priv::err() << "Failed to open GL trace file " << path;
+            delete writer;
+            return;
+        }
+
+        GLTraceImpl::traceWriter = writer;
+        std::atexit([] { GLTraceImpl::traceWriter->close(); });
+    }
+
+#define SFML_PRIV_GL_TRACE_INSTALL(name) \
+    GLTraceImpl::Hook<GLTraceImpl::CallId::name, decltype(glad_gl##name)>::install(glad_gl##name);
+    SFML_PRIV_GL_TRACED_FUNCTIONS(SFML_PRIV_GL_TRACE_INSTALL)
+#undef SFML_PRIV_GL_TRACE_INSTALL
+}
+
+
+////////////////////////////////////////////////////////////
+void markGLTraceFrame()
+{
+    if (GLTraceImpl::traceWriter == nullptr || !GLTraceImpl::traceWriter->isActive())
+        return;
+
+    const std::uint64_t now = GLTraceImpl::traceWriter->now();
+    GLTraceImpl::traceWriter->record(GLTraceImpl::frameMarkerId, now, now, nullptr, 0u, nullptr);
+}
+
+} // namespace sf::priv
@@ -0,0 +1,50 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Start recording the GL calls if requested by the environment
+///
+/// If the `SFML_GL_TRACE_FILE` environment variable names a
+/// file, replaces the traced GL entry points loaded by GLAD
+/// with wrappers recording each call into that file. Must be
+/// called after the entry points are loaded.
+///
+/// Only available when SFML is built with
+/// `SFML_ENABLE_GL_TRACING`.
+///
+////////////////////////////////////////////////////////////
+void installGLTraceHooks();
+
+////////////////////////////////////////////////////////////
+/// \brief Record the end of a frame in the trace, if recording
+///
+////////////////////////////////////////////////////////////
+void markGLTraceFrame();
+
+} // namespace sf::priv
+
+
+////////////////////////////////////////////////////////////
+// Trace file format, all integers little-endian:
+//
+// Header:
+//   char[8]  magic            "SFGLTRC1"
+//   u16      callNameCount
+//   callNameCount times:
+//     u16    nameLength
+//     char[] name             e.g. "glDrawElements", not null-terminated
+//
+// Records, until the end of the file:
+//   u16      callId           index into the names, 0xFFFF for the end of a frame
+//   u8       argumentCount
+//   u8       flags            bit 0: a byte count follows the duration
+//   u32      durationNs       CPU time spent in the call
+//   u64      timestampNs      CPU time at the start of the call, since the start of the trace
+//   u64      byteCount        only if flagged: bytes uploaded or read back by the call
+//   u64[]    arguments        integers zero or sign-extended, floats as their bits, pointers as addresses
+//
+// `examples/gl_trace_summary` reads and summarizes such files.
+////////////////////////////////////////////////////////////
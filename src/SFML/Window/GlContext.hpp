@@ -5,6 +5,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/ContextSettings.hpp"
+#include "SFML/Window/GLStateCache.hpp"
 
 #include <cstdint>
 
@@ -158,7 +159,8 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    const std::uint64_t m_id;
+    const std::uint64_t m_id;         //!< Unique identifier of the context
+    GLStateCache        m_stateCache; //!< Shadow copy of the GL state of the context
 };
 
 } // namespace sf::priv
@@ -3,6 +3,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Window/GLTrace.hpp"
 #include "SFML/Window/GlContext.hpp"
 #include "SFML/Window/VideoMode.hpp"
 #include "SFML/Window/VideoModeUtils.hpp"
@@ -11,9 +12,8 @@
 #include "SFML/Window/WindowImpl.hpp"
 #include "SFML/Window/WindowSettings.hpp"
 
-#include "SFML/System/Clock.hpp"
 #include "SFML/System/Err.hpp"
-#include "SFML/System/Sleep.hpp"
+#include "SFML/System/FramePacer.hpp"
 #include "SFML/System/Time.hpp"
 
 #include "SFML/Base/Macros.hpp"
@@ -30,9 +30,9 @@ namespace sf
 struct Window::Window::Impl
 {
     WindowContext*                   windowContext;
-    base::UniquePtr<priv::GlContext> glContext;      //!< Platform-specific implementation of the OpenGL context
-    Clock                            clock;          //!< Clock for measuring the elapsed time between frames
-    Time                             frameTimeLimit; //!< Current framerate limit
+    base::UniquePtr<priv::GlContext> glContext;     //!< Platform-specific implementation of the OpenGL context
+    FramePacer                       framePacer;    //!< Limits the framerate and measures the time between frames
+    DisplayHook                      displayHook{}; //!< Called before presenting each frame, if any
 
     explicit Impl(WindowContext& theWindowContext, base::UniquePtr<priv::GlContext>&& theContext) :
     windowContext(&theWindowContext),
@@ -114,7 +114,14 @@ void Window::setVerticalSyncEnabled(bool enabled)
 ////////////////////////////////////////////////////////////
 void Window::setFramerateLimit(unsigned int limit)
 {
-    m_impl->frameTimeLimit = limit > 0 ? seconds(1.f / static_cast<float>(limit)) : Time::Zero;
+    m_impl->framePacer.setTargetFrameTime(limit > 0 ? seconds(1.f / static_cast<float>(limit)) : Time::Zero);
+}
+
+
+////////////////////////////////////////////////////////////
+FramePacer::Statistics Window::getFrameTimeStatistics() const
+{
+    return m_impl->framePacer.getStatistics();
 }
 
 
@@ -136,18 +143,30 @@ void Window::display()
 {
     // Display the backbuffer on screen
     if (setActive())
-        m_impl->glContext->display();
-
-    // Limit the framerate if needed
-    if (m_impl->frameTimeLimit != Time::Zero)
     {
-        sleep(m_impl->frameTimeLimit - m_impl->clock.getElapsedTime());
-        m_impl->clock.restart();
+        if (m_impl->displayHook != nullptr)
+            m_impl->displayHook(*this);
+
+        m_impl->glContext->display();
     }
 
+#ifdef SFML_ENABLE_GL_TRACING
+    priv::markGLTraceFrame();
+#endif
+
+    // Limit the framerate if needed, and measure the frame time
+    m_impl->framePacer.waitForNextFrame();
+
 #ifdef SFML_SYSTEM_EMSCRIPTEN
     emscripten_sleep(0u);
 #endif
 }
 
+
+////////////////////////////////////////////////////////////
+void Window::setDisplayHook(DisplayHook hook)
+{
+    m_impl->displayHook = hook;
+}
+
 } // namespace sf
@@ -8,6 +8,8 @@
 #include "SFML/Window/ContextSettings.hpp"
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLExtensions.hpp"
+#include "SFML/Window/GLStateCache.hpp"
+#include "SFML/Window/GLTrace.hpp"
 #include "SFML/Window/GlContext.hpp"
 #include "SFML/Window/GlContextTypeImpl.hpp"
 #include "SFML/Window/WindowContext.hpp"
@@ -408,6 +410,30 @@ const priv::GlContext* WindowContext::getActiveThreadLocalGlContextPtr() const
 }
 
 
+////////////////////////////////////////////////////////////
+priv::GLStateCache& WindowContext::getActiveGLStateCache() const
+{
+    SFML_BASE_ASSERT(windowContextAlive);
+    SFML_BASE_ASSERT(activeGlContext.ptr != nullptr);
+
+    return activeGlContext.ptr->m_stateCache;
+}
+
+
+////////////////////////////////////////////////////////////
+WindowContext::GLStateCacheStatistics WindowContext::getGLStateCacheStatistics() const
+{
+    return getActiveGLStateCache().getStatistics();
+}
+
+
+////////////////////////////////////////////////////////////
+void WindowContext::resetGLStateCacheStatistics()
+{
+    getActiveGLStateCache().resetStatistics();
+}
+
+
 ////////////////////////////////////////////////////////////
 std::uint64_t WindowContext::getActiveThreadLocalGlContextId() const
 {
@@ -503,6 +529,11 @@ void WindowContext::loadGLEntryPointsViaGLAD() const
 #else
     gladLoadGL(getGLLoadFn());
 #endif
+
+#ifdef SFML_ENABLE_GL_TRACING
+    // Wrap the entry points that were just loaded, if requested
+    priv::installGLTraceHooks();
+#endif
 }
 
 
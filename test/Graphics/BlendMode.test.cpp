@@ -187,5 +187,12 @@ TEST_CASE("[Graphics] sf::BlendMode")
         CHECK(sf::BlendNone.alphaSrcFactor == sf::BlendMode::Factor::One);
         CHECK(sf::BlendNone.alphaDstFactor == sf::BlendMode::Factor::Zero);
         CHECK(sf::BlendNone.alphaEquation == sf::BlendMode::Equation::Add);
+
+        CHECK(sf::BlendPremultipliedAlpha.colorSrcFactor == sf::BlendMode::Factor::One);
+        CHECK(sf::BlendPremultipliedAlpha.colorDstFactor == sf::BlendMode::Factor::OneMinusSrcAlpha);
+        CHECK(sf::BlendPremultipliedAlpha.colorEquation == sf::BlendMode::Equation::Add);
+        CHECK(sf::BlendPremultipliedAlpha.alphaSrcFactor == sf::BlendMode::Factor::One);
+        CHECK(sf::BlendPremultipliedAlpha.alphaDstFactor == sf::BlendMode::Factor::OneMinusSrcAlpha);
+        CHECK(sf::BlendPremultipliedAlpha.alphaEquation == sf::BlendMode::Equation::Add);
     }
 }
@@ -1,9 +1,13 @@
 #include "SFML/Graphics/CircleShape.hpp"
 
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+
 #include <Doctest.hpp>
 
 #include <CommonTraits.hpp>
 #include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
 
 TEST_CASE("[Graphics] sf::CircleShape")
 {
@@ -131,3 +135,60 @@ TEST_CASE("[Graphics] sf::CircleShape")
         }
     }
 }
+
+TEST_CASE("[Graphics] sf::CircleShape (unit-circle tables)" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("getUnitCircleTable()")
+    {
+        CHECK(graphicsContext.getUnitCircleTable(0) == nullptr);
+
+        const sf::Vector2f* table = graphicsContext.getUnitCircleTable(4);
+        REQUIRE(table != nullptr);
+        CHECK(table[0] == Approx(sf::Vector2f(0.f, -1.f)));
+        CHECK(table[1] == Approx(sf::Vector2f(1.f, 0.f)));
+        CHECK(table[2] == Approx(sf::Vector2f(0.f, 1.f)));
+        CHECK(table[3] == Approx(sf::Vector2f(-1.f, 0.f)));
+
+        // Cached per point count, and never moved by later insertions
+        CHECK(graphicsContext.getUnitCircleTable(3) != table);
+        CHECK(graphicsContext.getUnitCircleTable(64) != table);
+        CHECK(graphicsContext.getUnitCircleTable(4) == table);
+    }
+
+    SECTION("Same points as the trigonometric path")
+    {
+        sf::CircleShape reference(15.f, 30);
+        sf::CircleShape circle(graphicsContext, 15.f, 30);
+
+        const auto checkSamePoints = [&]
+        {
+            REQUIRE(circle.getPointCount() == reference.getPointCount());
+            CHECK(circle.getRadius() == reference.getRadius());
+            CHECK(circle.getGeometricCenter() == reference.getGeometricCenter());
+            CHECK(circle.getLocalBounds() == reference.getLocalBounds());
+
+            for (std::size_t i = 0; i < circle.getPointCount(); ++i)
+                CHECK(circle.getPoint(i) == reference.getPoint(i));
+        };
+
+        checkSamePoints();
+
+        reference.setRadius(42.5f);
+        circle.setRadius(42.5f);
+        checkSamePoints();
+
+        reference.setPointCount(7);
+        circle.setPointCount(7);
+        checkSamePoints();
+
+        reference.setOutlineThickness(3.f);
+        circle.setOutlineThickness(3.f);
+        checkSamePoints();
+
+        reference.setPointCount(2);
+        circle.setPointCount(2);
+        checkSamePoints();
+    }
+}
@@ -11,6 +11,13 @@
 #include <CommonTraits.hpp>
 #include <GraphicsUtil.hpp>
 
+#include <utility>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
 TEST_CASE("[Graphics] sf::Image")
 {
     SECTION("Type traits")
@@ -194,6 +201,18 @@ TEST_CASE("[Graphics] sf::Image")
         CHECK(image.getPixelsPtr() != nullptr);
         CHECK(image.getPixel({0, 0}) == sf::Color(255, 255, 255, 0));
         CHECK(image.getPixel({200, 150}) == sf::Color(144, 208, 62));
+        CHECK(!image.isAlphaPremultiplied());
+    }
+
+    SECTION("Load with premultiplied alpha")
+    {
+        const auto memory = sf::ImageUtils::saveToMemory(sf::Image::create({8, 8}, sf::Color(255, 128, 0, 128)).value(),
+                                                         sf::ImageUtils::SaveFormat::PNG);
+
+        const auto image = sf::Image::loadFromMemory(memory.data(), memory.size(), /* premultiplyAlpha */ true).value();
+        CHECK(image.isAlphaPremultiplied());
+        CHECK(image.getPixel({0, 0}) == sf::Color(128, 64, 0, 128));
+        CHECK(image.getPixel({7, 7}) == sf::Color(128, 64, 0, 128));
     }
 
     SECTION("saveToFile()")
@@ -362,6 +381,26 @@ TEST_CASE("[Graphics] sf::Image")
             }
         }
 
+        SECTION("Copy premultiplied (Image, Vector2u, IntRect, bool)")
+        {
+            auto image1 = sf::Image::create(sf::Vector2u{10, 10}, sf::Color(0, 0, 255, 255)).value();
+            auto image2 = sf::Image::create(sf::Vector2u{10, 10}, sf::Color(255, 0, 0, 128)).value();
+            image1.premultiplyAlpha();
+            image2.premultiplyAlpha();
+
+            // Premultiplied over: source + destination * (255 - source alpha) / 255
+            CHECK(image1.copy(image2, sf::Vector2u{0, 0}, sf::IntRect(sf::Vector2i{0, 0}, sf::Vector2i{10, 10}), true));
+            CHECK(image1.isAlphaPremultiplied());
+
+            for (std::uint32_t i = 0; i < 10; ++i)
+            {
+                for (std::uint32_t j = 0; j < 10; ++j)
+                {
+                    CHECK(image1.getPixel(sf::Vector2u{i, j}) == sf::Color(128, 0, 127, 255));
+                }
+            }
+        }
+
         SECTION("Copy (Out of bounds sourceRect)")
         {
             const auto image1 = sf::Image::create(sf::Vector2u{5, 5}, sf::Color::Blue).value();
@@ -378,6 +417,91 @@ TEST_CASE("[Graphics] sf::Image")
         }
     }
 
+    SECTION("Image views")
+    {
+        // 3x2 BGRA pixels, with rows padded to 4 pixels
+        std::uint8_t bgraPixels[4 * 2 * 4]{};
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            bgraPixels[i * 4 + 0] = 30;
+            bgraPixels[i * 4 + 1] = 20;
+            bgraPixels[i * 4 + 2] = static_cast<std::uint8_t>(10 * i);
+            bgraPixels[i * 4 + 3] = 255;
+        }
+
+        const sf::ImageView view{bgraPixels, {3u, 2u}, 16u, sf::PixelFormat::BGRA};
+
+        SECTION("create(ImageView)")
+        {
+            const auto image = sf::Image::create(view).value();
+            CHECK(image.getSize() == sf::Vector2u{3, 2});
+            CHECK(image.getPixel({0, 0}) == sf::Color(0, 20, 30));
+            CHECK(image.getPixel({2, 0}) == sf::Color(20, 20, 30));
+            CHECK(image.getPixel({0, 1}) == sf::Color(40, 20, 30));
+            CHECK(image.getPixel({2, 1}) == sf::Color(60, 20, 30));
+
+            CHECK(!sf::Image::create(sf::ImageView{nullptr, {3u, 2u}}).hasValue());
+            CHECK(!sf::Image::create(sf::ImageView{bgraPixels, {0u, 2u}}).hasValue());
+        }
+
+        SECTION("copy(ImageView)")
+        {
+            auto image = sf::Image::create(sf::Vector2u{4, 4}, sf::Color::Black).value();
+            CHECK(image.copy(view, {1, 1}, sf::IntRect({1, 0}, {2, 2})));
+            CHECK(image.getPixel({0, 0}) == sf::Color::Black);
+            CHECK(image.getPixel({1, 1}) == sf::Color(10, 20, 30));
+            CHECK(image.getPixel({2, 2}) == sf::Color(60, 20, 30));
+            CHECK(image.getPixel({3, 3}) == sf::Color::Black);
+        }
+
+        SECTION("asImageView()")
+        {
+            const auto image     = sf::Image::create(sf::Vector2u{5, 3}, sf::Color::Red).value();
+            const auto imageView = image.asImageView();
+            CHECK(imageView.pixels == image.getPixelsPtr());
+            CHECK(imageView.size == sf::Vector2u{5, 3});
+            CHECK(imageView.isContiguous());
+            CHECK(imageView.format == sf::PixelFormat::RGBA);
+        }
+
+        SECTION("Pixel operations on a sub-view")
+        {
+            auto image = sf::Image::create(sf::Vector2u{6, 4}, sf::Color(10, 20, 30)).value();
+            image.setPixel({1, 1}, sf::Color(40, 50, 60));
+            image.setPixel({2, 2}, sf::Color(70, 80, 90));
+
+            const sf::MutableImageView subView = image.asMutableImageView().getSubView({1u, 1u}, {3u, 2u});
+
+            sf::ImageUtils::flipVertically(subView);
+            CHECK(image.getPixel({1, 2}) == sf::Color(40, 50, 60));
+            CHECK(image.getPixel({2, 1}) == sf::Color(70, 80, 90));
+
+            sf::ImageUtils::swapRedBlueChannels(subView);
+            CHECK(image.getPixel({1, 2}) == sf::Color(60, 50, 40));
+            CHECK(image.getPixel({3, 1}) == sf::Color(30, 20, 10));
+            CHECK(image.getPixel({0, 0}) == sf::Color(10, 20, 30));
+            CHECK(image.getPixel({4, 1}) == sf::Color(10, 20, 30));
+
+            sf::ImageUtils::applyColorKey(subView, sf::Color(10, 20, 30));
+            CHECK(image.getPixel({3, 1}) == sf::Color(30, 20, 10));
+
+            sf::ImageUtils::applyColorKey({subView.pixels, subView.size, subView.stride, sf::PixelFormat::BGRA},
+                                          sf::Color(10, 20, 30));
+            CHECK(image.getPixel({3, 1}) == sf::Color(30, 20, 10, 0));
+            CHECK(image.getPixel({1, 2}) == sf::Color(60, 50, 40));
+            CHECK(image.getPixel({0, 0}) == sf::Color(10, 20, 30));
+        }
+
+        SECTION("saveToMemory(ImageView)")
+        {
+            const auto memory = sf::ImageUtils::saveToMemory(view, sf::ImageUtils::SaveFormat::PNG);
+            const auto image  = sf::Image::loadFromMemory(memory.data(), memory.size()).value();
+            CHECK(image.getSize() == sf::Vector2u{3, 2});
+            CHECK(image.getPixel({1, 0}) == sf::Color(10, 20, 30));
+            CHECK(image.getPixel({2, 1}) == sf::Color(60, 20, 30));
+        }
+    }
+
     SECTION("Create mask from color")
     {
         SECTION("createMaskFromColor(Color)")
@@ -426,4 +550,258 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u{0, 9}) == sf::Color::Green);
     }
+
+    SECTION("Flip odd widths")
+    {
+        // Exercise both the vectorized body and the scalar tail of the row kernels
+        for (const unsigned int width : {1u, 3u, 7u, 17u, 33u})
+        {
+            auto image = sf::Image::create(sf::Vector2u{width, 3}, sf::Color::Red).value();
+            image.setPixel(sf::Vector2u{0, 0}, sf::Color::Green);
+            image.setPixel(sf::Vector2u{1 % width, 2}, sf::Color::Blue);
+
+            image.flipHorizontally();
+            CHECK(image.getPixel(sf::Vector2u{width - 1, 0}) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u{width - 1 - 1 % width, 2}) == sf::Color::Blue);
+
+            image.flipVertically();
+            CHECK(image.getPixel(sf::Vector2u{width - 1, 2}) == sf::Color::Green);
+            CHECK(image.getPixel(sf::Vector2u{width - 1 - 1 % width, 0}) == sf::Color::Blue);
+        }
+    }
+
+    SECTION("Apply color key")
+    {
+        auto image = sf::Image::create(sf::Vector2u{10, 10}, sf::Color(0, 0, 255, 200)).value();
+        image.setPixel(sf::Vector2u{3, 3}, sf::Color::Red);
+        image.applyColorKey(sf::Color::Blue, 10);
+
+        CHECK(image.getPixel(sf::Vector2u{0, 0}) == sf::Color(0, 0, 255, 10));
+        CHECK(image.getPixel(sf::Vector2u{9, 9}) == sf::Color(0, 0, 255, 10));
+        CHECK(image.getPixel(sf::Vector2u{3, 3}) == sf::Color::Red);
+    }
+
+    SECTION("Swap red and blue channels")
+    {
+        auto image = sf::Image::create(sf::Vector2u{7, 3}, sf::Color(10, 20, 30, 40)).value();
+        image.swapRedBlueChannels();
+
+        CHECK(image.getPixel(sf::Vector2u{0, 0}) == sf::Color(30, 20, 10, 40));
+        CHECK(image.getPixel(sf::Vector2u{6, 2}) == sf::Color(30, 20, 10, 40));
+    }
+
+    SECTION("Premultiply/unpremultiply alpha")
+    {
+        auto image = sf::Image::create(sf::Vector2u{7, 3}, sf::Color(255, 128, 0, 128)).value();
+        image.setPixel(sf::Vector2u{1, 1}, sf::Color(50, 60, 70, 0));
+
+        CHECK(!image.isAlphaPremultiplied());
+
+        image.premultiplyAlpha();
+        CHECK(image.isAlphaPremultiplied());
+        CHECK(image.getPixel(sf::Vector2u{0, 0}) == sf::Color(128, 64, 0, 128));
+        CHECK(image.getPixel(sf::Vector2u{6, 2}) == sf::Color(128, 64, 0, 128));
+        CHECK(image.getPixel(sf::Vector2u{1, 1}) == sf::Color(0, 0, 0, 0));
+
+        image.unpremultiplyAlpha();
+        CHECK(!image.isAlphaPremultiplied());
+        CHECK(image.getPixel(sf::Vector2u{0, 0}) == sf::Color(255, 128, 0, 128));
+        CHECK(image.getPixel(sf::Vector2u{6, 2}) == sf::Color(255, 128, 0, 128));
+        CHECK(image.getPixel(sf::Vector2u{1, 1}) == sf::Color(0, 0, 0, 0));
+    }
+
+    SECTION("Pixel kernels match the scalar reference")
+    {
+        // Widths that are not multiples of the vector widths, so that the scalar tails run as well
+        for (const unsigned int width : {1u, 5u, 13u, 31u, 67u})
+        {
+            const sf::Vector2u size{width, 3};
+            const std::size_t  byteCount = std::size_t{width} * 3u * 4u;
+
+            // Deterministic pseudo-random pixels, with some of them matching the color keys below
+            std::vector<std::uint8_t> random(byteCount);
+            std::uint32_t             state = 0x12345678u + width;
+
+            for (std::uint8_t& byte : random)
+            {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                byte = static_cast<std::uint8_t>(state >> 24);
+            }
+
+            for (std::size_t i = 0; i < byteCount; i += 4 * 5)
+            {
+                random[i]     = 10;
+                random[i + 1] = 20;
+                random[i + 2] = 30;
+                random[i + 3] = i % 3 == 0 ? 40 : random[i + 3];
+            }
+
+            const auto check = [&](const sf::Image& image, const std::vector<std::uint8_t>& expected)
+            { CHECK(std::memcmp(image.getPixelsPtr(), expected.data(), byteCount) == 0); };
+
+            const auto mulDiv255 = [](unsigned int c, unsigned int a)
+            {
+                const unsigned int t = c * a + 128u;
+                return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+            };
+
+            // createMaskFromColor()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.createMaskFromColor(sf::Color(10, 20, 30, 40), 7);
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                    if (expected[i] == 10 && expected[i + 1] == 20 && expected[i + 2] == 30 && expected[i + 3] == 40)
+                        expected[i + 3] = 7;
+
+                check(image, expected);
+            }
+
+            // applyColorKey()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.applyColorKey(sf::Color(10, 20, 30), 7);
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                    if (expected[i] == 10 && expected[i + 1] == 20 && expected[i + 2] == 30)
+                        expected[i + 3] = 7;
+
+                check(image, expected);
+            }
+
+            // swapRedBlueChannels()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.swapRedBlueChannels();
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                    std::swap(expected[i], expected[i + 2]);
+
+                check(image, expected);
+            }
+
+            // flipHorizontally()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.flipHorizontally();
+
+                std::vector<std::uint8_t> expected = random;
+                for (unsigned int y = 0; y < size.y; ++y)
+                    for (unsigned int x = 0; x < width; ++x)
+                        std::memcpy(&expected[(y * width + x) * 4], &random[(y * width + width - 1 - x) * 4], 4);
+
+                check(image, expected);
+            }
+
+            // premultiplyAlpha()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.premultiplyAlpha();
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                    for (std::size_t k = 0; k < 3; ++k)
+                        expected[i + k] = mulDiv255(expected[i + k], expected[i + 3]);
+
+                check(image, expected);
+            }
+
+            // unpremultiplyAlpha()
+            {
+                auto image = sf::Image::create(size, random.data()).value();
+                image.setAlphaPremultiplied(true);
+                image.unpremultiplyAlpha();
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                {
+                    const unsigned int a = expected[i + 3];
+
+                    if (a == 0)
+                        continue;
+
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        const unsigned int value = (expected[i + k] * 255u + a / 2u) / a;
+                        expected[i + k]          = static_cast<std::uint8_t>(value > 255u ? 255u : value);
+                    }
+                }
+
+                check(image, expected);
+            }
+
+            // copy() with alpha
+            {
+                // Blend the bytes in reverse order over the pixels, so that source and destination differ
+                std::vector<std::uint8_t> source(random.rbegin(), random.rend());
+
+                auto       image       = sf::Image::create(size, random.data()).value();
+                const auto sourceImage = sf::Image::create(size, source.data()).value();
+                CHECK(image.copy(sourceImage, {0, 0}, {}, true));
+
+                std::vector<std::uint8_t> expected = random;
+                for (std::size_t i = 0; i < byteCount; i += 4)
+                {
+                    const std::uint8_t* src      = &source[i];
+                    std::uint8_t*       dst      = &expected[i];
+                    const unsigned int  srcAlpha = src[3];
+                    const unsigned int  dstAlpha = dst[3];
+                    const unsigned int  outAlpha = srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255;
+
+                    dst[3] = static_cast<std::uint8_t>(outAlpha);
+
+                    for (std::size_t k = 0; k < 3; ++k)
+                    {
+                        if (outAlpha)
+                            dst[k] = static_cast<std::uint8_t>(
+                                (src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+                        else
+                            dst[k] = src[k];
+                    }
+                }
+
+                check(image, expected);
+            }
+        }
+    }
+
+    SECTION("Create downscaled")
+    {
+        auto image = sf::Image::create(sf::Vector2u{4, 4}, sf::Color::White).value();
+        image.setPixel(sf::Vector2u{0, 0}, sf::Color::Black);
+
+        SECTION("Invalid size")
+        {
+            CHECK(!image.createDownscaled(sf::Vector2u{0, 2}).hasValue());
+            CHECK(!image.createDownscaled(sf::Vector2u{5, 2}).hasValue());
+        }
+
+        SECTION("Box")
+        {
+            const auto downscaled = image.createDownscaled(sf::Vector2u{2, 2}).value();
+            CHECK(downscaled.getSize() == sf::Vector2u{2, 2});
+            CHECK(downscaled.getPixel(sf::Vector2u{0, 0}) == sf::Color(191, 191, 191));
+            CHECK(downscaled.getPixel(sf::Vector2u{1, 1}) == sf::Color::White);
+        }
+
+        SECTION("Bilinear")
+        {
+            const auto downscaled = image.createDownscaled(sf::Vector2u{2, 2}, sf::Image::DownscaleFilter::Bilinear).value();
+            CHECK(downscaled.getSize() == sf::Vector2u{2, 2});
+            CHECK(downscaled.getPixel(sf::Vector2u{0, 0}) == sf::Color(191, 191, 191));
+            CHECK(downscaled.getPixel(sf::Vector2u{1, 1}) == sf::Color::White);
+        }
+
+        SECTION("Same size")
+        {
+            const auto copy = image.createDownscaled(sf::Vector2u{4, 4}, sf::Image::DownscaleFilter::Bilinear).value();
+            CHECK(copy.getPixel(sf::Vector2u{0, 0}) == sf::Color::Black);
+            CHECK(copy.getPixel(sf::Vector2u{1, 0}) == sf::Color::White);
+        }
+    }
 }
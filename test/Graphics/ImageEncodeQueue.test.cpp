@@ -0,0 +1,120 @@
+#include "SFML/Graphics/ImageEncodeQueue.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::ImageEncodeQueue")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ImageEncodeQueue));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::ImageEncodeQueue));
+        STATIC_CHECK(!SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::ImageEncodeQueue));
+        STATIC_CHECK(!SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::ImageEncodeQueue));
+    }
+
+    SECTION("Encode in memory")
+    {
+        sf::ImageEncodeQueue queue(2u, 16u);
+
+        std::mutex                             mutex;
+        std::vector<std::vector<std::uint8_t>> results;
+
+        for (int i = 0; i < 8; ++i)
+        {
+            auto image = sf::Image::create({32u, 16u}, sf::Color(static_cast<std::uint8_t>(i * 20), 40, 60)).value();
+
+            const bool queued = queue.push(SFML_BASE_MOVE(image),
+                                           sf::ImageUtils::SaveFormat::PNG,
+                                           [&](bool success, const std::uint8_t* data, std::size_t size)
+                                           {
+                                               const std::lock_guard lock(mutex);
+                                               if (success)
+                                                   results.emplace_back(data, data + size);
+                                           },
+                                           {sf::PngCompression::Fast});
+            CHECK(queued);
+        }
+
+        queue.waitForCompletion();
+        CHECK(queue.getPendingJobCount() == 0u);
+        CHECK(queue.getFailedJobCount() == 0u);
+
+        REQUIRE(results.size() == 8u);
+
+        int redSum = 0;
+        for (const std::vector<std::uint8_t>& result : results)
+        {
+            const auto image = sf::Image::loadFromMemory(result.data(), result.size()).value();
+            CHECK(image.getSize() == sf::Vector2u{32u, 16u});
+            CHECK(image.getPixel({31, 15}).g == 40);
+            redSum += image.getPixel({0, 0}).r;
+        }
+
+        CHECK(redSum == 20 * (0 + 1 + 2 + 3 + 4 + 5 + 6 + 7));
+    }
+
+    SECTION("Full queue rejects jobs without consuming the image")
+    {
+        sf::ImageEncodeQueue queue(1u, 1u);
+
+        std::atomic<bool> release{false};
+
+        auto first = sf::Image::create({4u, 4u}, sf::Color::Red).value();
+        REQUIRE(queue.push(SFML_BASE_MOVE(first),
+                           sf::ImageUtils::SaveFormat::BMP,
+                           [&](bool, const std::uint8_t*, std::size_t)
+                           {
+                               while (!release.load())
+                               {
+                               }
+                           }));
+
+        auto second = sf::Image::create({4u, 4u}, sf::Color::Green).value();
+        CHECK(!queue.push(SFML_BASE_MOVE(second), sf::ImageUtils::SaveFormat::BMP, [](bool, const std::uint8_t*, std::size_t) {}));
+        CHECK(queue.getPendingJobCount() == 1u);
+
+        CHECK(second.getSize() == sf::Vector2u{4u, 4u});
+        CHECK(second.getPixel({0, 0}) == sf::Color::Green);
+
+        release.store(true);
+        queue.waitForCompletion();
+        CHECK(queue.getPendingJobCount() == 0u);
+    }
+
+    SECTION("Save to file")
+    {
+        const sf::Path filename = sf::Path::tempDirectoryPath() / "encode_queue_test.png";
+
+        auto image = sf::Image::create({8u, 8u}, sf::Color(255, 128, 0, 128)).value();
+        image.premultiplyAlpha();
+
+        {
+            sf::ImageEncodeQueue queue;
+
+            CHECK(queue.push(sf::Image::create({8u, 8u}).value(), "test.foo"));
+            queue.waitForCompletion();
+            CHECK(queue.getFailedJobCount() == 1u);
+
+            CHECK(queue.push(SFML_BASE_MOVE(image), filename));
+        } // The destructor finishes pending jobs
+
+        const auto loadedImage = sf::Image::loadFromFile(filename).value();
+        CHECK(loadedImage.getPixel({0, 0}) == sf::Color(255, 128, 0, 128));
+        CHECK(filename.remove());
+    }
+}
@@ -0,0 +1,189 @@
+#include "SFML/Graphics/ImageEncoder.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <vector>
+
+#include <cstdint>
+
+namespace
+{
+[[nodiscard]] sf::Image makeGradientImage(sf::Vector2u size)
+{
+    auto image = sf::Image::create(size).value();
+
+    for (unsigned int y = 0; y < size.y; ++y)
+        for (unsigned int x = 0; x < size.x; ++x)
+            image.setPixel({x, y},
+                           sf::Color(static_cast<std::uint8_t>(x),
+                                     static_cast<std::uint8_t>(y),
+                                     static_cast<std::uint8_t>(x ^ y),
+                                     static_cast<std::uint8_t>(255 - x)));
+
+    return image;
+}
+
+[[nodiscard]] bool samePixels(const sf::Image& lhs, const sf::Image& rhs)
+{
+    if (lhs.getSize() != rhs.getSize())
+        return false;
+
+    for (unsigned int y = 0; y < lhs.getSize().y; ++y)
+        for (unsigned int x = 0; x < lhs.getSize().x; ++x)
+            if (lhs.getPixel({x, y}) != rhs.getPixel({x, y}))
+                return false;
+
+    return true;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::ImageEncoder")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::ImageEncoder));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ImageEncoder));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::ImageEncoder));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::ImageEncoder));
+    }
+
+    const sf::Image source = makeGradientImage({200u, 120u}); // Larger than a stored deflate block
+
+    sf::ImageEncoder          encoder;
+    std::vector<std::uint8_t> buffer;
+
+    SECTION("Default PNG matches ImageUtils")
+    {
+        const auto image = sf::Image::create({16, 16}, sf::Color::Magenta).value();
+
+        REQUIRE(encoder.encode(image.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer));
+        CHECK(buffer.size() == 92);
+        CHECK(buffer == sf::ImageUtils::saveToMemory(image, sf::ImageUtils::SaveFormat::PNG));
+    }
+
+    SECTION("PNG compression levels")
+    {
+        std::size_t sizes[3]{};
+
+        for (const sf::PngCompression compression :
+             {sf::PngCompression::None, sf::PngCompression::Fast, sf::PngCompression::Default})
+        {
+            REQUIRE(encoder.encode(source.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer, {compression}));
+
+            const auto decoded = sf::Image::loadFromMemory(buffer.data(), buffer.size()).value();
+            CHECK(samePixels(decoded, source));
+
+            sizes[static_cast<int>(compression)] = buffer.size();
+        }
+
+        CHECK(sizes[0] > static_cast<std::size_t>(200 * 120 * 4));
+        CHECK(sizes[1] < sizes[0]);
+        CHECK(sizes[2] <= sizes[1]);
+    }
+
+    SECTION("Padded and BGRA views")
+    {
+        auto padded = makeGradientImage({210u, 120u});
+        padded.swapRedBlueChannels();
+
+        const sf::ImageView view = padded.asImageView().getSubView({5u, 0u}, {200u, 120u});
+        const sf::ImageView bgraView{view.pixels, view.size, view.stride, sf::PixelFormat::BGRA};
+
+        for (const sf::PngCompression compression :
+             {sf::PngCompression::None, sf::PngCompression::Fast, sf::PngCompression::Default})
+        {
+            REQUIRE(encoder.encode(bgraView, sf::ImageUtils::SaveFormat::PNG, buffer, {compression}));
+
+            const auto decoded = sf::Image::loadFromMemory(buffer.data(), buffer.size()).value();
+            CHECK(decoded.getSize() == sf::Vector2u{200u, 120u});
+            CHECK(decoded.getPixel({0, 0}) == sf::Color(5, 0, 5, 250));
+            CHECK(decoded.getPixel({199, 119}) == sf::Color(204, 119, 204 ^ 119, 51));
+        }
+
+        REQUIRE(encoder.encode(bgraView, sf::ImageUtils::SaveFormat::BMP, buffer));
+        const auto decoded = sf::Image::loadFromMemory(buffer.data(), buffer.size()).value();
+        CHECK(decoded.getPixel({10, 20}) == sf::Color(15, 20, 15 ^ 20, 240));
+    }
+
+    SECTION("Buffer reuse")
+    {
+        REQUIRE(encoder.encode(source.asImageView(), sf::ImageUtils::SaveFormat::TGA, buffer));
+        const std::vector<std::uint8_t> first    = buffer;
+        const std::uint8_t*             storage  = buffer.data();
+        const std::size_t               capacity = buffer.capacity();
+
+        REQUIRE(encoder.encode(source.asImageView(), sf::ImageUtils::SaveFormat::TGA, buffer));
+        CHECK(buffer == first);
+        CHECK(buffer.data() == storage);
+        CHECK(buffer.capacity() == capacity);
+    }
+
+    SECTION("Sink")
+    {
+        for (const sf::ImageUtils::SaveFormat format :
+             {sf::ImageUtils::SaveFormat::BMP, sf::ImageUtils::SaveFormat::TGA, sf::ImageUtils::SaveFormat::PNG})
+        {
+            REQUIRE(encoder.encode(source.asImageView(), format, buffer, {sf::PngCompression::None}));
+
+            std::vector<std::uint8_t> streamed;
+            std::size_t               chunkCount = 0;
+
+            CHECK(encoder.encode(
+                source.asImageView(),
+                format,
+                [&](const std::uint8_t* data, std::size_t size)
+                {
+                    streamed.insert(streamed.end(), data, data + size);
+                    ++chunkCount;
+                    return true;
+                },
+                {sf::PngCompression::None}));
+
+            CHECK(streamed == buffer);
+            CHECK(chunkCount > 1);
+        }
+
+        SECTION("Aborted by the sink")
+        {
+            std::size_t chunkCount = 0;
+
+            CHECK(!encoder.encode(source.asImageView(),
+                                  sf::ImageUtils::SaveFormat::PNG,
+                                  [&](const std::uint8_t*, std::size_t)
+                                  {
+                                      ++chunkCount;
+                                      return false;
+                                  }));
+
+            CHECK(chunkCount == 1);
+        }
+    }
+
+    SECTION("encodeToFile()")
+    {
+        CHECK(!encoder.encodeToFile(source.asImageView(), "test.foo"));
+
+        const sf::Path filename = sf::Path::tempDirectoryPath() / "encoder_test.png";
+        REQUIRE(encoder.encodeToFile(source.asImageView(), filename, {sf::PngCompression::Fast}));
+
+        const auto loadedImage = sf::Image::loadFromFile(filename).value();
+        CHECK(samePixels(loadedImage, source));
+        CHECK(filename.remove());
+    }
+
+    SECTION("releaseMemory()")
+    {
+        REQUIRE(encoder.encode(source.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer));
+        encoder.releaseMemory();
+        CHECK(encoder.encode(source.asImageView(), sf::ImageUtils::SaveFormat::PNG, buffer));
+    }
+}
@@ -0,0 +1,65 @@
+#include "SFML/Graphics/ImageView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <SystemUtil.hpp>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::ImageView")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ImageView));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::ImageView));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::ImageView));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::ImageView));
+        STATIC_CHECK(SFML_BASE_IS_AGGREGATE(sf::ImageView));
+        STATIC_CHECK(SFML_BASE_IS_AGGREGATE(sf::MutableImageView));
+        STATIC_CHECK(SFML_BASE_IS_CONVERTIBLE(sf::MutableImageView, sf::ImageView));
+        STATIC_CHECK(!SFML_BASE_IS_CONVERTIBLE(sf::ImageView, sf::MutableImageView));
+    }
+
+    SECTION("Construction")
+    {
+        constexpr sf::ImageView view;
+        STATIC_CHECK(view.pixels == nullptr);
+        STATIC_CHECK(view.size == sf::Vector2u{});
+        STATIC_CHECK(view.stride == 0u);
+        STATIC_CHECK(view.format == sf::PixelFormat::RGBA);
+    }
+
+    SECTION("Row stride")
+    {
+        constexpr sf::ImageView packed{nullptr, {10u, 4u}};
+        STATIC_CHECK(packed.getRowStride() == 40u);
+        STATIC_CHECK(packed.isContiguous());
+
+        constexpr sf::ImageView padded{nullptr, {10u, 4u}, 64u};
+        STATIC_CHECK(padded.getRowStride() == 64u);
+        STATIC_CHECK(!padded.isContiguous());
+    }
+
+    SECTION("Rows and sub-views")
+    {
+        std::uint8_t pixels[8 * 4 * 4]{};
+
+        const sf::MutableImageView view{pixels, {8u, 4u}, 0u, sf::PixelFormat::BGRA};
+        CHECK(view.getRow(0) == pixels);
+        CHECK(view.getRow(3) == pixels + 3 * 8 * 4);
+
+        const sf::MutableImageView subView = view.getSubView({2u, 1u}, {3u, 2u});
+        CHECK(subView.pixels == pixels + (1 * 8 + 2) * 4);
+        CHECK(subView.size == sf::Vector2u{3u, 2u});
+        CHECK(subView.getRowStride() == 8u * 4u);
+        CHECK(!subView.isContiguous());
+        CHECK(subView.format == sf::PixelFormat::BGRA);
+        CHECK(subView.getRow(1) == pixels + (2 * 8 + 2) * 4);
+
+        const sf::ImageView readOnly = subView;
+        CHECK(readOnly.pixels == subView.pixels);
+        CHECK(readOnly.getRowStride() == subView.getRowStride());
+        CHECK(readOnly.format == sf::PixelFormat::BGRA);
+    }
+}
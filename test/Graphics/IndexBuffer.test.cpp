@@ -0,0 +1,57 @@
+#include "SFML/Graphics/IndexBuffer.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::IndexBuffer" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::IndexBuffer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::IndexBuffer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::IndexBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::IndexBuffer));
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::IndexBuffer::create(graphicsContext, 0u).hasValue());
+
+        const auto indexBuffer = sf::IndexBuffer::create(graphicsContext, 6u, sf::IndexBuffer::Usage::Static).value();
+        CHECK(indexBuffer.getIndexCount() == 6u);
+        CHECK(indexBuffer.getUsage() == sf::IndexBuffer::Usage::Static);
+        CHECK(indexBuffer.getNativeHandle() != 0u);
+    }
+
+    SECTION("Move semantics")
+    {
+        auto       movedIndexBuffer = sf::IndexBuffer::create(graphicsContext, 3u).value();
+        const auto nativeHandle     = movedIndexBuffer.getNativeHandle();
+
+        const sf::IndexBuffer indexBuffer = SFML_BASE_MOVE(movedIndexBuffer);
+        CHECK(indexBuffer.getNativeHandle() == nativeHandle);
+        CHECK(indexBuffer.getIndexCount() == 3u);
+    }
+
+    SECTION("update()")
+    {
+        auto indexBuffer = sf::IndexBuffer::create(graphicsContext, 6u).value();
+
+        const sf::IndexType indices[]{0u, 1u, 2u, 2u, 1u, 3u};
+        CHECK(indexBuffer.update(indices, 6u));
+        CHECK(indexBuffer.update(indices, 3u, 3u));
+        CHECK(indexBuffer.update(indices, 0u, 6u));
+        CHECK(!indexBuffer.update(indices, 4u, 3u));
+        CHECK(!indexBuffer.update(indices, 1u, 7u));
+    }
+}
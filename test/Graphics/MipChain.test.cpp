@@ -0,0 +1,116 @@
+#include "SFML/Graphics/MipChain.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Image.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <vector>
+
+TEST_CASE("[Graphics] sf::MipChain")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::MipChain));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::MipChain));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::MipChain));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::MipChain));
+    }
+
+    SECTION("getFullLevelCount()")
+    {
+        CHECK(sf::MipChain::getFullLevelCount({1u, 1u}) == 1u);
+        CHECK(sf::MipChain::getFullLevelCount({2u, 1u}) == 2u);
+        CHECK(sf::MipChain::getFullLevelCount({256u, 256u}) == 9u);
+        CHECK(sf::MipChain::getFullLevelCount({300u, 20u}) == 9u);
+    }
+
+    SECTION("getLevelSize()")
+    {
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 0u) == sf::Vector2u{300u, 20u});
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 1u) == sf::Vector2u{150u, 10u});
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 2u) == sf::Vector2u{75u, 5u});
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 3u) == sf::Vector2u{37u, 2u});
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 5u) == sf::Vector2u{9u, 1u});
+        CHECK(sf::MipChain::getLevelSize({300u, 20u}, 8u) == sf::Vector2u{1u, 1u});
+    }
+
+    SECTION("create(const Image&)")
+    {
+        auto image = sf::Image::create({64u, 16u}, sf::Color::Black).value();
+        for (unsigned int y = 0u; y < 16u; ++y)
+            for (unsigned int x = 0u; x < 32u; ++x)
+                image.setPixel({x, y}, sf::Color::White);
+
+        const auto chain = sf::MipChain::create(image).value();
+
+        REQUIRE(chain.getLevelCount() == 7u);
+        CHECK(chain.getSize() == sf::Vector2u{64u, 16u});
+        CHECK(chain.getLevel(0u).getPixel({0u, 0u}) == sf::Color::White);
+        CHECK(chain.getLevel(4u).getSize() == sf::Vector2u{4u, 1u});
+        CHECK(chain.getLevel(6u).getSize() == sf::Vector2u{1u, 1u});
+
+        // Box filtering averages both halves on the last level
+        CHECK(chain.getLevel(1u).getPixel({0u, 0u}) == sf::Color::White);
+        CHECK(chain.getLevel(1u).getPixel({31u, 7u}) == sf::Color::Black);
+        CHECK(chain.getLevel(6u).getPixel({0u, 0u}) == sf::Color(128, 128, 128));
+    }
+
+    SECTION("create(std::vector<Image>&&)")
+    {
+        std::vector<sf::Image> levels;
+        levels.push_back(sf::Image::create({8u, 4u}).value());
+        levels.push_back(sf::Image::create({4u, 2u}).value());
+
+        SECTION("Partial chain")
+        {
+            const auto chain = sf::MipChain::create(SFML_BASE_MOVE(levels)).value();
+            CHECK(chain.getLevelCount() == 2u);
+            CHECK(chain.getByteCount() == (8u * 4u + 4u * 2u) * 4u);
+            CHECK(chain.getByteCount(1u) == 4u * 2u * 4u);
+        }
+
+        SECTION("Inconsistent size")
+        {
+            levels.push_back(sf::Image::create({2u, 2u}).value());
+            CHECK(!sf::MipChain::create(SFML_BASE_MOVE(levels)).hasValue());
+        }
+
+        SECTION("Too many levels")
+        {
+            levels.push_back(sf::Image::create({2u, 1u}).value());
+            levels.push_back(sf::Image::create({1u, 1u}).value());
+            levels.push_back(sf::Image::create({1u, 1u}).value());
+
+            CHECK(!sf::MipChain::create(SFML_BASE_MOVE(levels)).hasValue());
+        }
+
+        SECTION("Empty")
+        {
+            CHECK(!sf::MipChain::create(std::vector<sf::Image>{}).hasValue());
+        }
+    }
+
+    SECTION("selectLevel()")
+    {
+        const auto chain = sf::MipChain::create(sf::Image::create({1024u, 256u}).value()).value();
+        REQUIRE(chain.getLevelCount() == 11u);
+
+        CHECK(chain.selectLevel({2048.f, 512.f}) == 0u);
+        CHECK(chain.selectLevel({1024.f, 256.f}) == 0u);
+        CHECK(chain.selectLevel({1000.f, 200.f}) == 0u);
+        CHECK(chain.selectLevel({512.f, 128.f}) == 1u);
+        CHECK(chain.selectLevel({300.f, 10.f}) == 1u);
+        CHECK(chain.selectLevel({256.f, 64.f}) == 2u);
+        CHECK(chain.selectLevel({0.f, 0.f}) == 10u);
+
+        // The height of a line is 1 pixel on every level, only its width matters
+        const auto line = sf::MipChain::create(sf::Image::create({8u, 1u}).value()).value();
+        CHECK(line.selectLevel({2.f, 5.f}) == 2u);
+    }
+}
@@ -0,0 +1,145 @@
+#include "SFML/Graphics/ParticleSystem.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+
+#include <vector>
+
+TEST_CASE("[Graphics] sf::ParticleSystem" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::ParticleSystem));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ParticleSystem));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::ParticleSystem));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ParticleSystem particleSystem(graphicsContext);
+        CHECK(particleSystem.getParticleCount() == 0u);
+        CHECK(particleSystem.getThreadCount() == 1u);
+        CHECK(particleSystem.getAcceleration() == sf::Vector2f{});
+        CHECK(particleSystem.getDrag() == 0.f);
+        CHECK(!particleSystem.isFadeOutEnabled());
+        CHECK(particleSystem.getTextureRect() == sf::IntRect{});
+
+        const sf::ParticleSystem threadedParticleSystem(graphicsContext, 0u);
+        CHECK(threadedParticleSystem.getThreadCount() >= 1u);
+    }
+
+    SECTION("Set/get properties")
+    {
+        sf::ParticleSystem particleSystem(graphicsContext);
+        particleSystem.setAcceleration({0.f, 9.8f});
+        particleSystem.setDrag(0.5f);
+        particleSystem.setFadeOutEnabled(true);
+        particleSystem.setTextureRect({{1, 2}, {3, 4}});
+
+        CHECK(particleSystem.getAcceleration() == sf::Vector2f{0.f, 9.8f});
+        CHECK(particleSystem.getDrag() == 0.5f);
+        CHECK(particleSystem.isFadeOutEnabled());
+        CHECK(particleSystem.getTextureRect() == sf::IntRect({1, 2}, {3, 4}));
+    }
+
+    SECTION("Update")
+    {
+        sf::ParticleSystem particleSystem(graphicsContext);
+        particleSystem.setAcceleration({0.f, 10.f});
+
+        particleSystem.emit({.position{1.f, 2.f}, .velocity{10.f, 0.f}, .lifetime = 1.5f});
+        CHECK(particleSystem.getParticleCount() == 1u);
+        CHECK(particleSystem.getParticlePosition(0u) == sf::Vector2f{1.f, 2.f});
+
+        // The velocity is updated before the position
+        particleSystem.update(sf::seconds(1.f));
+        CHECK(particleSystem.getParticleCount() == 1u);
+        CHECK(particleSystem.getParticlePosition(0u) == sf::Vector2f{11.f, 12.f});
+
+        // Expired particles are removed
+        particleSystem.update(sf::seconds(1.f));
+        CHECK(particleSystem.getParticleCount() == 0u);
+    }
+
+    SECTION("Drag")
+    {
+        sf::ParticleSystem particleSystem(graphicsContext);
+        particleSystem.setDrag(0.5f);
+
+        particleSystem.emit({.velocity{8.f, 0.f}, .lifetime = 10.f});
+        particleSystem.update(sf::seconds(1.f));
+        CHECK(particleSystem.getParticlePosition(0u) == sf::Vector2f{4.f, 0.f});
+    }
+
+    SECTION("Multithreaded update")
+    {
+        std::vector<sf::ParticleSystem::Particle> particles(100'000u);
+        for (std::size_t i = 0u; i < particles.size(); ++i)
+            particles[i] = {.position{static_cast<float>(i), 0.f},
+                            .velocity{1.f, 2.f},
+                            .lifetime = (i % 2u == 0u) ? 0.5f : 2.f};
+
+        sf::ParticleSystem singleThreaded(graphicsContext, 1u);
+        sf::ParticleSystem multiThreaded(graphicsContext, 4u);
+        CHECK(multiThreaded.getThreadCount() == 4u);
+
+        singleThreaded.emit(particles.data(), particles.size());
+        multiThreaded.emit(particles.data(), particles.size());
+
+        singleThreaded.update(sf::seconds(1.f));
+        multiThreaded.update(sf::seconds(1.f));
+
+        REQUIRE(singleThreaded.getParticleCount() == 50'000u);
+        REQUIRE(multiThreaded.getParticleCount() == 50'000u);
+
+        for (std::size_t i = 0u; i < singleThreaded.getParticleCount(); ++i)
+            CHECK(singleThreaded.getParticlePosition(i) == multiThreaded.getParticlePosition(i));
+    }
+
+    SECTION("Clear")
+    {
+        sf::ParticleSystem particleSystem(graphicsContext);
+        particleSystem.reserve(16u);
+        particleSystem.emit({});
+        particleSystem.emit({});
+        CHECK(particleSystem.getParticleCount() == 2u);
+
+        particleSystem.clear();
+        CHECK(particleSystem.getParticleCount() == 0u);
+    }
+
+    SECTION("Draw")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {32u, 32u}).value();
+
+        sf::ParticleSystem particleSystem(graphicsContext);
+        particleSystem.setTextureRect({{0, 0}, {4, 4}});
+        particleSystem.emit({.position{8.f, 8.f}, .lifetime = 1.f, .size = 8.f, .color = sf::Color::Red});
+        particleSystem.emit({.position{24.f, 24.f}, .lifetime = 1.f, .size = 8.f, .color = sf::Color::Green});
+
+        renderTexture.clear();
+        particleSystem.draw(renderTexture, nullptr, sf::RenderStates::Default);
+        renderTexture.display();
+
+        const auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({8u, 8u}) == sf::Color::Red);
+        CHECK(result.getPixel({24u, 24u}) == sf::Color::Green);
+        CHECK(result.getPixel({16u, 16u}) == sf::Color::Black);
+        CHECK(result.getPixel({8u, 24u}) == sf::Color::Black);
+    }
+}
@@ -0,0 +1,137 @@
+#include "SFML/Graphics/PolygonShape.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+
+#include <vector>
+
+TEST_CASE("[Graphics] sf::PolygonShape")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PolygonShape));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::PolygonShape));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::PolygonShape));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::PolygonShape));
+    }
+
+    const sf::Vector2f square[]{{0.f, 0.f}, {100.f, 0.f}, {100.f, 100.f}, {0.f, 100.f}};
+    const sf::Vector2f hole[]{{25.f, 25.f}, {75.f, 25.f}, {75.f, 75.f}, {25.f, 75.f}};
+
+    SECTION("Default constructor")
+    {
+        const sf::PolygonShape polygon;
+        CHECK(polygon.getPointCount() == 0);
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getFillColor() == sf::Color::White);
+        CHECK(polygon.getOutlineThickness() == 0.f);
+        CHECK(polygon.getFillIndexCount() == 0);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect());
+    }
+
+    SECTION("Points and holes")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPoints(square, 4);
+        CHECK(polygon.getPointCount() == 4);
+        CHECK(polygon.getFillIndexCount() == 6);
+
+        polygon.addHole(hole, 4);
+        CHECK(polygon.getPointCount() == 8);
+        CHECK(polygon.getHoleCount() == 1);
+        CHECK(polygon.getPoint(4) == sf::Vector2f{25.f, 25.f});
+        CHECK(polygon.getFillIndexCount() == 24);
+
+        polygon.clearHoles();
+        CHECK(polygon.getPointCount() == 4);
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getFillIndexCount() == 6);
+
+        polygon.addHole(hole, 4);
+        polygon.setPoints(square, 3);
+        CHECK(polygon.getPointCount() == 3);
+        CHECK(polygon.getHoleCount() == 0);
+        CHECK(polygon.getFillIndexCount() == 3);
+    }
+
+    SECTION("Set point")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPoints(square, 4);
+        CHECK(polygon.getFillIndexCount() == 6);
+
+        // Moving a point into the polygon makes it concave
+        polygon.setPoint(2, {50.f, 50.f});
+        CHECK(polygon.getPoint(2) == sf::Vector2f{50.f, 50.f});
+        CHECK(polygon.getFillIndexCount() == 6);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({0.f, 0.f}, {100.f, 100.f}));
+    }
+
+    SECTION("Bounds")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPoints(square, 4);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({0.f, 0.f}, {100.f, 100.f}));
+
+        // The outline is centered on the contour
+        polygon.setOutlineThickness(2.f);
+        CHECK(polygon.getLocalBounds() == sf::FloatRect({-1.f, -1.f}, {102.f, 102.f}));
+
+        polygon.setPosition({10.f, 20.f});
+        CHECK(polygon.getGlobalBounds() == sf::FloatRect({9.f, 19.f}, {102.f, 102.f}));
+    }
+
+    SECTION("Append geometry")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPoints(square, 4);
+        polygon.addHole(hole, 4);
+        polygon.setFillColor(sf::Color::Red);
+        polygon.setPosition({10.f, 0.f});
+
+        std::vector<sf::Vertex>    vertices;
+        std::vector<sf::IndexType> indices;
+
+        polygon.appendGeometry(vertices, indices);
+        CHECK(vertices.size() == 8);
+        CHECK(indices.size() == 24);
+        CHECK(vertices[0].position == sf::Vector2f{10.f, 0.f});
+        CHECK(vertices[0].color == sf::Color::Red);
+
+        // A second polygon is appended after the first one
+        polygon.appendGeometry(vertices, indices);
+        CHECK(vertices.size() == 16);
+        CHECK(indices.size() == 48);
+
+        for (std::size_t i = 24; i < indices.size(); ++i)
+            CHECK(indices[i] >= 8);
+
+        // The outline follows the fill
+        polygon.setOutlineThickness(1.f);
+        polygon.setOutlineColor(sf::Color::Blue);
+
+        vertices.clear();
+        indices.clear();
+        polygon.appendGeometry(vertices, indices);
+        CHECK(vertices.size() > 8);
+        CHECK(indices.size() == 24 + vertices.size() - 8);
+        CHECK(vertices.back().color == sf::Color::Blue);
+    }
+
+    SECTION("Texture coordinates")
+    {
+        sf::PolygonShape polygon;
+        polygon.setPoints(square, 4);
+        polygon.setTextureRect({{0, 0}, {50, 20}});
+
+        std::vector<sf::Vertex>    vertices;
+        std::vector<sf::IndexType> indices;
+
+        polygon.appendGeometry(vertices, indices);
+        CHECK(vertices[0].texCoords == sf::Vector2f{0.f, 0.f});
+        CHECK(vertices[2].texCoords == sf::Vector2f{50.f, 20.f});
+    }
+}
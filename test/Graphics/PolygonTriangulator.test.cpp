@@ -0,0 +1,137 @@
+#include "SFML/Graphics/PolygonTriangulator.hpp"
+
+// Other 1st party headers
+#include "SFML/System/Angle.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <SystemUtil.hpp>
+
+#include <vector>
+
+#include <cmath>
+
+namespace
+{
+// Sum of the areas of the triangles, regardless of their winding
+[[nodiscard]] float computeArea(const std::vector<sf::IndexType>& indices, const sf::Vector2f* points)
+{
+    float area = 0.f;
+
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        const sf::Vector2f a = points[indices[i]];
+        area += std::fabs((points[indices[i + 1]] - a).cross(points[indices[i + 2]] - a)) * 0.5f;
+    }
+
+    return area;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::PolygonTriangulator")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::PolygonTriangulator));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PolygonTriangulator));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::PolygonTriangulator));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::PolygonTriangulator));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::PolygonTriangulator));
+    }
+
+    sf::PolygonTriangulator    triangulator;
+    std::vector<sf::IndexType> indices;
+
+    const sf::Vector2f square[]{{0.f, 0.f}, {100.f, 0.f}, {100.f, 100.f}, {0.f, 100.f}};
+
+    SECTION("Degenerate polygons")
+    {
+        CHECK(triangulator.triangulate(indices, square, 0) == 0);
+        CHECK(triangulator.triangulate(indices, square, 2) == 0);
+
+        const sf::Vector2f line[]{{0.f, 0.f}, {50.f, 0.f}, {100.f, 0.f}};
+        CHECK(triangulator.triangulate(indices, line, 3) == 0);
+        CHECK(indices.empty());
+    }
+
+    SECTION("Convex polygon")
+    {
+        CHECK(triangulator.triangulate(indices, square, 4) == 6);
+        CHECK(indices.size() == 6);
+        CHECK(computeArea(indices, square) == Approx(10'000.f));
+    }
+
+    SECTION("Winding order does not matter")
+    {
+        const sf::Vector2f reversed[]{{0.f, 100.f}, {100.f, 100.f}, {100.f, 0.f}, {0.f, 0.f}};
+
+        CHECK(triangulator.triangulate(indices, reversed, 4) == 6);
+        CHECK(computeArea(indices, reversed) == Approx(10'000.f));
+    }
+
+    SECTION("Concave polygon")
+    {
+        const sf::Vector2f lShape[]{{0.f, 0.f}, {100.f, 0.f}, {100.f, 50.f}, {50.f, 50.f}, {50.f, 100.f}, {0.f, 100.f}};
+
+        CHECK(triangulator.triangulate(indices, lShape, 6) == 12);
+        CHECK(computeArea(indices, lShape) == Approx(7500.f));
+    }
+
+    SECTION("Polygon with holes")
+    {
+        const sf::Vector2f points[]{{0.f, 0.f},
+                                    {100.f, 0.f},
+                                    {100.f, 100.f},
+                                    {0.f, 100.f},
+                                    {10.f, 10.f},
+                                    {40.f, 10.f},
+                                    {40.f, 40.f},
+                                    {10.f, 40.f},
+                                    {60.f, 60.f},
+                                    {90.f, 60.f},
+                                    {90.f, 90.f},
+                                    {60.f, 90.f}};
+
+        const std::size_t holeOffsets[]{4, 8};
+
+        // Bridging each hole to the outer contour duplicates two vertices, so
+        // 12 vertices and 2 holes give 12 + 2 * 2 - 2 = 14 triangles
+        CHECK(triangulator.triangulate(indices, points, 12, holeOffsets, 2) == 14 * 3);
+        CHECK(computeArea(indices, points) == Approx(10'000.f - 2 * 900.f));
+    }
+
+    SECTION("Large polygon")
+    {
+        // Star with enough points to sort them along a z-order curve
+        std::vector<sf::Vector2f> star;
+        float                     expectedArea = 0.f;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            const float radius = i % 2 == 0 ? 100.f : 50.f;
+            star.push_back(sf::Vector2f::fromAngle(radius, sf::degrees(static_cast<float>(i) * 1.8f)));
+        }
+
+        for (std::size_t i = 0; i < star.size(); ++i)
+            expectedArea += star[i].cross(star[(i + 1) % star.size()]) * 0.5f;
+
+        CHECK(triangulator.triangulate(indices, star.data(), star.size()) == (star.size() - 2) * 3);
+        CHECK(computeArea(indices, star.data()) == Approx(std::fabs(expectedArea)));
+    }
+
+    SECTION("Base index")
+    {
+        indices.push_back(42);
+
+        CHECK(triangulator.triangulate(indices, square, 4, nullptr, 0, 10) == 6);
+        CHECK(indices.size() == 7);
+        CHECK(indices[0] == 42);
+
+        for (std::size_t i = 1; i < indices.size(); ++i)
+        {
+            CHECK(indices[i] >= 10);
+            CHECK(indices[i] < 14);
+        }
+    }
+}
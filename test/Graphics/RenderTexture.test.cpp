@@ -49,6 +49,119 @@ TEST_CASE("[Graphics] sf::RenderTexture" * doctest::skip(skipDisplayTests))
         CHECK(!texture.isSrgb());
         CHECK(!texture.isRepeated());
         CHECK(texture.getNativeHandle() != 0);
+        CHECK(texture.getFormat() == sf::TextureFormat::RGBA8);
+        CHECK(renderTexture.getColorAttachmentCount() == 1);
+        CHECK(&renderTexture.getTexture(0) == &texture);
+    }
+
+    SECTION("create() with texture formats")
+    {
+        const sf::TextureFormat hdrFormat = sf::TextureFormat::RGBA16F;
+
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {64, 32}, &hdrFormat, 1).value();
+        CHECK(renderTexture.getColorAttachmentCount() == 1);
+        CHECK(renderTexture.getTexture().getFormat() == sf::TextureFormat::RGBA16F);
+        CHECK(!renderTexture.getTexture().isSrgb());
+
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({0u, 0u}) == sf::Color::Green);
+    }
+
+    SECTION("create() with multiple color attachments")
+    {
+        CHECK(sf::RenderTexture::getMaximumColorAttachmentCount(graphicsContext) >= 1);
+        CHECK(sf::RenderTexture::getMaximumColorAttachmentCount(graphicsContext) <= sf::RenderTexture::MaxColorAttachments);
+
+        const sf::TextureFormat formats[]{sf::TextureFormat::RGBA8, sf::TextureFormat::R11FG11FB10F, sf::TextureFormat::R8};
+
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {64, 32}, formats, 3).value();
+        CHECK(renderTexture.getColorAttachmentCount() == 3);
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            CHECK(renderTexture.getTexture(i).getSize() == sf::Vector2u{64, 32});
+            CHECK(renderTexture.getTexture(i).getFormat() == formats[i]);
+        }
+
+        CHECK(renderTexture.getTexture(1).getNativeHandle() != renderTexture.getTexture(0).getNativeHandle());
+
+        // Settings apply to all the attachments
+        renderTexture.setSmooth(true);
+        CHECK(renderTexture.getTexture(2).isSmooth());
+
+        // Clearing writes to every draw buffer
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture(0).copyToImage().getPixel({0u, 0u}) == sf::Color::Red);
+        CHECK(renderTexture.getTexture(2).copyToImage().getPixel({0u, 0u}).r == 255);
+    }
+
+    SECTION("Redundant state changes are skipped")
+    {
+        auto       renderTexture = sf::RenderTexture::create(graphicsContext, {64, 32}).value();
+        const auto image         = sf::Image::create({64, 32}, sf::Color::Red).value();
+        const auto texture       = sf::Texture::loadFromImage(graphicsContext, image).value();
+
+        const sf::Sprite sprite(texture.getRect());
+
+        renderTexture.clear();
+        renderTexture.draw(sprite, texture);
+
+        // Drawing the same sprite again sets states already set by the first draw
+        graphicsContext.resetGLStateCacheStatistics();
+        renderTexture.draw(sprite, texture);
+        CHECK(graphicsContext.getGLStateCacheStatistics().skippedCalls > 0u);
+
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({0u, 0u}) == sf::Color::Red);
+    }
+
+    SECTION("Damage tracking")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {64, 32}).value();
+        CHECK(!renderTexture.isDamageTrackingEnabled());
+
+        // Damage is ignored while tracking is disabled
+        renderTexture.markDirty({{0, 0}, {8, 8}});
+        CHECK(renderTexture.getDirtyRegion() == sf::IntRect{});
+
+        // Enabling tracking damages the whole target
+        CHECK(renderTexture.setDamageTrackingEnabled(true));
+        CHECK(renderTexture.isDamageTrackingEnabled());
+        CHECK(renderTexture.getDirtyRegion() == sf::IntRect({0, 0}, {64, 32}));
+
+        renderTexture.clear(sf::Color::Red);
+        renderTexture.display();
+        CHECK(renderTexture.getDirtyRegion() == sf::IntRect{});
+
+        // Damage is clamped to the target and merged into its bounding rectangle
+        renderTexture.markDirty({{-8, -8}, {16, 16}});
+        renderTexture.markDirty({{4, 4}, {4, 4}});
+        CHECK(renderTexture.getDirtyRegion() == sf::IntRect({0, 0}, {8, 8}));
+
+        // Only the dirty region is redrawn
+        renderTexture.clear(sf::Color::Green);
+        renderTexture.display();
+
+        auto image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0u, 0u}) == sf::Color::Green);
+        CHECK(image.getPixel({7u, 7u}) == sf::Color::Green);
+        CHECK(image.getPixel({8u, 8u}) == sf::Color::Red);
+        CHECK(image.getPixel({63u, 31u}) == sf::Color::Red);
+
+        // Nothing is redrawn without damage
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.display();
+
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({0u, 0u}) == sf::Color::Green);
+        CHECK(image.getPixel({63u, 31u}) == sf::Color::Red);
+
+        CHECK(renderTexture.setDamageTrackingEnabled(false));
+        renderTexture.clear(sf::Color::Blue);
+        renderTexture.display();
+        CHECK(renderTexture.getTexture().copyToImage().getPixel({63u, 31u}) == sf::Color::Blue);
     }
 #if 0
     SECTION("getMaximumAntialiasingLevel()")
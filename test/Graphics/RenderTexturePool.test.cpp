@@ -0,0 +1,146 @@
+#include "SFML/Graphics/RenderTexturePool.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureFormat.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::RenderTexturePool" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::RenderTexturePool));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::RenderTexturePool));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::RenderTexturePool));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::RenderTexturePool pool(graphicsContext);
+        CHECK(pool.getRenderTextureCount() == 0);
+        CHECK(pool.getAcquiredCount() == 0);
+        CHECK(pool.getReuseCount() == 0);
+        CHECK(pool.getMemoryUsage() == 0);
+        CHECK(pool.getMaxIdleFrames() == 3);
+    }
+
+    SECTION("Acquire and release")
+    {
+        sf::RenderTexturePool pool(graphicsContext);
+
+        sf::RenderTexture* first = pool.acquire({64, 32});
+        REQUIRE(first != nullptr);
+        CHECK(first->getSize() == sf::Vector2u{64, 32});
+        CHECK(pool.getAcquiredCount() == 1);
+        CHECK(pool.getMemoryUsage() == 64 * 32 * 4);
+
+        // Acquired render textures are never handed out twice
+        sf::RenderTexture* second = pool.acquire({64, 32});
+        REQUIRE(second != nullptr);
+        CHECK(second != first);
+        CHECK(pool.getRenderTextureCount() == 2);
+        CHECK(pool.getReuseCount() == 0);
+
+        pool.release(*first);
+        CHECK(pool.getAcquiredCount() == 1);
+
+        // A different size or setting needs a new render texture
+        sf::RenderTexture* other = pool.acquire({64, 32}, {.depthBits = 24});
+        REQUIRE(other != nullptr);
+        CHECK(other != first);
+        CHECK(pool.getRenderTextureCount() == 3);
+
+        // Released render textures are reset and reused
+        first->setSmooth(true);
+        first->setView(sf::View(sf::FloatRect({0.f, 0.f}, {10.f, 10.f})));
+
+        CHECK(pool.acquire({64, 32}) == first);
+        CHECK(pool.getReuseCount() == 1);
+        CHECK(!first->isSmooth());
+        CHECK(first->getView().getCenter() == first->getDefaultView().getCenter());
+    }
+
+    SECTION("Color formats")
+    {
+        sf::RenderTexturePool pool(graphicsContext);
+
+        const sf::TextureFormat formats[]{sf::TextureFormat::RGBA16F, sf::TextureFormat::R8};
+
+        sf::RenderTexture* hdr = pool.acquire({16, 16}, formats, 2);
+        REQUIRE(hdr != nullptr);
+        CHECK(hdr->getTexture(0).getFormat() == sf::TextureFormat::RGBA16F);
+        CHECK(pool.getMemoryUsage() == 16 * 16 * (8 + 1));
+
+        pool.release(*hdr);
+
+        // A render texture with other formats is never handed out
+        sf::RenderTexture* plain = pool.acquire({16, 16});
+        REQUIRE(plain != nullptr);
+        CHECK(plain != hdr);
+        CHECK(plain->getTexture().getFormat() == sf::TextureFormat::RGBA8);
+        CHECK(pool.getMemoryUsage() == 16 * 16 * (8 + 1) + 16 * 16 * 4);
+
+        CHECK(pool.acquire({16, 16}, formats, 1) != hdr);
+        CHECK(pool.acquire({16, 16}, formats, 2) == hdr);
+        CHECK(pool.getReuseCount() == 1);
+    }
+
+    SECTION("Idle render textures are destroyed")
+    {
+        sf::RenderTexturePool pool(graphicsContext);
+        pool.setMaxIdleFrames(1);
+
+        sf::RenderTexture* renderTexture = pool.acquire({16, 16});
+        REQUIRE(renderTexture != nullptr);
+
+        // Acquired render textures are kept regardless of their age
+        pool.endFrame();
+        pool.endFrame();
+        CHECK(pool.getRenderTextureCount() == 1);
+
+        pool.release(*renderTexture);
+        pool.endFrame();
+        CHECK(pool.getRenderTextureCount() == 1);
+
+        pool.endFrame();
+        CHECK(pool.getRenderTextureCount() == 0);
+        CHECK(pool.getMemoryUsage() == 0);
+    }
+
+    SECTION("Clear")
+    {
+        sf::RenderTexturePool pool(graphicsContext);
+
+        sf::RenderTexture* kept     = pool.acquire({16, 16});
+        sf::RenderTexture* released = pool.acquire({32, 32});
+        REQUIRE(kept != nullptr);
+        REQUIRE(released != nullptr);
+
+        pool.release(*released);
+        pool.clear();
+        CHECK(pool.getRenderTextureCount() == 1);
+        CHECK(pool.getAcquiredCount() == 1);
+        CHECK(pool.getMemoryUsage() == 16 * 16 * 4);
+        CHECK(kept->getSize() == sf::Vector2u{16, 16});
+    }
+
+    SECTION("Graphics context pool")
+    {
+        sf::RenderTexturePool& pool = graphicsContext.getRenderTexturePool();
+        CHECK(&pool == &graphicsContext.getRenderTexturePool());
+
+        sf::RenderTexture* renderTexture = pool.acquire({8, 8});
+        REQUIRE(renderTexture != nullptr);
+        pool.release(*renderTexture);
+    }
+}
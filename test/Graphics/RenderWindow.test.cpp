@@ -106,6 +106,44 @@ TEST_CASE("[Graphics] sf::RenderWindow" * doctest::skip(skipDisplayTests))
         CHECK(texture.copyToImage().getPixel(sf::Vector2u{196, 196}) == sf::Color::Blue);
     }
 
+    SECTION("Damage tracking")
+    {
+        sf::RenderWindow window(graphicsContext,
+                                {.size{256u, 256u},
+                                 .bitsPerPixel = 24,
+                                 .title        = "RenderWindow Tests",
+                                 .style        = sf::Style::Default,
+                                 .state        = sf::State::Windowed});
+
+        REQUIRE(window.setDamageTrackingEnabled(true));
+        CHECK(window.isDamageTrackingEnabled());
+        CHECK(window.getDirtyRegion() == sf::IntRect({0, 0}, {256, 256}));
+
+        window.clear(sf::Color::Red);
+
+        // Presenting through the base class also finishes the frame
+        static_cast<sf::Window&>(window).display();
+        CHECK(window.getDirtyRegion() == sf::IntRect{});
+
+        window.markDirty({{0, 0}, {64, 64}});
+        window.clear(sf::Color::Green);
+        window.display();
+        CHECK(window.getDirtyRegion() == sf::IntRect{});
+
+        // Resizing recreates the back buffer, whose contents must be redrawn
+        window.setSize({128u, 128u});
+        CHECK(window.getDirtyRegion() == sf::IntRect({0, 0}, window.getSize().to<sf::Vector2i>()));
+
+        window.clear(sf::Color::Blue);
+        window.display();
+
+        CHECK(window.setDamageTrackingEnabled(false));
+        CHECK(!window.isDamageTrackingEnabled());
+
+        window.clear(sf::Color::Blue);
+        window.display();
+    }
+
 // Creating multiple windows in Emscripten is not supported
 #ifndef SFML_SYSTEM_EMSCRIPTEN
     SECTION("Multiple windows 1")
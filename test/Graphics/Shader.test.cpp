@@ -2,6 +2,11 @@
 
 // Other 1st party headers
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Vertex.hpp"
 
 #include "SFML/System/FileInputStream.hpp"
 #include "SFML/System/Path.hpp"
@@ -142,6 +147,29 @@ void main()
 
 )glsl";
 
+constexpr auto reflectionFragmentSource = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+uniform sampler2D sf_u_texture;
+uniform sampler2D layers[2];
+uniform float     weights[3];
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+out vec4 sf_fragColor;
+
+void main()
+{
+    vec4 layer = texture(layers[0], sf_v_texCoord) * weights[0] + texture(layers[1], sf_v_texCoord) * weights[1];
+    sf_fragColor = sf_v_color * texture(sf_u_texture, sf_v_texCoord) * layer * weights[2];
+}
+
+)glsl";
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 constexpr bool skipShaderFullTest = false;
 #else
@@ -259,6 +287,70 @@ TEST_CASE("[Graphics] sf::Shader" * doctest::skip(skipShaderFullTest))
             CHECK(static_cast<bool>(shader->getNativeHandle()));
     }
 
+    SECTION("Uniform blocks")
+    {
+        const auto& viewBlockShader = graphicsContext.getBuiltInViewBlockShader();
+        CHECK(viewBlockShader.getUniformBlockIndex("sf_u_ViewBlock").hasValue());
+        CHECK(!viewBlockShader.getUniformBlockIndex("does_not_exist").hasValue());
+        CHECK(viewBlockShader.getUniformLocation("sf_u_modelMatrix").hasValue());
+
+        CHECK(viewBlockShader.setUniformBlockBinding("sf_u_ViewBlock", sf::Shader::ViewBlockBindingPoint));
+        CHECK(!viewBlockShader.setUniformBlockBinding("does_not_exist", 1u));
+
+        const auto& builtInShader = graphicsContext.getBuiltInShader();
+        CHECK(!builtInShader.getUniformBlockIndex("sf_u_ViewBlock").hasValue());
+    }
+
+    SECTION("Uniform reflection")
+    {
+        const auto shader = sf::Shader::loadFromMemory(graphicsContext,
+                                                       graphicsContext.getBuiltInViewBlockShaderVertexSrc(),
+                                                       reflectionFragmentSource)
+                                .value();
+
+        // Arrays are reachable by their bare name and by element
+        const auto weights = shader.getUniformLocation("weights");
+        REQUIRE(weights.hasValue());
+        CHECK(shader.getUniformLocation("weights[0]").hasValue());
+        CHECK(shader.getUniformLocation("weights[2]").hasValue());
+        CHECK(!shader.getUniformLocation("does_not_exist").hasValue());
+
+        const auto texture = sf::Texture::create(graphicsContext, {1u, 1u}).value();
+
+        const auto layer1 = shader.getUniformLocation("layers[1]");
+        REQUIRE(layer1.hasValue());
+        CHECK(shader.setUniform(*layer1, texture));
+        CHECK(shader.setUniform(shader.getUniformLocation("layers").value(), texture));
+
+        // Textures can only be assigned to samplers
+        CHECK(!shader.setUniform(*weights, texture));
+    }
+
+    SECTION("Destroying the last used shader")
+    {
+        const auto shader = sf::Shader::loadFromMemory(graphicsContext,
+                                                       graphicsContext.getBuiltInViewBlockShaderVertexSrc(),
+                                                       reflectionFragmentSource)
+                                .value();
+
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {8u, 8u}).value();
+
+        {
+            const auto lastUsedShader = sf::Shader::loadFromMemory(graphicsContext, vertexSource, fragmentSource).value();
+
+            const sf::Vertex vertices[3]{{{0.f, 0.f}}, {{8.f, 0.f}}, {{0.f, 8.f}}};
+
+            sf::RenderStates states;
+            states.shader = &lastUsedShader;
+
+            renderTexture.draw(vertices, sf::PrimitiveType::Triangles, states);
+        }
+
+        // Setting a uniform restores the previous program, which must not be the deleted one
+        shader.setUniform(shader.getUniformLocation("weights[0]").value(), 1.f);
+        renderTexture.display();
+    }
+
     SECTION("loadFromStream()")
     {
         auto vertexShaderStream   = sf::FileInputStream::open("Graphics/shader.vert").value();
@@ -0,0 +1,90 @@
+#include "SFML/Graphics/ShaderCache.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shader.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <WindowUtil.hpp>
+
+#include <chrono>
+#include <string>
+
+namespace
+{
+// Make the sources unique so that previous test runs never produce a hit
+[[nodiscard]] std::string makeUniqueFragmentSource()
+{
+    return "#version 300 es\n"
+           "// " +
+           std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+           "\n"
+           "precision mediump float;\n"
+           "in vec4 sf_v_color;\n"
+           "out vec4 sf_fragColor;\n"
+           "void main() { sf_fragColor = sf_v_color; }\n";
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::ShaderCache" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::ShaderCache));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::ShaderCache));
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::ShaderCache::create(graphicsContext, "does-not-exist").hasValue());
+
+        const auto shaderCache = sf::ShaderCache::create(graphicsContext, sf::Path::tempDirectoryPath());
+        CHECK(shaderCache.hasValue() == sf::ShaderCache::isAvailable(graphicsContext));
+    }
+
+    SECTION("Hits and misses")
+    {
+        if (!sf::ShaderCache::isAvailable(graphicsContext))
+            return;
+
+        auto shaderCache = sf::ShaderCache::create(graphicsContext, sf::Path::tempDirectoryPath()).value();
+        CHECK(shaderCache.getHitCount() == 0u);
+        CHECK(shaderCache.getMissCount() == 0u);
+
+        const std::string fragmentSource = makeUniqueFragmentSource();
+        const char*       vertexSource   = graphicsContext.getBuiltInViewBlockShaderVertexSrc();
+
+        // Not used until installed
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, vertexSource, fragmentSource).hasValue());
+        CHECK(shaderCache.getMissCount() == 0u);
+
+        graphicsContext.setShaderCache(&shaderCache);
+        CHECK(graphicsContext.getShaderCache() == &shaderCache);
+
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, vertexSource, fragmentSource).hasValue());
+        CHECK(shaderCache.getHitCount() == 0u);
+        CHECK(shaderCache.getMissCount() == 1u);
+
+        const auto shader = sf::Shader::loadFromMemory(graphicsContext, vertexSource, fragmentSource);
+        CHECK(shader.hasValue());
+        CHECK(shaderCache.getHitCount() == 1u);
+        CHECK(shaderCache.getMissCount() == 1u);
+        CHECK(shaderCache.getRejectedCount() == 0u);
+
+        // Restored programs behave like compiled ones
+        CHECK(shader->getUniformLocation("sf_u_modelMatrix").hasValue());
+        CHECK(shader->getUniformBlockIndex("sf_u_ViewBlock").hasValue());
+
+        shaderCache.resetCounters();
+        CHECK(shaderCache.getHitCount() == 0u);
+        CHECK(shaderCache.getMissCount() == 0u);
+
+        graphicsContext.setShaderCache(nullptr);
+    }
+}
@@ -0,0 +1,111 @@
+#include "SFML/Graphics/ShaderCompileQueue.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shader.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <WindowUtil.hpp>
+
+namespace
+{
+constexpr auto fragmentSource = R"glsl(#version 300 es
+
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+in vec4 sf_v_color;
+out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_v_color;
+}
+
+)glsl";
+
+constexpr auto invalidFragmentSource = R"glsl(#version 300 es
+
+void main()
+{
+    this does not compile;
+}
+
+)glsl";
+} // namespace
+
+TEST_CASE("[Graphics] sf::ShaderCompileQueue" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::ShaderCompileQueue));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ShaderCompileQueue));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::ShaderCompileQueue));
+    }
+
+    SECTION("waitForCompletion()")
+    {
+        sf::ShaderCompileQueue queue(graphicsContext);
+
+        const char* vertexSource = graphicsContext.getBuiltInViewBlockShaderVertexSrc();
+
+        const sf::ShaderCompileQueue::Id valid   = queue.push(vertexSource, fragmentSource);
+        const sf::ShaderCompileQueue::Id invalid = queue.push(vertexSource, invalidFragmentSource);
+
+        CHECK(queue.getPendingCount() == 2u);
+        CHECK(queue.getStatus(valid) == sf::ShaderCompileQueue::Status::Pending);
+        CHECK(queue.getShader(valid) == nullptr);
+        CHECK(&queue.getShaderOr(valid, graphicsContext.getBuiltInShader()) == &graphicsContext.getBuiltInShader());
+
+        queue.waitForCompletion();
+
+        CHECK(queue.getPendingCount() == 0u);
+        CHECK(queue.getStatus(valid) == sf::ShaderCompileQueue::Status::Ready);
+        CHECK(queue.getStatus(invalid) == sf::ShaderCompileQueue::Status::Failed);
+
+        REQUIRE(queue.getShader(valid) != nullptr);
+        CHECK(queue.getShader(valid)->getNativeHandle() != 0u);
+        CHECK(queue.getShader(valid)->getUniformBlockIndex("sf_u_ViewBlock").hasValue());
+        CHECK(queue.getShader(invalid) == nullptr);
+    }
+
+    SECTION("update()")
+    {
+        sf::ShaderCompileQueue queue(graphicsContext, /* maxCompilesPerUpdate */ 1u);
+
+        const char* vertexSource = graphicsContext.getBuiltInViewBlockShaderVertexSrc();
+
+        for (int i = 0; i < 3; ++i)
+            (void)queue.push(vertexSource, fragmentSource);
+
+        // Without parallel compilation, one program is compiled per update
+        if (!sf::ShaderCompileQueue::isParallelCompileAvailable(graphicsContext))
+        {
+            queue.update();
+            CHECK(queue.getPendingCount() == 2u);
+        }
+
+        while (queue.getPendingCount() > 0u)
+            queue.update();
+
+        for (sf::ShaderCompileQueue::Id id = 0u; id < 3u; ++id)
+            CHECK(queue.getStatus(id) == sf::ShaderCompileQueue::Status::Ready);
+    }
+
+    SECTION("Missing stages")
+    {
+        sf::ShaderCompileQueue queue(graphicsContext);
+
+        // Missing stages are handled like `Shader::loadFromMemory` does
+        const sf::ShaderCompileQueue::Id fragmentOnly = queue.push({}, fragmentSource);
+        queue.waitForCompletion();
+
+        CHECK(queue.getStatus(fragmentOnly) == sf::ShaderCompileQueue::Status::Ready);
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, fragmentSource, sf::Shader::Type::Fragment).hasValue());
+    }
+}
@@ -0,0 +1,119 @@
+#include "SFML/Graphics/ShapeBatch.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/CircleShape.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RectangleShape.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+TEST_CASE("[Graphics] sf::ShapeBatch" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::ShapeBatch));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::ShapeBatch));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::ShapeBatch));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::ShapeBatch batch(graphicsContext);
+        CHECK(batch.getShapeCount() == 0u);
+        CHECK(batch.getVertexCount() == 0u);
+        CHECK(batch.getIndexCount() == 0u);
+    }
+
+    SECTION("add()")
+    {
+        sf::ShapeBatch batch(graphicsContext);
+
+        sf::RectangleShape rectangle({10.f, 10.f});
+        CHECK(batch.add(rectangle) == 0u);
+        CHECK(batch.getVertexCount() == 5u);
+        CHECK(batch.getIndexCount() == 12u);
+
+        // Outlines add two vertices and two triangles per point
+        rectangle.setOutlineThickness(1.f);
+        CHECK(batch.add(rectangle) == 1u);
+        CHECK(batch.getShapeCount() == 2u);
+        CHECK(batch.getVertexCount() == 5u + 13u);
+        CHECK(batch.getIndexCount() == 12u + 12u + 24u);
+    }
+
+    SECTION("set()")
+    {
+        sf::ShapeBatch batch(graphicsContext);
+
+        sf::CircleShape circle(5.f, 8u);
+        const sf::ShapeBatch::Handle first  = batch.add(circle);
+        const sf::ShapeBatch::Handle second = batch.add(circle);
+        CHECK(batch.getVertexCount() == 18u);
+
+        // Same topology, overwritten in place
+        circle.setPosition({20.f, 20.f});
+        batch.set(second, circle);
+        CHECK(batch.getVertexCount() == 18u);
+
+        // Different topology, the following shapes are moved
+        circle.setPointCount(16u);
+        batch.set(first, circle);
+        CHECK(batch.getVertexCount() == 17u + 9u);
+        CHECK(batch.getIndexCount() == 48u + 24u);
+
+        batch.clear();
+        CHECK(batch.getShapeCount() == 0u);
+        CHECK(batch.getVertexCount() == 0u);
+        CHECK(batch.getIndexCount() == 0u);
+    }
+
+    SECTION("draw()")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {64u, 64u}).value();
+        renderTexture.clear(sf::Color::Black);
+
+        sf::ShapeBatch batch(graphicsContext);
+
+        sf::RectangleShape rectangle({16.f, 16.f});
+        rectangle.setFillColor(sf::Color::Red);
+        rectangle.setOutlineColor(sf::Color::Blue);
+        rectangle.setOutlineThickness(4.f);
+        rectangle.setPosition({8.f, 8.f});
+        const sf::ShapeBatch::Handle handle = batch.add(rectangle);
+
+        rectangle.setFillColor(sf::Color::Green);
+        rectangle.setPosition({40.f, 40.f});
+        (void)batch.add(rectangle);
+
+        renderTexture.draw(batch);
+        renderTexture.display();
+
+        sf::Image image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({16u, 16u}) == sf::Color::Red);
+        CHECK(image.getPixel({48u, 48u}) == sf::Color::Green);
+        CHECK(image.getPixel({6u, 16u}) == sf::Color::Blue);
+        CHECK(image.getPixel({32u, 32u}) == sf::Color::Black);
+
+        // Only the updated shape changes
+        rectangle.setFillColor(sf::Color::White);
+        rectangle.setPosition({8.f, 8.f});
+        batch.set(handle, rectangle);
+
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(batch);
+        renderTexture.display();
+
+        image = renderTexture.getTexture().copyToImage();
+        CHECK(image.getPixel({16u, 16u}) == sf::Color::White);
+        CHECK(image.getPixel({48u, 48u}) == sf::Color::Green);
+    }
+}
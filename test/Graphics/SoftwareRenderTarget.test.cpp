@@ -0,0 +1,423 @@
+#include "SFML/Graphics/SoftwareRenderTarget.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+#include <vector>
+
+#include <cstdint>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<sf::Vertex> makeQuad(sf::Vector2f position, sf::Vector2f size, sf::Color color)
+{
+    return {{position, color, {0.f, 0.f}},
+            {position + sf::Vector2f{size.x, 0.f}, color, {size.x, 0.f}},
+            {position + sf::Vector2f{0.f, size.y}, color, {0.f, size.y}},
+            {position + size, color, size}};
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<sf::Vertex> makeScene()
+{
+    std::vector<sf::Vertex> vertices;
+
+    // Overlapping translucent triangles spanning several tiles
+    for (int i = 0; i < 16; ++i)
+    {
+        const float offset = static_cast<float>(i) * 13.f;
+        const auto  color  = sf::Color(static_cast<std::uint8_t>(i * 16),
+                                      200,
+                                      static_cast<std::uint8_t>(255 - i * 16),
+                                      160);
+
+        vertices.push_back({{offset, 3.f}, color});
+        vertices.push_back({{offset + 90.f, offset + 20.f}, color});
+        vertices.push_back({{20.f, offset + 110.f}, color});
+    }
+
+    return vertices;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool imagesMatch(const sf::Image& lhs, const sf::Image& rhs, int tolerance)
+{
+    if (lhs.getSize() != rhs.getSize())
+        return false;
+
+    const std::uint8_t* lhsPixels = lhs.getPixelsPtr();
+    const std::uint8_t* rhsPixels = rhs.getPixelsPtr();
+
+    for (std::size_t i = 0; i < std::size_t{lhs.getSize().x} * lhs.getSize().y * 4u; ++i)
+        if (std::abs(static_cast<int>(lhsPixels[i]) - static_cast<int>(rhsPixels[i])) > tolerance)
+            return false;
+
+    return true;
+}
+
+} // namespace
+
+
+TEST_CASE("[Graphics] sf::SoftwareRenderTarget")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::SoftwareRenderTarget));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SoftwareRenderTarget));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::SoftwareRenderTarget));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::SoftwareRenderTarget target({100, 50}, 3);
+        CHECK(target.getSize() == sf::Vector2u{100, 50});
+        CHECK(target.getImage().getSize() == sf::Vector2u{100, 50});
+        CHECK(target.getThreadCount() == 3);
+        CHECK(target.getView().getCenter() == sf::Vector2f{50.f, 25.f});
+        CHECK(target.getDefaultView().getSize() == sf::Vector2f{100.f, 50.f});
+
+        const sf::SoftwareRenderTarget defaultThreads({8, 8});
+        CHECK(defaultThreads.getThreadCount() >= 1);
+    }
+
+    SECTION("Clear")
+    {
+        sf::SoftwareRenderTarget target({16, 16}, 1);
+        target.clear(sf::Color::Red);
+        target.display();
+        CHECK(target.getImage().getPixel({0, 0}) == sf::Color::Red);
+        CHECK(target.getImage().getPixel({15, 15}) == sf::Color::Red);
+    }
+
+    SECTION("Draw untextured geometry")
+    {
+        sf::SoftwareRenderTarget target({64, 64}, 1);
+        target.clear(sf::Color::Black);
+
+        const auto quad = makeQuad({8.f, 8.f}, {16.f, 16.f}, sf::Color::Green);
+        target.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+
+        // Nothing is rasterized before `display`
+        CHECK(target.getImage().getPixel({10, 10}) == sf::Color::Black);
+
+        target.display();
+        CHECK(target.getImage().getPixel({8, 8}) == sf::Color::Green);
+        CHECK(target.getImage().getPixel({23, 23}) == sf::Color::Green);
+        CHECK(target.getImage().getPixel({7, 8}) == sf::Color::Black);
+        CHECK(target.getImage().getPixel({24, 23}) == sf::Color::Black);
+    }
+
+    SECTION("Shared edges are drawn once")
+    {
+        sf::SoftwareRenderTarget target({32, 32}, 1);
+        target.clear(sf::Color::Black);
+
+        const auto quad = makeQuad({0.f, 0.f}, {32.f, 32.f}, sf::Color(255, 255, 255, 128));
+        target.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+        target.display();
+
+        for (unsigned int y = 0; y < 32; ++y)
+            for (unsigned int x = 0; x < 32; ++x)
+                REQUIRE(target.getImage().getPixel({x, y}) == sf::Color(128, 128, 128));
+    }
+
+    SECTION("Draw indexed geometry")
+    {
+        sf::SoftwareRenderTarget target({16, 16}, 1);
+        target.clear(sf::Color::Black);
+
+        const auto          quad      = makeQuad({0.f, 0.f}, {8.f, 8.f}, sf::Color::Blue);
+        const sf::IndexType indices[] = {0, 1, 2, 1, 3, 2};
+        target.drawIndexed(quad.data(), quad.size(), indices, 6, sf::PrimitiveType::Triangles);
+        target.display();
+
+        CHECK(target.getImage().getPixel({0, 0}) == sf::Color::Blue);
+        CHECK(target.getImage().getPixel({7, 7}) == sf::Color::Blue);
+        CHECK(target.getImage().getPixel({8, 8}) == sf::Color::Black);
+    }
+
+    SECTION("Points and lines")
+    {
+        sf::SoftwareRenderTarget target({10, 10}, 1);
+        target.clear(sf::Color::Black);
+
+        const sf::Vertex point{{3.5f, 4.5f}, sf::Color::Green};
+        target.draw(&point, 1, sf::PrimitiveType::Points);
+
+        const sf::Vertex line[] = {{{0.f, 8.5f}, sf::Color::Blue}, {{10.f, 8.5f}, sf::Color::Blue}};
+        target.draw(line, 2, sf::PrimitiveType::Lines);
+        target.display();
+
+        CHECK(target.getImage().getPixel({3, 4}) == sf::Color::Green);
+        CHECK(target.getImage().getPixel({4, 4}) == sf::Color::Black);
+        CHECK(target.getImage().getPixel({0, 8}) == sf::Color::Blue);
+        CHECK(target.getImage().getPixel({9, 8}) == sf::Color::Blue);
+        CHECK(target.getImage().getPixel({5, 7}) == sf::Color::Black);
+    }
+
+    SECTION("Texture sampling")
+    {
+        auto image = sf::Image::create({2, 2}).value();
+        image.setPixel({0, 0}, sf::Color::Red);
+        image.setPixel({1, 0}, sf::Color::Green);
+        image.setPixel({0, 1}, sf::Color::Blue);
+        image.setPixel({1, 1}, sf::Color::White);
+
+        sf::SoftwareRenderTarget target({4, 4}, 1);
+        target.clear(sf::Color::Black);
+
+        auto quad = makeQuad({0.f, 0.f}, {4.f, 4.f}, sf::Color::White);
+        for (sf::Vertex& vertex : quad)
+            vertex.texCoords /= 2.f;
+
+        SECTION("Nearest")
+        {
+            target.draw(quad.data(),
+                        quad.size(),
+                        sf::PrimitiveType::TriangleStrip,
+                        sf::RenderStates::Default,
+                        {&image});
+            target.display();
+
+            CHECK(target.getImage().getPixel({0, 0}) == sf::Color::Red);
+            CHECK(target.getImage().getPixel({3, 0}) == sf::Color::Green);
+            CHECK(target.getImage().getPixel({0, 3}) == sf::Color::Blue);
+            CHECK(target.getImage().getPixel({3, 3}) == sf::Color::White);
+        }
+
+        SECTION("Vertex color modulation")
+        {
+            for (sf::Vertex& vertex : quad)
+                vertex.color = sf::Color(255, 0, 255);
+
+            target.draw(quad.data(),
+                        quad.size(),
+                        sf::PrimitiveType::TriangleStrip,
+                        sf::RenderStates::Default,
+                        {&image});
+            target.display();
+
+            CHECK(target.getImage().getPixel({3, 3}) == sf::Color::Magenta);
+            CHECK(target.getImage().getPixel({3, 0}) == sf::Color::Black);
+        }
+
+        SECTION("Bilinear")
+        {
+            auto gradient = sf::Image::create({2, 1}).value();
+            gradient.setPixel({0, 0}, sf::Color::Black);
+            gradient.setPixel({1, 0}, sf::Color::White);
+
+            auto strip = makeQuad({0.f, 0.f}, {4.f, 1.f}, sf::Color::White);
+            for (sf::Vertex& vertex : strip)
+                vertex.texCoords.x /= 2.f;
+
+            target.draw(strip.data(),
+                        strip.size(),
+                        sf::PrimitiveType::TriangleStrip,
+                        sf::RenderStates::Default,
+                        {&gradient, /* smooth */ true});
+            target.display();
+
+            CHECK(target.getImage().getPixel({0, 0}).r == 0);
+            CHECK(target.getImage().getPixel({1, 0}).r == 64);
+            CHECK(target.getImage().getPixel({2, 0}).r == 191);
+            CHECK(target.getImage().getPixel({3, 0}).r == 255);
+        }
+
+        SECTION("Repeated")
+        {
+            for (sf::Vertex& vertex : quad)
+                vertex.texCoords *= 2.f;
+
+            target.draw(quad.data(),
+                        quad.size(),
+                        sf::PrimitiveType::TriangleStrip,
+                        sf::RenderStates::Default,
+                        {&image, /* smooth */ false, /* repeated */ true});
+            target.display();
+
+            CHECK(target.getImage().getPixel({0, 0}) == sf::Color::Red);
+            CHECK(target.getImage().getPixel({2, 0}) == sf::Color::Red);
+            CHECK(target.getImage().getPixel({3, 3}) == sf::Color::White);
+        }
+    }
+
+    SECTION("Blend modes")
+    {
+        sf::SoftwareRenderTarget target({4, 4}, 1);
+        target.clear(sf::Color(100, 100, 100));
+
+        const auto quad = makeQuad({0.f, 0.f}, {4.f, 4.f}, sf::Color(50, 200, 0));
+
+        SECTION("Add")
+        {
+            target.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip, sf::RenderStates(sf::BlendAdd));
+            target.display();
+            CHECK(target.getImage().getPixel({1, 1}) == sf::Color(150, 255, 100));
+        }
+
+        SECTION("Multiply")
+        {
+            target.draw(quad.data(),
+                        quad.size(),
+                        sf::PrimitiveType::TriangleStrip,
+                        sf::RenderStates(sf::BlendMultiply));
+            target.display();
+            CHECK(target.getImage().getPixel({1, 1}) == sf::Color(20, 78, 0));
+        }
+
+        SECTION("Min")
+        {
+            target.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip, sf::RenderStates(sf::BlendMin));
+            target.display();
+            CHECK(target.getImage().getPixel({1, 1}) == sf::Color(50, 100, 0));
+        }
+    }
+
+    SECTION("Stencil")
+    {
+        sf::SoftwareRenderTarget target({10, 10}, 1);
+        target.clear(sf::Color::Black, 0);
+
+        const auto mask = makeQuad({0.f, 0.f}, {5.f, 10.f}, sf::Color::White);
+        target.draw(mask.data(),
+                    mask.size(),
+                    sf::PrimitiveType::TriangleStrip,
+                    sf::RenderStates(sf::StencilMode{sf::StencilComparison::Always,
+                                                     sf::StencilUpdateOperation::Replace,
+                                                     1u,
+                                                     ~0u,
+                                                     /* stencilOnly */ true}));
+
+        const auto fill = makeQuad({0.f, 0.f}, {10.f, 10.f}, sf::Color::Red);
+        target.draw(fill.data(),
+                    fill.size(),
+                    sf::PrimitiveType::TriangleStrip,
+                    sf::RenderStates(sf::StencilMode{sf::StencilComparison::Equal,
+                                                     sf::StencilUpdateOperation::Keep,
+                                                     1u,
+                                                     ~0u,
+                                                     false}));
+        target.display();
+
+        CHECK(target.getImage().getPixel({2, 2}) == sf::Color::Red);
+        CHECK(target.getImage().getPixel({7, 2}) == sf::Color::Black);
+    }
+
+    SECTION("Viewport and scissor")
+    {
+        sf::SoftwareRenderTarget target({100, 100}, 2);
+        target.clear(sf::Color::Black);
+
+        sf::View view(sf::FloatRect({0.f, 0.f}, {100.f, 100.f}));
+        view.setViewport(sf::FloatRect({0.5f, 0.f}, {0.5f, 0.5f}));
+        target.setView(view);
+
+        const auto quad = makeQuad({0.f, 0.f}, {100.f, 100.f}, sf::Color::Red);
+        target.draw(quad.data(), quad.size(), sf::PrimitiveType::TriangleStrip);
+
+        sf::View scissored = target.getDefaultView();
+        scissored.setScissor(sf::FloatRect({0.f, 0.5f}, {1.f, 0.5f}));
+        target.setView(scissored);
+        target.clear(sf::Color::Blue);
+        target.display();
+
+        CHECK(target.getImage().getPixel({60, 10}) == sf::Color::Red);
+        CHECK(target.getImage().getPixel({40, 10}) == sf::Color::Black);
+        CHECK(target.getImage().getPixel({60, 60}) == sf::Color::Blue);
+    }
+
+    SECTION("Multithreaded rasterization matches single-threaded")
+    {
+        const auto scene = makeScene();
+
+        sf::SoftwareRenderTarget singleThreaded({300, 300}, 1);
+        sf::SoftwareRenderTarget multiThreaded({300, 300}, 4);
+
+        for (sf::SoftwareRenderTarget* target : {&singleThreaded, &multiThreaded})
+        {
+            // Several frames reuse the tile bins
+            for (int frame = 0; frame < 3; ++frame)
+            {
+                target->clear(sf::Color(10, 20, 30));
+                target->draw(scene.data(), scene.size(), sf::PrimitiveType::Triangles);
+                target->draw(scene.data(), 12, sf::PrimitiveType::LineStrip);
+                target->display();
+            }
+        }
+
+        CHECK(imagesMatch(singleThreaded.getImage(), multiThreaded.getImage(), 0));
+    }
+}
+
+
+TEST_CASE("[Graphics] sf::SoftwareRenderTarget (golden)" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    // The software target is compared against the graphics card, which rounds differently
+    constexpr int tolerance = 2;
+
+    auto renderTexture = sf::RenderTexture::create(graphicsContext, {128, 128}).value();
+    sf::SoftwareRenderTarget target({128, 128}, 2);
+
+    SECTION("Untextured")
+    {
+        const auto scene = makeScene();
+
+        renderTexture.clear(sf::Color(10, 20, 30));
+        renderTexture.draw(scene.data(), scene.size(), sf::PrimitiveType::Triangles);
+        renderTexture.display();
+
+        target.clear(sf::Color(10, 20, 30));
+        target.draw(scene.data(), scene.size(), sf::PrimitiveType::Triangles);
+        target.display();
+
+        CHECK(imagesMatch(renderTexture.getTexture().copyToImage(), target.getImage(), tolerance));
+    }
+
+    SECTION("Textured")
+    {
+        auto image = sf::Image::create({4, 4}).value();
+        for (unsigned int y = 0; y < 4; ++y)
+            for (unsigned int x = 0; x < 4; ++x)
+                image.setPixel({x, y},
+                               sf::Color(static_cast<std::uint8_t>(x * 80), static_cast<std::uint8_t>(y * 80), 128));
+
+        const auto texture = sf::Texture::loadFromImage(graphicsContext, image).value();
+
+        auto scaled = makeQuad({16.f, 16.f}, {96.f, 96.f}, sf::Color(255, 255, 255, 200));
+        for (sf::Vertex& vertex : scaled)
+            vertex.texCoords /= 24.f;
+
+        renderTexture.clear(sf::Color::Black);
+        renderTexture.draw(scaled.data(), scaled.size(), sf::PrimitiveType::TriangleStrip, sf::RenderStates(&texture));
+        renderTexture.display();
+
+        target.clear(sf::Color::Black);
+        target.draw(scaled.data(),
+                    scaled.size(),
+                    sf::PrimitiveType::TriangleStrip,
+                    sf::RenderStates::Default,
+                    {&image});
+        target.display();
+
+        CHECK(imagesMatch(renderTexture.getTexture().copyToImage(), target.getImage(), tolerance));
+    }
+}
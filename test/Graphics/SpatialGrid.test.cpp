@@ -0,0 +1,122 @@
+#include "SFML/Graphics/SpatialGrid.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/View.hpp"
+
+#include "SFML/System/Angle.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+[[nodiscard]] std::vector<sf::SpatialGrid::ObjectId> sorted(std::vector<sf::SpatialGrid::ObjectId> ids)
+{
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::SpatialGrid")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::SpatialGrid));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SpatialGrid));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::SpatialGrid));
+    }
+
+    sf::SpatialGrid grid(sf::FloatRect({0.f, 0.f}, {1000.f, 1000.f}), {100.f, 100.f});
+
+    SECTION("Construction")
+    {
+        CHECK(grid.getObjectCount() == 0u);
+        CHECK(grid.getVisibleCount() == 0u);
+        CHECK(grid.getCulledCount() == 0u);
+    }
+
+    const auto a = grid.insert({{10.f, 10.f}, {20.f, 20.f}});
+    const auto b = grid.insert({{150.f, 50.f}, {100.f, 100.f}}); // Spans several cells
+    const auto c = grid.insert({{900.f, 900.f}, {10.f, 10.f}});
+    const auto d = grid.insert({{-500.f, 2000.f}, {10.f, 10.f}}); // Outside of the grid area
+
+    std::vector<sf::SpatialGrid::ObjectId> result;
+
+    SECTION("Insert")
+    {
+        CHECK(grid.getObjectCount() == 4u);
+        CHECK(grid.getBounds(b) == sf::FloatRect({150.f, 50.f}, {100.f, 100.f}));
+    }
+
+    SECTION("Query")
+    {
+        CHECK(grid.query({{0.f, 0.f}, {300.f, 300.f}}, result) == 2u);
+        CHECK(sorted(result) == std::vector{a, b});
+
+        // Objects spanning several cells are reported once
+        result.clear();
+        CHECK(grid.query({{200.f, 60.f}, {10.f, 200.f}}, result) == 1u);
+        CHECK(result == std::vector{b});
+
+        result.clear();
+        CHECK(grid.query({{-600.f, 1900.f}, {200.f, 200.f}}, result) == 1u);
+        CHECK(result == std::vector{d});
+    }
+
+    SECTION("Update")
+    {
+        grid.update(a, {{12.f, 12.f}, {20.f, 20.f}});
+        grid.update(c, {{50.f, 50.f}, {10.f, 10.f}});
+        CHECK(grid.getBounds(a) == sf::FloatRect({12.f, 12.f}, {20.f, 20.f}));
+
+        CHECK(grid.query({{0.f, 0.f}, {100.f, 100.f}}, result) == 2u);
+        CHECK(sorted(result) == std::vector{a, c});
+
+        result.clear();
+        CHECK(grid.query({{850.f, 850.f}, {100.f, 100.f}}, result) == 0u);
+    }
+
+    SECTION("Remove")
+    {
+        grid.remove(b);
+        CHECK(grid.getObjectCount() == 3u);
+        CHECK(grid.query({{0.f, 0.f}, {300.f, 300.f}}, result) == 1u);
+
+        // Identifiers are reused
+        CHECK(grid.insert({{0.f, 0.f}, {1.f, 1.f}}) == b);
+
+        grid.clear();
+        CHECK(grid.getObjectCount() == 0u);
+    }
+
+    SECTION("Query visible")
+    {
+        CHECK(grid.queryVisible(sf::View(sf::FloatRect({0.f, 0.f}, {400.f, 300.f})), result) == 2u);
+        CHECK(sorted(result) == std::vector{a, b});
+        CHECK(grid.getVisibleCount() == 2u);
+        CHECK(grid.getCulledCount() == 2u);
+
+        // In a corner of the view, which the view rotated by 45 degrees no longer covers
+        const auto e = grid.insert({{-195.f, -195.f}, {5.f, 5.f}});
+
+        sf::View view({0.f, 0.f}, {400.f, 400.f});
+
+        result.clear();
+        CHECK(grid.queryVisible(view, result) == 3u);
+        CHECK(sorted(result) == std::vector{a, b, e});
+
+        // e is still inside the bounding box of the rotated view
+        view.setRotation(sf::degrees(45.f));
+
+        result.clear();
+        CHECK(grid.queryVisible(view, result) == 2u);
+        CHECK(sorted(result) == std::vector{a, b});
+        CHECK(grid.getVisibleCount() == 2u);
+        CHECK(grid.getCulledCount() == 3u);
+    }
+}
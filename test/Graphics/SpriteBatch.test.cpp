@@ -0,0 +1,200 @@
+#include "SFML/Graphics/SpriteBatch.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::SpriteBatch" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::SpriteBatch));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SpriteBatch));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::SpriteBatch));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::SpriteBatch batch(graphicsContext);
+        CHECK(batch.getSpriteCount() == 0u);
+        CHECK(batch.getThreadCount() == 1u);
+
+        const sf::SpriteBatch threadedBatch(graphicsContext, 0u);
+        CHECK(threadedBatch.getThreadCount() >= 1u);
+    }
+
+    SECTION("Add")
+    {
+        sf::Sprite sprite({{8, 16}, {32, 24}});
+        sprite.setPosition({10.f, 20.f});
+        sprite.setRotation(sf::degrees(-90.f));
+        sprite.setScale({2.f, 3.f});
+        sprite.setOrigin({4.f, 5.f});
+        sprite.setColor(sf::Color::Cyan);
+
+        sf::SpriteBatch batch(graphicsContext);
+        const sf::SpriteBatch::Handle handle = batch.add(sprite);
+
+        CHECK(batch.getSpriteCount() == 1u);
+        CHECK(batch.getPosition(handle) == sf::Vector2f{10.f, 20.f});
+        CHECK(batch.getRotation(handle) == sf::degrees(270.f));
+        CHECK(batch.getScale(handle) == sf::Vector2f{2.f, 3.f});
+        CHECK(batch.getOrigin(handle) == sf::Vector2f{4.f, 5.f});
+        CHECK(batch.getTextureRect(handle) == sf::IntRect({8, 16}, {32, 24}));
+        CHECK(batch.getColor(handle) == sf::Color::Cyan);
+
+        SECTION("Set")
+        {
+            batch.setPosition(handle, {1.f, 2.f});
+            batch.move(handle, {1.f, 1.f});
+            batch.setRotation(handle, sf::degrees(45.f));
+            batch.setScale(handle, {0.5f, 0.5f});
+            batch.setOrigin(handle, {0.f, 1.f});
+            batch.setTextureRect(handle, {{0, 0}, {-4, 4}});
+            batch.setColor(handle, sf::Color::Red);
+
+            CHECK(batch.getPosition(handle) == sf::Vector2f{2.f, 3.f});
+            CHECK(batch.getRotation(handle) == sf::degrees(45.f));
+            CHECK(batch.getScale(handle) == sf::Vector2f{0.5f, 0.5f});
+            CHECK(batch.getOrigin(handle) == sf::Vector2f{0.f, 1.f});
+            CHECK(batch.getTextureRect(handle) == sf::IntRect({0, 0}, {-4, 4}));
+            CHECK(batch.getColor(handle) == sf::Color::Red);
+
+            batch.set(handle, sprite);
+            CHECK(batch.getPosition(handle) == sf::Vector2f{10.f, 20.f});
+            CHECK(batch.getColor(handle) == sf::Color::Cyan);
+        }
+
+        SECTION("Clear")
+        {
+            batch.reserve(16u);
+            batch.clear();
+            CHECK(batch.getSpriteCount() == 0u);
+        }
+    }
+
+    SECTION("Draw")
+    {
+        // Left half is red, right half is green
+        auto image = sf::Image::create({16u, 8u}, sf::Color::Red).value();
+        for (unsigned int y = 0u; y < 8u; ++y)
+            for (unsigned int x = 8u; x < 16u; ++x)
+                image.setPixel({x, y}, sf::Color::Green);
+
+        const auto texture = sf::Texture::loadFromImage(graphicsContext, image).value();
+
+        std::vector<sf::Sprite> sprites;
+        for (int i = 0; i < 20; ++i)
+        {
+            sf::Sprite& sprite = sprites.emplace_back(sf::IntRect({(i % 2) * 8, 0}, {8, 8}));
+            sprite.setPosition({static_cast<float>(i % 5) * 12.f + 4.f, static_cast<float>(i / 5) * 12.f + 4.f});
+            sprite.setOrigin({4.f, 4.f});
+            sprite.setRotation(sf::degrees(static_cast<float>(i) * 90.f));
+        }
+
+        const auto drawAndCopy = [&](auto&& drawFunc)
+        {
+            auto renderTexture = sf::RenderTexture::create(graphicsContext, {64u, 64u}).value();
+            renderTexture.clear();
+            drawFunc(renderTexture);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        const auto expected = drawAndCopy(
+            [&](sf::RenderTexture& renderTexture)
+        {
+            for (const sf::Sprite& sprite : sprites)
+                renderTexture.draw(sprite, texture);
+        });
+
+        for (const unsigned int threadCount : {1u, 4u})
+        {
+            sf::SpriteBatch batch(graphicsContext, threadCount);
+            for (const sf::Sprite& sprite : sprites)
+                (void)batch.add(sprite);
+
+            const auto result = drawAndCopy([&](sf::RenderTexture& renderTexture)
+                                            { batch.draw(renderTexture, texture, sf::RenderStates::Default); });
+
+            for (unsigned int y = 0u; y < 64u; y += 3u)
+                for (unsigned int x = 0u; x < 64u; x += 3u)
+                    CHECK(result.getPixel({x, y}) == expected.getPixel({x, y}));
+        }
+    }
+
+    SECTION("Multithreaded draw")
+    {
+        const auto texture = sf::Texture::loadFromImage(graphicsContext,
+                                                        sf::Image::create({8u, 8u}, sf::Color::White).value())
+                                 .value();
+
+        // More than three blocks of 8192 sprites, each 8x8 cell of the target covered once per block
+        constexpr std::size_t cellCount   = 64u;
+        constexpr std::size_t spriteCount = 3u * 8192u + cellCount;
+
+        const auto cellColor = [](std::size_t index)
+        {
+            return sf::Color{static_cast<std::uint8_t>((index % cellCount) * 4u),
+                             static_cast<std::uint8_t>(index / 8192u * 64u),
+                             255u};
+        };
+
+        sf::SpriteBatch batch(graphicsContext, 4u);
+        batch.reserve(spriteCount);
+
+        for (std::size_t i = 0u; i < spriteCount; ++i)
+        {
+            sf::Sprite sprite(sf::IntRect({0, 0}, {8, 8}));
+            sprite.setPosition({static_cast<float>(i % 8u * 8u), static_cast<float>(i % cellCount / 8u * 8u)});
+            sprite.setColor(cellColor(i));
+            (void)batch.add(sprite);
+        }
+
+        const auto drawAndCopy = [&]
+        {
+            auto renderTexture = sf::RenderTexture::create(graphicsContext, {64u, 64u}).value();
+            renderTexture.clear();
+            batch.draw(renderTexture, texture, sf::RenderStates::Default);
+            renderTexture.display();
+            return renderTexture.getTexture().copyToImage();
+        };
+
+        // The sprites of the last, partial block are drawn last
+        const auto last = drawAndCopy();
+
+        for (std::size_t cell = 0u; cell < cellCount; ++cell)
+            CHECK(last.getPixel({static_cast<unsigned int>(cell % 8u * 8u + 4u),
+                                 static_cast<unsigned int>(cell / 8u * 8u + 4u)}) ==
+                  cellColor(spriteCount - cellCount + cell));
+
+        // Moving them away reveals the sprites of the third block
+        for (std::size_t i = spriteCount - cellCount; i < spriteCount; ++i)
+            batch.move(i, {100.f, 0.f});
+
+        const auto third = drawAndCopy();
+
+        for (std::size_t cell = 0u; cell < cellCount; ++cell)
+            CHECK(third.getPixel({static_cast<unsigned int>(cell % 8u * 8u + 4u),
+                                  static_cast<unsigned int>(cell / 8u * 8u + 4u)}) ==
+                  cellColor(spriteCount - 2u * cellCount + cell));
+    }
+}
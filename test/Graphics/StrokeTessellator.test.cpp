@@ -0,0 +1,168 @@
+#include "SFML/Graphics/StrokeTessellator.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/Vertex.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+
+#include <vector>
+
+namespace
+{
+// Sum of the areas of the triangles, also counting the ones with a reversed winding
+[[nodiscard]] float computeArea(const std::vector<sf::Vertex>& vertices, bool& consistentWinding)
+{
+    float area        = 0.f;
+    consistentWinding = true;
+
+    for (std::size_t i = 0; i + 2 < vertices.size(); i += 3)
+    {
+        const sf::Vector2f a = vertices[i].position;
+
+        const float signedArea = (vertices[i + 1].position - a).cross(vertices[i + 2].position - a) * 0.5f;
+        consistentWinding      = consistentWinding && signedArea >= -0.0001f;
+        area += signedArea < 0.f ? -signedArea : signedArea;
+    }
+
+    return area;
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::StrokeTessellator")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::StrokeTessellator));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::StrokeTessellator));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::StrokeTessellator));
+        STATIC_CHECK(SFML_BASE_IS_AGGREGATE(sf::StrokeStyle));
+    }
+
+    sf::StrokeTessellator   tessellator;
+    std::vector<sf::Vertex> vertices;
+    bool                    consistentWinding = false;
+
+    const sf::Vector2f segment[]{{0.f, 0.f}, {10.f, 0.f}};
+    const sf::Vector2f corner[]{{0.f, 0.f}, {10.f, 0.f}, {10.f, 10.f}};
+    const sf::Vector2f square[]{{0.f, 0.f}, {10.f, 0.f}, {10.f, 10.f}, {0.f, 10.f}};
+
+    SECTION("Degenerate polylines")
+    {
+        CHECK(tessellator.appendPolyline(vertices, segment, 0, {}) == 0);
+        CHECK(tessellator.appendPolyline(vertices, segment, 1, {}) == 0);
+
+        const sf::Vector2f duplicates[]{{5.f, 5.f}, {5.f, 5.f}, {5.f, 5.f}};
+        CHECK(tessellator.appendPolyline(vertices, duplicates, 3, {}) == 0);
+        CHECK(vertices.empty());
+    }
+
+    SECTION("Butt cap")
+    {
+        CHECK(tessellator.appendPolyline(vertices, segment, 2, {.thickness = 2.f, .color = sf::Color::Red}) == 6);
+        CHECK(computeArea(vertices, consistentWinding) == Approx(20.f));
+        CHECK(consistentWinding);
+
+        for (const sf::Vertex& vertex : vertices)
+            CHECK(vertex.color == sf::Color::Red);
+    }
+
+    SECTION("Square cap")
+    {
+        CHECK(tessellator.appendPolyline(vertices, segment, 2, {.thickness = 2.f, .cap = sf::LineCap::Square}) == 6);
+        CHECK(computeArea(vertices, consistentWinding) == Approx(24.f));
+        CHECK(consistentWinding);
+    }
+
+    SECTION("Round cap")
+    {
+        CHECK(tessellator.appendPolyline(vertices, segment, 2, {.thickness = 20.f, .cap = sf::LineCap::Round}) > 6);
+
+        // The arcs are inscribed in the half circles
+        const float area = computeArea(vertices, consistentWinding);
+        CHECK(area > 200.f + 3.f * 100.f);
+        CHECK(area < 200.f + 3.1416f * 100.f);
+        CHECK(consistentWinding);
+    }
+
+    SECTION("Joins")
+    {
+        SECTION("Miter")
+        {
+            CHECK(tessellator.appendPolyline(vertices, corner, 3, {.thickness = 2.f}) == 12);
+            CHECK(computeArea(vertices, consistentWinding) == Approx(40.f));
+            CHECK(consistentWinding);
+        }
+
+        SECTION("Miter beyond the limit")
+        {
+            CHECK(tessellator.appendPolyline(vertices, corner, 3, {.thickness = 2.f, .miterLimit = 1.f}) == 18);
+            CHECK(computeArea(vertices, consistentWinding) == Approx(39.5f));
+            CHECK(consistentWinding);
+        }
+
+        SECTION("Bevel")
+        {
+            CHECK(tessellator.appendPolyline(vertices, corner, 3, {.thickness = 2.f, .join = sf::LineJoin::Bevel}) == 18);
+            CHECK(computeArea(vertices, consistentWinding) == Approx(39.5f));
+            CHECK(consistentWinding);
+        }
+
+        SECTION("Round")
+        {
+            CHECK(tessellator.appendPolyline(vertices, corner, 3, {.thickness = 2.f, .join = sf::LineJoin::Round}) > 18);
+
+            const float area = computeArea(vertices, consistentWinding);
+            CHECK(area > 39.5f);
+            CHECK(area < 39.5f + 3.1416f / 4.f - 0.5f);
+            CHECK(consistentWinding);
+        }
+    }
+
+    SECTION("Closed polygon")
+    {
+        CHECK(tessellator.appendPolygon(vertices, square, 4, {.thickness = 2.f}) == 24);
+        CHECK(computeArea(vertices, consistentWinding) == Approx(80.f));
+        CHECK(consistentWinding);
+
+        // Repeating the first point does not change the outline
+        const sf::Vector2f closedSquare[]{{0.f, 0.f}, {10.f, 0.f}, {10.f, 10.f}, {0.f, 10.f}, {0.f, 0.f}};
+        std::vector<sf::Vertex> otherVertices;
+        CHECK(tessellator.appendPolygon(otherVertices, closedSquare, 5, {.thickness = 2.f}) == 24);
+        CHECK(computeArea(otherVertices, consistentWinding) == Approx(80.f));
+    }
+
+    SECTION("Antialiasing")
+    {
+        const sf::StrokeStyle style{.thickness = 2.f, .color = sf::Color::Blue, .antialiasingWidth = 1.f};
+
+        // Solid core, a fringe on both sides and a fading end on both caps
+        CHECK(tessellator.appendPolyline(vertices, segment, 2, style) == 3 * 6 * 3);
+        CHECK(computeArea(vertices, consistentWinding) == Approx(3.f * 11.f));
+        CHECK(consistentWinding);
+
+        bool hasTransparent = false;
+        bool hasOpaque      = false;
+
+        for (const sf::Vertex& vertex : vertices)
+        {
+            CHECK(sf::Color(vertex.color.r, vertex.color.g, vertex.color.b) == sf::Color::Blue);
+            hasTransparent = hasTransparent || vertex.color.a == 0;
+            hasOpaque      = hasOpaque || vertex.color.a == 255;
+        }
+
+        CHECK(hasTransparent);
+        CHECK(hasOpaque);
+    }
+
+    SECTION("Appends to the output")
+    {
+        vertices.resize(3);
+        CHECK(tessellator.appendPolyline(vertices, segment, 2, {}) == 6);
+        CHECK(tessellator.appendPolygon(vertices, square, 4, {}) == 24);
+        CHECK(vertices.size() == 3 + 6 + 24);
+    }
+}
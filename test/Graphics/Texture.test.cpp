@@ -71,6 +71,18 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
             const auto texture = sf::Texture::create(graphicsContext, {100, 100}).value();
             CHECK(texture.getSize() == sf::Vector2u{100, 100});
             CHECK(texture.getNativeHandle() != 0);
+            CHECK(texture.getFormat() == sf::TextureFormat::RGBA8);
+        }
+
+        SECTION("Texture format")
+        {
+            const auto texture = sf::Texture::create(graphicsContext, {100, 100}, sf::TextureFormat::RGBA16F, true).value();
+            CHECK(texture.getSize() == sf::Vector2u{100, 100});
+            CHECK(texture.getFormat() == sf::TextureFormat::RGBA16F);
+            CHECK(!texture.isSrgb()); // sRGB only applies to RGBA8
+
+            const sf::Texture copy(texture);
+            CHECK(copy.getFormat() == sf::TextureFormat::RGBA16F);
         }
 
         SECTION("Too large")
@@ -139,6 +151,22 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
                 CHECK(texture.getNativeHandle() != 0);
             }
         }
+
+        SECTION("Premultiplied image")
+        {
+            auto image = sf::Image::create(sf::Vector2u{10, 15}, sf::Color(255, 255, 255, 128)).value();
+            image.premultiplyAlpha();
+
+            const auto texture = sf::Texture::loadFromImage(graphicsContext, image).value();
+            CHECK(texture.isAlphaPremultiplied());
+
+            const auto subTexture = sf::Texture::loadFromImage(graphicsContext, image, false, {{0, 0}, {5, 10}}).value();
+            CHECK(subTexture.isAlphaPremultiplied());
+
+            const auto copiedImage = texture.copyToImage();
+            CHECK(copiedImage.isAlphaPremultiplied());
+            CHECK(copiedImage.getPixel({0, 0}) == sf::Color(128, 128, 128, 128));
+        }
     }
 
     SECTION("Copy semantics")
@@ -217,6 +245,21 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
             const auto image   = sf::Image::create(sf::Vector2u{16, 32}, sf::Color::Red).value();
             texture.update(image);
             CHECK(texture.copyToImage().getPixel(sf::Vector2u{7, 15}) == sf::Color::Red);
+            CHECK(!texture.isAlphaPremultiplied());
+
+            auto premultipliedImage = sf::Image::create(sf::Vector2u{16, 32}, sf::Color(255, 0, 0, 128)).value();
+            premultipliedImage.premultiplyAlpha();
+            texture.update(premultipliedImage);
+            CHECK(texture.isAlphaPremultiplied());
+
+            // A partial update keeps the alpha encoding of the texture
+            auto smallImage = sf::Image::create(sf::Vector2u{8, 8}, sf::Color(255, 0, 0, 128)).value();
+            smallImage.premultiplyAlpha();
+            texture.update(smallImage);
+            CHECK(texture.isAlphaPremultiplied());
+
+            texture.update(image);
+            CHECK(!texture.isAlphaPremultiplied());
         }
 
         SECTION("Image and destination")
@@ -232,6 +275,23 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
             CHECK(textureAsImage.getPixel(sf::Vector2u{7, 7}) == sf::Color::Red);
             CHECK(textureAsImage.getPixel(sf::Vector2u{7, 22}) == sf::Color::Green);
         }
+
+        SECTION("Image view")
+        {
+            auto image = sf::Image::create(sf::Vector2u{8, 8}, sf::Color::Red).value();
+            image.setPixel(sf::Vector2u{3, 3}, sf::Color::Blue);
+
+            auto texture = sf::Texture::create(graphicsContext, sf::Vector2u{4, 4}).value();
+            texture.update(image.asImageView().getSubView({2u, 2u}, {4u, 4u}));
+
+            const auto textureAsImage = texture.copyToImage();
+            CHECK(textureAsImage.getPixel(sf::Vector2u{0, 0}) == sf::Color::Red);
+            CHECK(textureAsImage.getPixel(sf::Vector2u{1, 1}) == sf::Color::Blue);
+
+            const sf::ImageView bgraView{image.getPixelsPtr(), {4u, 4u}, 8u * 4u, sf::PixelFormat::BGRA};
+            texture.update(bgraView);
+            CHECK(texture.copyToImage().getPixel(sf::Vector2u{0, 0}) == sf::Color::Blue);
+        }
     }
 
     SECTION("Set/get smooth")
@@ -244,6 +304,16 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
         CHECK(!texture.isSmooth());
     }
 
+    SECTION("Set/get premultiplied alpha")
+    {
+        sf::Texture texture = sf::Texture::create(graphicsContext, {64, 64}).value();
+        CHECK(!texture.isAlphaPremultiplied());
+        texture.setAlphaPremultiplied(true);
+        CHECK(texture.isAlphaPremultiplied());
+        texture.setAlphaPremultiplied(false);
+        CHECK(!texture.isAlphaPremultiplied());
+    }
+
     SECTION("Set/get repeated")
     {
         sf::Texture texture = sf::Texture::create(graphicsContext, {64, 64}).value();
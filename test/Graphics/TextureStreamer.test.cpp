@@ -0,0 +1,175 @@
+#include "SFML/Graphics/TextureStreamer.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/MipChain.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+#include <cstddef>
+
+namespace
+{
+[[nodiscard]] sf::MipChain makeChain(unsigned int size, sf::Color color = sf::Color::Red)
+{
+    return sf::MipChain::create(sf::Image::create({size, size}, color).value()).value();
+}
+
+// Bytes used by levels `level` to the end of a square chain
+[[nodiscard]] std::size_t chainBytes(unsigned int size, unsigned int level)
+{
+    return makeChain(size).getByteCount(level);
+}
+} // namespace
+
+TEST_CASE("[Graphics] sf::TextureStreamer" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TextureStreamer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextureStreamer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TextureStreamer));
+    }
+
+    SECTION("add()")
+    {
+        sf::TextureStreamer streamer(graphicsContext, 1024u * 1024u);
+
+        const sf::TextureStreamer::Id id = streamer.add(makeChain(256u)).value();
+
+        CHECK(streamer.getTextureCount() == 1u);
+        CHECK(streamer.getTexture(id).getSize() == sf::Vector2u{256u, 256u});
+        CHECK(streamer.getMipChain(id).getLevelCount() == 9u);
+
+        // Only the 1x1 level is resident
+        const sf::TextureStreamer::Residency residency = streamer.getResidency(id);
+        CHECK(residency.residentLevel == 8u);
+        CHECK(residency.desiredLevel == 8u);
+        CHECK(residency.levelCount == 9u);
+        CHECK(residency.byteCount == 4u);
+        CHECK(streamer.getResidentByteCount() == 4u);
+    }
+
+    SECTION("Progressive refinement")
+    {
+        sf::TextureStreamer streamer(graphicsContext, 1024u * 1024u);
+
+        const sf::TextureStreamer::Id id = streamer.add(makeChain(256u, sf::Color::Green)).value();
+
+        for (unsigned int expectedLevel = 7u; expectedLevel >= 2u; --expectedLevel)
+        {
+            streamer.request(id, {64.f, 64.f});
+            streamer.update();
+
+            CHECK(streamer.getResidency(id).residentLevel == expectedLevel);
+            CHECK(streamer.getResidency(id).desiredLevel == 2u);
+        }
+
+        // No further refinement once the desired level is resident
+        streamer.request(id, {64.f, 64.f});
+        streamer.update();
+        CHECK(streamer.getResidency(id).residentLevel == 2u);
+        CHECK(streamer.getResidentByteCount() == chainBytes(256u, 2u));
+
+        // Displaying the texture smaller does not evict anything while there is room
+        streamer.request(id, {16.f, 16.f});
+        streamer.update();
+        CHECK(streamer.getResidency(id).residentLevel == 2u);
+        CHECK(streamer.getResidency(id).desiredLevel == 4u);
+    }
+
+    SECTION("Upload budget")
+    {
+        sf::TextureStreamer streamer(graphicsContext, 1024u * 1024u, /* uploadBudget */ 64u);
+
+        const sf::TextureStreamer::Id a = streamer.add(makeChain(256u)).value();
+        const sf::TextureStreamer::Id b = streamer.add(makeChain(256u)).value();
+
+        streamer.request(a, {256.f, 256.f});
+        streamer.request(b, {256.f, 256.f});
+
+        // 2x2 levels are 16 bytes, both fit
+        streamer.update();
+        CHECK(streamer.getResidency(a).residentLevel == 7u);
+        CHECK(streamer.getResidency(b).residentLevel == 7u);
+
+        streamer.request(a, {256.f, 256.f});
+        streamer.request(b, {256.f, 256.f});
+
+        // 4x4 levels are 64 bytes, only one fits
+        streamer.update();
+        CHECK(streamer.getResidency(a).residentLevel + streamer.getResidency(b).residentLevel == 13u);
+    }
+
+    SECTION("Memory budget")
+    {
+        const std::size_t budget = chainBytes(256u, 1u) + chainBytes(256u, 8u);
+
+        sf::TextureStreamer streamer(graphicsContext, budget, /* uploadBudget */ 0u);
+
+        const sf::TextureStreamer::Id visible = streamer.add(makeChain(256u)).value();
+        const sf::TextureStreamer::Id hidden  = streamer.add(makeChain(256u)).value();
+
+        // Fully refine the first texture while the second one is hidden
+        for (int i = 0; i < 8; ++i)
+        {
+            streamer.request(visible, {256.f, 256.f});
+            streamer.update();
+        }
+
+        // Level 0 does not fit next to the other texture's smallest level
+        CHECK(streamer.getResidency(visible).residentLevel == 1u);
+        CHECK(streamer.getResidency(hidden).residentLevel == 8u);
+        CHECK(streamer.getResidentByteCount() <= budget);
+
+        // Swap roles: the hidden texture takes over the memory of the other one
+        for (int i = 0; i < 8; ++i)
+        {
+            streamer.request(hidden, {256.f, 256.f});
+            streamer.update();
+        }
+
+        CHECK(streamer.getResidency(hidden).residentLevel == 1u);
+        CHECK(streamer.getResidency(visible).residentLevel == 8u);
+        CHECK(streamer.getResidentByteCount() <= budget);
+
+        SECTION("Shrinking the budget evicts needed levels")
+        {
+            streamer.setMemoryBudget(chainBytes(256u, 4u) + chainBytes(256u, 8u));
+
+            streamer.request(hidden, {256.f, 256.f});
+            streamer.update();
+
+            CHECK(streamer.getResidency(hidden).residentLevel == 4u);
+            CHECK(streamer.getResidentByteCount() == streamer.getMemoryBudget());
+        }
+    }
+
+    SECTION("remove()")
+    {
+        sf::TextureStreamer streamer(graphicsContext, 1024u * 1024u);
+
+        const sf::TextureStreamer::Id a = streamer.add(makeChain(16u)).value();
+        const sf::TextureStreamer::Id b = streamer.add(makeChain(32u)).value();
+
+        streamer.remove(a);
+        CHECK(streamer.getTextureCount() == 1u);
+        CHECK(streamer.getResidentByteCount() == 4u);
+
+        // Identifiers are reused
+        const sf::TextureStreamer::Id c = streamer.add(makeChain(64u)).value();
+        CHECK(c == a);
+        CHECK(streamer.getTexture(c).getSize() == sf::Vector2u{64u, 64u});
+        CHECK(streamer.getTexture(b).getSize() == sf::Vector2u{32u, 32u});
+    }
+}
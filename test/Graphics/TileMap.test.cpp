@@ -0,0 +1,124 @@
+#include "SFML/Graphics/TileMap.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/View.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+
+#include <vector>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::TileMap" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    // 8x8 pixels tiles, 16x16 tiles chunks: each chunk covers 128x128 pixels
+    const sf::TileMap::Settings settings{.mapSize{100u, 70u}, .tileSize{8u, 8u}, .tilesetColumns = 2u, .chunkSize = 16u};
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TileMap));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TileMap));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TileMap));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TileMap));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::TileMap));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::TileMap tileMap(graphicsContext, settings);
+        CHECK(tileMap.getMapSize() == sf::Vector2u{100u, 70u});
+        CHECK(tileMap.getTileSize() == sf::Vector2u{8u, 8u});
+        CHECK(tileMap.getChunkCount() == sf::Vector2u{7u, 5u});
+        CHECK(tileMap.getDrawnChunkCount() == 0u);
+        CHECK(tileMap.getTile({0u, 0u}) == sf::TileMap::emptyTile);
+        CHECK(tileMap.getTile({99u, 69u}) == sf::TileMap::emptyTile);
+        CHECK(tileMap.getLocalBounds() == sf::FloatRect({0.f, 0.f}, {800.f, 560.f}));
+    }
+
+    SECTION("Set/get tiles")
+    {
+        sf::TileMap tileMap(graphicsContext, settings);
+
+        tileMap.setTile({42u, 17u}, 3u);
+        CHECK(tileMap.getTile({42u, 17u}) == 3u);
+        CHECK(tileMap.getTile({43u, 17u}) == sf::TileMap::emptyTile);
+
+        std::vector<std::uint32_t> tiles(100u * 70u, 1u);
+        tileMap.setTiles(tiles.data());
+        CHECK(tileMap.getTile({42u, 17u}) == 1u);
+        CHECK(tileMap.getTile({99u, 69u}) == 1u);
+    }
+
+    SECTION("Draw")
+    {
+        // Tile 0 is red, tile 1 is green
+        auto image = sf::Image::create({16u, 8u}, sf::Color::Red).value();
+        for (unsigned int y = 0u; y < 8u; ++y)
+            for (unsigned int x = 8u; x < 16u; ++x)
+                image.setPixel({x, y}, sf::Color::Green);
+
+        const auto tileset       = sf::Texture::loadFromImage(graphicsContext, image).value();
+        auto       renderTexture = sf::RenderTexture::create(graphicsContext, {64u, 64u}).value();
+
+        sf::TileMap tileMap(graphicsContext, settings);
+        tileMap.setTile({0u, 0u}, 0u);
+        tileMap.setTile({1u, 0u}, 1u);
+
+        renderTexture.clear();
+        tileMap.draw(renderTexture, tileset, sf::RenderStates::Default);
+        renderTexture.display();
+
+        CHECK(tileMap.getDrawnChunkCount() == 1u);
+
+        auto result = renderTexture.getTexture().copyToImage();
+        CHECK(result.getPixel({4u, 4u}) == sf::Color::Red);
+        CHECK(result.getPixel({12u, 4u}) == sf::Color::Green);
+        CHECK(result.getPixel({20u, 4u}) == sf::Color::Black);
+
+        SECTION("Partial update")
+        {
+            tileMap.setTile({0u, 0u}, 1u);
+            tileMap.setTile({1u, 0u}, sf::TileMap::emptyTile);
+
+            renderTexture.clear();
+            tileMap.draw(renderTexture, tileset, sf::RenderStates::Default);
+            renderTexture.display();
+
+            result = renderTexture.getTexture().copyToImage();
+            CHECK(result.getPixel({4u, 4u}) == sf::Color::Green);
+            CHECK(result.getPixel({12u, 4u}) == sf::Color::Black);
+        }
+
+        SECTION("Culling")
+        {
+            std::vector<std::uint32_t> tiles(100u * 70u, 0u);
+            tileMap.setTiles(tiles.data());
+
+            // Only the first chunk overlaps the default view
+            tileMap.draw(renderTexture, tileset, sf::RenderStates::Default);
+            CHECK(tileMap.getDrawnChunkCount() == 1u);
+
+            // A view centered on a chunk corner overlaps four chunks
+            renderTexture.setView(sf::View({256.f, 128.f}, {64.f, 64.f}));
+            tileMap.draw(renderTexture, tileset, sf::RenderStates::Default);
+            CHECK(tileMap.getDrawnChunkCount() == 4u);
+
+            // A view outside of the map draws nothing
+            renderTexture.setView(sf::View({-500.f, -500.f}, {64.f, 64.f}));
+            tileMap.draw(renderTexture, tileset, sf::RenderStates::Default);
+            CHECK(tileMap.getDrawnChunkCount() == 0u);
+        }
+    }
+}
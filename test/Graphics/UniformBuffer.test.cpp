@@ -0,0 +1,80 @@
+#include "SFML/Graphics/UniformBuffer.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shader.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <WindowUtil.hpp>
+
+#include <cstddef>
+
+TEST_CASE("[Graphics] sf::UniformBuffer" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::UniformBuffer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::UniformBuffer));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::UniformBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::UniformBuffer));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::UniformBuffer));
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::UniformBuffer::create(graphicsContext, 0u).hasValue());
+
+        const auto uniformBuffer = sf::UniformBuffer::create(graphicsContext, 64u, sf::UniformBuffer::Usage::Stream).value();
+        CHECK(uniformBuffer.getByteCount() == 64u);
+        CHECK(uniformBuffer.getUsage() == sf::UniformBuffer::Usage::Stream);
+        CHECK(uniformBuffer.getNativeHandle() != 0u);
+    }
+
+    SECTION("Move semantics")
+    {
+        auto       movedUniformBuffer = sf::UniformBuffer::create(graphicsContext, 16u).value();
+        const auto nativeHandle       = movedUniformBuffer.getNativeHandle();
+
+        const sf::UniformBuffer uniformBuffer = SFML_BASE_MOVE(movedUniformBuffer);
+        CHECK(uniformBuffer.getNativeHandle() == nativeHandle);
+        CHECK(uniformBuffer.getByteCount() == 16u);
+    }
+
+    SECTION("update()")
+    {
+        auto uniformBuffer = sf::UniformBuffer::create(graphicsContext, 32u).value();
+
+        const float values[4]{1.f, 2.f, 3.f, 4.f};
+        CHECK(uniformBuffer.update(values, sizeof(values)));
+        CHECK(uniformBuffer.update(values, sizeof(values), 16u));
+        CHECK(!uniformBuffer.update(values, sizeof(values), 17u));
+        CHECK(!uniformBuffer.update(values, sizeof(values), 64u));
+    }
+
+    SECTION("bindRange()")
+    {
+        const std::size_t alignment = sf::UniformBuffer::getOffsetAlignment(graphicsContext);
+        REQUIRE(alignment > 0u);
+
+        const auto uniformBuffer = sf::UniformBuffer::create(graphicsContext, alignment * 2u).value();
+
+        CHECK(uniformBuffer.bindRange(1u, 0u, alignment));
+        CHECK(uniformBuffer.bindRange(1u, alignment, alignment));
+        CHECK(!uniformBuffer.bindRange(1u, alignment, alignment + 1u));
+        CHECK(!uniformBuffer.bindRange(1u, 0u, 0u));
+
+        if (alignment > 1u)
+            CHECK(!uniformBuffer.bindRange(1u, 1u, alignment));
+    }
+
+    SECTION("getMaximumBindingPoints()")
+    {
+        CHECK(sf::UniformBuffer::getMaximumBindingPoints(graphicsContext) > sf::Shader::ViewBlockBindingPoint);
+    }
+}
@@ -4,6 +4,8 @@
 
 // Other 1st party headers
 #include "SFML/Graphics/Vertex.hpp"
+#include "SFML/Graphics/VertexCompact.hpp"
+#include "SFML/Graphics/VertexPacked.hpp"
 
 #include "SFML/Base/Traits/IsNothrowSwappable.hpp"
 
@@ -41,6 +43,7 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getNativeHandle() == 0);
             CHECK(vertexBuffer.getPrimitiveType() == sf::PrimitiveType::Points);
             CHECK(vertexBuffer.getUsage() == sf::VertexBuffer::Usage::Stream);
+            CHECK(vertexBuffer.getVertexFormat() == sf::VertexFormat::Standard);
         }
 
         SECTION("Primitive type constructor")
@@ -100,6 +103,11 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
         sf::VertexBuffer vertexBuffer(graphicsContext);
         CHECK(vertexBuffer.create(100));
         CHECK(vertexBuffer.getVertexCount() == 100);
+        CHECK(vertexBuffer.getVertexFormat() == sf::VertexFormat::Standard);
+
+        CHECK(vertexBuffer.create(50, sf::VertexFormat::Packed));
+        CHECK(vertexBuffer.getVertexCount() == 50);
+        CHECK(vertexBuffer.getVertexFormat() == sf::VertexFormat::Packed);
     }
 
     SECTION("update()")
@@ -139,6 +147,25 @@ TEST_CASE("[Graphics] sf::VertexBuffer", "[.display]")
             CHECK(vertexBuffer.getVertexCount() == 128);
         }
 
+        SECTION("Compact and packed vertices")
+        {
+            sf::VertexCompact compactVertices[128]{};
+            sf::VertexPacked  packedVertices[128]{};
+
+            CHECK(vertexBuffer.create(128, sf::VertexFormat::Compact));
+            CHECK(vertexBuffer.update(compactVertices, 128, 0));
+            CHECK(vertexBuffer.getVertexCount() == 128);
+
+            SECTION("Mismatched format")
+            {
+                CHECK(!vertexBuffer.update(vertices, 128, 0));
+                CHECK(!vertexBuffer.update(packedVertices, 128, 0));
+            }
+
+            CHECK(vertexBuffer.create(128, sf::VertexFormat::Packed));
+            CHECK(vertexBuffer.update(packedVertices, 128, 0));
+        }
+
         SECTION("Another buffer")
         {
             sf::VertexBuffer otherVertexBuffer(graphicsContext);
@@ -0,0 +1,40 @@
+#include "SFML/Graphics/VertexCompact.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::VertexCompact")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::VertexCompact));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::VertexCompact));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::VertexCompact));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::VertexCompact));
+        STATIC_CHECK(SFML_BASE_IS_AGGREGATE(sf::VertexCompact));
+        STATIC_CHECK(sizeof(sf::VertexCompact) == 16);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Aggregate initialization -- Nothing")
+        {
+            constexpr sf::VertexCompact vertex;
+            STATIC_CHECK(vertex.position == sf::Vector2f(0.0f, 0.0f));
+            STATIC_CHECK(vertex.color == sf::Color(255, 255, 255));
+            STATIC_CHECK(vertex.texCoords == sf::Vector2<std::uint16_t>(0, 0));
+        }
+
+        SECTION("Aggregate initialization -- Position, color, and coords")
+        {
+            constexpr sf::VertexCompact vertex{{1.5f, 2.5f}, {3, 4, 5, 6}, {7, 8}};
+            STATIC_CHECK(vertex.position == sf::Vector2f(1.5f, 2.5f));
+            STATIC_CHECK(vertex.color == sf::Color(3, 4, 5, 6));
+            STATIC_CHECK(vertex.texCoords == sf::Vector2<std::uint16_t>(7, 8));
+        }
+    }
+}
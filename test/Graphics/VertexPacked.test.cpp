@@ -0,0 +1,40 @@
+#include "SFML/Graphics/VertexPacked.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <cstdint>
+
+TEST_CASE("[Graphics] sf::VertexPacked")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::VertexPacked));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::VertexPacked));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::VertexPacked));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::VertexPacked));
+        STATIC_CHECK(SFML_BASE_IS_AGGREGATE(sf::VertexPacked));
+        STATIC_CHECK(sizeof(sf::VertexPacked) == 12);
+    }
+
+    SECTION("Construction")
+    {
+        SECTION("Aggregate initialization -- Nothing")
+        {
+            constexpr sf::VertexPacked vertex;
+            STATIC_CHECK(vertex.position == sf::Vector2<std::int16_t>(0, 0));
+            STATIC_CHECK(vertex.color == sf::Color(255, 255, 255));
+            STATIC_CHECK(vertex.texCoords == sf::Vector2<std::uint16_t>(0, 0));
+        }
+
+        SECTION("Aggregate initialization -- Position, color, and coords")
+        {
+            constexpr sf::VertexPacked vertex{{1, -2}, {3, 4, 5, 6}, {7, 8}};
+            STATIC_CHECK(vertex.position == sf::Vector2<std::int16_t>(1, -2));
+            STATIC_CHECK(vertex.color == sf::Color(3, 4, 5, 6));
+            STATIC_CHECK(vertex.texCoords == sf::Vector2<std::uint16_t>(7, 8));
+        }
+    }
+}
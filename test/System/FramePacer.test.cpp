@@ -0,0 +1,67 @@
+#include "SFML/System/FramePacer.hpp"
+
+// Other 1st party headers
+#include "SFML/System/Time.hpp"
+
+#include <Doctest.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("[System] sf::FramePacer")
+{
+    SECTION("Construction")
+    {
+        const sf::FramePacer framePacer;
+        CHECK(framePacer.getTargetFrameTime() == sf::Time::Zero);
+        CHECK(framePacer.getSpinDuration() == sf::milliseconds(1));
+
+        const sf::FramePacer::Statistics statistics = framePacer.getStatistics();
+        CHECK(statistics.frameCount == 0u);
+        CHECK(statistics.average == sf::Time::Zero);
+    }
+
+    SECTION("Set/get properties")
+    {
+        sf::FramePacer framePacer;
+        framePacer.setTargetFrameTime(sf::milliseconds(16));
+        framePacer.setSpinDuration(sf::microseconds(500));
+        CHECK(framePacer.getTargetFrameTime() == sf::milliseconds(16));
+        CHECK(framePacer.getSpinDuration() == sf::microseconds(500));
+    }
+
+    SECTION("Pacing")
+    {
+        sf::FramePacer framePacer;
+        framePacer.setTargetFrameTime(sf::milliseconds(5));
+
+        // The first call starts the schedule, each following one waits for a whole frame
+        const auto startTime = std::chrono::steady_clock::now();
+        for (int i = 0; i < 11; ++i)
+            framePacer.waitForNextFrame();
+        const auto elapsed = std::chrono::steady_clock::now() - startTime;
+
+        CHECK(elapsed >= 50ms);
+
+        const sf::FramePacer::Statistics statistics = framePacer.getStatistics();
+        CHECK(statistics.frameCount == 10u);
+        CHECK(statistics.minimum <= statistics.average);
+        CHECK(statistics.average <= statistics.percentile99);
+        CHECK(statistics.percentile99 <= statistics.maximum);
+        CHECK(statistics.average >= sf::milliseconds(4));
+
+        framePacer.resetStatistics();
+        CHECK(framePacer.getStatistics().frameCount == 0u);
+    }
+
+    SECTION("Rolling statistics")
+    {
+        sf::FramePacer framePacer;
+
+        for (std::size_t i = 0u; i < sf::FramePacer::sampleCapacity + 10u; ++i)
+            framePacer.waitForNextFrame();
+
+        CHECK(framePacer.getStatistics().frameCount == sf::FramePacer::sampleCapacity);
+    }
+}